@@ -5,7 +5,11 @@
 
 var NODEJS = 0;
 
+// `node make native` builds the linux tools (wwm_bench, wwm_convert, wwm_mkbank) instead
+var NATIVE = process.argv.indexOf('native') > -1;
+
 var EMCC = '/usr/lib/emsdk_portable/emscripten/master/emcc';
+var CC = process.env.CC || 'cc';
 
 var OPTIMIZE_FLAGS = ' -O2 ';
 
@@ -13,9 +17,9 @@ var sources = [
     'wm_error.c',
     'file_io.c',
     'lock.c',
-    'wildmidi_lib.c',
-    'reverb.c',
-    'gus_pat.c',
+    // 'wildmidi_lib.c', // built through src/wwm_synth.c
+    // 'reverb.c', // replaced by src/wwm_reverb.c
+    // 'gus_pat.c', // built through src/wwm_gus_pat.c
     'internal_midi.c',
     'patches.c',
     'f_xmidi.c',
@@ -33,7 +37,33 @@ var sources = [
 	return 'wildmidi/src/' + include;
 });
 
+// gus_pat.c with the pre-decoded patch bank in front
+sources.push('src/wwm_gus_pat.c');
+// block reverb tiers behind the library's reverb api
+sources.push('src/wwm_reverb.c');
+// wildmidi_lib.c with its output loop on the voice kernels of wwm_pcm.c
+sources.push('src/wwm_synth.c');
+
+// the library's own sources, their malloc goes to the song's arena (src/wwm_alloc.h)
+var hooked_sources = sources.slice();
+
+sources.push('src/wwm_patbank.c');
+sources.push('src/wwm_arena.c');
+sources.push('src/wwm_pcm.c');
+
+// library only, for the native tools
+var lib_sources = sources.slice();
+
 sources.push('src/wildwebmidi.c');
+sources.push('src/wwm.c');
+sources.push('src/wwm_scan.c');
+sources.push('src/wwm_export.c');
+sources.push('src/wwm_wav.c');
+sources.push('src/wwm_flac.c');
+sources.push('src/wwm_adpcm.c');
+sources.push('src/wwm_seek.c');
+sources.push('src/wwm_mixer.c');
+sources.push('src/wwm_live.c');
 
 console.log('sources: ' + sources);
 
@@ -41,6 +71,17 @@ var DEFINES = '';
 
 var FLAGS = OPTIMIZE_FLAGS;
 
+// only package the config, the worker fetches the patches songs use (patch_loader.js)
+var LAZY_PATCHES = 1;
+
+// build freepats-<rate>.bank with wwm_mkbank first, the worker then loads patches
+// pre-decoded from it instead of fetching and decoding .pat files
+var PATCH_BANK = 0;
+
+// wasm simd128 kernels (src/wwm_pcm.c), needs the upstream wasm backend. wasm
+// cannot detect cpu features at runtime, browsers without simd need a build without
+var SIMD = 0;
+
 var MEM = 64 * 1024 * 1024; // 64MB
 FLAGS += ' -s TOTAL_MEMORY=' + MEM + ' ';
 
@@ -50,19 +91,21 @@ if (NODEJS) {
 }
 else {
 	// browser
-	FLAGS += ' --preload-file freepats ';
-	FLAGS += ' --pre-js pre.js --post-js post.js '
+	FLAGS += LAZY_PATCHES ? ' --preload-file freepats/freepats.cfg ' : ' --preload-file freepats ';
+	FLAGS += ' --pre-js pre.js --post-js post.js'
+}
+
+if (SIMD) {
+	FLAGS += ' -msimd128 ';
 }
 
-FLAGS += ' -s EMTERPRETIFY=1 ';
-FLAGS += ' -s EMTERPRETIFY_ASYNC=1 ';
-FLAGS += ' -s EMTERPRETIFY_WHITELIST="[\'_wildwebmidi\']" ';
+// no EMTERPRETIFY: the worker drives wildwebmidi_step, everything runs compiled
+// (the last emterpreted build was 386,822 bytes of js and 40,417 of .js.mem)
 
 /* DEBUG FLAGS */
 // var DEBUG_FLAGS = ' -g '; FLAGS += DEBUG_FLAGS;
 // FLAGS += ' -s ASSERTIONS=2 '
 // FLAGS += ' --profiling-funcs '
-// FLAGS += ' -s EMTERPRETIFY_ADVISE=1 '
 // FLAGS += ' -s ALLOW_MEMORY_GROWTH=1';
 // FLAGS += '  -s DEMANGLE_SUPPORT=1 ';
 
@@ -70,12 +113,117 @@ var INCLUDES = '';
 INCLUDES += '-Isrc ';
 // INCLUDES += '-I/System/Library/Frameworks/OpenAL.framework/Headers ';
 INCLUDES += '-Iwildmidi/include ';
+INCLUDES += '-Iwildmidi/src ';
 
 
+var EXPORTS = [
+	'_wildwebmidi',
+	'_wildwebmidi_start',
+	'_wildwebmidi_start_memory',
+	'_wildwebmidi_step',
+	'_wildwebmidi_set_output_f32',
+	'_wildwebmidi_command',
+	'_wildwebmidi_stats',
+	'_wildwebmidi_telemetry',
+	'_wildwebmidi_queue_memory',
+	'_wildwebmidi_set_crossfade',
+	'_wildwebmidi_set_guard',
+	'_wildwebmidi_configure',
+	'_wildwebmidi_set_reverb',
+	'_wildwebmidi_set_cache',
+	'_wildwebmidi_patch_report',
+	'_wildwebmidi_start_live',
+	'_wildwebmidi_live_event',
+	'_wildwebmidi_live_clock',
+	'_wwm_scan_patches',
+	'_wwm_scan_patches_buffer',
+	'_wwm_patbank_use',
+	'_malloc',
+	'_free',
+
+	// persistent synth api, see src/wwm.h
+	'_wwm_init',
+	'_wwm_open',
+	'_wwm_open_memory',
+	'_wwm_render',
+	'_wwm_render_f32',
+	'_wwm_close',
+	'_wwm_shutdown',
+
+	// several songs into one output, see src/wwm_mixer.h
+	'_wwm_mixer_new',
+	'_wwm_mixer_free',
+	'_wwm_mixer_add',
+	'_wwm_mixer_add_memory',
+	'_wwm_mixer_remove',
+	'_wwm_mixer_set_gain',
+	'_wwm_mixer_set_loop',
+	'_wwm_mixer_playing',
+	'_wwm_mixer_render',
+
+	// segments of a parallel export, see parallel_export.js
+	'_wwm_song_length_memory',
+	'_wwm_segment_open_memory',
+	'_wwm_segment_render',
+	'_wwm_segment_close',
+];
+
+/*
+ * The hooked sources are compiled on their own with wwm_alloc.h forced in,
+ * into dir, and linked as objects with the rest
+ */
+function object(dir, source) {
+	return dir + '/' + source.replace(/^.*\//, '').replace(/\.c$/, '.o');
+}
+
+function compile_hooked(cc, flags, dir) {
+	return 'mkdir -p ' + dir + ' && ' + hooked_sources.map(function(source) {
+		return cc + ' -c ' + INCLUDES + '-include wwm_alloc.h ' + source + flags + ' -o ' + object(dir, source);
+	}).join(' && ');
+}
+
+function linked(list, dir) {
+	return list.map(function(source) {
+		return hooked_sources.indexOf(source) > -1 ? object(dir, source) : source;
+	});
+}
+
+var WASM_OBJECTS = 'build/wasm';
+var NATIVE_OBJECTS = 'build/native';
+
+var compile_lib = compile_hooked(EMCC, OPTIMIZE_FLAGS + (SIMD ? ' -msimd128 ' : '') + DEFINES, WASM_OBJECTS);
+
 var compile_all = EMCC + ' ' + INCLUDES
-	+ sources.join(' ')
+	+ linked(sources, WASM_OBJECTS).join(' ')
 	+ FLAGS + ' ' + DEFINES + ' -o wildwebmidi.js '
-	+ ' -s EXPORTED_FUNCTIONS="[\'_wildwebmidi\']"' ;
+	+ ' -s EXPORTED_FUNCTIONS="[' + EXPORTS.map(function(name) {
+		return '\'' + name + '\'';
+	}).join(', ') + ']"' ;
+
+/* Native build: EM_ASM hooks are provided by the benchmark driver */
+var NATIVE_FLAGS = OPTIMIZE_FLAGS + ' -g -fno-omit-frame-pointer -pthread ';
+
+var compile_native_lib = compile_hooked(CC, NATIVE_FLAGS, NATIVE_OBJECTS);
+
+var compile_native = CC + ' ' + INCLUDES
+	+ linked(sources, NATIVE_OBJECTS).concat('src/wwm_bench.c').join(' ')
+	+ NATIVE_FLAGS + ' -o wwm_bench -lm ';
+
+// wwm_convert renders without the player, so no wildwebmidi.c and host hooks
+var compile_convert = CC + ' ' + INCLUDES
+	+ linked(sources, NATIVE_OBJECTS).filter(function(source) {
+		return source !== 'src/wildwebmidi.c';
+	}).concat('src/wwm_batch.c', 'src/wwm_convert.c').join(' ')
+	+ NATIVE_FLAGS + ' -o wwm_convert -lm ';
+
+var compile_mkbank = CC + ' ' + INCLUDES
+	+ linked(lib_sources, NATIVE_OBJECTS).concat('src/wwm_mkbank.c').join(' ')
+	+ NATIVE_FLAGS + ' -o wwm_mkbank -lm ';
+
+// one bank per common device rate, the worker fetches the one of its rate
+var make_bank = [44100, 48000].map(function(rate) {
+	return './wwm_mkbank -c freepats/freepats.cfg -R ' + rate + ' -o freepats-' + rate + '.bank';
+}).join(' && ');
 
 var
 	exec = require('child_process').exec,
@@ -91,20 +239,45 @@ function onExec(error, stdout, stderr) {
 	}
 }
 
+// what the page downloads, raw and gzip -9, to compare builds by
+function reportSizes() {
+	var fs = require('fs'), zlib = require('zlib');
+
+	['wildwebmidi.js', 'wildwebmidi.wasm', 'wildwebmidi.js.mem', 'wildwebmidi.data'].forEach(function(file) {
+		if (!fs.existsSync(file)) return;
+		var data = fs.readFileSync(file);
+		console.log(file + ': ' + data.length + ' bytes, '
+			+ zlib.gzipSync(data, { level: 9 }).length + ' gzipped');
+	});
+}
+
 function nextJob() {
 	if (!jobs.length) {
 		console.log('jobs done');
 		return;
 	}
 	var cmd = jobs.shift();
+	if (typeof cmd === 'function') {
+		cmd();
+		nextJob();
+		return;
+	}
 	console.log('running ' + cmd);
 	exec(cmd, onExec);
 }
 
 var jobs = [
-	compile_all
+	compile_lib,
+	compile_all,
+	reportSizes
 ];
 
+if (NATIVE) {
+	jobs = [compile_native_lib, compile_native, compile_convert, compile_mkbank];
+} else if (PATCH_BANK) {
+	jobs = [compile_native_lib, compile_mkbank, make_bank, compile_lib, compile_all, reportSizes];
+}
+
 nextJob();
 
 
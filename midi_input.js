@@ -0,0 +1,75 @@
+/*
+ * Live MIDI input (see src/wwm_live.h)
+ *
+ * Web MIDI only exists on the page, so the page queues every channel
+ * message with its time in a MidiRing over a SharedArrayBuffer and the
+ * render worker takes them out before each chunk it renders. Single
+ * producer (the page), single consumer (the worker). Times are absolute
+ * (timeOrigin + timeStamp), the page and the worker have different
+ * performance.now origins.
+ */
+function MidiRing(sab) {
+	this.header = new Int32Array(sab, 0, MidiRing.HEADER);
+	this.messages = new Int32Array(sab, MidiRing.HEADER * 4, MidiRing.SIZE);
+	this.times = new Float64Array(sab, MidiRing.HEADER * 4 + MidiRing.SIZE * 4, MidiRing.SIZE);
+}
+
+MidiRing.SIZE = 256; // a power of two
+MidiRing.READ = 0;
+MidiRing.WRITE = 1;
+MidiRing.HEADER = 2;
+
+MidiRing.create = function() {
+	return new SharedArrayBuffer(MidiRing.HEADER * 4 + MidiRing.SIZE * 12);
+};
+
+// message: status | data1 << 8 | data2 << 16, false when the ring is full
+MidiRing.prototype.push = function(message, time) {
+	var w = Atomics.load(this.header, MidiRing.WRITE);
+	if (((w - Atomics.load(this.header, MidiRing.READ)) | 0) === MidiRing.SIZE) return false;
+
+	this.messages[w & (MidiRing.SIZE - 1)] = message;
+	this.times[w & (MidiRing.SIZE - 1)] = time;
+	Atomics.store(this.header, MidiRing.WRITE, (w + 1) | 0);
+	return true;
+};
+
+// calls fn(message, time) for everything queued
+MidiRing.prototype.drain = function(fn) {
+	var r = Atomics.load(this.header, MidiRing.READ);
+	var w = Atomics.load(this.header, MidiRing.WRITE);
+
+	for (; r !== w; r = (r + 1) | 0) {
+		fn(this.messages[r & (MidiRing.SIZE - 1)], this.times[r & (MidiRing.SIZE - 1)]);
+	}
+	Atomics.store(this.header, MidiRing.READ, r);
+};
+
+/*
+ * Page side: resolves with a ring every MIDI input (also ones plugged in
+ * later) plays into, rejects without Web MIDI.
+ */
+function openMidiInput() {
+	if (!navigator.requestMIDIAccess) return Promise.reject(new Error('No Web MIDI in this browser'));
+
+	return navigator.requestMIDIAccess().then(function(access) {
+		var ring = new MidiRing(MidiRing.create());
+		ring.sab = ring.header.buffer;
+
+		var onMessage = function(e) {
+			var d = e.data;
+			// channel messages only, running status is resolved by the browser
+			if (d.length < 2 || d[0] >= 0xF0) return;
+			ring.push(d[0] | d[1] << 8 | (d.length > 2 ? d[2] : 0) << 16, performance.timeOrigin + e.timeStamp);
+		};
+		var listen = function() {
+			access.inputs.forEach(function(input) {
+				input.onmidimessage = onMessage;
+			});
+		};
+
+		listen();
+		access.onstatechange = listen;
+		return ring;
+	});
+}
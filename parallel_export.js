@@ -0,0 +1,151 @@
+/*
+ * Parallel WAV export
+ *
+ * The browser side of src/wwm_export.c: a song is cut into time segments,
+ * every segment renders in its own render worker (wwm_worker.js, through
+ * wwm_segment_open_memory), comes back a chunk at a time and the pieces are
+ * crossfaded back together here.
+ * See src/wwm_export.h for how close this gets to a serial render.
+ */
+function ParallelExport(workers, reverb) {
+	this.count = Math.max(1, Math.min(workers, ParallelExport.MAX_WORKERS));
+	this.reverb = reverb || 0; // WWM_REVERB_* of src/wwm_reverb.h
+}
+
+ParallelExport.RATE = 44100; // WWM_DEFAULT_RATE
+ParallelExport.XFADE = 1024; // WWM_EXPORT_XFADE
+ParallelExport.MAX_WORKERS = 64; // WWM_EXPORT_MAX_THREADS
+
+// same as wwm_export_split
+ParallelExport.split = function(frames, workers) {
+	var count = Math.min(workers, ParallelExport.MAX_WORKERS);
+	while (count > 1 && frames / count < ParallelExport.RATE) count--;
+	count = Math.max(count, 1);
+	return { count: count, length: Math.ceil(frames / count) };
+};
+
+// same as wwm_crossfade, head is mixed into tail starting at offset (frames)
+ParallelExport.crossfade = function(tail, offset, head, frames) {
+	for (var i = 0; i < frames * 2; i++) {
+		var j = i >> 1;
+		var mixed = tail[offset * 2 + i] * (frames - j) + head[i] * j + (frames >> 1);
+		tail[offset * 2 + i] = Math.floor(mixed / frames);
+	}
+};
+
+ParallelExport.wavHeader = function(frames) {
+	var header = new DataView(new ArrayBuffer(44));
+	var text = function(offset, str) {
+		for (var i = 0; i < 4; i++) header.setUint8(offset + i, str.charCodeAt(i));
+	};
+
+	text(0, 'RIFF');
+	header.setUint32(4, frames * 4 + 36, true);
+	text(8, 'WAVE');
+	text(12, 'fmt ');
+	header.setUint32(16, 16, true);
+	header.setUint16(20, 1, true); // WAVE_FORMAT_PCM
+	header.setUint16(22, 2, true); // channels
+	header.setUint32(24, ParallelExport.RATE, true);
+	header.setUint32(28, ParallelExport.RATE * 4, true);
+	header.setUint16(32, 4, true);
+	header.setUint16(34, 16, true);
+	text(36, 'data');
+	header.setUint32(40, frames * 4, true);
+	return new Uint8Array(header.buffer);
+};
+
+// resolves with a ready render worker
+ParallelExport.prototype.spawn = function(files) {
+	var reverb = this.reverb;
+	return new Promise(function(resolve, reject) {
+		var worker = new Worker('wwm_worker.js');
+		worker.onerror = reject;
+		worker.onmessage = function(e) {
+			if (e.data.type !== 'ready') return;
+			for (var name in files) {
+				worker.postMessage({ type: 'file', name: name, data: files[name] });
+			}
+			worker.postMessage({ type: 'reverb', tier: reverb });
+			resolve(worker);
+		};
+	});
+};
+
+// sends one request and resolves with the reply of the same type, onChunk gets the segment-chunk replies before it
+ParallelExport.request = function(worker, msg, onChunk) {
+	return new Promise(function(resolve, reject) {
+		worker.onmessage = function(e) {
+			if (e.data.type === 'segment-chunk' && onChunk) onChunk(e.data);
+			if (e.data.type !== msg.type) return;
+			if (e.data.status) reject(new Error('Rendering ' + msg.source + ' failed'));
+			else resolve(e.data);
+		};
+		worker.postMessage(msg);
+	});
+};
+
+/*
+ * renders source (a song path as the worker fetches it, files are opened
+ * midis to hand it first, { name: Uint8Array }) and resolves with the wav
+ * as Blob parts
+ */
+ParallelExport.prototype.run = function(source, files, onStatus) {
+	var self = this;
+	var workers = [];
+	var request = ParallelExport.request;
+	var XFADE = ParallelExport.XFADE;
+	onStatus = onStatus || function() {};
+
+	var spawning = [];
+	for (var i = 0; i < this.count; i++) spawning.push(this.spawn(files || {}));
+
+	return Promise.all(spawning).then(function(ready) {
+		workers = ready;
+		return request(workers[0], { type: 'length', source: source });
+	}).then(function(reply) {
+		var total = reply.frames;
+		var split = ParallelExport.split(total, self.count);
+		var pcm = new Int16Array(total * 2);
+		var done = 0;
+
+		onStatus('Rendering ' + split.count + ' segments (0/' + split.count + ')');
+
+		var jobs = [];
+		for (var k = 0; k < split.count; k++) {
+			var start = k * split.length;
+			var head = k ? XFADE : 0;
+			var frames = Math.min(split.length, total - start);
+
+			// the first head frames of a segment are its crossfade, the rest goes straight into pcm
+			var headPcm = new Int16Array(head * 2);
+			var onChunk = function(start, head, headPcm, chunk) {
+				var from = chunk.offset, to = chunk.offset + chunk.pcm.length / 2;
+				if (from < head) headPcm.set(chunk.pcm.subarray(0, (Math.min(to, head) - from) * 2), from * 2);
+				if (to > head) pcm.set(chunk.pcm.subarray(Math.max(head - from, 0) * 2), (start - head + Math.max(from, head)) * 2);
+			}.bind(null, start, head, headPcm);
+
+			jobs.push(request(workers[k], {
+				type: 'segment', source: source, start: start - head, frames: frames + head
+			}, onChunk).then(function(start, headPcm) {
+				onStatus('Rendering ' + split.count + ' segments (' + (++done) + '/' + split.count + ')');
+				return { start: start, head: headPcm };
+			}.bind(null, start, headPcm)));
+		}
+
+		return Promise.all(jobs).then(function(segments) {
+			segments.forEach(function(segment, k) {
+				if (k) ParallelExport.crossfade(pcm, segment.start - XFADE, segment.head, XFADE);
+			});
+
+			// Blob parts, the samples are not copied behind the header
+			return [ParallelExport.wavHeader(total), pcm.buffer];
+		});
+	}).then(function(parts) {
+		workers.forEach(function(worker) { worker.terminate(); });
+		return parts;
+	}, function(error) {
+		workers.forEach(function(worker) { worker.terminate(); });
+		throw error;
+	});
+};
@@ -0,0 +1,132 @@
+/*
+ * On-demand patch loading
+ *
+ * Instead of preloading the whole freepats bank, only the .pat files a song
+ * plays are fetched (see wwm_scan_patches) and written into MEMFS before the
+ * song is opened. Downloaded patches are kept in IndexedDB for next time.
+ *
+ * Runs in the render worker, next to the emscripten FS.
+ */
+function PatchLoader(configPath, baseUrl) {
+	this.dir = configPath.substring(0, configPath.lastIndexOf('/') + 1); // MEMFS
+	this.baseUrl = baseUrl; // where the patch files are served from
+	this.programs = []; // bank 0, program -> file
+	this.drums = []; // drumset 0, note -> file
+	this.dbPromise = null;
+
+	this.parseConfig(FS.readFile(configPath, { encoding: 'utf8' }));
+}
+
+PatchLoader.DB_NAME = 'wildwebmidi-patches';
+PatchLoader.STORE = 'patches';
+PatchLoader.DRUMS = 128; // offset of drum notes in the scan result
+
+// reads the bank 0 / drumset 0 mappings of a timidity style config
+PatchLoader.prototype.parseConfig = function(text) {
+	var target = null;
+
+	text.split('\n').forEach(function(line) {
+		var words = line.replace(/#.*/, '').trim().split(/\s+/);
+		if (!words[0]) return;
+
+		if (words[0] === 'bank') {
+			target = words[1] === '0' ? this.programs : null;
+		} else if (words[0] === 'drumset') {
+			target = words[1] === '0' ? this.drums : null;
+		} else if (target && /^\d+$/.test(words[0]) && words[1]) {
+			var file = words[1];
+			if (!/\.pat$/i.test(file)) file += '.pat'; // as libWildMidi does
+			target[parseInt(words[0])] = file;
+		}
+	}, this);
+};
+
+// returns the patch files for a scan result, or all of them when there is none
+PatchLoader.prototype.filesFor = function(used) {
+	var files = {};
+	var add = function(file) { if (file) files[file] = true; };
+
+	for (var i = 0; i < 128; i++) {
+		if (!used || used[i]) add(this.programs[i]);
+		if (!used || used[PatchLoader.DRUMS + i]) add(this.drums[i]);
+	}
+	return Object.keys(files);
+};
+
+/*
+ * resolves once every file is in MEMFS, with how many were there already,
+ * came from IndexedDB and were downloaded ({ loaded, cached, fetched })
+ */
+PatchLoader.prototype.load = function(files) {
+	return Promise.all(files.map(this.loadFile, this)).then(function(sources) {
+		var counts = { loaded: 0, cached: 0, fetched: 0 };
+		sources.forEach(function(source) { counts[source]++; });
+		return counts;
+	});
+};
+
+// resolves with where the file came from: 'loaded', 'cached' or 'fetched'
+PatchLoader.prototype.loadFile = function(file) {
+	var path = this.dir + file;
+	if (FS.analyzePath(path).exists) return Promise.resolve('loaded');
+
+	var self = this;
+	var source = 'cached';
+	return this.cacheGet(file).then(function(data) {
+		if (data) return data;
+
+		source = 'fetched';
+		return fetch(self.baseUrl + file).then(function(response) {
+			if (!response.ok) throw new Error('Cannot fetch patch ' + file);
+			return response.arrayBuffer();
+		}).then(function(buffer) {
+			var data = new Uint8Array(buffer);
+			self.cachePut(file, data);
+			return data;
+		});
+	}).then(function(data) {
+		FS.mkdirTree(path.substring(0, path.lastIndexOf('/')));
+		FS.writeFile(path, data, { encoding: 'binary' });
+		return source;
+	});
+};
+
+/*
+ * IndexedDB cache, failures just mean downloading again
+ */
+
+PatchLoader.prototype.openCache = function() {
+	if (!this.dbPromise) {
+		this.dbPromise = new Promise(function(resolve) {
+			if (typeof indexedDB === 'undefined') return resolve(null);
+
+			var request = indexedDB.open(PatchLoader.DB_NAME, 1);
+			request.onupgradeneeded = function() {
+				request.result.createObjectStore(PatchLoader.STORE);
+			};
+			request.onsuccess = function() { resolve(request.result); };
+			request.onerror = function() { resolve(null); };
+		});
+	}
+	return this.dbPromise;
+};
+
+PatchLoader.prototype.cacheGet = function(file) {
+	return this.openCache().then(function(db) {
+		if (!db) return null;
+
+		return new Promise(function(resolve) {
+			var request = db.transaction(PatchLoader.STORE, 'readonly')
+				.objectStore(PatchLoader.STORE).get(file);
+			request.onsuccess = function() { resolve(request.result || null); };
+			request.onerror = function() { resolve(null); };
+		});
+	});
+};
+
+PatchLoader.prototype.cachePut = function(file, data) {
+	this.openCache().then(function(db) {
+		if (db) db.transaction(PatchLoader.STORE, 'readwrite')
+			.objectStore(PatchLoader.STORE).put(data, file);
+	});
+};
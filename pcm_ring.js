@@ -0,0 +1,131 @@
+/*
+ * Lock-free PCM ring buffer over a SharedArrayBuffer
+ *
+ * Single producer (the render worker) and single consumer (the audio worklet).
+ * Frames are planar float32 stereo, so both sides copy whole runs with
+ * TypedArray.set. Read and write positions are free running int32 frame
+ * counters, the capacity is a power of two so they may wrap around.
+ */
+function PcmRing(sab) {
+	this.sab = sab;
+	this.header = new Int32Array(sab, 0, PcmRing.HEADER);
+	this.capacity = (sab.byteLength - PcmRing.HEADER * 4) / (PcmRing.CHANNELS * 4);
+	this.mask = this.capacity - 1;
+	this.left = new Float32Array(sab, PcmRing.HEADER * 4, this.capacity);
+	this.right = new Float32Array(sab, PcmRing.HEADER * 4 + this.capacity * 4, this.capacity);
+}
+
+PcmRing.CHANNELS = 2;
+
+// header slots
+PcmRing.READ = 0;
+PcmRing.WRITE = 1;
+PcmRing.FLUSH = 2; // consumer skips ahead to this position
+PcmRing.DONE = 3; // producer finished the song
+PcmRing.WAIT = 4; // frames of room the producer waits for, 0 when it does not
+PcmRing.UNDERRUNS = 5; // quanta the consumer could not fill, counted up only
+PcmRing.HEADER = 6;
+
+PcmRing.create = function(frames) {
+	return new SharedArrayBuffer(PcmRing.HEADER * 4 + frames * PcmRing.CHANNELS * 4);
+};
+
+// read position, taking pending flushes into account
+PcmRing.prototype.readPosition = function() {
+	var r = Atomics.load(this.header, PcmRing.READ);
+	var f = Atomics.load(this.header, PcmRing.FLUSH);
+	return ((f - r) | 0) > 0 ? f : r;
+};
+
+// returns number of frames that can be read
+PcmRing.prototype.availableRead = function() {
+	return (Atomics.load(this.header, PcmRing.WRITE) - this.readPosition()) | 0;
+};
+
+// returns number of frames that can be written
+PcmRing.prototype.availableWrite = function() {
+	return this.capacity - this.availableRead();
+};
+
+/*
+ * Producer side
+ */
+
+// drops everything queued so far (seek, stop)
+PcmRing.prototype.reset = function() {
+	Atomics.store(this.header, PcmRing.FLUSH, Atomics.load(this.header, PcmRing.WRITE));
+};
+
+// registers a wait for room, false when there is enough already
+PcmRing.prototype.waitForSpace = function(frames) {
+	Atomics.store(this.header, PcmRing.WAIT, frames);
+	if (this.availableWrite() < frames) return true;
+
+	Atomics.store(this.header, PcmRing.WAIT, 0);
+	return false;
+};
+
+PcmRing.prototype.underruns = function() {
+	return Atomics.load(this.header, PcmRing.UNDERRUNS);
+};
+
+PcmRing.prototype.setDone = function(done) {
+	Atomics.store(this.header, PcmRing.DONE, done ? 1 : 0);
+};
+
+// copies planar frames (eg. Module.HEAPF32 views), returns number written
+PcmRing.prototype.write = function(left, right, frames) {
+	var w = Atomics.load(this.header, PcmRing.WRITE);
+	frames = Math.min(frames, this.availableWrite());
+
+	var start = w & this.mask;
+	var first = Math.min(frames, this.capacity - start);
+	this.left.set(left.subarray(0, first), start);
+	this.right.set(right.subarray(0, first), start);
+	if (first < frames) { // wrap around
+		this.left.set(left.subarray(first, frames), 0);
+		this.right.set(right.subarray(first, frames), 0);
+	}
+
+	Atomics.store(this.header, PcmRing.WRITE, (w + frames) | 0);
+	return frames;
+};
+
+/*
+ * Consumer side
+ */
+
+PcmRing.prototype.done = function() {
+	return Atomics.load(this.header, PcmRing.DONE) === 1;
+};
+
+// fills up to left.length frames, returns number of frames read
+PcmRing.prototype.read = function(left, right) {
+	var r = this.readPosition();
+	var frames = Math.min((Atomics.load(this.header, PcmRing.WRITE) - r) | 0, left.length);
+
+	var start = r & this.mask;
+	var first = Math.min(frames, this.capacity - start);
+	left.set(this.left.subarray(start, start + first));
+	right.set(this.right.subarray(start, start + first));
+	if (first < frames) { // wrap around
+		left.set(this.left.subarray(0, frames - first), first);
+		right.set(this.right.subarray(0, frames - first), first);
+	}
+
+	Atomics.store(this.header, PcmRing.READ, (r + frames) | 0);
+	return frames;
+};
+
+PcmRing.prototype.countUnderrun = function() {
+	Atomics.add(this.header, PcmRing.UNDERRUNS, 1);
+};
+
+// true once when the room the producer waits for is there, it is then woken
+PcmRing.prototype.spaceReady = function() {
+	var want = Atomics.load(this.header, PcmRing.WAIT);
+	return want > 0 && this.availableWrite() >= want &&
+		Atomics.compareExchange(this.header, PcmRing.WAIT, want, 0) === want;
+};
+
+if (typeof globalThis !== 'undefined') globalThis.PcmRing = PcmRing;
@@ -1,29 +1,22 @@
-
-
-	// return wildwebmidi;
-
-// })();
-
-// self.wildwebmidi = wildwebmidi; // make accessible to other webworker scripts
-
-
-// Callbacks API
+// Callbacks API (defined by wwm_worker.js, the render worker)
 
 /*
- * - circularBuffer.full()
+ * - circularBuffer.availableWrite() // room in the PcmRing shared with the audio worklet
  *
- * - updateProgress(current, total) // progress
+ * - processAudio(left, right, frames)
  *
- * - processAudio(pointer, size)
+ * - writeOutput(ptr, size, header) // a piece of a converted file, header: it replaces the first
  *
  * - completeConversion(status)
  *
+ * The worker drives rendering with Module._wildwebmidi_start and
+ * Module._wildwebmidi_step, see wildwebmidi.h. Progress is not a callback,
+ * the worker copies Module._wildwebmidi_telemetry() to the page after every
+ * pump (telemetry.js).
  */
 
 /*
- // Signals
+ // Commands
 
- - pauseAudioAfterDrainingBuffer
- - seekSamples
- - signalStop
-*/
\ No newline at end of file
+ - Module._wildwebmidi_command(WWM_CMD_STOP / WWM_CMD_SEEK, samples)
+*/
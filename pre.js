@@ -1,4 +1,2 @@
 // wildwebmidi.js - port of wildmid to JavaScript using emscripten
 // by Joshua Koo http://github.com/zz85 http://twitter.com/blurspline
-
-// var wildwebmidi = (function() {
\ No newline at end of file
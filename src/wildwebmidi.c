@@ -35,6 +35,7 @@
 #if !defined(_WIN32) && !defined(__DJGPP__) /* unix build */
 static int msleep(unsigned long millisec);
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <getopt.h>
 #include <time.h>
@@ -48,11 +49,54 @@ static int msleep(unsigned long millisec);
 
 #include "wildmidi_lib.h"
 #include "filenames.h"
+#include "wildwebmidi.h"
+#include "wwm.h"
+#include "wwm_adpcm.h"
+#include "wwm_export.h"
+#include "wwm_flac.h"
+#include "wwm_live.h"
+#include "wwm_patbank.h"
+#include "wwm_pcm.h"
+#include "wwm_reverb.h"
+#include "wwm_seek.h"
+#include "wwm_synth.h"
+#include "wwm_wav.h"
 
 static void completeConversion(int status);
 
+#ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 
+/*
+ JS bridge, see post.js for the callbacks api
+ */
+static int host_buffer_space(void) {
+    return EM_ASM_INT_V({
+        return circularBuffer.availableWrite();
+    });
+}
+
+
+static void host_process_audio(float *left, float *right, int frames) {
+    EM_ASM_({
+        processAudio($0, $1, $2);
+    }, left, right, frames);
+}
+
+// header: the bytes replace the first part, the header written first
+static void host_write_output(const uint8_t *data, uint32_t size, int header) {
+    EM_ASM_({
+        writeOutput($0, $1, $2);
+    }, data, size, header);
+}
+
+static void host_complete_conversion(int status) {
+    EM_ASM_({
+        completeConversion($0);
+    }, status);
+}
+#endif
+
 
 /*
  ==============================
@@ -65,7 +109,44 @@ static void completeConversion(int status);
  ==============================
  */
 
-static unsigned int rate = 44100; // 32072;
+static unsigned int rate = WWM_DEFAULT_RATE; // 32072;
+
+/* frames per wildwebmidi_step, streaming renders once the consumer has room for them */
+static int chunk_frames = WWM_DEFAULT_CHUNK;
+
+/* see wildwebmidi.h, keep web_audio_player.js PROFILES in step */
+static const struct wwm_profile profiles[] = {
+    { "live", 64, 4 },
+    { "low-latency", 256, 4 },
+    { "balanced", 1024, 8 },
+    { "batch", WWM_MAX_CHUNK, 2 },
+};
+#define PROFILE_COUNT ((int) (sizeof(profiles) / sizeof(profiles[0])))
+
+const struct wwm_profile *wildwebmidi_profile(int i) {
+    return (i >= 0 && i < PROFILE_COUNT) ? &profiles[i] : NULL;
+}
+
+const struct wwm_profile *wildwebmidi_find_profile(const char *name) {
+    int i;
+
+    for (i = 0; i < PROFILE_COUNT; i++) {
+        if (strcmp(profiles[i].name, name) == 0)
+            return &profiles[i];
+    }
+    return (NULL);
+}
+
+int wildwebmidi_configure(unsigned int new_rate, int new_chunk_frames) {
+    if (new_rate < WWM_MIN_RATE || new_rate > WWM_MAX_RATE)
+        return (-1);
+    if (new_chunk_frames < 1 || new_chunk_frames > WWM_MAX_CHUNK)
+        return (-1);
+
+    rate = new_rate;
+    chunk_frames = new_chunk_frames;
+    return (0);
+}
 
 static int (*send_output)(int8_t *output_data, int output_size);
 static void (*close_output)(void);
@@ -77,6 +158,8 @@ static void pause_output_nop(void) {
 }
 static void resume_output_nop(void) {
 }
+static void close_output_nop(void) {
+}
 
 /*
  MIDI Output Functions
@@ -117,58 +200,158 @@ static int write_midi_output(void *output_data, int output_size) {
 }
 
 /*
- Wav Output Functions
+ Encoded output (wav, flac, adpcm wav) goes through one buffer: natively into the file
+ with a few large writes, in the browser to the worker as Blob parts
+ (writeOutput in wwm_worker.js), so no MEMFS file grows with the song and
+ only the buffer is held here. The header is written first and once more
+ when the sizes are known.
  */
+#define SINK_BUFFER (256 * 1024)
 
-static uint32_t wav_size;
+static struct {
+    uint8_t *buffer;
+    uint32_t used;
+} sink;
 
-static int write_wav_output(int8_t *output_data, int output_size);
-static void close_wav_output(void);
+static void sink_close(const uint8_t *header, uint32_t size);
 
-static int open_wav_output(char* wav_file) {
-    uint8_t wav_hdr[] = {
-        0x52, 0x49, 0x46, 0x46, /* "RIFF"  */
-        0x00, 0x00, 0x00, 0x00, /* riffsize: pcm size + 36 (filled when closing.) */
-        0x57, 0x41, 0x56, 0x45, /* "WAVE"  */
-        0x66, 0x6D, 0x74, 0x20, /* "fmt "  */
-        0x10, 0x00, 0x00, 0x00, /* length of this RIFF block: 16  */
-        0x01, 0x00,             /* wave format == 1 (WAVE_FORMAT_PCM)  */
-        0x02, 0x00,             /* channels == 2  */
-        0x00, 0x00, 0x00, 0x00, /* sample rate (filled below)  */
-        0x00, 0x00, 0x00, 0x00, /* bytes_per_sec: rate * channels * format bytes  */
-        0x04, 0x00,             /* block alignment: channels * format bytes == 4  */
-        0x10, 0x00,             /* format bits == 16  */
-        0x64, 0x61, 0x74, 0x61, /* "data"  */
-        0x00, 0x00, 0x00, 0x00  /* datasize: the pcm size (filled when closing.)  */
-    };
+#ifndef __EMSCRIPTEN__
+/* the buffer, then data */
+static int sink_send(const void *data, uint32_t size) {
+    struct iovec iov[2];
+    int count = 0;
+    ssize_t res;
 
-    if (wav_file[0] == '\0')
+    if (sink.used > 0) {
+        iov[count].iov_base = sink.buffer;
+        iov[count++].iov_len = sink.used;
+    }
+    if (size > 0) {
+        iov[count].iov_base = (void *) data;
+        iov[count++].iov_len = size;
+    }
+    sink.used = 0;
+
+    while (count > 0) {
+        res = writev(audio_fd, iov, count);
+        if (res < 0) {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "\nERROR: failed writing output (%s)\r\n", strerror(errno));
+            return (-1);
+        }
+        while (count > 0 && (size_t) res >= iov[0].iov_len) {
+            res -= iov[0].iov_len;
+            iov[0] = iov[1];
+            count--;
+        }
+        if (count > 0) {
+            iov[0].iov_base = (uint8_t *) iov[0].iov_base + res;
+            iov[0].iov_len -= res;
+        }
+    }
+    return (0);
+}
+
+static int sink_header(const uint8_t *header, uint32_t size) {
+    if (sink_send(NULL, 0) < 0)
         return (-1);
+    lseek(audio_fd, 0, SEEK_SET);
+    return sink_send(header, size);
+}
+#else
+static int sink_send(const void *data, uint32_t size) {
+    if (sink.used > 0)
+        host_write_output(sink.buffer, sink.used, 0);
+    if (size > 0)
+        host_write_output(data, size, 0);
+    sink.used = 0;
+    return (0);
+}
+
+static int sink_header(const uint8_t *header, uint32_t size) {
+    sink_send(NULL, 0);
+    host_write_output(header, size, 1);
+    return (0);
+}
+#endif
+
+static int sink_write(const void *data, uint32_t size) {
+    if (sink.used + size > SINK_BUFFER)
+        return sink_send(data, size);
+
+    memcpy(sink.buffer + sink.used, data, size);
+    sink.used += size;
+    return (0);
+}
 
-    audio_fd = open(wav_file, (O_RDWR | O_CREAT | O_TRUNC),
+/* path is where the file goes natively, then header */
+static int sink_open(const char *path, const uint8_t *header, uint32_t size) {
+    sink.buffer = malloc(SINK_BUFFER);
+    sink.used = 0;
+    if (sink.buffer == NULL) {
+        fprintf(stderr, "Not enough memory\r\n");
+        return (-1);
+    }
+
+#ifndef __EMSCRIPTEN__
+    audio_fd = open(path, (O_RDWR | O_CREAT | O_TRUNC),
                                                            (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH));
     if (audio_fd < 0) {
         fprintf(stderr, "Error: unable to open file for writing (%s)\r\n", strerror(errno));
+        free(sink.buffer);
+        sink.buffer = NULL;
         return (-1);
-    } else {
-        uint32_t bytes_per_sec;
-
-        wav_hdr[24] = (rate) & 0xFF;
-        wav_hdr[25] = (rate >> 8) & 0xFF;
-
-        bytes_per_sec = rate * 4;
-        wav_hdr[28] = (bytes_per_sec) & 0xFF;
-        wav_hdr[29] = (bytes_per_sec >> 8) & 0xFF;
-        wav_hdr[30] = (bytes_per_sec >> 16) & 0xFF;
-        wav_hdr[31] = (bytes_per_sec >> 24) & 0xFF;
     }
+#else
+    (void) path;
+#endif
 
-    if (write(audio_fd, &wav_hdr, 44) < 0) {
-        fprintf(stderr, "ERROR: failed writing wav header (%s)\r\n", strerror(errno));
-        close(audio_fd);
-        audio_fd = -1;
+    if (sink_header(header, size) < 0) {
+        fprintf(stderr, "ERROR: failed writing header\r\n");
+        sink_close(NULL, 0);
         return (-1);
     }
+    return (0);
+}
+
+/* flushes, puts the final header (NULL keeps the first) and closes */
+static void sink_close(const uint8_t *header, uint32_t size) {
+    if (sink.buffer == NULL)
+        return;
+
+    if (header != NULL)
+        sink_header(header, size);
+    else
+        sink_send(NULL, 0);
+
+#ifndef __EMSCRIPTEN__
+    close(audio_fd);
+    audio_fd = -1;
+#endif
+    free(sink.buffer);
+    sink.buffer = NULL;
+}
+
+/*
+ Wav Output Functions
+ */
+
+static uint32_t wav_size;
+
+static int write_wav_output(int8_t *output_data, int output_size);
+static void close_wav_output(void);
+
+static int open_wav_output(char* wav_file) {
+    uint8_t wav_hdr[WWM_WAV_HEADER_SIZE];
+
+    if (wav_file[0] == '\0')
+        return (-1);
+
+    /* sizes are filled when closing */
+    wwm_wav_header(wav_hdr, rate, 0);
+    if (sink_open(wav_file, wav_hdr, WWM_WAV_HEADER_SIZE) < 0)
+        return (-1);
 
     wav_size = 0;
     send_output = write_wav_output;
@@ -179,56 +362,144 @@ static int open_wav_output(char* wav_file) {
 }
 
 static int write_wav_output(int8_t *output_data, int output_size) {
-#ifdef WORDS_BIGENDIAN
-/* libWildMidi outputs host-endian, *.wav must have little-endian. */
-    uint16_t *swp = (uint16_t *) output_data;
-    int i = (output_size / 2) - 1;
-    for (; i >= 0; --i) {
-        swp[i] = (swp[i] << 8) | (swp[i] >> 8);
-    }
-#endif
-    if (write(audio_fd, output_data, output_size) < 0) {
-        fprintf(stderr, "\nERROR: failed writing wav (%s)\r\n", strerror(errno));
-        close(audio_fd);
-        audio_fd = -1;
+    wwm_wav_swap((int16_t *) output_data, output_size / 2);
+    if (sink_write(output_data, output_size) < 0)
         return (-1);
-    }
 
     wav_size += output_size;
     return (0);
 }
 
 static void close_wav_output(void) {
-    uint8_t wav_count[4];
-    if (audio_fd < 0)
+    uint8_t wav_hdr[WWM_WAV_HEADER_SIZE];
+    if (sink.buffer == NULL)
         return;
 
     printf("Finishing and closing wav output\r");
-    wav_count[0] = (wav_size) & 0xFF;
-    wav_count[1] = (wav_size >> 8) & 0xFF;
-    wav_count[2] = (wav_size >> 16) & 0xFF;
-    wav_count[3] = (wav_size >> 24) & 0xFF;
-    lseek(audio_fd, 40, SEEK_SET);
-    if (write(audio_fd, &wav_count, 4) < 0) {
-        fprintf(stderr, "\nERROR: failed writing wav (%s)\r\n", strerror(errno));
-        goto end;
-    }
-
-    wav_size += 36;
-    wav_count[0] = (wav_size) & 0xFF;
-    wav_count[1] = (wav_size >> 8) & 0xFF;
-    wav_count[2] = (wav_size >> 16) & 0xFF;
-    wav_count[3] = (wav_size >> 24) & 0xFF;
-    lseek(audio_fd, 4, SEEK_SET);
-    if (write(audio_fd, &wav_count, 4) < 0) {
-        fprintf(stderr, "\nERROR: failed writing wav (%s)\r\n", strerror(errno));
-        goto end;
-    }
-
-end:    printf("\n");
-    if (audio_fd >= 0)
-        close(audio_fd);
-    audio_fd = -1;
+    wwm_wav_header(wav_hdr, rate, wav_size);
+    sink_close(wav_hdr, WWM_WAV_HEADER_SIZE);
+    printf("\n");
+}
+
+/*
+ FLAC Output Functions
+ */
+
+static wwm_flac *flac_encoder;
+
+static int write_flac_output(int8_t *output_data, int output_size);
+static void close_flac_output(void);
+
+static int write_sink(void *ctx, const uint8_t *data, uint32_t size) {
+    (void) ctx;
+    return sink_write(data, size);
+}
+
+static int open_flac_output(char* flac_file) {
+    uint8_t flac_hdr[WWM_FLAC_HEADER_SIZE];
+
+    flac_encoder = wwm_flac_new(rate, write_sink, NULL);
+    if (flac_encoder == NULL) {
+        fprintf(stderr, "Not enough memory\r\n");
+        return (-1);
+    }
+
+    /* length and frame sizes are filled when closing */
+    wwm_flac_header(flac_encoder, flac_hdr);
+    if (sink_open(flac_file, flac_hdr, WWM_FLAC_HEADER_SIZE) < 0) {
+        wwm_flac_free(flac_encoder);
+        flac_encoder = NULL;
+        return (-1);
+    }
+
+    send_output = write_flac_output;
+    close_output = close_flac_output;
+    pause_output = pause_output_nop;
+    resume_output = resume_output_nop;
+    return (0);
+}
+
+static int write_flac_output(int8_t *output_data, int output_size) {
+    if (wwm_flac_write(flac_encoder, (int16_t *) output_data, output_size / 4) < 0)
+        return (-1);
+    return (0);
+}
+
+static void close_flac_output(void) {
+    uint8_t flac_hdr[WWM_FLAC_HEADER_SIZE];
+
+    if (flac_encoder == NULL)
+        return;
+
+    printf("Finishing and closing flac output\r");
+    if (wwm_flac_finish(flac_encoder) == 0) {
+        wwm_flac_header(flac_encoder, flac_hdr);
+        sink_close(flac_hdr, WWM_FLAC_HEADER_SIZE);
+    } else {
+        sink_close(NULL, 0);
+    }
+    printf("\n");
+
+    wwm_flac_free(flac_encoder);
+    flac_encoder = NULL;
+}
+
+/*
+ ADPCM Output Functions
+ */
+
+static wwm_adpcm *adpcm_encoder;
+
+static int write_adpcm_output(int8_t *output_data, int output_size);
+static void close_adpcm_output(void);
+
+static int open_adpcm_output(char* adpcm_file) {
+    uint8_t adpcm_hdr[WWM_ADPCM_HEADER_SIZE];
+
+    adpcm_encoder = wwm_adpcm_new(rate, write_sink, NULL);
+    if (adpcm_encoder == NULL) {
+        fprintf(stderr, "Not enough memory\r\n");
+        return (-1);
+    }
+
+    /* sizes are filled when closing */
+    wwm_adpcm_header(adpcm_encoder, adpcm_hdr);
+    if (sink_open(adpcm_file, adpcm_hdr, WWM_ADPCM_HEADER_SIZE) < 0) {
+        wwm_adpcm_free(adpcm_encoder);
+        adpcm_encoder = NULL;
+        return (-1);
+    }
+
+    send_output = write_adpcm_output;
+    close_output = close_adpcm_output;
+    pause_output = pause_output_nop;
+    resume_output = resume_output_nop;
+    return (0);
+}
+
+static int write_adpcm_output(int8_t *output_data, int output_size) {
+    if (wwm_adpcm_write(adpcm_encoder, (int16_t *) output_data, output_size / 4) < 0)
+        return (-1);
+    return (0);
+}
+
+static void close_adpcm_output(void) {
+    uint8_t adpcm_hdr[WWM_ADPCM_HEADER_SIZE];
+
+    if (adpcm_encoder == NULL)
+        return;
+
+    printf("Finishing and closing adpcm output\r");
+    if (wwm_adpcm_finish(adpcm_encoder) == 0) {
+        wwm_adpcm_header(adpcm_encoder, adpcm_hdr);
+        sink_close(adpcm_hdr, WWM_ADPCM_HEADER_SIZE);
+    } else {
+        sink_close(NULL, 0);
+    }
+    printf("\n");
+
+    wwm_adpcm_free(adpcm_encoder);
+    adpcm_encoder = NULL;
 }
 
 #if defined AUDIODRV_OPENAL
@@ -374,270 +645,793 @@ static void do_version(void) {
     printf("WildMIDI homepage is at %s\n\n", PACKAGE_URL);
 }
 
-static char *config_file;
+/*
+ Command queue: stop and seek are queued by the host and picked up once
+ per rendered chunk (in the browser the worker queues them while
+ wildwebmidi() waits for the audio worklet).
+ */
+#define COMMAND_SLOTS 16
+
+static struct {
+    int cmd;
+    uint32_t arg;
+} commands[COMMAND_SLOTS];
+static unsigned int command_head;
+static unsigned int command_tail;
+
+void wildwebmidi_command(int cmd, uint32_t arg) {
+    if (command_tail - command_head == COMMAND_SLOTS) {
+        if (cmd != WWM_CMD_STOP)
+            return; /* a stop always gets in, it ends the song anyway */
+        command_head++;
+    }
+    commands[command_tail % COMMAND_SLOTS].cmd = cmd;
+    commands[command_tail % COMMAND_SLOTS].arg = arg;
+    command_tail++;
+}
+
+static int next_command(int *cmd, uint32_t *arg) {
+    if (command_head == command_tail)
+        return (0);
+    *cmd = commands[command_head % COMMAND_SLOTS].cmd;
+    *arg = commands[command_head % COMMAND_SLOTS].arg;
+    command_head++;
+    return (1);
+}
+
+/* keeps the queued seeks, eg. a click on the seek bar before playing */
+static void drop_stop_commands(void) {
+    unsigned int i, kept = command_head;
 
+    for (i = command_head; i != command_tail; i++) {
+        if (commands[i % COMMAND_SLOTS].cmd != WWM_CMD_STOP)
+            commands[kept++ % COMMAND_SLOTS] = commands[i % COMMAND_SLOTS];
+    }
+    command_tail = kept;
+}
+
+static char *config_file = "/freepats/freepats.cfg";
+
+void wildwebmidi_set_config(char *cfg) {
+    config_file = cfg;
+}
+
+/*
+ Streaming output: planar float32 for web audio
+ */
+static float *output_left;
+static float *output_right;
+static int output_frames;
+
+void wildwebmidi_set_output_f32(float *left, float *right, int frames) {
+    output_left = left;
+    output_right = right;
+    output_frames = frames;
+}
 
 static int send_output_to_js(int8_t *output_data, int output_size) {
-    EM_ASM_({
-        processAudio($0, $1);
-    }, output_data, output_size);
-    return 0;
+    int16_t *frame_data = (int16_t *) output_data;
+    int frames = output_size / 4;
+
+    if (output_left == NULL) {
+        fprintf(stderr, "Error: no output buffers set\r\n");
+        return (-1);
+    }
+
+    while (frames > 0) {
+        int count = (frames > output_frames) ? output_frames : frames;
+        wwm_s16_to_f32(frame_data, output_left, output_right, count);
+        host_process_audio(output_left, output_right, count);
+        frame_data += count * 2;
+        frames -= count;
+    }
+    return (0);
 }
 
 
-int wildwebmidi(char* midi_file, char* wav_file, int sleep) {
+/*
+ Stats and load guard, see wildwebmidi.h
+ */
+static struct wwm_stats stats;
+static int guard;
+
+/* % of a chunk's play time: above, drop a quality step */
+#define GUARD_HIGH 75
+/* below for GUARD_RECOVER chunks in a row, bring one back */
+#define GUARD_LOW 40
+#define GUARD_RECOVER 16
+
+/*
+ A slow chunk lowers the song's voice limit by a quarter of the voices
+ sounding, down to GUARD_MIN_VOICES, and the quietest voices over it are
+ stolen after every chunk. A recovery raises it by half, until it is over
+ the song's peak again and goes away.
+ */
+#define GUARD_MIN_VOICES 16
+
+/*
+ turned off in this order once the voices are down to GUARD_MIN_VOICES,
+ both cost per voice and sample
+ */
+static const uint16_t guard_steps[] = { WM_MO_ENHANCED_RESAMPLING, WM_MO_REVERB };
+#define GUARD_STEPS (sizeof(guard_steps) / sizeof(guard_steps[0]))
+
+struct wwm_stats *wildwebmidi_stats(void) {
+    return &stats;
+}
+
+void wildwebmidi_set_guard(int on) {
+    guard = on;
+}
+
+int wildwebmidi_set_reverb(int tier) {
+    return wwm_reverb_set_tier(tier);
+}
+
+void wildwebmidi_set_cache(int kb) {
+    wwm_synth_set_cache(kb > 0 ? (uint32_t) kb * 1024 : 0);
+}
+
+static void print_patch(void *ctx, const struct wwm_patch_memory *patch) {
+    uint64_t *bytes = ctx;
+
+    printf("%s: %u slots, %u samples, %u bytes (%u unshared)\n", patch->path,
+           patch->slots, patch->samples, patch->bytes, patch->unshared_bytes);
+    bytes[0] += patch->bytes;
+    bytes[1] += patch->unshared_bytes;
+}
+
+void wildwebmidi_patch_report(void) {
+    uint64_t bytes[2] = { 0, 0 };
+    int count = wwm_patch_memory(print_patch, bytes);
+
+    printf("%d patches, %llu bytes (%llu unshared)\n", count,
+           (unsigned long long) bytes[0], (unsigned long long) bytes[1]);
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+/*
+ The song being rendered, advanced one chunk per wildwebmidi_step()
+ */
+static struct {
+    midi *handle;
+    struct _WM_Info *info;
+    wwm_seek_index *seek;
+    wwm_live *live;      /* played from events, handle is its */
+    int output_wav;
+    int active;
+    int fast_chunks; /* in a row, for the guard */
+} song;
+
+/*
+ Gapless playlists: the song queued to follow the streaming one. It is
+ opened NEXT_OPEN_MS (plus the crossfade) before the playing song ends, so
+ it is parsed and its patches are loaded early, and its first AHEAD_CHUNKS
+ chunks are rendered ahead, one per step. The chunk the playing song ends
+ in is filled up with the next one, which starts on the very next sample,
+ or the two are crossfaded over next.fade frames.
+ */
+#define NEXT_OPEN_MS 3000
+#define AHEAD_CHUNKS 4
+
+static struct {
+    char *midi_file;     /* queued, */
+    uint8_t *data;       /* or queued from memory */
+    uint32_t size;
+    midi *handle;        /* once opened */
+    struct _WM_Info *info;
+    wwm_seek_index *seek;
+    uint32_t fade;       /* frames it overlaps the playing song */
+} next;
+
+static uint32_t crossfade_ms;
+
+/* frames rendered ahead of a handle's output, the next song's until it plays */
+static struct {
+    midi *owner;
+    int16_t pcm[WWM_MAX_CHUNK * 2];
+    int pos;
+    int frames;
+} ahead;
+
+static void drop_ahead(midi *handle) {
+    if (ahead.owner != handle)
+        return;
+    ahead.owner = NULL;
+    ahead.pos = 0;
+    ahead.frames = 0;
+}
+
+/* frames of handle, what was rendered ahead of it first. Fewer at its end */
+static int render_frames(midi *handle, int16_t *out, int frames) {
+    int done = 0;
+    int res;
+
+    if (ahead.owner == handle) {
+        done = ahead.frames - ahead.pos;
+        if (done > frames)
+            done = frames;
+        memcpy(out, ahead.pcm + ahead.pos * 2, done * 4);
+        ahead.pos += done;
+        if (ahead.pos == ahead.frames)
+            drop_ahead(handle);
+    }
+    if (done < frames) {
+        res = wwm_render(handle, (int8_t *) (out + done * 2), (frames - done) * 4);
+        if (res > 0)
+            done += res / 4;
+    }
+    return (done);
+}
+
+/* where the song is for the listener, frames rendered ahead are still to come */
+static uint32_t song_position(void) {
+    uint32_t position = wwm_position(song.handle);
+
+    if (ahead.owner == song.handle)
+        position -= ahead.frames - ahead.pos;
+    return (position);
+}
+
+static void seek_song(midi *handle, wwm_seek_index *seek, uint32_t sample) {
+    unsigned long int seek_to_sample = sample;
+
+    drop_ahead(handle);
+    if (seek != NULL)
+        wwm_seek_to(seek, sample);
+    else
+        WildMidi_FastSeek(handle, &seek_to_sample);
+}
+
+// the crossfade, shortened to what is left of the playing song and to the next one
+static uint32_t next_fade(uint32_t remaining) {
+    uint32_t fade = (uint32_t) ((uint64_t) rate * crossfade_ms / 1000);
+
+    if (fade > remaining)
+        fade = remaining;
+    if (fade > next.info->approx_total_samples)
+        fade = next.info->approx_total_samples;
+    return (fade);
+}
+
+static void drop_next(void) {
+    free(next.midi_file);
+    free(next.data);
+    next.midi_file = NULL;
+    next.data = NULL;
+    wwm_seek_free(next.seek);
+    next.seek = NULL;
+    if (next.handle != NULL) {
+        drop_ahead(next.handle);
+        wwm_close(next.handle);
+        next.handle = NULL;
+    }
+}
+
+static int queue_song(char *midi_file, uint8_t *data, uint32_t size) {
+    drop_next();
+
+    // only a song streaming to the host is followed
+    if ((midi_file == NULL && data == NULL) || !song.active || song.output_wav || song.live != NULL) {
+        free(midi_file);
+        free(data);
+        return (-1);
+    }
+    next.midi_file = midi_file;
+    next.data = data;
+    next.size = size;
+    return (0);
+}
+
+int wildwebmidi_queue(char *midi_file) {
+    return queue_song(midi_file != NULL ? strdup(midi_file) : NULL, NULL, 0);
+}
+
+int wildwebmidi_queue_memory(uint8_t *data, uint32_t size) {
+    return queue_song(NULL, data, size);
+}
+
+void wildwebmidi_set_crossfade(int ms) {
+    crossfade_ms = ms < 0 ? 0 : ms > WWM_MAX_CROSSFADE_MS ? WWM_MAX_CROSSFADE_MS : (uint32_t) ms;
+}
+
+static void open_next(uint32_t remaining) {
+    next.handle = next.data != NULL ? wwm_open_memory(next.data, next.size) : wwm_open(next.midi_file);
+    free(next.midi_file);
+    free(next.data);
+    next.midi_file = NULL;
+    next.data = NULL;
+    if (next.handle == NULL) {
+        printf(" Error opening the next midi: %s\r\n", WildMidi_GetError());
+        return;
+    }
+
+    next.info = WildMidi_GetInfo(next.handle);
+    next.seek = wwm_seek_new(next.handle, (uint32_t) ((uint64_t) rate * WWM_SEEK_INTERVAL_MS / 1000));
+    next.fade = next_fade(remaining);
+}
+
+// a chunk more of the next song, while the playing one has nothing ahead
+static void render_ahead(void) {
+    int room = AHEAD_CHUNKS * chunk_frames;
+    int res;
+
+    if (ahead.owner != NULL && ahead.owner != next.handle)
+        return;
+
+    if (room > WWM_MAX_CHUNK)
+        room = WWM_MAX_CHUNK;
+    room -= ahead.frames;
+    if (room > chunk_frames)
+        room = chunk_frames;
+    if (room <= 0)
+        return;
+
+    res = wwm_render(next.handle, (int8_t *) (ahead.pcm + ahead.frames * 2), room * 4);
+    if (res > 0) {
+        ahead.owner = next.handle;
+        ahead.frames += res / 4;
+    }
+    if (next.seek != NULL)
+        wwm_seek_record(next.seek);
+}
+
+/*
+ A chunk the playing song has less than frames + next.fade left of: its
+ last frames, then the next song, mixed where the two overlap. Returns
+ frames rendered, fewer only when the next song is shorter.
+ */
+static int render_transition(int16_t *out, int frames, uint32_t remaining) {
+    static int16_t head[WWM_MAX_CHUNK * 2];
+    int tail = remaining < (uint32_t) frames ? (int) remaining : frames;
+    int start = remaining > next.fade ? (int) (remaining - next.fade) : 0;
+    int overlap = tail - start;
+    int got, count;
+
+    got = render_frames(song.handle, out, tail);
+    memset(out + got * 2, 0, (frames - got) * 4);
+
+    count = render_frames(next.handle, head, frames - start);
+    if (count < overlap)
+        memset(head + count * 2, 0, (overlap - count) * 4);
+
+    if (overlap > 0)
+        wwm_crossfade_part(out + start * 2, head, overlap, next.fade - (remaining - start), next.fade);
+    if (count > overlap) {
+        memcpy(out + tail * 2, head + overlap * 2, (count - overlap) * 4);
+        return (tail + count - overlap);
+    }
+    return (tail);
+}
+
+static struct wwm_telemetry telemetry;
+
+#define TELEMETRY_WORDS (sizeof(struct wwm_telemetry) / sizeof(uint32_t))
+
+const struct wwm_telemetry *wildwebmidi_telemetry(void) {
+    return &telemetry;
+}
+
+// the player is the only writer, so it reads its own copy plainly
+static void publish_telemetry(const struct wwm_telemetry *update) {
+    const uint32_t *src = (const uint32_t *) update;
+    uint32_t *dst = (uint32_t *) &telemetry;
+    uint32_t seq = telemetry.seq;
+    size_t i;
+
+    __atomic_store_n(&telemetry.seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    for (i = 1; i < TELEMETRY_WORDS; i++)
+        __atomic_store_n(&dst[i], src[i], __ATOMIC_RELAXED);
+    __atomic_store_n(&telemetry.seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+void wildwebmidi_telemetry_read(struct wwm_telemetry *copy) {
+    const uint32_t *src = (const uint32_t *) &telemetry;
+    uint32_t *dst = (uint32_t *) copy;
+    uint32_t seq;
+    size_t i;
+
+    do {
+        while ((seq = __atomic_load_n(&telemetry.seq, __ATOMIC_ACQUIRE)) & 1)
+            ;
+        for (i = 1; i < TELEMETRY_WORDS; i++)
+            dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&telemetry.seq, __ATOMIC_RELAXED) != seq);
+    copy->seq = seq;
+}
+
+static void start_telemetry(void) {
+    struct wwm_telemetry update;
+
+    memset(&update, 0, sizeof(update));
+    update.song = telemetry.song + 1;
+    update.playing = 1;
+    if (song.live == NULL) {
+        update.current_sample = song_position();
+        update.total_samples = song.info->approx_total_samples;
+    }
+    publish_telemetry(&update);
+}
+
+static void finish_song(int status) {
+    struct wwm_telemetry update;
+
+    close_output();
+    drop_next();
+    drop_ahead(song.handle);
+    wwm_seek_free(song.seek);
+    song.seek = NULL;
+    if (song.live != NULL)
+        wwm_live_close(song.live);
+    else if (song.handle != NULL)
+        wwm_close(song.handle);
+    song.live = NULL;
+    song.handle = NULL;
+    song.active = 0;
+
+    update = telemetry;
+    update.playing = 0;
+    update.voices = 0;
+    publish_telemetry(&update);
+
+    printf("ok \r\n");
+    completeConversion(status);
+}
+
+// the next song takes over, without a completeConversion in between
+static void play_next(void) {
+    wwm_seek_free(song.seek);
+    wwm_close(song.handle);
+    song.handle = next.handle;
+    song.info = next.info;
+    song.seek = next.seek;
+    next.handle = NULL;
+    next.seek = NULL;
+
+    song.fast_chunks = 0;
+    memset(&stats, 0, sizeof(stats));
+    start_telemetry();
+    printf("\rPlaying the next midi\r\n");
+}
+
+static void use_js_output(void) {
+    send_output = send_output_to_js;
+    close_output = close_output_nop;
+    pause_output = pause_output_nop;
+    resume_output = resume_output_nop;
+}
+
+// the synth stays initialized across songs (see wwm.c), until the rate changes
+static int init_synth(void) {
+    long libraryver;
+
+    if (wwm_initialized() && wwm_rate() != rate)
+        wwm_shutdown();
+
+    if (!wwm_initialized()) {
+        libraryver = WildMidi_GetVersion();
+        printf("Initializing libWildMidi %ld.%ld.%ld\n\n",
+                            (libraryver>>16) & 255,
+                            (libraryver>> 8) & 255,
+                            (libraryver    ) & 255);
+
+        if (wwm_init(config_file, rate, 0) == -1) {
+            printf("Cannot WildMidi_Init");
+            return (-1);
+        }
+    }
+    return (0);
+}
+
+/* data NULL opens midi_file, else the song in memory */
+static int start_song(char *midi_file, const uint8_t *data, uint32_t size, char *wav_file) {
 
     #ifdef NODEJS
     // mount the current folder as a NODEFS instance
     // inside of emscripten
-    EM_ASM(
-        FS.mkdir('/working');
-        FS.mount(NODEFS, { root: '.' }, '/working');
-    );
+    static int mounted;
+    if (!mounted) {
+        EM_ASM(
+            FS.mkdir('/working');
+            FS.mount(NODEFS, { root: '.' }, '/working');
+        );
+        mounted = 1;
+    }
     #endif
 
-    struct _WM_Info *wm_info;
-    int i, res;
-    int option_index = 0;
-    uint16_t mixer_options = 0;
-    void *midi_ptr;
-    uint8_t master_volume = 127;
-    int8_t *output_buffer;
-
     uint32_t apr_mins;
     uint32_t apr_secs;
-    uint32_t count_diff;
-
-    uint8_t test_midi = 0;
-    uint8_t test_count = 0;
-    uint8_t *test_data;
-    uint8_t test_bank = 0;
-    uint8_t test_patch = 0;
-
-    unsigned long int seek_to_sample;
-    int inpause = 0;
-    char * ret_err = NULL;
-    long libraryver;
-    char * lyric = NULL;
-    char *last_lyric = NULL;
-    uint32_t last_lyric_length = 0;
-    int8_t kareoke = 0;
-#define MAX_LYRIC_CHAR 128
-    char lyrics[MAX_LYRIC_CHAR + 1];
-#define MAX_DISPLAY_LYRICS 29
-    char display_lyrics[MAX_DISPLAY_LYRICS + 1];
 
-    memset(lyrics,' ',MAX_LYRIC_CHAR);
-    memset(display_lyrics,' ',MAX_DISPLAY_LYRICS);
+    // do_version();
 
-    config_file = "/freepats/freepats.cfg";
+    if (song.active)
+        finish_song(0);
 
-    // do_version();
+    // a stop left over from the last song must not end this one
+    drop_stop_commands();
 
     printf("Initializing Sound System\n");
-    int output_wav = wav_file[0] != '\0';
-    if (output_wav) {
-        if (open_wav_output(wav_file) == -1) {
+    song.output_wav = wav_file[0] != '\0';
+    if (song.output_wav) {
+        // the file name picks the encoder, *.flac, *.adpcm.wav or else wav
+        if ((wwm_flac_filename(wav_file) ? open_flac_output(wav_file)
+                : wwm_adpcm_filename(wav_file) ? open_adpcm_output(wav_file)
+                : open_wav_output(wav_file)) == -1) {
             printf("Cannot open wave");
             completeConversion(1);
-            return (1);
+            return (-1);
         }
     } /* else if (open_audio_output() == -1) {
         printf("Cannot audio output");
         completeConversion(1);
-        return (1);
+        return (-1);
     }*/ else {
-        send_output = send_output_to_js;
+        use_js_output();
     }
 
-    libraryver = WildMidi_GetVersion();
-    printf("Initializing libWildMidi %ld.%ld.%ld\n\n",
-                        (libraryver>>16) & 255,
-                        (libraryver>> 8) & 255,
-                        (libraryver    ) & 255);
-
-    if (WildMidi_Init(config_file, rate, mixer_options) == -1) {
-        printf("Cannot WildMidi_Init");
+    if (init_synth() == -1) {
+        close_output();
         completeConversion(1);
-        return (1);
+        return (-1);
     }
-    output_buffer = malloc(16384);
-    if (output_buffer == NULL) {
-        fprintf(stderr, "Not enough memory, exiting\n");
-        WildMidi_Shutdown();
-        completeConversion(1);
-        return (1);
+
+    printf("\rProcessing %s ", data ? "midi in memory" : midi_file);
+    song.handle = data ? wwm_open_memory(data, size) : wwm_open(midi_file);
+    if (song.handle == NULL) {
+        printf(" Error opening midi: %s\r\n", WildMidi_GetError());
+        song.active = 1;
+        finish_song(1);
+        return (-1);
     }
+    song.info = WildMidi_GetInfo(song.handle);
+    song.seek = wwm_seek_new(song.handle, (uint32_t) ((uint64_t) rate * WWM_SEEK_INTERVAL_MS / 1000));
+    song.active = 1;
+    song.fast_chunks = 0;
+    memset(&stats, 0, sizeof(stats));
+    start_telemetry();
 
-    WildMidi_MasterVolume(master_volume);
+    // reverb and enhanced resampling are set by wwm_open (WWM_MIXER_OPTIONS)
 
-    // while (optind < argc || test_midi) {
-        WildMidi_ClearError();
-        if (!test_midi) {
-            char *real_file = midi_file;
-            printf("\rProcessing %s ", real_file);
+    apr_mins = song.info->approx_total_samples / (rate * 60);
+    apr_secs = (song.info->approx_total_samples % (rate * 60)) / rate;
+    printf("\r\n[Duration of midi approx %2um %2us Total]\r\n", apr_mins, apr_secs);
+    fprintf(stderr, "\r");
 
+    return (0);
+}
 
-            midi_ptr = WildMidi_Open(real_file);
-            optind++;
-            if (midi_ptr == NULL) {
-                ret_err = WildMidi_GetError();
-                printf(" Error opening midi: %s\r\n",ret_err);
-            }
-        }
-        wm_info = WildMidi_GetInfo(midi_ptr);
-
-        apr_mins = wm_info->approx_total_samples / (rate * 60);
-        apr_secs = (wm_info->approx_total_samples % (rate * 60)) / rate;
-        mixer_options = wm_info->mixer_options;
-
-        // WildMidi_SetOption(midi_ptr, (WM_MO_ENHANCED_RESAMPLING), (WM_MO_ENHANCED_RESAMPLING));
-        // WildMidi_SetOption(midi_ptr, (WM_MO_REVERB), (WM_MO_REVERB));
-        WildMidi_SetOption(midi_ptr, (WM_MO_REVERB | WM_MO_ENHANCED_RESAMPLING), (WM_MO_REVERB | WM_MO_ENHANCED_RESAMPLING));
-
-        printf("\r\n[Duration of midi approx %2um %2us Total]\r\n", apr_mins, apr_secs);
-        fprintf(stderr, "\r");
-
-        memset(lyrics,' ',MAX_LYRIC_CHAR);
-        memset(display_lyrics,' ',MAX_DISPLAY_LYRICS);
-
-        while (1) {
-            // exit loop when samples are finished
-            count_diff = wm_info->approx_total_samples
-                        - wm_info->current_sample;
-
-            if (count_diff == 0)
-                break;
-
-            // check buffers in streaming mode
-            if (!output_wav) {
-                if (EM_ASM_INT_V({
-                    return signalStop;
-                })) {
-                    // stop
-                    goto end2;
-                }
-
-                // support seaking
-                unsigned long int seek = EM_ASM_INT_V({
-                    if (seekSamples < ULONG_MAX) {
-                        var tmp = seekSamples;
-                        seekSamples = ULONG_MAX;
-                        circularBuffer.reset();
-                        return tmp;
-                    }
-                    return ULONG_MAX;
-                });
-
-                if (seek < 4294967295) {
-                    WildMidi_FastSeek(midi_ptr, &seek);
-                }
-
-                int buffer_full = EM_ASM_INT_V({
-                    return circularBuffer.full();
-                });
-
-                if (buffer_full) {
-                    msleep(sleep);
-                    continue;
-                }
-            }
+int wildwebmidi_start(char* midi_file, char* wav_file) {
+    return start_song(midi_file, NULL, 0, wav_file);
+}
+
+int wildwebmidi_start_memory(uint8_t *data, uint32_t size, char *wav_file) {
+    return start_song(NULL, data, size, wav_file);
+}
 
-            if (inpause) {
-                wm_info = WildMidi_GetInfo(midi_ptr);
+int wildwebmidi_start_live(const uint8_t *used) {
+    if (song.active)
+        finish_song(0);
+    drop_stop_commands();
 
-                msleep(5);
-                continue;
-            }
+    song.output_wav = 0;
+    use_js_output();
+    if (init_synth() == -1) {
+        completeConversion(1);
+        return (-1);
+    }
 
-            res = WildMidi_GetOutput(midi_ptr, output_buffer,
-                                     (count_diff >= 4096)? 16384 : (count_diff * 4));
-            if (res <= 0)
-                break;
-
-            wm_info = WildMidi_GetInfo(midi_ptr);
-
-            /*
-            // TODO Support Lyrics
-            lyric = WildMidi_GetLyric(midi_ptr);
-
-            memcpy(lyrics, &lyrics[1], MAX_LYRIC_CHAR - 1);
-            lyrics[MAX_LYRIC_CHAR - 1] = ' ';
-
-            if ((lyric != NULL) && (lyric != last_lyric) && (kareoke)) {
-                last_lyric = lyric;
-                if (last_lyric_length != 0) {
-                    memcpy(lyrics, &lyrics[last_lyric_length], MAX_LYRIC_CHAR - last_lyric_length);
-                }
-                memcpy(&lyrics[MAX_DISPLAY_LYRICS], lyric, strlen(lyric));
-                last_lyric_length = strlen(lyric);
-            } else {
-                if (last_lyric_length != 0) last_lyric_length--;
-            }
+    song.live = wwm_live_open(used);
+    if (song.live == NULL) {
+        printf("Cannot open live input: %s\r\n", WildMidi_GetError());
+        completeConversion(1);
+        return (-1);
+    }
+    song.handle = wwm_live_handle(song.live);
+    song.info = WildMidi_GetInfo(song.handle);
+    song.active = 1;
+    song.fast_chunks = 0;
+    memset(&stats, 0, sizeof(stats));
+    start_telemetry();
+    return (0);
+}
 
-            memcpy(display_lyrics,lyrics,MAX_DISPLAY_LYRICS);
-            display_lyrics[MAX_DISPLAY_LYRICS] = '\0';
-            */
+int wildwebmidi_live_event(uint32_t frame, int status, int data1, int data2) {
+    if (song.live == NULL)
+        return (-1);
+    return wwm_live_push(song.live, frame, (uint8_t) status, (uint8_t) data1, (uint8_t) data2);
+}
 
+uint32_t wildwebmidi_live_clock(void) {
+    return song.live != NULL ? wwm_live_clock(song.live) : 0;
+}
 
-            // Update progress
-            EM_ASM_({
-                updateProgress($0, $1, $2);
-            }, wm_info->current_sample, wm_info->approx_total_samples, wm_info->total_midi_time);
-            // wm_info->mixer_options
+const struct wwm_live_stats *wildwebmidi_live_stats(void) {
+    return song.live != NULL ? wwm_live_stats(song.live) : NULL;
+}
 
+static void update_stats(uint32_t render_us, uint32_t frames) {
+    uint32_t play_us = (uint32_t) (frames * 1000000ULL / rate);
+    uint32_t limit;
+    uint16_t step;
+
+    stats.chunks++;
+    stats.voices = wwm_voices(song.handle);
+    if (stats.voices > stats.peak_voices)
+        stats.peak_voices = stats.voices;
+    stats.render_us = render_us;
+    if (render_us > stats.peak_render_us)
+        stats.peak_render_us = render_us;
+    if (render_us > play_us)
+        stats.late_chunks++;
+
+    // a file has no deadline
+    if (!guard || song.output_wav)
+        return;
 
-            if (send_output(output_buffer, res) < 0) {
-                /* driver prints an error message already. */
-                printf("\r");
-                goto end2;
+    if (render_us * 100 > play_us * GUARD_HIGH) {
+        song.fast_chunks = 0;
+        limit = stats.voices - stats.voices / 4;
+        if (limit < GUARD_MIN_VOICES)
+            limit = GUARD_MIN_VOICES;
+        if (stats.voices > GUARD_MIN_VOICES && (stats.voice_limit == 0 || limit < stats.voice_limit)) {
+            stats.voice_limit = limit;
+        } else if (stats.degraded < GUARD_STEPS) {
+            step = guard_steps[stats.degraded++];
+            WildMidi_SetOption(song.handle, step, 0);
+        }
+    } else if (render_us * 100 < play_us * GUARD_LOW) {
+        if (++song.fast_chunks >= GUARD_RECOVER) {
+            song.fast_chunks = 0;
+            if (stats.degraded > 0) {
+                step = guard_steps[--stats.degraded];
+                WildMidi_SetOption(song.handle, step, WWM_MIXER_OPTIONS & step);
+            } else if (stats.voice_limit != 0) {
+                stats.voice_limit += stats.voice_limit / 2;
+                if (stats.voice_limit > stats.peak_voices)
+                    stats.voice_limit = 0;
             }
+        }
+    } else {
+        song.fast_chunks = 0;
+    }
 
+    if (stats.voice_limit != 0)
+        stats.stolen += wwm_steal_voices(song.handle, stats.voice_limit);
+}
 
-            // this converts to setTimeout and lets browser breath!
-            if (sleep > -1) msleep(sleep);
-
-            // end while
+int wildwebmidi_step(void) {
+    static int16_t output_buffer[WWM_MAX_CHUNK * 2];
+    uint32_t count_diff;
+    struct wwm_telemetry update;
+    uint64_t start_ns;
+    uint32_t render_ns;
+    uint32_t frames;
+    uint32_t arg;
+    int cmd, res;
+    int ending;
+
+    if (!song.active)
+        return (WWM_STEP_DONE);
+
+    // commands are picked up once per chunk
+    while (next_command(&cmd, &arg)) {
+        if (cmd == WWM_CMD_STOP) {
+            finish_song(0);
+            return (WWM_STEP_DONE);
         }
 
-        // NEXT MIDI
-        // fprintf(stderr, "\r\n");
-        if (WildMidi_Close(midi_ptr) == -1) {
-            ret_err = WildMidi_GetError();
-            fprintf(stderr, "OOPS: failed closing midi handle!\r\n%s\r\n",ret_err);
+        // a wav is always rendered from start to end
+        if (cmd == WWM_CMD_SEEK && !song.output_wav && song.live == NULL) {
+            seek_song(song.handle, song.seek, arg);
+
+            // the next song starts over if it had begun fading in
+            if (next.handle != NULL) {
+                if (wwm_position(next.handle) > (uint32_t) (ahead.owner == next.handle ? ahead.frames : 0))
+                    seek_song(next.handle, next.seek, 0);
+                next.fade = next_fade(song.info->approx_total_samples - song_position());
+            }
         }
-        memset(output_buffer, 0, 16384);
-        // send_output(output_buffer, 16384);
-    // }
-    // end1:
-    // memset(output_buffer, 0, 16384);
-    // send_output(output_buffer, 16384);
-    // msleep(5);
-
-    end2:
-    close_output();
-    free(output_buffer);
-    if (WildMidi_Shutdown() == -1) {
-        ret_err = WildMidi_GetError();
-        fprintf(stderr, "OOPS: failure shutting down libWildMidi\r\n%s\r\n", ret_err);
-        WildMidi_ClearError();
     }
 
-    printf("ok \r\n");
-    completeConversion(0);
+    // exit when samples are finished, live input plays until stopped
+    count_diff = song.info->approx_total_samples
+                - song_position();
+    if (song.live == NULL && (next.midi_file != NULL || next.data != NULL)
+            && count_diff <= (uint64_t) rate * (NEXT_OPEN_MS + crossfade_ms) / 1000)
+        open_next(count_diff);
+    if (count_diff == 0 && song.live == NULL && next.handle == NULL) {
+        finish_song(0);
+        return (WWM_STEP_DONE);
+    }
+    ending = song.live == NULL && next.handle != NULL && count_diff < next.fade + (uint32_t) chunk_frames;
+    frames = (song.live != NULL || ending || count_diff >= (uint32_t) chunk_frames) ? (uint32_t) chunk_frames : count_diff;
+
+    // streaming renders what the consumer has room for
+    if (!song.output_wav && host_buffer_space() < (int) frames)
+        return (WWM_STEP_WAIT);
+
+    start_ns = now_ns();
+    if (song.live != NULL) {
+        res = wwm_live_render(song.live, output_buffer, frames);
+    } else if (ending) {
+        res = render_transition(output_buffer, frames, count_diff);
+    } else {
+        res = render_frames(song.handle, output_buffer, frames);
+        if (next.handle != NULL)
+            render_ahead();
+    }
+    if (res <= 0) {
+        finish_song(0);
+        return (WWM_STEP_DONE);
+    }
+    render_ns = (uint32_t) (now_ns() - start_ns);
+    update_stats(render_ns / 1000, res);
+    if (song.seek != NULL)
+        wwm_seek_record(song.seek);
+
+    update = telemetry;
+    update.current_sample = song_position();
+    update.voices = stats.voices;
+    update.render_ns = render_ns;
+    publish_telemetry(&update);
+
+    if (send_output((int8_t *) output_buffer, res * 4) < 0) {
+        /* driver prints an error message already. */
+        printf("\r");
+        finish_song(1);
+        return (WWM_STEP_DONE);
+    }
+
+    // the playing song ended in this chunk
+    if (ending && count_diff <= frames)
+        play_next();
 
-    return 0;
+    return (res);
+}
+
+int wildwebmidi(char* midi_file, char* wav_file, int sleep) {
+    int res;
+
+    if (wildwebmidi_start(midi_file, wav_file) == -1)
+        return (1);
+
+    while ((res = wildwebmidi_step()) != WWM_STEP_DONE) {
+        if (res == WWM_STEP_WAIT) {
+#ifdef __EMSCRIPTEN__
+            // nothing to block on here, the host continues with wildwebmidi_step
+            return (0);
+#else
+            host_wait_for_demand(chunk_frames);
+#endif
+        } else if (sleep > -1) {
+            msleep(sleep);
+        }
+    }
+
+    return (0);
 }
 
 static void completeConversion(int status) {
-    EM_ASM(
-        completeConversion(status);
-    );
+    host_complete_conversion(status);
 }
 
 
 /* helper / replacement functions: */
 static int msleep(unsigned long milisec) {
-    emscripten_sleep(milisec);
+#ifndef __EMSCRIPTEN__
+    struct timespec req;
+    req.tv_sec = milisec / 1000;
+    req.tv_nsec = (milisec % 1000) * 1000000;
+    nanosleep(&req, NULL);
+#else
+    (void) milisec; /* the host yields between wildwebmidi_step calls */
+#endif
     return 1;
 }
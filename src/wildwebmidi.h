@@ -0,0 +1,210 @@
+/*
+ * wildwebmidi.h -- entry points of the WildWebMidi player
+ *
+ * by Joshua Koo http://github.com/zz85 http://twitter.com/blurspline
+ */
+
+#ifndef WILDWEBMIDI_H
+#define WILDWEBMIDI_H
+
+#include <stdint.h>
+
+#define WWM_DEFAULT_RATE 44100
+#define WWM_MIN_RATE 11025 /* what WildMidi_Init accepts */
+#define WWM_MAX_RATE 65000
+
+#define WWM_DEFAULT_CHUNK 4096
+#define WWM_MAX_CHUNK 16384
+
+/* config to use instead of /freepats/freepats.cfg (MEMFS path in the browser) */
+void wildwebmidi_set_config(char *cfg);
+
+/*
+ * Output rate and frames rendered per wildwebmidi_step (1 - WWM_MAX_CHUNK),
+ * -1 when out of range. Used from the next wildwebmidi_start, a new rate
+ * initializes the synth again then (patches are reloaded). The browser
+ * passes the AudioContext rate, so the audio is not resampled on its way
+ * out.
+ */
+int wildwebmidi_configure(unsigned int rate, int chunk_frames);
+
+/*
+ * Named latency/throughput profiles: a streaming consumer queues
+ * queue_chunks chunks of chunk_frames ahead, which is the latency the
+ * player adds. Smaller chunks cost more per frame rendered (wwm_bench -p).
+ */
+struct wwm_profile {
+    const char *name;
+    int chunk_frames;
+    int queue_chunks;
+};
+
+/* the i-th profile, NULL past the last */
+const struct wwm_profile *wildwebmidi_profile(int i);
+const struct wwm_profile *wildwebmidi_find_profile(const char *name);
+
+/*
+ * caller-owned planar float32 buffers of `frames` each that streaming mode
+ * renders into before handing them to processAudio
+ */
+void wildwebmidi_set_output_f32(float *left, float *right, int frames);
+
+/*
+ * Step API, the host drives rendering one chunk at a time.
+ *
+ * wildwebmidi_start opens the song (and the output file when wav_file is
+ * not empty, *.flac or wav), -1 on failure. Each wildwebmidi_step renders
+ * one chunk and returns the frames rendered, WWM_STEP_WAIT when streaming
+ * and the consumer has no room (call again on its demand) or
+ * WWM_STEP_DONE once the song finished, was stopped or failed; either way
+ * host_complete_conversion has been called by then.
+ */
+#define WWM_STEP_DONE 0
+#define WWM_STEP_WAIT (-1)
+
+int wildwebmidi_start(char* midi_file, char* wav_file);
+int wildwebmidi_step(void);
+
+/*
+ * start with a song the host put into the heap (see wwm_open_memory), data
+ * can be freed once this returns
+ */
+int wildwebmidi_start_memory(uint8_t *data, uint32_t size, char *wav_file);
+
+/*
+ * start + step until done. sleep: ms to yield after every chunk of a wav
+ * conversion, -1 not to. Natively it blocks in host_wait_for_demand while
+ * streaming, in the browser it returns at the first WWM_STEP_WAIT and the
+ * host continues with wildwebmidi_step.
+ */
+int wildwebmidi(char* midi_file, char* wav_file, int sleep);
+
+/*
+ * Gapless playlists: the song to stream when the playing one ends. It is
+ * opened in the playing song's last seconds and takes over on the sample
+ * after its last, or crossfaded into it, without host_complete_conversion
+ * in between (telemetry's song counts up instead). A song queued before
+ * is replaced, NULL just drops it. 0, or -1 when nothing streams. _memory
+ * takes data, it must come from malloc.
+ */
+#define WWM_MAX_CROSSFADE_MS 2000
+
+int wildwebmidi_queue(char *midi_file);
+int wildwebmidi_queue_memory(uint8_t *data, uint32_t size);
+
+/* ms the next song fades in over the playing one, 0 (the default) splices them */
+void wildwebmidi_set_crossfade(int ms);
+
+/*
+ * Render stats of the playing song, updated after every chunk and reset
+ * when a song starts. All uint32_t, so JS reads them straight off HEAPU32.
+ */
+struct wwm_stats {
+    uint32_t chunks;
+    uint32_t voices;         /* sounding after the last chunk */
+    uint32_t peak_voices;
+    uint32_t render_us;      /* render time of the last chunk */
+    uint32_t peak_render_us;
+    uint32_t late_chunks;    /* rendered slower than they play */
+    uint32_t degraded;       /* quality steps the guard has turned off */
+    uint32_t voice_limit;    /* the guard's, 0 for none */
+    uint32_t stolen;         /* voices the guard released */
+};
+
+struct wwm_stats *wildwebmidi_stats(void);
+
+/*
+ * Where the player is, published after every chunk so a reader on another
+ * thread can poll it instead of getting a call per chunk: the worker copies
+ * it into a SharedArrayBuffer the page reads each frame (telemetry.js).
+ * A seqlock with the player as only writer, seq is odd while it writes.
+ * Kept after a song finishes, with playing 0. Underruns happen at the
+ * consumer, the worker adds them next to these.
+ */
+struct wwm_telemetry {
+    uint32_t seq;
+    uint32_t song;            /* songs started so far */
+    uint32_t playing;
+    uint32_t current_sample;
+    uint32_t total_samples;   /* 0 for live input */
+    uint32_t voices;
+    uint32_t render_ns;       /* the last chunk */
+};
+
+const struct wwm_telemetry *wildwebmidi_telemetry(void);
+
+/* a consistent copy, from any thread */
+void wildwebmidi_telemetry_read(struct wwm_telemetry *copy);
+
+/*
+ * Load guard for streaming: when a chunk takes most of its play time to
+ * render, the song gets a voice limit and its quietest (or oldest) voices
+ * over it are faded out, lower at every slow chunk. Once the limit is down
+ * to a few voices, enhanced resampling and then reverb are turned off.
+ * When rendering is fast again they come back one at a time, then the limit
+ * is raised until it goes. Off by default.
+ */
+void wildwebmidi_set_guard(int on);
+
+/*
+ * Reverb tier of the songs started from now on, one of WWM_REVERB_ROOM,
+ * _LIGHT or _CONVOLUTION (see wwm_reverb.h). -1 for an unknown tier.
+ */
+int wildwebmidi_set_reverb(int tier);
+
+/*
+ * Keeps the rendered premix of drum hits and other one-shot notes in kb
+ * of memory, later hits of the same note are mixed from there (see
+ * wwm_synth.h). 0 turns it off and frees it.
+ */
+void wildwebmidi_set_cache(int kb);
+
+/*
+ * Prints the patches loaded now with the bytes each holds, sample data
+ * shared between the program slots loading it, against every slot holding
+ * its own copy (see wwm_patbank.h).
+ */
+void wildwebmidi_patch_report(void);
+
+/*
+ * Control of a playing song, picked up before the next chunk is rendered.
+ * A seek queued while nothing plays applies to the next song, a stop is
+ * dropped.
+ */
+#define WWM_CMD_STOP 1
+#define WWM_CMD_SEEK 2 /* arg: sample to seek to */
+
+void wildwebmidi_command(int cmd, uint32_t arg);
+
+/*
+ * Live input (see wwm_live.h): a song played from midi events until it is
+ * stopped, stepped like any streaming song. used as for wwm_live_open,
+ * NULL loads every patch. Events are raw channel messages due at a frame
+ * of wildwebmidi_live_clock; -1 when no live song plays or the queue is
+ * full. Seeks are ignored.
+ */
+int wildwebmidi_start_live(const uint8_t *used);
+int wildwebmidi_live_event(uint32_t frame, int status, int data1, int data2);
+uint32_t wildwebmidi_live_clock(void);
+
+/* NULL when no live song plays */
+struct wwm_live_stats;
+const struct wwm_live_stats *wildwebmidi_live_stats(void);
+
+#ifndef __EMSCRIPTEN__
+/*
+ * Host hooks
+ *
+ * In the browser these are EM_ASM calls into the page (see post.js for the
+ * callbacks API). The native build has no page, so whoever links
+ * wildwebmidi.c (eg. wwm_bench.c) provides them instead.
+ */
+int host_buffer_space(void); /* frames the consumer has room for */
+void host_process_audio(float *left, float *right, int frames);
+void host_complete_conversion(int status);
+
+/* waits until the consumer has room for frames (or a command was queued) */
+void host_wait_for_demand(int frames);
+#endif
+
+#endif /* WILDWEBMIDI_H */
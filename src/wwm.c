@@ -0,0 +1,461 @@
+/*
+ * wwm.c -- persistent synth instance for WildWebMidi
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __EMSCRIPTEN__
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* struct _mdi for wwm_voices and wwm_position, in the order internal_midi.c includes them */
+#include "common.h"
+#include "reverb.h"
+#include "internal_midi.h"
+#include "wm_error.h"
+
+#include "wwm.h"
+#include "wwm_arena.h"
+#include "wwm_pcm.h"
+
+#define WWM_CHUNK_BYTES 16384
+
+static int initialized;
+static unsigned int init_rate;
+static int8_t *render_buffer;
+
+/*
+ * libWildMidi unloads a patch as soon as no open midi uses it. Closing a
+ * song is therefore deferred until the next one has been opened, which
+ * picks up every patch the two have in common without reloading it.
+ */
+static midi *retired;
+
+/* every open song's memory, dropped at once when it closes */
+struct song_arena {
+    midi *handle;
+    wwm_arena *arena;
+    struct song_arena *next;
+};
+
+static struct song_arena *song_arenas;
+
+#ifndef __EMSCRIPTEN__
+static pthread_mutex_t lib_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void wwm_lock(void) {
+    pthread_mutex_lock(&lib_lock);
+}
+
+void wwm_unlock(void) {
+    pthread_mutex_unlock(&lib_lock);
+}
+#else
+void wwm_lock(void) {
+}
+
+void wwm_unlock(void) {
+}
+#endif
+
+#ifndef __EMSCRIPTEN__
+/*
+ * The file is parsed straight out of the page cache. Private and writable
+ * so libWildMidi may treat it as its own buffer, pages are only copied if
+ * it writes. Anything odd goes to WildMidi_Open, which also reports it.
+ */
+static midi *open_mapped(const char *midi_file) {
+    struct stat st;
+    void *data;
+    midi *handle;
+    int fd = open(midi_file, O_RDONLY);
+
+    if (fd == -1)
+        return WildMidi_Open(midi_file);
+    if (fstat(fd, &st) == -1 || st.st_size == 0 || (uint64_t) st.st_size > UINT32_MAX) {
+        close(fd);
+        return WildMidi_Open(midi_file);
+    }
+
+    data = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return WildMidi_Open(midi_file);
+
+    handle = WildMidi_OpenBuffer(data, (uint32_t) st.st_size);
+    munmap(data, st.st_size);
+    return (handle);
+}
+#endif
+
+/* the song is parsed into events, data is not needed after this */
+static midi *lib_open(const char *midi_file, const uint8_t *data, uint32_t size) {
+    if (data != NULL)
+        return WildMidi_OpenBuffer((uint8_t *) data, size);
+#ifndef __EMSCRIPTEN__
+    return open_mapped(midi_file);
+#else
+    return WildMidi_Open(midi_file);
+#endif
+}
+
+/* with wwm_lock held, data NULL opens midi_file */
+static midi *open_song(const char *midi_file, const uint8_t *data, uint32_t size) {
+    struct song_arena *entry = malloc(sizeof(*entry));
+    wwm_arena *previous;
+
+    /* without an arena the song just lives on the heap */
+    if (entry == NULL || (entry->arena = wwm_arena_new()) == NULL) {
+        free(entry);
+        return lib_open(midi_file, data, size);
+    }
+
+    previous = wwm_arena_enter(entry->arena);
+    entry->handle = lib_open(midi_file, data, size);
+    wwm_arena_enter(previous);
+
+    /* an error raised meanwhile has to outlive the arena */
+    if (_WM_Global_ErrorS != NULL && wwm_arena_owns(_WM_Global_ErrorS))
+        _WM_Global_ErrorS = strdup(_WM_Global_ErrorS);
+
+    if (entry->handle == NULL) {
+        wwm_arena_free(entry->arena);
+        free(entry);
+        return (NULL);
+    }
+    entry->next = song_arenas;
+    song_arenas = entry;
+    return (entry->handle);
+}
+
+static void forget_stolen(midi *handle, int all);
+
+/* with wwm_lock held */
+static int close_song(midi *handle) {
+    struct song_arena **link = &song_arenas;
+    struct song_arena *entry;
+    int res;
+
+    forget_stolen(handle, 1);
+    res = WildMidi_Close(handle);
+
+    while (*link != NULL && (*link)->handle != handle)
+        link = &(*link)->next;
+    if ((entry = *link) != NULL) {
+        *link = entry->next;
+        wwm_arena_free(entry->arena);
+        free(entry);
+    }
+    return (res);
+}
+
+static void close_retired(void) {
+    if (retired == NULL)
+        return;
+
+    wwm_lock();
+    if (close_song(retired) == -1) {
+        fprintf(stderr, "OOPS: failed closing midi handle!\r\n%s\r\n", WildMidi_GetError());
+        WildMidi_ClearError();
+    }
+    wwm_unlock();
+    retired = NULL;
+}
+
+int wwm_init(const char *config_file, unsigned int rate, uint16_t mixer_options) {
+    if (initialized)
+        return (0);
+
+    if (WildMidi_Init(config_file, rate, mixer_options) == -1) {
+        fprintf(stderr, "Error: WildMidi_Init failed (%s)\r\n", WildMidi_GetError());
+        WildMidi_ClearError();
+        return (-1);
+    }
+
+    render_buffer = malloc(WWM_CHUNK_BYTES);
+    if (render_buffer == NULL) {
+        fprintf(stderr, "Not enough memory\r\n");
+        WildMidi_Shutdown();
+        return (-1);
+    }
+
+    WildMidi_MasterVolume(127);
+    init_rate = rate;
+    initialized = 1;
+    return (0);
+}
+
+int wwm_initialized(void) {
+    return initialized;
+}
+
+unsigned int wwm_rate(void) {
+    return init_rate;
+}
+
+static midi *player_open(const char *midi_file, const uint8_t *data, uint32_t size) {
+    midi *handle;
+
+    if (!initialized)
+        return (NULL);
+
+    WildMidi_ClearError();
+    wwm_lock();
+    handle = open_song(midi_file, data, size);
+    wwm_unlock();
+    if (handle != NULL)
+        WildMidi_SetOption(handle, WWM_MIXER_OPTIONS, WWM_MIXER_OPTIONS);
+    close_retired();
+
+    return (handle);
+}
+
+midi *wwm_open(const char *midi_file) {
+    return player_open(midi_file, NULL, 0);
+}
+
+midi *wwm_open_memory(const uint8_t *data, uint32_t size) {
+    if (data == NULL)
+        return (NULL);
+    return player_open(NULL, data, size);
+}
+
+int wwm_render(midi *handle, int8_t *buffer, int size) {
+    return WildMidi_GetOutput(handle, buffer, size);
+}
+
+int wwm_render_f32(midi *handle, float *left, float *right, int frames) {
+    int done = 0;
+
+    while (done < frames) {
+        int bytes = (frames - done) * 4;
+        int res;
+
+        if (bytes > WWM_CHUNK_BYTES)
+            bytes = WWM_CHUNK_BYTES;
+
+        res = WildMidi_GetOutput(handle, render_buffer, bytes);
+        if (res <= 0)
+            break;
+
+        wwm_s16_to_f32((int16_t *) render_buffer, left + done, right + done, res / 4);
+        done += res / 4;
+    }
+
+    return (done);
+}
+
+int wwm_voices(midi *handle) {
+    struct _note *note;
+    int count = 0;
+
+    if (handle == NULL)
+        return (0);
+
+    for (note = ((struct _mdi *) handle)->note; note != NULL; note = note->next)
+        count++;
+    return (count);
+}
+
+/* ms a stolen voice fades out over */
+#define STEAL_FADE_MS 10
+
+/*
+ * A voice wwm_steal_voices released plays its own copy of the sample, with
+ * a release target of 0: the release stage ends the note when it gets
+ * there, whatever target the patch has (the sample is shared by every note
+ * of it). The copy is dropped once the note plays another sample or its
+ * song closes. Under wwm_lock.
+ */
+struct stolen_note {
+    midi *handle;
+    struct _note *note;
+    struct _sample sample;
+    struct stolen_note *next;
+};
+
+static struct stolen_note *stolen_notes;
+
+static int stolen(const struct _note *note) {
+    struct stolen_note *entry;
+
+    for (entry = stolen_notes; entry != NULL; entry = entry->next) {
+        if (entry->note == note)
+            return (note->sample == &entry->sample);
+    }
+    return (0);
+}
+
+/* the copies of handle's notes that play another sample now, or all of them */
+static void forget_stolen(midi *handle, int all) {
+    struct stolen_note **link = &stolen_notes;
+
+    while (*link != NULL) {
+        struct stolen_note *entry = *link;
+
+        if (entry->handle == handle && (all || entry->note->sample != &entry->sample)) {
+            *link = entry->next;
+            free(entry);
+        } else {
+            link = &entry->next;
+        }
+    }
+}
+
+/*
+ * How loud a note is to the steal: its envelope level, or for a note still
+ * in its attack the level it rises to, times its volume.
+ */
+static int64_t loudness(const struct _note *note) {
+    int32_t level = note->env_level;
+
+    if (note->env == 0 && note->env_inc > 0 && note->sample->env_target[0] > level)
+        level = note->sample->env_target[0];
+    return ((int64_t) level * (note->left_mix_volume + note->right_mix_volume));
+}
+
+/* released and sustaining voices go before the ones still rising */
+static int steal_before(const struct _note *note, int64_t level, const struct _note *victim, int64_t quietest) {
+    int settled = (note->env >= 2 || note->is_off || note->env_inc <= 0);
+    int victim_settled = (victim->env >= 2 || victim->is_off || victim->env_inc <= 0);
+
+    if (settled != victim_settled)
+        return (settled);
+    return (level <= quietest);
+}
+
+int wwm_steal_voices(midi *handle, int keep) {
+    struct _note *note, *victim;
+    struct stolen_note *entry;
+    int64_t level, quietest;
+    int32_t fade = init_rate * STEAL_FADE_MS / 1000;
+    int count = 0, steal, released = 0;
+
+    if (handle == NULL)
+        return (0);
+
+    wwm_lock();
+    forget_stolen(handle, 0);
+    for (note = ((struct _mdi *) handle)->note; note != NULL; note = note->next)
+        if (!stolen(note))
+            count++;
+
+    for (steal = count - keep; steal > 0; steal--) {
+        // new notes go in front, a tie goes to the one further on: the oldest
+        victim = NULL;
+        quietest = 0;
+        for (note = ((struct _mdi *) handle)->note; note != NULL; note = note->next) {
+            if (stolen(note))
+                continue;
+            level = loudness(note);
+            if (victim == NULL || steal_before(note, level, victim, quietest)) {
+                victim = note;
+                quietest = level;
+            }
+        }
+
+        entry = malloc(sizeof(*entry));
+        if (entry == NULL)
+            break;
+        entry->handle = handle;
+        entry->note = victim;
+        memcpy(&entry->sample, victim->sample, sizeof(entry->sample));
+        entry->sample.env_target[5] = 0;
+        entry->next = stolen_notes;
+        stolen_notes = entry;
+
+        /*
+         * The release stage ends the note when it gets to 0, from any level,
+         * a note in its attack fades from where it is. The envelope flag keeps
+         * a note off from stopping the fade.
+         */
+        victim->sample = &entry->sample;
+        victim->env = 5;
+        victim->env_inc = -(victim->env_level / fade + 1);
+        victim->modes |= SAMPLE_ENVELOPE;
+        victim->modes &= ~SAMPLE_LOOP;
+        victim->hold = 0;
+        released++;
+    }
+    wwm_unlock();
+    return (released);
+}
+
+uint32_t wwm_position(midi *handle) {
+    if (handle == NULL)
+        return (0);
+    return (((struct _mdi *) handle)->extra_info.current_sample);
+}
+
+int wwm_close(midi *handle) {
+    if (handle == NULL)
+        return (-1);
+
+    close_retired();
+    retired = handle;
+    return (0);
+}
+
+static midi *handle_open(const char *midi_file, const uint8_t *data, uint32_t size) {
+    midi *handle;
+
+    if (!initialized)
+        return (NULL);
+
+    wwm_lock();
+    handle = open_song(midi_file, data, size);
+    wwm_unlock();
+
+    if (handle == NULL) {
+        fprintf(stderr, "Error opening %s: %s\r\n", data ? "midi in memory" : midi_file, WildMidi_GetError());
+        return (NULL);
+    }
+    WildMidi_SetOption(handle, WWM_MIXER_OPTIONS, WWM_MIXER_OPTIONS);
+    return (handle);
+}
+
+midi *wwm_open_handle(const char *midi_file) {
+    return handle_open(midi_file, NULL, 0);
+}
+
+midi *wwm_open_handle_memory(const uint8_t *data, uint32_t size) {
+    if (data == NULL)
+        return (NULL);
+    return handle_open(NULL, data, size);
+}
+
+void wwm_close_handle(midi *handle) {
+    if (handle == NULL)
+        return;
+
+    wwm_lock();
+    close_song(handle);
+    wwm_unlock();
+}
+
+int wwm_shutdown(void) {
+    int res;
+
+    if (!initialized)
+        return (0);
+
+    close_retired();
+    free(render_buffer);
+    render_buffer = NULL;
+    initialized = 0;
+
+    res = WildMidi_Shutdown();
+    if (res == -1) {
+        fprintf(stderr, "OOPS: failure shutting down libWildMidi\r\n%s\r\n", WildMidi_GetError());
+        WildMidi_ClearError();
+    }
+    return (res);
+}
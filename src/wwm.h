@@ -0,0 +1,82 @@
+/*
+ * wwm.h -- persistent synth instance for WildWebMidi
+ *
+ * WildMidi_Init parses the config once in wwm_init, songs are then only
+ * opened, rendered and closed until wwm_shutdown. Patches loaded for a song
+ * stay resident across a track switch, so the next song only has to parse
+ * its midi.
+ */
+
+#ifndef WWM_H
+#define WWM_H
+
+#include <stdint.h>
+
+#include "wildmidi_lib.h"
+
+/* what the player renders with, applied to every opened song */
+#define WWM_MIXER_OPTIONS (WM_MO_REVERB | WM_MO_ENHANCED_RESAMPLING)
+
+int wwm_init(const char *config_file, unsigned int rate, uint16_t mixer_options);
+int wwm_initialized(void);
+unsigned int wwm_rate(void);
+
+/*
+ * libWildMidi's own locks are not thread safe, every WildMidi_Open and
+ * WildMidi_Close has to hold this one when songs render on several threads.
+ * Rendering separate handles needs no lock. No-op in the browser.
+ */
+void wwm_lock(void);
+void wwm_unlock(void);
+
+/* natively the file is mapped and parsed in place (WildMidi_OpenBuffer) */
+midi *wwm_open(const char *midi_file);
+
+/*
+ * Opens a song from a midi (or xmi, mus, hmp, hmi) file in memory, without
+ * a copy into MEMFS or a file buffer of the library. data is only read
+ * while opening, the caller may free it as soon as this returns.
+ */
+midi *wwm_open_memory(const uint8_t *data, uint32_t size);
+
+/* renders up to size bytes of stereo16, returns bytes rendered */
+int wwm_render(midi *handle, int8_t *buffer, int size);
+
+/* renders up to frames into planar float32, returns frames rendered */
+int wwm_render_f32(midi *handle, float *left, float *right, int frames);
+
+/*
+ * voices sounding in a song (libWildMidi's mixer list, releasing notes
+ * included), call it from the thread rendering the handle
+ */
+int wwm_voices(midi *handle);
+
+/*
+ * Releases voices of a song until at most keep are left sounding: sustained
+ * and released ones before those still in their attack, the quietest first
+ * (envelope level, or the level an attack rises to, times volume), the
+ * oldest among equals. They fade out to 0 over a few ms and end instead of
+ * cutting off, the ones already fading are not counted. Returns the voices
+ * released, call it from the thread rendering the handle.
+ */
+int wwm_steal_voices(midi *handle, int keep);
+
+/*
+ * the sample a song is at, what WildMidi_GetInfo reports as current_sample
+ * without copying the whole info (and its copyright string) every chunk
+ */
+uint32_t wwm_position(midi *handle);
+
+int wwm_close(midi *handle);
+int wwm_shutdown(void);
+
+/*
+ * Thread safe open/close for handles rendered next to the player (export
+ * segments, batch jobs). The handle is closed right away, there is no
+ * deferred close.
+ */
+midi *wwm_open_handle(const char *midi_file);
+midi *wwm_open_handle_memory(const uint8_t *data, uint32_t size);
+void wwm_close_handle(midi *handle);
+
+#endif /* WWM_H */
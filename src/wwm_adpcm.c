@@ -0,0 +1,203 @@
+/*
+ * wwm_adpcm.c -- streaming IMA ADPCM wav encoder for 16 bit stereo output
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "wwm_adpcm.h"
+
+/* after the verbatim frame: 4 bytes of each channel in turn, 8 samples each */
+#define GROUP_FRAMES 8
+
+struct wwm_adpcm {
+    wwm_adpcm_sink sink;
+    void *ctx;
+    uint32_t rate;
+    uint32_t total;    /* frames given, without the padding */
+    uint32_t blocks;
+
+    /* carried from block to block, like a decoder has it */
+    int32_t predictor[2];
+    int index[2];
+
+    uint32_t fill;
+    int16_t pcm[WWM_ADPCM_BLOCK * 2];
+    uint8_t out[WWM_ADPCM_BLOCK_BYTES];
+};
+
+static const int16_t step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static void put_le16(uint8_t *p, uint32_t value) {
+    p[0] = value & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+}
+
+static void put_le32(uint8_t *p, uint32_t value) {
+    put_le16(p, value & 0xFFFF);
+    put_le16(p + 2, value >> 16);
+}
+
+/* one sample to its code, the predictor moves the way the decoder's does */
+static uint8_t encode_sample(wwm_adpcm *adpcm, int ch, int32_t sample) {
+    int32_t step = step_table[adpcm->index[ch]];
+    int32_t diff = sample - adpcm->predictor[ch];
+    int32_t delta = step >> 3;
+    uint8_t code = 0;
+
+    if (diff < 0) {
+        code = 8;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        code |= 4;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 2;
+        diff -= step;
+        delta += step;
+    }
+    step >>= 1;
+    if (diff >= step) {
+        code |= 1;
+        delta += step;
+    }
+
+    adpcm->predictor[ch] += (code & 8) ? -delta : delta;
+    if (adpcm->predictor[ch] > 32767)
+        adpcm->predictor[ch] = 32767;
+    else if (adpcm->predictor[ch] < -32768)
+        adpcm->predictor[ch] = -32768;
+
+    adpcm->index[ch] += index_table[code];
+    if (adpcm->index[ch] < 0)
+        adpcm->index[ch] = 0;
+    else if (adpcm->index[ch] > 88)
+        adpcm->index[ch] = 88;
+    return (code);
+}
+
+static int encode_block(wwm_adpcm *adpcm) {
+    uint8_t *out = adpcm->out;
+    uint32_t i, j;
+    int ch;
+
+    /* a short last block repeats its last frame */
+    for (i = adpcm->fill; i < WWM_ADPCM_BLOCK; i++) {
+        adpcm->pcm[i * 2] = adpcm->pcm[(adpcm->fill - 1) * 2];
+        adpcm->pcm[i * 2 + 1] = adpcm->pcm[(adpcm->fill - 1) * 2 + 1];
+    }
+
+    for (ch = 0; ch < 2; ch++) {
+        adpcm->predictor[ch] = adpcm->pcm[ch];
+        put_le16(out, (uint16_t) adpcm->pcm[ch]);
+        out[2] = (uint8_t) adpcm->index[ch];
+        out[3] = 0;
+        out += 4;
+    }
+
+    for (i = 1; i < WWM_ADPCM_BLOCK; i += GROUP_FRAMES) {
+        for (ch = 0; ch < 2; ch++) {
+            /* two samples a byte, the earlier in the low nibble */
+            for (j = 0; j < GROUP_FRAMES; j += 2) {
+                uint8_t lo = encode_sample(adpcm, ch, adpcm->pcm[(i + j) * 2 + ch]);
+                uint8_t hi = encode_sample(adpcm, ch, adpcm->pcm[(i + j + 1) * 2 + ch]);
+                *out++ = (uint8_t) (lo | (hi << 4));
+            }
+        }
+    }
+
+    adpcm->fill = 0;
+    adpcm->blocks++;
+    return adpcm->sink(adpcm->ctx, adpcm->out, WWM_ADPCM_BLOCK_BYTES);
+}
+
+wwm_adpcm *wwm_adpcm_new(uint32_t rate, wwm_adpcm_sink sink, void *ctx) {
+    wwm_adpcm *adpcm = calloc(1, sizeof(*adpcm));
+
+    if (adpcm == NULL)
+        return (NULL);
+    adpcm->rate = rate;
+    adpcm->sink = sink;
+    adpcm->ctx = ctx;
+    return (adpcm);
+}
+
+void wwm_adpcm_header(wwm_adpcm *adpcm, uint8_t *hdr) {
+    static const uint8_t template[WWM_ADPCM_HEADER_SIZE] = {
+        0x52, 0x49, 0x46, 0x46, /* "RIFF"  */
+        0x00, 0x00, 0x00, 0x00, /* riffsize: data size + 52 */
+        0x57, 0x41, 0x56, 0x45, /* "WAVE"  */
+        0x66, 0x6D, 0x74, 0x20, /* "fmt "  */
+        0x14, 0x00, 0x00, 0x00, /* length of this RIFF block: 20  */
+        0x11, 0x00,             /* wave format == 0x11 (WAVE_FORMAT_IMA_ADPCM)  */
+        0x02, 0x00,             /* channels == 2  */
+        0x00, 0x00, 0x00, 0x00, /* sample rate  */
+        0x00, 0x00, 0x00, 0x00, /* bytes_per_sec: rate * block bytes / block frames  */
+        0x00, 0x08,             /* block alignment == 2048  */
+        0x04, 0x00,             /* format bits == 4  */
+        0x02, 0x00,             /* extra format bytes == 2  */
+        0xF9, 0x07,             /* frames per block == 2041  */
+        0x66, 0x61, 0x63, 0x74, /* "fact"  */
+        0x04, 0x00, 0x00, 0x00, /* length of this RIFF block: 4  */
+        0x00, 0x00, 0x00, 0x00, /* frames, without the padding of the last block  */
+        0x64, 0x61, 0x74, 0x61, /* "data"  */
+        0x00, 0x00, 0x00, 0x00  /* datasize: the blocks */
+    };
+    uint32_t data_size = adpcm->blocks * WWM_ADPCM_BLOCK_BYTES;
+
+    memcpy(hdr, template, WWM_ADPCM_HEADER_SIZE);
+    put_le32(&hdr[4], data_size + WWM_ADPCM_HEADER_SIZE - 8);
+    put_le32(&hdr[24], adpcm->rate);
+    put_le32(&hdr[28], (uint32_t) ((uint64_t) adpcm->rate * WWM_ADPCM_BLOCK_BYTES / WWM_ADPCM_BLOCK));
+    put_le32(&hdr[48], adpcm->total);
+    put_le32(&hdr[56], data_size);
+}
+
+int wwm_adpcm_write(wwm_adpcm *adpcm, const int16_t *pcm, uint32_t frames) {
+    uint32_t i;
+
+    for (i = 0; i < frames; i++) {
+        adpcm->pcm[adpcm->fill * 2] = pcm[i * 2];
+        adpcm->pcm[adpcm->fill * 2 + 1] = pcm[i * 2 + 1];
+        adpcm->total++;
+        if (++adpcm->fill == WWM_ADPCM_BLOCK && encode_block(adpcm) == -1)
+            return (-1);
+    }
+    return (0);
+}
+
+int wwm_adpcm_finish(wwm_adpcm *adpcm) {
+    if (adpcm->fill == 0)
+        return (0);
+    return encode_block(adpcm);
+}
+
+void wwm_adpcm_free(wwm_adpcm *adpcm) {
+    free(adpcm);
+}
+
+int wwm_adpcm_filename(const char *file) {
+    size_t len = strlen(file);
+    return (len >= 10 && strcasecmp(file + len - 10, ".adpcm.wav") == 0);
+}
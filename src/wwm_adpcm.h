@@ -0,0 +1,44 @@
+/*
+ * wwm_adpcm.h -- streaming IMA ADPCM wav encoder for 16 bit stereo output
+ *
+ * The lossy export: 4 bits a sample, a quarter of the pcm wav, with no
+ * encoder library in the build. Microsoft's IMA ADPCM layout (wave format
+ * 0x11), blocks of WWM_ADPCM_BLOCK frames that start from a verbatim
+ * sample each, so an error never outlives its block. Every block goes to
+ * the sink as soon as it is full, memory does not grow with the song.
+ *
+ * Like a wav, the header is written up front with an unknown length and
+ * rewritten at the end (wwm_adpcm_header).
+ */
+
+#ifndef WWM_ADPCM_H
+#define WWM_ADPCM_H
+
+#include <stdint.h>
+
+#define WWM_ADPCM_HEADER_SIZE 60 /* RIFF, fmt, fact and data headers */
+#define WWM_ADPCM_BLOCK_BYTES 2048
+#define WWM_ADPCM_BLOCK 2041 /* frames in a block: the verbatim one and 8 per 8 bytes */
+
+/* receives encoded bytes, returns -1 to stop encoding */
+typedef int (*wwm_adpcm_sink)(void *ctx, const uint8_t *data, uint32_t size);
+
+typedef struct wwm_adpcm wwm_adpcm;
+
+wwm_adpcm *wwm_adpcm_new(uint32_t rate, wwm_adpcm_sink sink, void *ctx);
+
+/* fills the header for what has been encoded so far */
+void wwm_adpcm_header(wwm_adpcm *adpcm, uint8_t *hdr);
+
+/* encodes interleaved host-endian stereo16, returns 0 or -1 */
+int wwm_adpcm_write(wwm_adpcm *adpcm, const int16_t *pcm, uint32_t frames);
+
+/* encodes the last partial block, padded with its last frame, returns 0 or -1 */
+int wwm_adpcm_finish(wwm_adpcm *adpcm);
+
+void wwm_adpcm_free(wwm_adpcm *adpcm);
+
+/* whether a file name asks for adpcm (*.adpcm.wav) */
+int wwm_adpcm_filename(const char *file);
+
+#endif /* WWM_ADPCM_H */
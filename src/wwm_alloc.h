@@ -0,0 +1,23 @@
+/*
+ * wwm_alloc.h -- routes the heap functions through wwm_arena.c
+ *
+ * Forced into libWildMidi's translation units only (make.js compiles them
+ * with -include wwm_alloc.h), the rest of WildWebMidi keeps libc's. The
+ * libc headers come in before the macros so their declarations stay
+ * untouched.
+ */
+
+#ifndef WWM_ALLOC_H
+#define WWM_ALLOC_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "wwm_arena.h"
+
+#define malloc(size) wwm_lib_malloc(size)
+#define calloc(count, size) wwm_lib_calloc(count, size)
+#define realloc(ptr, size) wwm_lib_realloc(ptr, size)
+#define free(ptr) wwm_lib_free(ptr)
+
+#endif /* WWM_ALLOC_H */
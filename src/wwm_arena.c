@@ -0,0 +1,321 @@
+/*
+ * wwm_arena.c -- per-song arena for libWildMidi's allocations
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __EMSCRIPTEN__
+#include <pthread.h>
+#endif
+
+#include "wwm_arena.h"
+#include "wwm_patbank.h"
+
+#define ALIGN 16
+#define ROUND(n) (((n) + ALIGN - 1) & ~(size_t) (ALIGN - 1))
+
+#define SMALL_CLASS 16        /* 64k chunks the small allocations are bumped from */
+#define MAX_CLASS 30
+#define BIG_ALLOC (((size_t) 1 << SMALL_CLASS) / 4) /* from here on in a chunk of its own */
+#define POOL_MAX (8 * 1024 * 1024)
+
+struct chunk {
+    struct chunk *next;       /* in its arena, or in the pool */
+    struct wwm_arena *arena;
+    uint8_t *start, *top, *end;
+    int size_class;
+    int big;                  /* holds a single allocation */
+};
+
+/* in front of every allocation */
+struct block {
+    size_t size;
+};
+
+#define HEADER ROUND(sizeof(struct block))
+
+struct wwm_arena {
+    struct chunk *chunks;
+    struct chunk *small;      /* bumped from */
+};
+
+#ifdef __EMSCRIPTEN__
+static wwm_arena *current;
+#define lock()
+#define unlock()
+#else
+static __thread wwm_arena *current;
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+#define lock() pthread_mutex_lock(&registry_lock)
+#define unlock() pthread_mutex_unlock(&registry_lock)
+#endif
+
+/* live chunks by start address, for telling arena blocks from heap blocks */
+static struct chunk **live;
+static size_t live_count, live_size, live_bytes;
+
+static struct chunk *pool[MAX_CLASS + 1];
+static size_t pool_bytes;
+static size_t arena_count;
+
+static size_t find_live(const void *ptr) {
+    size_t lo = 0, hi = live_count;
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (live[mid]->start <= (const uint8_t *) ptr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo); /* first chunk starting after ptr */
+}
+
+static struct chunk *owner(const void *ptr) {
+    struct chunk *chunk = NULL;
+    size_t i;
+
+    lock();
+    i = find_live(ptr);
+    if (i > 0 && (const uint8_t *) ptr < live[i - 1]->end)
+        chunk = live[i - 1];
+    unlock();
+    return (chunk);
+}
+
+static struct chunk *chunk_get(wwm_arena *arena, int size_class) {
+    struct chunk *chunk;
+    size_t i;
+
+    lock();
+    if (live_count == live_size) {
+        size_t size = live_size ? live_size * 2 : 64;
+        struct chunk **grown = realloc(live, size * sizeof(*live));
+        if (grown == NULL) {
+            unlock();
+            return (NULL);
+        }
+        live = grown;
+        live_size = size;
+    }
+
+    chunk = pool[size_class];
+    if (chunk != NULL) {
+        pool[size_class] = chunk->next;
+        pool_bytes -= (size_t) 1 << size_class;
+    } else {
+        chunk = malloc(ROUND(sizeof(struct chunk)) + ((size_t) 1 << size_class));
+        if (chunk == NULL) {
+            unlock();
+            return (NULL);
+        }
+        chunk->start = (uint8_t *) chunk + ROUND(sizeof(struct chunk));
+        chunk->end = chunk->start + ((size_t) 1 << size_class);
+        chunk->size_class = size_class;
+    }
+
+    i = find_live(chunk->start);
+    memmove(&live[i + 1], &live[i], (live_count - i) * sizeof(*live));
+    live[i] = chunk;
+    live_count++;
+    live_bytes += (size_t) 1 << size_class;
+    unlock();
+
+    chunk->arena = arena;
+    chunk->top = chunk->start;
+    chunk->big = 0;
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    return (chunk);
+}
+
+/* the caller has unlinked it from its arena */
+static void chunk_put(struct chunk *chunk) {
+    size_t size = (size_t) 1 << chunk->size_class;
+    size_t i;
+
+    lock();
+    i = find_live(chunk->start) - 1;
+    memmove(&live[i], &live[i + 1], (live_count - i - 1) * sizeof(*live));
+    live_count--;
+    live_bytes -= size;
+
+    if (pool_bytes + size <= POOL_MAX) {
+        chunk->next = pool[chunk->size_class];
+        pool[chunk->size_class] = chunk;
+        pool_bytes += size;
+        chunk = NULL;
+    }
+    unlock();
+    free(chunk);
+}
+
+static void chunk_release(struct chunk *chunk) {
+    struct chunk **link = &chunk->arena->chunks;
+
+    while (*link != chunk)
+        link = &(*link)->next;
+    *link = chunk->next;
+    if (chunk->arena->small == chunk)
+        chunk->arena->small = NULL;
+    chunk_put(chunk);
+}
+
+static int class_of(size_t size) {
+    int size_class = SMALL_CLASS;
+
+    while (((size_t) 1 << size_class) < size) {
+        if (++size_class > MAX_CLASS)
+            return (-1);
+    }
+    return (size_class);
+}
+
+static void *arena_alloc(wwm_arena *arena, size_t size) {
+    size_t need = HEADER + ROUND(size);
+    struct chunk *chunk = arena->small;
+    struct block *block;
+
+    if (size > ((size_t) 1 << MAX_CLASS))
+        return (NULL);
+
+    if (need > BIG_ALLOC) {
+        int size_class = class_of(need);
+        if (size_class < 0 || (chunk = chunk_get(arena, size_class)) == NULL)
+            return (NULL);
+        chunk->big = 1;
+    } else if (chunk == NULL || (size_t) (chunk->end - chunk->top) < need) {
+        if ((chunk = chunk_get(arena, SMALL_CLASS)) == NULL)
+            return (NULL);
+        arena->small = chunk;
+    }
+
+    block = (struct block *) chunk->top;
+    block->size = size;
+    chunk->top += need;
+    return ((uint8_t *) block + HEADER);
+}
+
+wwm_arena *wwm_arena_new(void) {
+    wwm_arena *arena = calloc(1, sizeof(*arena));
+
+    if (arena != NULL) {
+        lock();
+        arena_count++;
+        unlock();
+    }
+    return (arena);
+}
+
+void wwm_arena_free(wwm_arena *arena) {
+    if (arena == NULL)
+        return;
+
+    while (arena->chunks != NULL) {
+        struct chunk *chunk = arena->chunks;
+        arena->chunks = chunk->next;
+        chunk_put(chunk);
+    }
+    lock();
+    arena_count--;
+    unlock();
+    free(arena);
+}
+
+wwm_arena *wwm_arena_enter(wwm_arena *arena) {
+    wwm_arena *previous = current;
+
+    current = arena;
+    return (previous);
+}
+
+int wwm_arena_owns(const void *ptr) {
+    return (owner(ptr) != NULL);
+}
+
+void wwm_arena_usage(struct wwm_arena_usage *usage) {
+    lock();
+    usage->arenas = arena_count;
+    usage->live_chunks = live_count;
+    usage->live_bytes = live_bytes;
+    usage->pool_bytes = pool_bytes;
+    unlock();
+}
+
+void *wwm_lib_malloc(size_t size) {
+    if (current == NULL)
+        return (malloc(size));
+    return (arena_alloc(current, size));
+}
+
+void *wwm_lib_calloc(size_t count, size_t size) {
+    void *ptr;
+
+    if (current == NULL)
+        return (calloc(count, size));
+    if (size != 0 && count > SIZE_MAX / size)
+        return (NULL);
+
+    /* pooled chunks come back dirty */
+    ptr = arena_alloc(current, count * size);
+    if (ptr != NULL)
+        memset(ptr, 0, count * size);
+    return (ptr);
+}
+
+/* arena blocks stay in the arena they came from, entered or not */
+void *wwm_lib_realloc(void *ptr, size_t size) {
+    struct chunk *chunk;
+    struct block *block;
+    void *moved;
+
+    if (ptr == NULL)
+        return (wwm_lib_malloc(size));
+
+    chunk = owner(ptr);
+    if (chunk == NULL)
+        return (realloc(ptr, size));
+
+    block = (struct block *) ((uint8_t *) ptr - HEADER);
+    if (size <= block->size) {
+        block->size = size;
+        return (ptr);
+    }
+
+    /* grow in place when nothing lies behind it */
+    if ((uint8_t *) ptr + ROUND(block->size) == chunk->top
+            && size <= (size_t) (chunk->end - (uint8_t *) ptr)) {
+        chunk->top = (uint8_t *) ptr + ROUND(size);
+        block->size = size;
+        return (ptr);
+    }
+
+    moved = arena_alloc(chunk->arena, size);
+    if (moved == NULL)
+        return (NULL);
+    memcpy(moved, ptr, block->size);
+    if (chunk->big)
+        chunk_release(chunk);
+    return (moved);
+}
+
+/*
+ * small blocks go with their arena, big ones are reused right away, sample
+ * data shared between patch slots when the last slot lets go of it, never
+ * sample data in the patch bank
+ */
+void wwm_lib_free(void *ptr) {
+    struct chunk *chunk;
+
+    if (ptr == NULL)
+        return;
+
+    chunk = owner(ptr);
+    if (chunk == NULL) {
+        if (!wwm_gus_pat_release(ptr) && !wwm_patbank_owns(ptr))
+            free(ptr);
+    } else if (chunk->big) {
+        chunk_release(chunk);
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * wwm_arena.h -- per-song arena for libWildMidi's allocations
+ *
+ * WildMidi_Open parses a song into many small heap blocks (the mdi, the
+ * event list, tempo and channel data, the reverb) and WildMidi_Close frees
+ * them one by one. Over hundreds of songs in one fixed size emscripten
+ * heap that fragments. While an arena is entered, every allocation the
+ * library makes on this thread comes out of it instead: small ones are
+ * bumped out of 64k chunks, big ones (the event list) get chunks of their
+ * own. Freeing a song's arena hands all of it back at once, and its chunks
+ * are kept in a pool for the next song, so the heap sees the same few
+ * chunk sizes over and over.
+ *
+ * Only the library's sources are hooked (wwm_alloc.h, see make.js). Its
+ * free and realloc tell arena blocks apart by address, plain heap blocks
+ * go to the libc functions, so memory may cross between the two freely.
+ * Patches outlive songs and are loaded outside of any arena
+ * (wwm_gus_pat.c).
+ */
+
+#ifndef WWM_ARENA_H
+#define WWM_ARENA_H
+
+#include <stddef.h>
+
+typedef struct wwm_arena wwm_arena;
+
+wwm_arena *wwm_arena_new(void);
+
+/* releases everything allocated in arena at once */
+void wwm_arena_free(wwm_arena *arena);
+
+/*
+ * makes arena (NULL for the plain heap) where library allocations of this
+ * thread go, returns the one entered before
+ */
+wwm_arena *wwm_arena_enter(wwm_arena *arena);
+
+/* whether ptr lies in some arena */
+int wwm_arena_owns(const void *ptr);
+
+struct wwm_arena_usage {
+    size_t arenas;       /* not freed yet */
+    size_t live_chunks;
+    size_t live_bytes;   /* in the chunks of live arenas */
+    size_t pool_bytes;   /* chunks kept for the next song */
+};
+
+void wwm_arena_usage(struct wwm_arena_usage *usage);
+
+/* the hooks of wwm_alloc.h */
+void *wwm_lib_malloc(size_t size);
+void *wwm_lib_calloc(size_t count, size_t size);
+void *wwm_lib_realloc(void *ptr, size_t size);
+void wwm_lib_free(void *ptr);
+
+#endif /* WWM_ARENA_H */
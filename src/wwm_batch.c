@@ -0,0 +1,278 @@
+/*
+ * wwm_batch.c -- many midi to wav conversions on a pool of threads
+ *
+ * Native only, the browser runs one conversion per worker instead.
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "wwm.h"
+#include "wwm_adpcm.h"
+#include "wwm_batch.h"
+#include "wwm_export.h"
+#include "wwm_flac.h"
+#include "wwm_wav.h"
+
+#define CHUNK_FRAMES 4096
+
+struct wwm_batch {
+    pthread_mutex_t lock;
+    pthread_cond_t queued;
+    struct wwm_job *head;
+    struct wwm_job *tail;
+    int closing;
+    int failed;
+
+    wwm_job_done done;
+    void *arg;
+
+    int threads;
+    pthread_t tids[WWM_EXPORT_MAX_THREADS];
+};
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static int write_file(void *ctx, const uint8_t *data, uint32_t size) {
+    return (fwrite(data, size, 1, ctx) == 1) ? 0 : -1;
+}
+
+/* the header of any format, sizes are filled at the end */
+static int write_header(FILE *out, wwm_flac *flac, wwm_adpcm *adpcm, uint32_t frames) {
+    uint8_t hdr[WWM_ADPCM_HEADER_SIZE > WWM_FLAC_HEADER_SIZE ? WWM_ADPCM_HEADER_SIZE : WWM_FLAC_HEADER_SIZE];
+    uint32_t size = WWM_WAV_HEADER_SIZE;
+
+    if (flac) {
+        wwm_flac_header(flac, hdr);
+        size = WWM_FLAC_HEADER_SIZE;
+    } else if (adpcm) {
+        wwm_adpcm_header(adpcm, hdr);
+        size = WWM_ADPCM_HEADER_SIZE;
+    } else {
+        wwm_wav_header(hdr, wwm_rate(), frames * 4);
+    }
+    return write_file(out, hdr, size);
+}
+
+/* streams the song into out_file (*.flac, *.adpcm.wav or wav), returns frames written or -1 */
+static int64_t render_file(midi *handle, const char *out_file) {
+    int16_t chunk[CHUNK_FRAMES * 2];
+    uint32_t frames = 0, total;
+    wwm_flac *flac = NULL;
+    wwm_adpcm *adpcm = NULL;
+    FILE *out;
+    int res;
+
+    out = fopen(out_file, "wb");
+    if (out == NULL) {
+        perror(out_file);
+        return (-1);
+    }
+    if (wwm_flac_filename(out_file)) {
+        flac = wwm_flac_new(wwm_rate(), write_file, out);
+        if (flac == NULL)
+            goto fail;
+    } else if (wwm_adpcm_filename(out_file)) {
+        adpcm = wwm_adpcm_new(wwm_rate(), write_file, out);
+        if (adpcm == NULL)
+            goto fail;
+    }
+
+    if (write_header(out, flac, adpcm, 0) == -1)
+        goto fail;
+
+    /* like the player, stop at the length libWildMidi estimated */
+    total = WildMidi_GetInfo(handle)->approx_total_samples;
+    while (frames < total) {
+        uint32_t count = total - frames;
+        if (count > CHUNK_FRAMES)
+            count = CHUNK_FRAMES;
+
+        res = WildMidi_GetOutput(handle, (int8_t *) chunk, count * 4);
+        if (res < 0)
+            goto fail;
+        if (res == 0)
+            break;
+
+        if (flac) {
+            if (wwm_flac_write(flac, chunk, res / 4) == -1)
+                goto fail;
+        } else if (adpcm) {
+            if (wwm_adpcm_write(adpcm, chunk, res / 4) == -1)
+                goto fail;
+        } else {
+            wwm_wav_swap(chunk, res / 2);
+            if (write_file(out, (uint8_t *) chunk, res) == -1)
+                goto fail;
+        }
+        frames += res / 4;
+    }
+
+    if (flac && wwm_flac_finish(flac) == -1)
+        goto fail;
+    if (adpcm && wwm_adpcm_finish(adpcm) == -1)
+        goto fail;
+    if (fseek(out, 0, SEEK_SET) != 0 || write_header(out, flac, adpcm, frames) == -1)
+        goto fail;
+
+    wwm_flac_free(flac);
+    wwm_adpcm_free(adpcm);
+    if (fclose(out) != 0) {
+        perror(out_file);
+        return (-1);
+    }
+    return (frames);
+
+fail:
+    perror(out_file);
+    wwm_flac_free(flac);
+    wwm_adpcm_free(adpcm);
+    fclose(out);
+    return (-1);
+}
+
+static struct wwm_job *next_job(wwm_batch *batch) {
+    struct wwm_job *job;
+
+    pthread_mutex_lock(&batch->lock);
+    while (batch->head == NULL && !batch->closing)
+        pthread_cond_wait(&batch->queued, &batch->lock);
+
+    job = batch->head;
+    if (job) {
+        batch->head = job->next;
+        if (batch->head == NULL)
+            batch->tail = NULL;
+    }
+    pthread_mutex_unlock(&batch->lock);
+    return (job);
+}
+
+static void *batch_thread(void *arg) {
+    wwm_batch *batch = arg;
+    struct wwm_job *job;
+    midi *retired = NULL;
+
+    while ((job = next_job(batch)) != NULL) {
+        double start = now_ms();
+        midi *handle = wwm_open_handle(job->midi_file);
+        int64_t frames = -1;
+
+        /* after the open, so shared patches are not unloaded in between */
+        wwm_close_handle(retired);
+        retired = handle;
+
+        if (handle)
+            frames = render_file(handle, job->wav_file);
+
+        job->status = frames < 0 ? -1 : 0;
+        job->frames = frames < 0 ? 0 : (uint32_t) frames;
+        job->wall_ms = now_ms() - start;
+
+        pthread_mutex_lock(&batch->lock);
+        if (job->status)
+            batch->failed++;
+        if (batch->done)
+            batch->done(job, batch->arg);
+        pthread_mutex_unlock(&batch->lock);
+
+        free(job->midi_file);
+        free(job->wav_file);
+        free(job);
+    }
+
+    wwm_close_handle(retired);
+    return (NULL);
+}
+
+wwm_batch *wwm_batch_start(int threads, wwm_job_done done, void *arg) {
+    wwm_batch *batch;
+    int i;
+
+    if (!wwm_initialized())
+        return (NULL);
+
+    batch = calloc(1, sizeof(*batch));
+    if (batch == NULL)
+        return (NULL);
+
+    pthread_mutex_init(&batch->lock, NULL);
+    pthread_cond_init(&batch->queued, NULL);
+    batch->done = done;
+    batch->arg = arg;
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > WWM_EXPORT_MAX_THREADS)
+        threads = WWM_EXPORT_MAX_THREADS;
+
+    for (i = 0; i < threads; i++) {
+        if (pthread_create(&batch->tids[i], NULL, batch_thread, batch) != 0)
+            break;
+    }
+    batch->threads = i;
+
+    if (batch->threads == 0) {
+        fprintf(stderr, "Error: cannot start batch threads\r\n");
+        pthread_cond_destroy(&batch->queued);
+        pthread_mutex_destroy(&batch->lock);
+        free(batch);
+        return (NULL);
+    }
+    return (batch);
+}
+
+int wwm_batch_add(wwm_batch *batch, const char *midi_file, const char *wav_file) {
+    struct wwm_job *job;
+
+    job = calloc(1, sizeof(*job));
+    if (job == NULL)
+        return (-1);
+
+    job->midi_file = strdup(midi_file);
+    job->wav_file = strdup(wav_file);
+    if (job->midi_file == NULL || job->wav_file == NULL) {
+        free(job->midi_file);
+        free(job->wav_file);
+        free(job);
+        return (-1);
+    }
+
+    pthread_mutex_lock(&batch->lock);
+    if (batch->tail)
+        batch->tail->next = job;
+    else
+        batch->head = job;
+    batch->tail = job;
+    pthread_cond_signal(&batch->queued);
+    pthread_mutex_unlock(&batch->lock);
+    return (0);
+}
+
+int wwm_batch_finish(wwm_batch *batch) {
+    int failed, i;
+
+    pthread_mutex_lock(&batch->lock);
+    batch->closing = 1;
+    pthread_cond_broadcast(&batch->queued);
+    pthread_mutex_unlock(&batch->lock);
+
+    for (i = 0; i < batch->threads; i++)
+        pthread_join(batch->tids[i], NULL);
+
+    failed = batch->failed;
+    pthread_cond_destroy(&batch->queued);
+    pthread_mutex_destroy(&batch->lock);
+    free(batch);
+    return (failed);
+}
@@ -0,0 +1,43 @@
+/*
+ * wwm_batch.h -- many midi to wav conversions on a pool of threads
+ *
+ * Jobs are queued with wwm_batch_add (while the batch runs, eg. from a
+ * stdin job list) and rendered by N threads sharing the one synth of
+ * wwm_init. libWildMidi keeps a single patch table, a patch loaded for one
+ * job is used read-only by every job that plays it. Each thread closes its
+ * previous song only after opening the next, so patches consecutive songs
+ * share stay loaded.
+ */
+
+#ifndef WWM_BATCH_H
+#define WWM_BATCH_H
+
+#include <stdint.h>
+
+struct wwm_job {
+    char *midi_file;
+    char *wav_file;
+    int status;     /* 0 ok, -1 failed */
+    uint32_t frames;
+    double wall_ms;
+    struct wwm_job *next;
+};
+
+typedef struct wwm_batch wwm_batch;
+
+/* called on the rendering thread for every finished job, one at a time */
+typedef void (*wwm_job_done)(const struct wwm_job *job, void *arg);
+
+/* needs wwm_init, NULL on failure */
+wwm_batch *wwm_batch_start(int threads, wwm_job_done done, void *arg);
+
+/*
+ * queues a conversion, wav_file may also be a *.flac. An existing file is
+ * overwritten.
+ */
+int wwm_batch_add(wwm_batch *batch, const char *midi_file, const char *wav_file);
+
+/* waits for every queued job, returns the number of failed ones */
+int wwm_batch_finish(wwm_batch *batch);
+
+#endif /* WWM_BATCH_H */
@@ -0,0 +1,1307 @@
+/*
+ * wwm_bench.c -- offline render benchmark for the native build of wildwebmidi
+ *
+ * Renders a fixed corpus of midis through wildwebmidi() as fast as possible
+ * (the same wildwebmidi_step chunks the browser worker drives) and reports the
+ * throughput of every file as json, so changes to the player can be compared
+ * against a recorded baseline.
+ *
+ *   node make native
+ *   ./wwm_bench -c freepats/freepats.cfg > baseline.json
+ *   perf record ./wwm_bench -c freepats/freepats.cfg -r 5 -o /dev/null
+ *   ./wwm_bench -b freepats-44100.bank   (patches from a wwm_mkbank bank)
+ *   ./wwm_bench -k                  (SIMD kernels against the scalar ones)
+ *   ./wwm_bench -x                  (the synth's output against libWildMidi's own loop)
+ *   ./wwm_bench -p low-latency -R 48000   (chunk size profile and rate)
+ *   ./wwm_bench -s 500              (heap use over 500 track changes)
+ *   ./wwm_bench -m a.mid b.mid      (all files at once through wwm_mixer)
+ *   ./wwm_bench -l 10               (live input latency over 10 seconds)
+ *   ./wwm_bench -g 0                (the files as a gapless playlist, no crossfade)
+ *   ./wwm_bench -e light            (render with a reverb tier)
+ *   ./wwm_bench -v                  (what every reverb tier costs)
+ *   ./wwm_bench -C 8192             (the synth with an 8 MB one-shot cache against without)
+ *   ./wwm_bench -P                  (memory of the patches the files load, shared across slots)
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+/* the reverb api and the config's room, in the order internal_midi.c includes them */
+#include "common.h"
+#include "reverb.h"
+#include "internal_midi.h"
+
+#include "wildwebmidi.h"
+#include "wwm.h"
+#include "wwm_arena.h"
+#include "wwm_export.h"
+#include "wwm_live.h"
+#include "wwm_mixer.h"
+#include "wwm_patbank.h"
+#include "wwm_pcm.h"
+#include "wwm_reverb.h"
+#include "wwm_synth.h"
+
+/* the demo playlist of index.html */
+static char *corpus[] = {
+    "freepats/deb_clai.mid",
+    "freepats/ff3chocobo.mid",
+    "freepats/etude_10_4_(c)finley.mid",
+    "freepats/chpn_op66.mid",
+    "freepats/liz_et3.mid",
+    "freepats/TOCATTA.MID",
+    "freepats/ENTERTNR.MID",
+    "freepats/STRIVING.MID",
+    "freepats/Super_Mario_Bros_-_Overworld_Theme_by_BlueSCD.mid",
+    "freepats/prelude.mid",
+    "freepats/melodies_of_life.mid",
+};
+
+/*
+ Host hooks: no commands, the buffer always has room, just keep count.
+ The live latency test (-l) plays into a simulated audio device instead.
+ */
+static int conversion_status;
+static int completions;
+
+/* streaming output, converted like it is for web audio */
+#define OUTPUT_FRAMES 4096
+
+/* the songs of the gapless test (-g) rendered on their own, to check the stream against */
+static struct {
+    int on;
+    int16_t *song[2];    /* the playing one and the next */
+    int16_t *played;     /* freed outside of the timed steps */
+    uint32_t length[2];
+    uint32_t pos;
+    uint64_t mismatched; /* frames */
+    float left[OUTPUT_FRAMES];
+    float right[OUTPUT_FRAMES];
+} splice;
+
+static struct {
+    int on;
+    double start_ms;     /* when it played its first quantum */
+    int capacity;        /* ring frames, what the live profile queues */
+    uint64_t written;
+    uint64_t underruns;
+} device;
+
+static unsigned int bench_rate = WWM_DEFAULT_RATE;
+
+static double now_ms(void);
+
+/* the AudioWorklet's render quantum */
+#define DEVICE_QUANTUM 128
+
+/* frames played by now, in whole quanta */
+static uint64_t device_played(void) {
+    uint64_t quanta = (uint64_t) ((now_ms() - device.start_ms) * bench_rate / 1000.0 / DEVICE_QUANTUM);
+    return quanta * DEVICE_QUANTUM;
+}
+
+static int device_space(void) {
+    uint64_t played = device_played();
+
+    /* a quantum with nothing queued plays silence, the ring starts over */
+    if (played > device.written) {
+        device.underruns += (played - device.written + DEVICE_QUANTUM - 1) / DEVICE_QUANTUM;
+        device.written = played;
+    }
+    return device.capacity - (int) (device.written - played);
+}
+
+int host_buffer_space(void) {
+    return device.on ? device_space() : INT_MAX;
+}
+
+void host_wait_for_demand(int frames) {
+    struct timespec ts = { 0, 250000 };
+
+    while (device.on && device_space() < frames)
+        nanosleep(&ts, NULL);
+}
+
+static void check_splice(const float *left, const float *right, int frames) {
+    int i = 0;
+
+    while (i < frames && splice.song[0] != NULL) {
+        int count = frames - i;
+        int j;
+
+        if (splice.pos == splice.length[0]) {
+            free(splice.played);
+            splice.played = splice.song[0];
+            splice.song[0] = splice.song[1];
+            splice.length[0] = splice.length[1];
+            splice.song[1] = NULL;
+            splice.pos = 0;
+            continue;
+        }
+        if ((uint32_t) count > splice.length[0] - splice.pos)
+            count = (int) (splice.length[0] - splice.pos);
+
+        wwm_s16_to_f32(splice.song[0] + splice.pos * 2, splice.left, splice.right, count);
+        for (j = 0; j < count; j++)
+            splice.mismatched += splice.left[j] != left[i + j] || splice.right[j] != right[i + j];
+        splice.pos += count;
+        i += count;
+    }
+    /* past the last song */
+    splice.mismatched += frames - i;
+}
+
+void host_process_audio(float *left, float *right, int frames) {
+    if (splice.on)
+        check_splice(left, right, frames);
+    device.written += frames;
+}
+
+void host_complete_conversion(int status) {
+    conversion_status = status;
+    completions++;
+}
+
+static float output_left[OUTPUT_FRAMES];
+static float output_right[OUTPUT_FRAMES];
+
+static double cpu_ms(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0
+         + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/*
+ opens a report with the library its numbers are of, a report is only
+ comparable against one of the same
+ */
+static void report_open(FILE *out) {
+    long version = WildMidi_GetVersion();
+
+    fprintf(out, "{\n  \"libwildmidi\": \"%ld.%ld.%ld\",\n",
+            (version >> 16) & 255, (version >> 8) & 255, version & 255);
+}
+
+static void json_string(FILE *out, const char *str) {
+    fputc('"', out);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            fputc('\\', out);
+        fputc(*str, out);
+    }
+    fputc('"', out);
+}
+
+static void json_stats(FILE *out, uint64_t samples, double wall_ms, double cpu) {
+    double audio_secs = (double) samples / bench_rate;
+    double wall_secs = wall_ms / 1000.0;
+
+    fprintf(out, "\"samples\": %llu, \"audio_secs\": %.3f, \"wall_ms\": %.3f, "
+                 "\"realtime_factor\": %.2f, \"samples_per_sec\": %.0f, "
+                 "\"cpu_ms\": %.3f, \"cpu_per_audio_sec_ms\": %.3f",
+            (unsigned long long) samples, audio_secs, wall_ms,
+            wall_secs > 0 ? audio_secs / wall_secs : 0,
+            wall_secs > 0 ? samples / wall_secs : 0,
+            cpu, audio_secs > 0 ? cpu / audio_secs : 0);
+}
+
+/*
+ Kernel check: every SIMD kernel set this cpu runs has to match the scalar
+ one bit for bit, on lengths that also exercise the leftover frames.
+ */
+#define KERNEL_FRAMES 4096
+#define KERNEL_ROUNDS 2000
+#define KERNEL_TAPS 35 /* libWildMidi's gauss window */
+
+static int16_t kernel_in[KERNEL_FRAMES * 2];
+static int32_t kernel_mix_in[KERNEL_FRAMES * 2];
+static int32_t kernel_mix[2][KERNEL_FRAMES * 2];
+static int16_t kernel_s16[2][KERNEL_FRAMES * 2];
+static float kernel_f32[2][2][KERNEL_FRAMES];
+static int32_t kernel_premix[2][KERNEL_FRAMES];
+static double kernel_gauss[1024 * KERNEL_TAPS];
+
+static void kernel_input(void) {
+    int i;
+
+    srand(1);
+    for (i = 0; i < KERNEL_FRAMES * 2; i++) {
+        kernel_in[i] = (int16_t) (rand() & 0xffff);
+        /* half of them beyond int16, to be clamped */
+        kernel_mix_in[i] = (rand() & 0x1ffff) - 0x10000;
+    }
+    kernel_in[0] = -32768;
+    kernel_in[1] = 32767;
+    for (i = 0; i < 1024 * KERNEL_TAPS; i++)
+        kernel_gauss[i] = (double) rand() / RAND_MAX - 0.5;
+}
+
+/*
+ * A note somewhere in kernel_in, the window before it included, stepping
+ * up to 2 samples a frame with its envelope level kept in range. The
+ * timed one steps 1.5 samples a frame and rises slowly.
+ */
+static struct wwm_voice kernel_voice(int timed) {
+    struct wwm_voice voice;
+
+    voice.data = kernel_in + KERNEL_TAPS;
+    voice.pos = timed ? 0 : (uint32_t) rand() % (1024 << 10);
+    voice.inc = timed ? 1536 : (uint32_t) rand() % 2048;
+    voice.env = timed ? 1 << 20 : 300000 + rand() % 3800000;
+    voice.env_inc = timed ? 256 : rand() % 8193 - 4096;
+    return (voice);
+}
+
+static int kernel_matches(const struct wwm_pcm_kernels *ref, const struct wwm_pcm_kernels *k) {
+    int16_t gains[] = { -32768, -1, 0, 1, WWM_GAIN_UNITY, 32767 };
+    int frames, g;
+
+    for (frames = 0; frames <= 67; frames++) {
+        ref->s16_to_f32(kernel_in, kernel_f32[0][0], kernel_f32[0][1], frames);
+        k->s16_to_f32(kernel_in, kernel_f32[1][0], kernel_f32[1][1], frames);
+        if (memcmp(kernel_f32[0][0], kernel_f32[1][0], frames * sizeof(float)) != 0
+                || memcmp(kernel_f32[0][1], kernel_f32[1][1], frames * sizeof(float)) != 0)
+            return (0);
+
+        ref->mix_to_s16(kernel_mix_in, kernel_s16[0], frames);
+        k->mix_to_s16(kernel_mix_in, kernel_s16[1], frames);
+        if (memcmp(kernel_s16[0], kernel_s16[1], frames * 4) != 0)
+            return (0);
+
+        for (g = 0; g < (int) (sizeof(gains) / sizeof(gains[0])); g++) {
+            int16_t gain_r = (int16_t) (rand() & 0xffff);
+
+            memcpy(kernel_mix[0], kernel_mix_in, frames * 8);
+            memcpy(kernel_mix[1], kernel_mix_in, frames * 8);
+            ref->mix_s16(kernel_mix[0], kernel_in, frames, gains[g], gain_r);
+            k->mix_s16(kernel_mix[1], kernel_in, frames, gains[g], gain_r);
+            if (memcmp(kernel_mix[0], kernel_mix[1], frames * 8) != 0)
+                return (0);
+        }
+
+        for (g = 0; g < 8; g++) {
+            struct wwm_voice voice = kernel_voice(0);
+            int32_t left = rand() % 1100 - 50, right = rand() % 1100;
+
+            ref->voice_linear(kernel_premix[0], &voice, frames);
+            k->voice_linear(kernel_premix[1], &voice, frames);
+            if (memcmp(kernel_premix[0], kernel_premix[1], frames * sizeof(int32_t)) != 0)
+                return (0);
+
+            ref->voice_gauss(kernel_premix[0], &voice, kernel_gauss, KERNEL_TAPS, frames);
+            k->voice_gauss(kernel_premix[1], &voice, kernel_gauss, KERNEL_TAPS, frames);
+            if (memcmp(kernel_premix[0], kernel_premix[1], frames * sizeof(int32_t)) != 0)
+                return (0);
+
+            memcpy(kernel_mix[0], kernel_mix_in, frames * 8);
+            memcpy(kernel_mix[1], kernel_mix_in, frames * 8);
+            ref->voice_mix(kernel_mix[0], kernel_premix[0], frames, left, right);
+            k->voice_mix(kernel_mix[1], kernel_premix[0], frames, left, right);
+            if (memcmp(kernel_mix[0], kernel_mix[1], frames * 8) != 0)
+                return (0);
+        }
+    }
+    return (1);
+}
+
+/* ns per frame of one kernel call, over KERNEL_ROUNDS chunks */
+#define KERNEL_TIME(ns, call) do { \
+        double start = now_ms(); \
+        int r; \
+        for (r = 0; r < KERNEL_ROUNDS; r++) \
+            call; \
+        ns = (now_ms() - start) * 1e6 / ((double) KERNEL_ROUNDS * KERNEL_FRAMES); \
+    } while (0)
+
+static int check_kernels(FILE *out) {
+    const struct wwm_pcm_kernels *sets[8];
+    int count = wwm_pcm_kernel_sets(sets, 8);
+    int failed = 0, i;
+    struct wwm_voice voice;
+    double ns;
+
+    kernel_input();
+    voice = kernel_voice(1);
+    fprintf(out, "{\n  \"frames\": %d,\n  \"kernels\": [\n", KERNEL_FRAMES);
+    for (i = 0; i < count; i++) {
+        const struct wwm_pcm_kernels *k = sets[i];
+        int exact = kernel_matches(sets[0], k);
+
+        failed += !exact;
+        fprintf(out, "    { \"name\": \"%s\", \"exact\": %s", k->name, exact ? "true" : "false");
+
+        KERNEL_TIME(ns, k->s16_to_f32(kernel_in, kernel_f32[0][0], kernel_f32[0][1], KERNEL_FRAMES));
+        fprintf(out, ", \"s16_to_f32_ns\": %.3f", ns);
+        KERNEL_TIME(ns, k->mix_s16(kernel_mix[0], kernel_in, KERNEL_FRAMES, WWM_GAIN_UNITY / 2, WWM_GAIN_UNITY / 3));
+        fprintf(out, ", \"mix_s16_ns\": %.3f", ns);
+        KERNEL_TIME(ns, k->mix_to_s16(kernel_mix_in, kernel_s16[0], KERNEL_FRAMES));
+        fprintf(out, ", \"mix_to_s16_ns\": %.3f", ns);
+        KERNEL_TIME(ns, k->voice_linear(kernel_premix[0], &voice, KERNEL_FRAMES));
+        fprintf(out, ", \"voice_linear_ns\": %.3f", ns);
+        KERNEL_TIME(ns, k->voice_gauss(kernel_premix[0], &voice, kernel_gauss, KERNEL_TAPS, KERNEL_FRAMES));
+        fprintf(out, ", \"voice_gauss_ns\": %.3f", ns);
+        KERNEL_TIME(ns, k->voice_mix(kernel_mix[0], kernel_premix[0], KERNEL_FRAMES, 700, 300));
+        fprintf(out, ", \"voice_mix_ns\": %.3f }%s\n", ns, (i + 1 < count) ? "," : "");
+    }
+    fprintf(out, "  ],\n  \"in_use\": \"%s\"\n}\n", sets[count - 1]->name);
+
+    if (failed)
+        fprintf(stderr, "wwm_bench: %d kernel set(s) differ from scalar\n", failed);
+    return (failed ? 1 : 0);
+}
+
+/*
+ Reverb cost: every tier of wwm_reverb.h run over REVERB_SECONDS of noise
+ in the chunks of the low-latency profile, as ns per frame and the share
+ of one core it takes to keep up at the bench rate.
+ */
+#define REVERB_SECONDS 20
+#define REVERB_CHUNK 256
+
+static int reverb_cost(FILE *out) {
+    int32_t *noise = malloc((size_t) bench_rate * 2 * sizeof(int32_t));
+    int32_t chunk[REVERB_CHUNK * 2];
+    uint32_t frames = bench_rate * REVERB_SECONDS, i;
+    int tier;
+
+    if (noise == NULL)
+        return (1);
+    srand(1);
+    for (i = 0; i < bench_rate * 2; i++)
+        noise[i] = (rand() & 0x7fff) - 0x4000;
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"chunk_frames\": %d,\n  \"tiers\": [\n", bench_rate, REVERB_CHUNK);
+    for (tier = 0; tier < WWM_REVERB_TIERS; tier++) {
+        struct _rvb *rvb;
+        double start, setup_ms, ns;
+
+        wwm_reverb_set_tier(tier);
+        start = now_ms();
+        rvb = _WM_init_reverb(bench_rate, _WM_reverb_room_width, _WM_reverb_room_length,
+                              _WM_reverb_listen_posx, _WM_reverb_listen_posy);
+        setup_ms = now_ms() - start;
+        if (rvb == NULL) {
+            fprintf(stderr, "wwm_bench: no memory for the %s reverb\n", wwm_reverb_name(tier));
+            free(noise);
+            return (1);
+        }
+
+        start = now_ms();
+        for (i = 0; i < frames; i += REVERB_CHUNK) {
+            memcpy(chunk, noise + (i % (bench_rate - REVERB_CHUNK)) * 2, sizeof(chunk));
+            _WM_do_reverb(rvb, chunk, REVERB_CHUNK * 2);
+        }
+        ns = (now_ms() - start) * 1e6 / frames;
+        _WM_free_reverb(rvb);
+
+        fprintf(out, "    { \"name\": \"%s\", \"setup_ms\": %.3f, \"ns_per_frame\": %.3f, "
+                     "\"cpu_percent\": %.3f }%s\n",
+                wwm_reverb_name(tier), setup_ms, ns, ns * bench_rate / 1e7,
+                (tier + 1 < WWM_REVERB_TIERS) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    free(noise);
+    return (0);
+}
+
+/*
+ Soak: change tracks the way a listener skipping through the playlist does,
+ a few chunks into every song, and sample the heap after every round of the
+ corpus. With songs in arenas it has to stay flat after the first round,
+ growing more than SOAK_MAX_GROWTH_KB after it fails the soak.
+ */
+#define SOAK_STEPS 8
+#define SOAK_MAX_GROWTH_KB 256
+
+static size_t heap_in_use(void) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+    return (size_t) (unsigned int) mallinfo().uordblks;
+#else
+    return 0;
+#endif
+}
+
+static int soak(FILE *out, char **files, int file_count, int changes) {
+    struct wwm_arena_usage usage;
+    size_t first = 0, heap = 0, peak = 0;
+    long growth_kb;
+    int n, step, failed = 0;
+
+    report_open(out);
+    fprintf(out, "  \"changes\": %d,\n  \"rounds\": [\n", changes);
+    for (n = 0; n < changes; n++) {
+        if (wildwebmidi_start(files[n % file_count], "") == -1) {
+            failed++;
+        } else {
+            for (step = 0; step < SOAK_STEPS; step++) {
+                if (wildwebmidi_step() == WWM_STEP_DONE)
+                    break;
+            }
+            if (step == SOAK_STEPS) {
+                wildwebmidi_command(WWM_CMD_STOP, 0);
+                wildwebmidi_step();
+            }
+        }
+
+        if ((n + 1) % file_count != 0 && n + 1 != changes)
+            continue;
+
+        heap = heap_in_use();
+        if (first == 0)
+            first = heap;
+        if (heap > peak)
+            peak = heap;
+        wwm_arena_usage(&usage);
+        fprintf(out, "    { \"changes\": %d, \"heap_kb\": %zu, \"arenas\": %zu, "
+                     "\"arena_kb\": %zu, \"pool_kb\": %zu }%s\n",
+                n + 1, heap / 1024, usage.arenas, usage.live_bytes / 1024,
+                usage.pool_bytes / 1024, (n + 1 < changes) ? "," : "");
+    }
+    /* growth after the first round has warmed the pool and patch cache */
+    growth_kb = ((long) heap - (long) first) / 1024;
+    fprintf(out, "  ],\n  \"failed\": %d,\n  \"heap_growth_kb\": %ld,\n  \"max_growth_kb\": %d,\n"
+                 "  \"peak_heap_kb\": %zu\n}\n",
+            failed, growth_kb, SOAK_MAX_GROWTH_KB, peak / 1024);
+    if (growth_kb > SOAK_MAX_GROWTH_KB)
+        fprintf(stderr, "wwm_bench: the heap grew %ld KB after the first round\n", growth_kb);
+    return (failed || growth_kb > SOAK_MAX_GROWTH_KB ? 1 : 0);
+}
+
+/*
+ Mix: every file a stream of one wwm_mixer, a second apart, rendered until
+ all have finished. Against the rendering of the same files one by one the
+ cost should follow the voices, not the number of streams.
+ */
+#define MIX_FRAMES 4096
+
+static int16_t mix_out[MIX_FRAMES * 2];
+
+static int mix(FILE *out, const char *config_file, char **files, int file_count) {
+    wwm_mixer *mixer;
+    uint32_t peak_voices = 0;
+    uint64_t samples = 0;
+    double start, cpu;
+    int i, playing, streams = 0;
+
+    if (wwm_init(config_file, bench_rate, 0) == -1)
+        return (1);
+    mixer = wwm_mixer_new(1);
+    if (mixer == NULL)
+        return (1);
+
+    for (i = 0; i < file_count && i < WWM_MIXER_STREAMS; i++) {
+        if (wwm_mixer_add(mixer, files[i], i * bench_rate) >= 0)
+            streams++;
+    }
+
+    cpu = cpu_ms();
+    start = now_ms();
+    do {
+        uint32_t voices;
+
+        wwm_mixer_render(mixer, mix_out, MIX_FRAMES);
+        samples += MIX_FRAMES;
+        voices = wwm_mixer_voices(mixer);
+        if (voices > peak_voices)
+            peak_voices = voices;
+
+        for (playing = 0, i = 0; i < WWM_MIXER_STREAMS; i++)
+            playing += wwm_mixer_playing(mixer, i);
+    } while (playing);
+    cpu = cpu_ms() - cpu;
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"streams\": %d,\n  \"mix\": { ", bench_rate, streams);
+    json_stats(out, samples, now_ms() - start, cpu);
+    fprintf(out, ", \"peak_voices\": %u }\n}\n", peak_voices);
+
+    wwm_mixer_free(mixer);
+    return (streams == file_count ? 0 : 1);
+}
+
+/*
+ Gapless playlist: the files stream as one playlist, every next one queued
+ as soon as the one before starts playing. The stream must hold all songs
+ back to back, less the crossfades, and without a crossfade it must be the
+ songs rendered on their own, sample for sample. The steps around the
+ transitions are timed against the rest.
+ */
+static int queue_next(const char *midi_file, uint32_t *length) {
+    *length = wwm_song_length(midi_file);
+    if (splice.on) {
+        free(splice.played);
+        splice.played = NULL;
+        splice.song[1] = malloc((size_t) *length * 4);
+        if (splice.song[1] == NULL || wwm_render_segment(midi_file, 0, *length, splice.song[1]) < 0)
+            return (-1);
+        splice.length[1] = *length;
+    }
+    return wildwebmidi_queue((char *) midi_file);
+}
+
+static int gapless(FILE *out, char **files, int file_count, int crossfade_ms) {
+    uint32_t fade = (uint32_t) ((uint64_t) bench_rate * crossfade_ms / 1000);
+    uint64_t expected, steps = 0;
+    double step_ms, sum_ms = 0, max_ms = 0, max_transition_ms = 0;
+    struct wwm_telemetry telemetry;
+    uint32_t song, length;
+    int switches = 0, queued = 0;
+    int res = 0;
+
+    wildwebmidi_set_crossfade(crossfade_ms);
+    splice.on = crossfade_ms == 0;
+    completions = 0;
+    conversion_status = 0;
+    device.written = 0;
+
+    if (wildwebmidi_start(files[0], "") == -1)
+        return (1);
+    wildwebmidi_telemetry_read(&telemetry);
+    song = telemetry.song;
+    expected = telemetry.total_samples;
+    if (splice.on) {
+        splice.song[0] = malloc((size_t) expected * 4);
+        if (splice.song[0] == NULL || wwm_render_segment(files[0], 0, (uint32_t) expected, splice.song[0]) < 0)
+            return (1);
+        splice.length[0] = (uint32_t) expected;
+        splice.pos = 0;
+        splice.mismatched = 0;
+    }
+
+    for (;;) {
+        if (queued + 1 < file_count && queued == switches) {
+            if (queue_next(files[++queued], &length) == -1)
+                return (1);
+            expected += length - (fade < length ? fade : length);
+        }
+
+        step_ms = now_ms();
+        res = wildwebmidi_step();
+        step_ms = now_ms() - step_ms;
+        if (res == WWM_STEP_DONE)
+            break;
+
+        sum_ms += step_ms;
+        steps++;
+        if (step_ms > max_ms)
+            max_ms = step_ms;
+        wildwebmidi_telemetry_read(&telemetry);
+        if (telemetry.song != song) {
+            song = telemetry.song;
+            switches++;
+            if (step_ms > max_transition_ms)
+                max_transition_ms = step_ms;
+        }
+    }
+    splice.on = 0;
+    free(splice.song[0]);
+    free(splice.song[1]);
+    free(splice.played);
+    splice.song[0] = splice.song[1] = splice.played = NULL;
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"crossfade_ms\": %d,\n  \"songs\": %d,\n  \"switches\": %d,\n"
+                 "  \"completions\": %d,\n  \"frames\": %llu,\n  \"expected_frames\": %llu,\n",
+            bench_rate, crossfade_ms, file_count, switches, completions,
+            (unsigned long long) device.written, (unsigned long long) expected);
+    if (crossfade_ms == 0)
+        fprintf(out, "  \"mismatched_frames\": %llu,\n", (unsigned long long) splice.mismatched);
+    fprintf(out, "  \"mean_step_ms\": %.3f,\n  \"max_step_ms\": %.3f,\n  \"max_transition_step_ms\": %.3f\n}\n",
+            steps ? sum_ms / steps : 0, max_ms, max_transition_ms);
+
+    return (switches == file_count - 1 && completions == 1 && conversion_status == 0
+            && device.written == expected && (crossfade_ms != 0 || splice.mismatched == 0) ? 0 : 1);
+}
+
+/*
+ Live latency: a player thread sends note ons every 3 - 20 ms, due at once
+ (frame 0), so each is applied at the start of the first chunk rendered
+ after it arrived. Its latency is from the moment it was sent to the
+ device playing that frame, where the note starts: the wait for a chunk,
+ the ring and the device quantum as they turn out, nothing assumed.
+ wwm_worker.js stamps Web MIDI input one ring ahead instead, for sample
+ exact timing at a fixed latency, this is what that has to cover. The
+ player thread also polls the telemetry the way the page does, the
+ position it reads must never go back. In the browser Web MIDI delivery
+ and the audio context's output latency come on top.
+ */
+#define LIVE_EVENTS 4096
+#define LIVE_TARGET_MS 10.0
+
+static struct {
+    volatile int running;
+    int sent;            /* events stamped and queued, atomic */
+    double sent_ms[LIVE_EVENTS];
+    uint32_t reads;
+    uint32_t backwards;
+} player;
+
+static void *live_player(void *arg) {
+    struct wwm_telemetry telemetry;
+    uint32_t position = 0;
+    unsigned int seed = 1;
+    int n = 0;
+    (void) arg;
+
+    while (player.running && n < LIVE_EVENTS) {
+        struct timespec ts = { 0, (3 + rand_r(&seed) % 18) * 1000000L };
+
+        nanosleep(&ts, NULL);
+        wildwebmidi_telemetry_read(&telemetry);
+        if (telemetry.current_sample < position)
+            player.backwards++;
+        position = telemetry.current_sample;
+        player.reads++;
+
+        player.sent_ms[n] = now_ms();
+        if (wildwebmidi_live_event(0, 0x90 | (n % 16 == 9 ? 0 : n % 16), 36 + n % 48, 100) == 0)
+            __atomic_store_n(&player.sent, ++n, __ATOMIC_RELEASE);
+    }
+    return (NULL);
+}
+
+static int live_latency(FILE *out, int seconds) {
+    const struct wwm_profile *profile = wildwebmidi_find_profile("live");
+    uint32_t applied = 0;
+    double sum = 0, max = 0, until;
+    pthread_t thread;
+
+    wildwebmidi_configure(bench_rate, profile->chunk_frames);
+    if (wildwebmidi_start_live(NULL) == -1)
+        return (1);
+
+    device.on = 1;
+    device.capacity = profile->chunk_frames * profile->queue_chunks;
+    device.written = 0;
+    device.start_ms = now_ms();
+    player.sent = 0;
+    player.reads = 0;
+    player.backwards = 0;
+    player.running = 1;
+    pthread_create(&thread, NULL, live_player, NULL);
+
+    until = now_ms() + seconds * 1000.0;
+    while (now_ms() < until) {
+        const struct wwm_live_stats *live;
+        uint32_t clock = wildwebmidi_live_clock();
+        uint64_t chunk_start;
+        int res = wildwebmidi_step();
+
+        if (res == WWM_STEP_DONE)
+            break;
+        if (res == WWM_STEP_WAIT) {
+            host_wait_for_demand(profile->chunk_frames);
+            continue;
+        }
+
+        /* the device frame the chunk went to, after any underrun skipped ahead */
+        chunk_start = device.written - (uint32_t) res;
+        live = wildwebmidi_live_stats();
+        while (applied < live->events) {
+            double latency;
+
+            /* queued before the player published its stamp, that is a moment away */
+            while (__atomic_load_n(&player.sent, __ATOMIC_ACQUIRE) <= (int) applied)
+                sched_yield();
+
+            latency = device.start_ms + (chunk_start + live->last_frame - clock) * 1000.0 / bench_rate
+                    - player.sent_ms[applied];
+            sum += latency;
+            if (latency > max)
+                max = latency;
+            applied++;
+        }
+    }
+    player.running = 0;
+    pthread_join(thread, NULL);
+    wildwebmidi_command(WWM_CMD_STOP, 0);
+    wildwebmidi_step();
+    device.on = 0;
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"profile\": \"live\",\n  \"ring_frames\": %d,\n"
+                 "  \"quantum\": %d,\n  \"events\": %u,\n"
+                 "  \"underruns\": %llu,\n  \"latency_ms\": { \"mean\": %.3f, \"max\": %.3f },\n"
+                 "  \"target_ms\": %.1f,\n  \"telemetry\": { \"reads\": %u, \"backwards\": %u }\n}\n",
+            bench_rate, device.capacity, DEVICE_QUANTUM, applied,
+            (unsigned long long) device.underruns, applied ? sum / applied : 0, max, LIVE_TARGET_MS,
+            player.reads, player.backwards);
+    return (applied > 0 && max < LIVE_TARGET_MS && player.backwards == 0 ? 0 : 1);
+}
+
+/*
+ Synth check: every file rendered through WildMidi_GetOutput (wwm_synth.c)
+ and through libWildMidi's own loop, from two handles of the same song,
+ with gauss and with linear resampling, each with reverb off and on (the
+ synth runs the reverb a block at a time, the library on all it renders
+ in a call). A single sample apart fails it. Reports the render time of
+ both.
+ */
+#define EXACT_FRAMES 4096
+
+static int16_t exact_pcm[2][EXACT_FRAMES * 2];
+
+static int synth_check(FILE *out, const char *config_file, char **files, int file_count) {
+    static const uint16_t options[] = {
+        WM_MO_ENHANCED_RESAMPLING, 0, WM_MO_ENHANCED_RESAMPLING | WM_MO_REVERB, WM_MO_REVERB
+    };
+    double total_synth = 0, total_lib = 0;
+    int i, o, runs = 0, failed = 0;
+
+    if (wwm_init(config_file, bench_rate, 0) == -1)
+        return (1);
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"runs\": [\n", bench_rate);
+    for (i = 0; i < file_count; i++) {
+        for (o = 0; o < 4; o++) {
+            midi *synth = wwm_open_handle(files[i]);
+            midi *lib = wwm_open_handle(files[i]);
+            double synth_ms = 0, lib_ms = 0, start;
+            uint32_t frames = 0;
+            int exact = 1, res;
+
+            if (synth == NULL || lib == NULL) {
+                if (synth != NULL)
+                    wwm_close_handle(synth);
+                if (lib != NULL)
+                    wwm_close_handle(lib);
+                failed++;
+                continue;
+            }
+            WildMidi_SetOption(synth, WM_MO_ENHANCED_RESAMPLING | WM_MO_REVERB, options[o]);
+            WildMidi_SetOption(lib, WM_MO_ENHANCED_RESAMPLING | WM_MO_REVERB, options[o]);
+
+            do {
+                start = now_ms();
+                res = WildMidi_GetOutput(synth, (int8_t *) exact_pcm[0], EXACT_FRAMES * 4);
+                synth_ms += now_ms() - start;
+                start = now_ms();
+                exact = _WM_lib_GetOutput(lib, (int8_t *) exact_pcm[1], EXACT_FRAMES * 4) == res
+                        && (res <= 0 || memcmp(exact_pcm[0], exact_pcm[1], res) == 0);
+                lib_ms += now_ms() - start;
+                if (res > 0)
+                    frames += res / 4;
+            } while (exact && res > 0);
+
+            failed += !exact;
+            fprintf(out, "%s    { \"file\": ", runs++ ? ",\n" : "");
+            json_string(out, files[i]);
+            fprintf(out, ", \"resampling\": \"%s\", \"reverb\": %s, \"frames\": %u, \"exact\": %s, "
+                         "\"synth_ms\": %.3f, \"lib_ms\": %.3f }",
+                    (options[o] & WM_MO_ENHANCED_RESAMPLING) ? "gauss" : "linear",
+                    (options[o] & WM_MO_REVERB) ? "true" : "false", frames,
+                    exact ? "true" : "false", synth_ms, lib_ms);
+            if (!exact)
+                fprintf(stderr, "wwm_bench: %s%s differs from libWildMidi after %u frames\n", files[i],
+                        (options[o] & WM_MO_REVERB) ? " with reverb" : "", frames);
+            total_synth += synth_ms;
+            total_lib += lib_ms;
+            wwm_close_handle(synth);
+            wwm_close_handle(lib);
+        }
+    }
+    fprintf(out, "%s  ],\n  \"synth_ms\": %.3f,\n  \"lib_ms\": %.3f,\n  \"speedup\": %.2f\n}\n",
+            runs ? "\n" : "", total_synth, total_lib, total_synth > 0 ? total_lib / total_synth : 0.0);
+
+    wwm_shutdown();
+    return (failed ? 1 : 0);
+}
+
+/*
+ Rendered one-shots: every file with either resampling, rendered with the
+ cache off and then with it on, the two compared sample for sample. The
+ cache is emptied before every run so its hits are the run's own. Reports
+ how many one-shots were mixed from it, the share of their frames that
+ was, and the render time of both. Fails on any sample apart and when the
+ cache saved no time over all runs, it is not worth its lock then.
+ */
+static int16_t *cache_render(midi *handle, uint32_t *frames, double *ms) {
+    int16_t *pcm = NULL, *grown;
+    uint32_t room = 0;
+    double start;
+    int res;
+
+    *frames = 0;
+    *ms = 0;
+    do {
+        if (*frames + EXACT_FRAMES > room) {
+            room = room ? room * 2 : EXACT_FRAMES * 64;
+            grown = realloc(pcm, (size_t) room * 4);
+            if (grown == NULL) {
+                free(pcm);
+                return (NULL);
+            }
+            pcm = grown;
+        }
+        start = now_ms();
+        res = WildMidi_GetOutput(handle, (int8_t *) (pcm + *frames * 2), EXACT_FRAMES * 4);
+        *ms += now_ms() - start;
+        if (res > 0)
+            *frames += res / 4;
+    } while (res > 0);
+    return (pcm);
+}
+
+static int cache_check(FILE *out, const char *config_file, char **files, int file_count, int kb) {
+    static const uint16_t options[] = { WM_MO_ENHANCED_RESAMPLING, 0 };
+    double total_plain = 0, total_cached = 0;
+    int i, o, runs = 0, failed = 0;
+
+    if (wwm_init(config_file, bench_rate, 0) == -1)
+        return (1);
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"cache_kb\": %d,\n  \"runs\": [\n", bench_rate, kb);
+    for (i = 0; i < file_count; i++) {
+        for (o = 0; o < 2; o++) {
+            midi *plain = wwm_open_handle(files[i]);
+            midi *cached = wwm_open_handle(files[i]);
+            struct wwm_synth_cache_stats before, stats;
+            int16_t *pcm[2] = { NULL, NULL };
+            uint32_t frames[2] = { 0, 0 };
+            double ms[2] = { 0, 0 };
+            int exact;
+
+            if (plain != NULL && cached != NULL) {
+                /* reverb off, as for -x: it would only add the same time to both */
+                WildMidi_SetOption(plain, WM_MO_ENHANCED_RESAMPLING | WM_MO_REVERB, options[o]);
+                WildMidi_SetOption(cached, WM_MO_ENHANCED_RESAMPLING | WM_MO_REVERB, options[o]);
+                wwm_synth_set_cache(0);
+                pcm[0] = cache_render(plain, &frames[0], &ms[0]);
+                wwm_synth_set_cache((uint32_t) kb * 1024);
+                wwm_synth_cache_stats(&before);
+                pcm[1] = cache_render(cached, &frames[1], &ms[1]);
+                wwm_synth_cache_stats(&stats);
+                wwm_synth_set_cache(0);
+            }
+            if (plain != NULL)
+                wwm_close_handle(plain);
+            if (cached != NULL)
+                wwm_close_handle(cached);
+            if (pcm[0] == NULL || pcm[1] == NULL) {
+                free(pcm[0]);
+                free(pcm[1]);
+                failed++;
+                continue;
+            }
+
+            exact = frames[0] == frames[1] && memcmp(pcm[0], pcm[1], (size_t) frames[0] * 4) == 0;
+            failed += !exact;
+            stats.notes -= before.notes;
+            stats.hits -= before.hits;
+            stats.changed -= before.changed;
+            stats.frames -= before.frames;
+            stats.cached_frames -= before.cached_frames;
+            stats.evictions -= before.evictions;
+
+            fprintf(out, "%s    { \"file\": ", runs++ ? ",\n" : "");
+            json_string(out, files[i]);
+            fprintf(out, ", \"resampling\": \"%s\", \"frames\": %u, \"exact\": %s, \"one_shots\": %llu, "
+                    "\"hit_pct\": %.1f, \"changed\": %llu, \"cached_frames_pct\": %.1f, \"evictions\": %u, "
+                    "\"uncached_ms\": %.3f, \"cached_ms\": %.3f }",
+                    (options[o] & WM_MO_ENHANCED_RESAMPLING) ? "gauss" : "linear", frames[0],
+                    exact ? "true" : "false", (unsigned long long) stats.notes,
+                    stats.notes ? stats.hits * 100.0 / stats.notes : 0.0, (unsigned long long) stats.changed,
+                    stats.frames ? stats.cached_frames * 100.0 / stats.frames : 0.0, stats.evictions,
+                    ms[0], ms[1]);
+            if (!exact)
+                fprintf(stderr, "wwm_bench: %s differs with the cache on\n", files[i]);
+            fprintf(stderr, "%s: %.0f ms uncached, %.0f ms cached\n", files[i], ms[0], ms[1]);
+            total_plain += ms[0];
+            total_cached += ms[1];
+            free(pcm[0]);
+            free(pcm[1]);
+        }
+    }
+    fprintf(out, "%s  ],\n  \"uncached_ms\": %.3f,\n  \"cached_ms\": %.3f,\n  \"cpu_saved\": %.3f\n}\n",
+            runs ? "\n" : "", total_plain, total_cached,
+            total_plain > 0 ? 1.0 - total_cached / total_plain : 0.0);
+    if (total_cached >= total_plain)
+        fprintf(stderr, "wwm_bench: the cache saved no time\n");
+
+    wwm_shutdown();
+    return (failed || total_cached >= total_plain ? 1 : 0);
+}
+
+/*
+ Patch memory: the files opened together, so every patch any of them plays
+ is loaded at once, and what each holds with its sample data shared
+ between the program slots loading it against every slot decoding its own.
+ */
+struct patch_totals {
+    FILE *out;
+    int count;
+    uint64_t bytes;
+    uint64_t unshared_bytes;
+};
+
+static void report_patch(void *ctx, const struct wwm_patch_memory *patch) {
+    struct patch_totals *totals = ctx;
+
+    fprintf(totals->out, "%s    { \"patch\": ", totals->count ? ",\n" : "");
+    json_string(totals->out, patch->path);
+    fprintf(totals->out, ", \"slots\": %u, \"samples\": %u, \"data_bytes\": %u, \"bytes\": %u, \"unshared_bytes\": %u }",
+            patch->slots, patch->samples, patch->data_bytes, patch->bytes, patch->unshared_bytes);
+    totals->count++;
+    totals->bytes += patch->bytes;
+    totals->unshared_bytes += patch->unshared_bytes;
+}
+
+static int patch_memory(FILE *out, const char *config_file, char **files, int file_count) {
+    struct patch_totals totals = { out, 0, 0, 0 };
+    midi **handles = calloc(file_count, sizeof(midi *));
+    int i, opened = 0;
+
+    if (handles == NULL || wwm_init(config_file, bench_rate, 0) == -1) {
+        free(handles);
+        return (1);
+    }
+    for (i = 0; i < file_count; i++) {
+        handles[i] = wwm_open(files[i]);
+        if (handles[i] != NULL)
+            opened++;
+    }
+
+    report_open(out);
+    fprintf(out, "  \"files\": %d,\n  \"patches\": [\n", opened);
+    wwm_patch_memory(report_patch, &totals);
+    fprintf(out, "%s  ],\n  \"total\": { \"patches\": %d, \"bytes\": %llu, \"unshared_bytes\": %llu }\n}\n",
+            totals.count ? "\n" : "", totals.count, (unsigned long long) totals.bytes, (unsigned long long) totals.unshared_bytes);
+
+    for (i = 0; i < file_count; i++) {
+        if (handles[i] != NULL)
+            wwm_close(handles[i]);
+    }
+    free(handles);
+    wwm_shutdown();
+    return (opened == file_count ? 0 : 1);
+}
+
+static void do_help(void) {
+    printf("Usage: wwm_bench [options] [midifile ...]\n\n");
+    printf("  -c --config   config file (default freepats/freepats.cfg)\n");
+    printf("  -b --bank     load patches from a pre-decoded bank (wwm_mkbank)\n");
+    printf("  -r --repeat   render every file N times (default 1)\n");
+    printf("  -o --output   write the json report here instead of stdout\n");
+    printf("  -p --profile  chunk size profile: low-latency, balanced or batch\n");
+    printf("  -R --rate     output rate (default %d)\n", WWM_DEFAULT_RATE);
+    printf("  -k --kernels  check and time the SIMD kernels instead\n");
+    printf("  -x --exact    the synth against libWildMidi's own output loop instead\n");
+    printf("  -s --soak     heap use over N track changes instead\n");
+    printf("  -m --mix      render the files at once through one mixer instead\n");
+    printf("  -l --live     live input latency over N seconds instead\n");
+    printf("  -g --gapless  the files as a gapless playlist, crossfaded over N ms, instead\n");
+    printf("  -e --reverb   reverb tier: room (default), light or convolution\n");
+    printf("  -v --reverbs  time every reverb tier instead\n");
+    printf("  -C --cache KB the synth with a one-shot cache of KB against without instead\n");
+    printf("  -P --patches  memory of the patches the files load instead\n");
+    printf("  -h --help     this help\n\n");
+    printf("Without midifiles the demo playlist under freepats/ is rendered.\n");
+}
+
+static struct option const long_options[] = {
+    { "config", 1, 0, 'c' },
+    { "bank", 1, 0, 'b' },
+    { "repeat", 1, 0, 'r' },
+    { "output", 1, 0, 'o' },
+    { "profile", 1, 0, 'p' },
+    { "rate", 1, 0, 'R' },
+    { "kernels", 0, 0, 'k' },
+    { "exact", 0, 0, 'x' },
+    { "soak", 1, 0, 's' },
+    { "mix", 0, 0, 'm' },
+    { "live", 1, 0, 'l' },
+    { "gapless", 1, 0, 'g' },
+    { "reverb", 1, 0, 'e' },
+    { "reverbs", 0, 0, 'v' },
+    { "cache", 1, 0, 'C' },
+    { "patches", 0, 0, 'P' },
+    { "help", 0, 0, 'h' },
+    { NULL, 0, NULL, 0 }
+};
+
+int main(int argc, char **argv) {
+    char *config_file = "freepats/freepats.cfg";
+    char *report_file = NULL;
+    char *bank_file = NULL;
+    int repeat = 1;
+    int kernels = 0;
+    int exact = 0;
+    int soak_changes = 0;
+    int mixing = 0;
+    int live_seconds = 0;
+    int crossfade_ms = -1;
+    int reverbs = 0;
+    int cache_kb = 0;
+    int patches = 0;
+    const struct wwm_profile *profile = NULL;
+    char **files;
+    int file_count;
+    int i, j, c;
+    FILE *out;
+    uint64_t total_samples = 0;
+    double total_ms = 0, total_cpu = 0;
+    int failed = 0;
+    struct rusage usage;
+
+    while ((c = getopt_long(argc, argv, "c:b:r:o:p:R:kxs:ml:g:e:vC:Ph", long_options, NULL)) != -1) {
+        switch (c) {
+        case 'c':
+            config_file = optarg;
+            break;
+        case 'b':
+            bank_file = optarg;
+            break;
+        case 'r':
+            repeat = atoi(optarg);
+            if (repeat < 1) repeat = 1;
+            break;
+        case 'o':
+            report_file = optarg;
+            break;
+        case 'p':
+            profile = wildwebmidi_find_profile(optarg);
+            if (profile == NULL) {
+                fprintf(stderr, "wwm_bench: unknown profile %s\n", optarg);
+                return (1);
+            }
+            break;
+        case 'R':
+            bench_rate = atoi(optarg);
+            break;
+        case 'k':
+            kernels = 1;
+            break;
+        case 'x':
+            exact = 1;
+            break;
+        case 's':
+            soak_changes = atoi(optarg);
+            if (soak_changes < 1) soak_changes = 1;
+            break;
+        case 'm':
+            mixing = 1;
+            break;
+        case 'l':
+            live_seconds = atoi(optarg);
+            if (live_seconds < 1) live_seconds = 1;
+            break;
+        case 'g':
+            crossfade_ms = atoi(optarg);
+            if (crossfade_ms < 0) crossfade_ms = 0;
+            if (crossfade_ms > WWM_MAX_CROSSFADE_MS) crossfade_ms = WWM_MAX_CROSSFADE_MS;
+            break;
+        case 'e':
+            if (wildwebmidi_set_reverb(wwm_reverb_find(optarg)) == -1) {
+                fprintf(stderr, "wwm_bench: unknown reverb %s\n", optarg);
+                return (1);
+            }
+            break;
+        case 'v':
+            reverbs = 1;
+            break;
+        case 'C':
+            cache_kb = atoi(optarg);
+            if (cache_kb < 1) cache_kb = 1;
+            break;
+        case 'P':
+            patches = 1;
+            break;
+        case 'h':
+            do_help();
+            return (0);
+        default:
+            do_help();
+            return (1);
+        }
+    }
+
+    if (optind < argc) {
+        files = &argv[optind];
+        file_count = argc - optind;
+    } else {
+        files = corpus;
+        file_count = sizeof(corpus) / sizeof(corpus[0]);
+    }
+
+    /*
+     * wildwebmidi() chats on stdout, keep the report on its own stream and
+     * send the chatter away.
+     */
+    if (report_file) {
+        out = fopen(report_file, "w");
+    } else {
+        out = fdopen(dup(STDOUT_FILENO), "w");
+    }
+    if (out == NULL) {
+        perror("wwm_bench: report");
+        return (1);
+    }
+    if (kernels) {
+        i = check_kernels(out);
+        fclose(out);
+        return (i);
+    }
+    if (reverbs) {
+        i = reverb_cost(out);
+        fclose(out);
+        return (i);
+    }
+
+    if (freopen("/dev/null", "w", stdout) == NULL) {
+        perror("wwm_bench: stdout");
+        return (1);
+    }
+
+    if (bank_file && wwm_patbank_open(bank_file) == -1)
+        return (1);
+    if (bank_file && wwm_patbank_rate() != bench_rate)
+        fprintf(stderr, "wwm_bench: %s was built for %u Hz, decoding patches instead\n", bank_file, wwm_patbank_rate());
+
+    wildwebmidi_set_config(config_file);
+    wildwebmidi_set_output_f32(output_left, output_right, OUTPUT_FRAMES);
+    if (wildwebmidi_configure(bench_rate, profile ? profile->chunk_frames : WWM_DEFAULT_CHUNK) == -1) {
+        fprintf(stderr, "wwm_bench: rate must be %d - %d\n", WWM_MIN_RATE, WWM_MAX_RATE);
+        return (1);
+    }
+
+    if (live_seconds) {
+        i = live_latency(out, live_seconds);
+        wwm_shutdown();
+        fclose(out);
+        return (i);
+    }
+
+    if (crossfade_ms >= 0) {
+        i = gapless(out, files, file_count, crossfade_ms);
+        wwm_shutdown();
+        fclose(out);
+        return (i);
+    }
+
+    if (exact) {
+        i = synth_check(out, config_file, files, file_count);
+        fclose(out);
+        return (i);
+    }
+
+    if (patches) {
+        i = patch_memory(out, config_file, files, file_count);
+        fclose(out);
+        return (i);
+    }
+
+    if (cache_kb) {
+        i = cache_check(out, config_file, files, file_count, cache_kb);
+        fclose(out);
+        return (i);
+    }
+
+    if (mixing) {
+        i = mix(out, config_file, files, file_count);
+        wwm_shutdown();
+        fclose(out);
+        return (i);
+    }
+
+    if (soak_changes) {
+        i = soak(out, files, file_count, soak_changes);
+        wwm_shutdown();
+        fclose(out);
+        return (i);
+    }
+
+    report_open(out);
+    fprintf(out, "  \"rate\": %u,\n  \"repeat\": %d,\n  \"bank\": %s,\n  \"reverb\": \"%s\",\n",
+            bench_rate, repeat, bank_file ? "true" : "false", wwm_reverb_name(wwm_reverb_tier()));
+    /* what a streaming consumer of this profile buffers ahead */
+    if (profile) {
+        fprintf(out, "  \"profile\": \"%s\",\n  \"chunk_frames\": %d,\n  \"latency_ms\": %.1f,\n",
+                profile->name, profile->chunk_frames,
+                profile->chunk_frames * profile->queue_chunks * 1000.0 / bench_rate);
+    } else {
+        fprintf(out, "  \"chunk_frames\": %d,\n", WWM_DEFAULT_CHUNK);
+    }
+    fprintf(out, "  \"files\": [\n");
+
+    for (i = 0; i < file_count; i++) {
+        uint64_t samples = 0;
+        uint32_t peak_voices = 0, peak_render_us = 0;
+        struct wwm_telemetry telemetry;
+        uint32_t song;
+        double start, wall_ms, cpu;
+        int status = 0;
+
+        /* the -1 sleep makes it the blocking conversion loop */
+        cpu = cpu_ms();
+        start = now_ms();
+        for (j = 0; j < repeat; j++) {
+            conversion_status = 0;
+            wildwebmidi_telemetry_read(&telemetry);
+            song = telemetry.song;
+            /* a song that does not open never completes */
+            if (wildwebmidi(files[i], "", -1) != 0 && conversion_status == 0)
+                conversion_status = 1;
+            /* the song's position stays published after it finished */
+            wildwebmidi_telemetry_read(&telemetry);
+            if (telemetry.song != song)
+                samples += telemetry.current_sample;
+            if (wildwebmidi_stats()->peak_voices > peak_voices)
+                peak_voices = wildwebmidi_stats()->peak_voices;
+            if (wildwebmidi_stats()->peak_render_us > peak_render_us)
+                peak_render_us = wildwebmidi_stats()->peak_render_us;
+            if (conversion_status)
+                status = conversion_status;
+        }
+        wall_ms = now_ms() - start;
+        cpu = cpu_ms() - cpu;
+
+        fprintf(out, "    { \"file\": ");
+        json_string(out, files[i]);
+        fprintf(out, ", \"status\": %d, ", status);
+        json_stats(out, samples, wall_ms, cpu);
+        fprintf(out, ", \"peak_voices\": %u, \"peak_chunk_ms\": %.3f", peak_voices, peak_render_us / 1000.0);
+        fprintf(out, " }%s\n", (i + 1 < file_count) ? "," : "");
+
+        fprintf(stderr, "%s: %.0f ms\n", files[i], wall_ms);
+
+        total_samples += samples;
+        total_ms += wall_ms;
+        total_cpu += cpu;
+        if (status)
+            failed = 1;
+    }
+
+    wwm_shutdown();
+    getrusage(RUSAGE_SELF, &usage);
+
+    fprintf(out, "  ],\n  \"total\": { ");
+    json_stats(out, total_samples, total_ms, total_cpu);
+    fprintf(out, " },\n  \"peak_rss_kb\": %ld\n}\n", usage.ru_maxrss);
+    fclose(out);
+
+    return (failed);
+}
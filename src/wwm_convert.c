@@ -0,0 +1,322 @@
+/*
+ * wwm_convert.c -- midi to wav on every core, native build of wildwebmidi
+ *
+ * Renders the song in time segments on several threads (see wwm_export.h)
+ * and writes one wav. In batch mode (-B) every thread converts whole songs
+ * from a job list instead (see wwm_batch.h) and a json line is printed per
+ * finished job.
+ *
+ *   node make native
+ *   ./wwm_convert -j 8 freepats/TOCATTA.MID toccata.wav
+ *   ./wwm_convert -j 8 -v freepats/TOCATTA.MID toccata.wav  (seam error report)
+ *   ./wwm_convert -e convolution freepats/TOCATTA.MID toccata.wav
+ *   ./wwm_convert -B -j 8 a.mid a.wav b.mid b.wav
+ *   ./wwm_convert -B a.mid a.flac b.mid b.adpcm.wav   (the output name picks the format)
+ *   find midis -name '*.mid' | ./wwm_convert -B -j 8     (jobs from stdin)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+
+#include "wildwebmidi.h"
+#include "wwm.h"
+#include "wwm_batch.h"
+#include "wwm_export.h"
+#include "wwm_patbank.h"
+#include "wwm_reverb.h"
+#include "wwm_wav.h"
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/* the samples of a wav wwm_export_wav wrote, host-endian, NULL on failure */
+static int16_t *read_wav(const char *wav_file, uint32_t *frames) {
+    uint8_t wav_hdr[WWM_WAV_HEADER_SIZE];
+    int16_t *pcm = NULL;
+    uint32_t data_size;
+    FILE *in;
+
+    in = fopen(wav_file, "rb");
+    if (in == NULL) {
+        perror(wav_file);
+        return (NULL);
+    }
+    if (fread(wav_hdr, WWM_WAV_HEADER_SIZE, 1, in) != 1 || memcmp(wav_hdr, "RIFF", 4) != 0
+            || memcmp(&wav_hdr[36], "data", 4) != 0) {
+        fprintf(stderr, "%s: not a wav of wwm_convert\r\n", wav_file);
+        fclose(in);
+        return (NULL);
+    }
+
+    data_size = wav_hdr[40] | wav_hdr[41] << 8 | wav_hdr[42] << 16 | (uint32_t) wav_hdr[43] << 24;
+    *frames = data_size / 4;
+    pcm = malloc((size_t) *frames * 4);
+    if (pcm == NULL || fread(pcm, 4, *frames, in) != *frames) {
+        fprintf(stderr, "%s: cannot read %u frames\r\n", wav_file, *frames);
+        free(pcm);
+        pcm = NULL;
+    } else {
+        wwm_wav_swap(pcm, *frames * 2);
+    }
+    fclose(in);
+    return (pcm);
+}
+
+/*
+ * compares the wav written from the parallel render against a serial
+ * render of the whole song as one segment, per seam (from the start of
+ * the crossfade to one second after it) and overall
+ */
+static int verify(const char *midi_file, const int16_t *pcm, uint32_t frames, int threads) {
+    int16_t *serial;
+    uint32_t seg_len, i;
+    double sq = 0;
+    int max_diff = 0;
+    int count;
+
+    serial = malloc((size_t) frames * 4);
+    if (serial == NULL) {
+        fprintf(stderr, "Not enough memory\r\n");
+        return (-1);
+    }
+    if (wwm_render_segment(midi_file, 0, frames, serial) < 0) {
+        free(serial);
+        return (-1);
+    }
+
+    /* the same split wwm_render_parallel made */
+    count = wwm_export_split(frames, threads, &seg_len);
+
+    for (i = 0; i < frames * 2; i++) {
+        int diff = abs(pcm[i] - serial[i]);
+        if (diff > max_diff)
+            max_diff = diff;
+        sq += (double) diff * diff;
+    }
+
+    for (i = 1; i < (uint32_t) count; i++) {
+        uint32_t from = i * seg_len - WWM_EXPORT_XFADE;
+        uint32_t to = i * seg_len + wwm_rate();
+        uint32_t j;
+        int seam_diff = 0;
+
+        if (to > frames)
+            to = frames;
+        for (j = from * 2; j < to * 2; j++) {
+            int diff = abs(pcm[j] - serial[j]);
+            if (diff > seam_diff)
+                seam_diff = diff;
+        }
+        printf("seam %u at %.3fs: max error %d\n", i, (double) i * seg_len / wwm_rate(), seam_diff);
+    }
+
+    printf("max error %d, rms error %.3f (of 32768)\n", max_diff, frames ? sqrt(sq / (frames * 2.0)) : 0);
+    free(serial);
+    return (0);
+}
+
+static void json_string(FILE *out, const char *str) {
+    fputc('"', out);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            fputc('\\', out);
+        fputc(*str, out);
+    }
+    fputc('"', out);
+}
+
+struct batch_stats {
+    uint64_t frames;
+    int jobs;
+};
+
+static void job_done(const struct wwm_job *job, void *arg) {
+    struct batch_stats *stats = arg;
+    double audio_secs = (double) job->frames / wwm_rate();
+
+    printf("{ \"file\": ");
+    json_string(stdout, job->midi_file);
+    printf(", \"output\": ");
+    json_string(stdout, job->wav_file);
+    printf(", \"status\": %d, \"samples\": %u, \"audio_secs\": %.3f, \"wall_ms\": %.3f, "
+           "\"realtime_factor\": %.2f }\n",
+           job->status, job->frames, audio_secs, job->wall_ms,
+           job->wall_ms > 0 ? audio_secs * 1000.0 / job->wall_ms : 0);
+    fflush(stdout);
+
+    stats->frames += job->frames;
+    stats->jobs++;
+}
+
+/* name.mid -> name.wav */
+static char *wav_name(const char *midi_file, char *buf, size_t size) {
+    const char *dot = strrchr(midi_file, '.');
+    size_t len = (dot && !strchr(dot, '/')) ? (size_t) (dot - midi_file) : strlen(midi_file);
+
+    if (len + 5 > size)
+        return (NULL);
+    memcpy(buf, midi_file, len);
+    strcpy(buf + len, ".wav");
+    return (buf);
+}
+
+/*
+ * jobs are pairs of arguments or, without any, lines on stdin of
+ * "midifile<TAB>wavfile" or just "midifile" (written next to it as .wav)
+ */
+static int run_batch(char **args, int count, int threads) {
+    struct batch_stats stats = { 0, 0 };
+    char line[4096], wav[4096];
+    double start, wall_ms;
+    wwm_batch *batch;
+    int failed, i;
+
+    batch = wwm_batch_start(threads, job_done, &stats);
+    if (batch == NULL)
+        return (-1);
+
+    start = now_ms();
+    if (count > 0) {
+        for (i = 0; i + 1 < count; i += 2)
+            wwm_batch_add(batch, args[i], args[i + 1]);
+    } else {
+        while (fgets(line, sizeof(line), stdin) != NULL) {
+            char *tab;
+
+            line[strcspn(line, "\r\n")] = '\0';
+            if (line[0] == '\0')
+                continue;
+
+            tab = strchr(line, '\t');
+            if (tab) {
+                *tab = '\0';
+                wwm_batch_add(batch, line, tab + 1);
+            } else if (wav_name(line, wav, sizeof(wav))) {
+                wwm_batch_add(batch, line, wav);
+            }
+        }
+    }
+    failed = wwm_batch_finish(batch);
+    wall_ms = now_ms() - start;
+
+    printf("{ \"total\": { \"jobs\": %d, \"failed\": %d, \"threads\": %d, \"samples\": %llu, "
+           "\"wall_ms\": %.3f, \"realtime_factor\": %.2f } }\n",
+           stats.jobs, failed, threads, (unsigned long long) stats.frames, wall_ms,
+           wall_ms > 0 ? (double) stats.frames / wwm_rate() * 1000.0 / wall_ms : 0);
+    return (failed ? -1 : 0);
+}
+
+static void do_help(void) {
+    printf("Usage: wwm_convert [options] midifile wavfile\n");
+    printf("       wwm_convert -B [options] [midifile wavfile ...]\n\n");
+    printf("  -c --config   config file (default freepats/freepats.cfg)\n");
+    printf("  -b --bank     load patches from a pre-decoded bank (wwm_mkbank)\n");
+    printf("  -j --threads  render segments on N threads (default: cores)\n");
+    printf("  -v --verify   compare the written wav with a serial render, print the seam error\n");
+    printf("  -e --reverb   reverb tier: room (default), light or convolution\n");
+    printf("  -B --batch    convert many songs, one per thread. Without arguments jobs\n");
+    printf("                are read from stdin, \"midifile<TAB>wavfile\" or \"midifile\"\n");
+    printf("  -h --help     this help\n");
+}
+
+static struct option const long_options[] = {
+    { "config", 1, 0, 'c' },
+    { "bank", 1, 0, 'b' },
+    { "threads", 1, 0, 'j' },
+    { "verify", 0, 0, 'v' },
+    { "reverb", 1, 0, 'e' },
+    { "batch", 0, 0, 'B' },
+    { "help", 0, 0, 'h' },
+    { NULL, 0, NULL, 0 }
+};
+
+int main(int argc, char **argv) {
+    char *config_file = "freepats/freepats.cfg";
+    char *bank_file = NULL;
+    int threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    int check = 0;
+    int batch = 0;
+    uint32_t frames;
+    int16_t *pcm;
+    double start, wall_ms;
+    int c, res = 0;
+
+    while ((c = getopt_long(argc, argv, "c:b:j:ve:Bh", long_options, NULL)) != -1) {
+        switch (c) {
+        case 'c':
+            config_file = optarg;
+            break;
+        case 'b':
+            bank_file = optarg;
+            break;
+        case 'j':
+            threads = atoi(optarg);
+            break;
+        case 'v':
+            check = 1;
+            break;
+        case 'e':
+            if (wwm_reverb_set_tier(wwm_reverb_find(optarg)) == -1) {
+                fprintf(stderr, "wwm_convert: unknown reverb %s\n", optarg);
+                return (1);
+            }
+            break;
+        case 'B':
+            batch = 1;
+            break;
+        case 'h':
+            do_help();
+            return (0);
+        default:
+            do_help();
+            return (1);
+        }
+    }
+
+    if (batch ? (argc - optind) % 2 != 0 : argc - optind != 2) {
+        do_help();
+        return (1);
+    }
+    if (threads < 1)
+        threads = 1;
+
+    if (bank_file && wwm_patbank_open(bank_file) == -1)
+        return (1);
+    if (bank_file && wwm_patbank_rate() != WWM_DEFAULT_RATE)
+        fprintf(stderr, "Warning: %s was built for %u Hz, decoding patches instead\n", bank_file, wwm_patbank_rate());
+    if (wwm_init(config_file, WWM_DEFAULT_RATE, 0) == -1)
+        return (1);
+
+    if (batch) {
+        res = run_batch(&argv[optind], argc - optind, threads) == -1;
+        wwm_shutdown();
+        return (res);
+    }
+
+    start = now_ms();
+    if (wwm_export_wav(argv[optind], argv[optind + 1], threads) == -1) {
+        fprintf(stderr, "wwm_convert: failed converting %s\n", argv[optind]);
+        res = 1;
+    }
+    wall_ms = now_ms() - start;
+    printf("%s: %d threads, %.0f ms\n", argv[optind + 1], threads, wall_ms);
+
+    if (!res && check) {
+        pcm = read_wav(argv[optind + 1], &frames);
+        if (pcm == NULL || verify(argv[optind], pcm, frames, threads) == -1)
+            res = 1;
+        free(pcm);
+    }
+
+    wwm_shutdown();
+    return (res);
+}
@@ -0,0 +1,280 @@
+/*
+ * wwm_export.c -- faster than realtime wav export for WildWebMidi
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __EMSCRIPTEN__
+#include <pthread.h>
+#endif
+
+#include "wwm.h"
+#include "wwm_export.h"
+#include "wwm_wav.h"
+
+#define CHUNK_FRAMES 4096
+
+/* renders frames into out (or nowhere when out is NULL), returns frames rendered */
+static uint32_t render_frames(midi *handle, int16_t *out, uint32_t frames) {
+    int16_t chunk[CHUNK_FRAMES * 2];
+    uint32_t done = 0;
+
+    while (done < frames) {
+        uint32_t count = frames - done;
+        int res;
+
+        if (count > CHUNK_FRAMES)
+            count = CHUNK_FRAMES;
+
+        res = WildMidi_GetOutput(handle, (int8_t *) (out ? out + done * 2 : chunk), count * 4);
+        if (res <= 0)
+            break;
+        done += res / 4;
+    }
+    return (done);
+}
+
+/* seeks to start minus the pre-roll and renders the pre-roll away */
+static midi *segment_seek(midi *handle, uint32_t start) {
+    uint32_t preroll = (uint32_t) ((uint64_t) wwm_rate() * WWM_EXPORT_PREROLL_MS / 1000);
+    unsigned long int seek_to = (start > preroll) ? start - preroll : 0;
+
+    if (handle == NULL)
+        return (NULL);
+
+    if (seek_to > 0)
+        WildMidi_FastSeek(handle, &seek_to);
+    render_frames(handle, NULL, start - seek_to);
+    return (handle);
+}
+
+midi *wwm_segment_open(const char *midi_file, uint32_t start) {
+    return segment_seek(wwm_open_handle(midi_file), start);
+}
+
+midi *wwm_segment_open_memory(const uint8_t *data, uint32_t size, uint32_t start) {
+    return segment_seek(wwm_open_handle_memory(data, size), start);
+}
+
+int wwm_segment_render(midi *handle, int16_t *out, uint32_t frames) {
+    uint32_t done;
+
+    if (handle == NULL || out == NULL)
+        return (-1);
+
+    done = render_frames(handle, out, frames);
+    if (done < frames)
+        memset(out + done * 2, 0, (frames - done) * 4);
+    return ((int) done);
+}
+
+void wwm_segment_close(midi *handle) {
+    wwm_close_handle(handle);
+}
+
+/* head_frames into head, then frames into out */
+static int render_span(const char *midi_file, uint32_t start,
+        int16_t *head, uint32_t head_frames, int16_t *out, uint32_t frames) {
+    midi *handle;
+    int res;
+
+    handle = wwm_segment_open(midi_file, start);
+    if (handle == NULL)
+        return (-1);
+
+    if (head_frames > 0)
+        render_frames(handle, head, head_frames);
+    res = wwm_segment_render(handle, out, frames);
+
+    wwm_segment_close(handle);
+    return (res);
+}
+
+/* closes handle */
+static uint32_t song_frames(midi *handle) {
+    struct _WM_Info *info;
+    uint32_t frames;
+
+    if (handle == NULL)
+        return (0);
+
+    info = WildMidi_GetInfo(handle);
+    frames = info ? info->approx_total_samples : 0;
+
+    wwm_close_handle(handle);
+    return (frames);
+}
+
+uint32_t wwm_song_length(const char *midi_file) {
+    return song_frames(wwm_open_handle(midi_file));
+}
+
+uint32_t wwm_song_length_memory(const uint8_t *data, uint32_t size) {
+    return song_frames(wwm_open_handle_memory(data, size));
+}
+
+int wwm_render_segment(const char *midi_file, uint32_t start, uint32_t frames, int16_t *out) {
+    if (out == NULL)
+        return (-1);
+    return render_span(midi_file, start, NULL, 0, out, frames);
+}
+
+/*
+ * floor rounding, so wherever both sides agree the result is exactly that
+ * sample again
+ */
+void wwm_crossfade(int16_t *tail, const int16_t *head, uint32_t frames) {
+    wwm_crossfade_part(tail, head, frames, 0, frames);
+}
+
+void wwm_crossfade_part(int16_t *tail, const int16_t *head, uint32_t frames, uint32_t at, uint32_t length) {
+    int64_t n = length;
+    uint32_t i;
+
+    for (i = 0; i < frames * 2; i++) {
+        int64_t in = at + i / 2;
+        int64_t mixed = tail[i] * (n - in) + head[i] * in + n / 2;
+        tail[i] = (int16_t) (mixed >= 0 ? mixed / n : -((-mixed + n - 1) / n));
+    }
+}
+
+int wwm_export_split(uint32_t frames, int threads, uint32_t *seg_len) {
+    int count = threads;
+
+    /* segments shorter than a second are not worth the pre-roll */
+    if (count > WWM_EXPORT_MAX_THREADS)
+        count = WWM_EXPORT_MAX_THREADS;
+    while (count > 1 && frames / count < wwm_rate())
+        count--;
+    if (count < 1)
+        count = 1;
+
+    *seg_len = (frames + count - 1) / count;
+    return (count);
+}
+
+struct segment {
+    const char *midi_file;
+    uint32_t start;
+    uint32_t frames;
+    int16_t *head; /* WWM_EXPORT_XFADE frames before start, NULL for the first */
+    int16_t *out;
+    int res;
+};
+
+static void *segment_run(void *arg) {
+    struct segment *seg = arg;
+    uint32_t head_frames = seg->head ? WWM_EXPORT_XFADE : 0;
+
+    seg->res = render_span(seg->midi_file, seg->start - head_frames,
+            seg->head, head_frames, seg->out, seg->frames);
+    return (NULL);
+}
+
+int16_t *wwm_render_parallel(const char *midi_file, int threads, uint32_t *frames) {
+    struct segment segs[WWM_EXPORT_MAX_THREADS];
+#ifndef __EMSCRIPTEN__
+    pthread_t tids[WWM_EXPORT_MAX_THREADS];
+    int started[WWM_EXPORT_MAX_THREADS];
+#endif
+    uint32_t total, seg_len;
+    int16_t *pcm, *heads;
+    int count, i, failed = 0;
+
+    if (!wwm_initialized())
+        return (NULL);
+
+    total = wwm_song_length(midi_file);
+    if (total == 0)
+        return (NULL);
+
+    count = wwm_export_split(total, threads, &seg_len);
+
+    pcm = malloc((size_t) total * 4);
+    heads = malloc((size_t) count * WWM_EXPORT_XFADE * 4);
+    if (pcm == NULL || heads == NULL) {
+        fprintf(stderr, "Not enough memory\r\n");
+        free(pcm);
+        free(heads);
+        return (NULL);
+    }
+
+    for (i = 0; i < count; i++) {
+        uint32_t start = i * seg_len;
+        segs[i].midi_file = midi_file;
+        segs[i].start = start;
+        segs[i].frames = (total - start < seg_len) ? total - start : seg_len;
+        segs[i].head = i ? heads + i * WWM_EXPORT_XFADE * 2 : NULL;
+        segs[i].out = pcm + (size_t) start * 2;
+        segs[i].res = -1;
+    }
+
+#ifndef __EMSCRIPTEN__
+    /* the calling thread takes the first segment itself */
+    for (i = 1; i < count; i++)
+        started[i] = pthread_create(&tids[i], NULL, segment_run, &segs[i]) == 0;
+    segment_run(&segs[0]);
+    for (i = 1; i < count; i++) {
+        if (started[i])
+            pthread_join(tids[i], NULL);
+        else
+            segment_run(&segs[i]);
+    }
+#else
+    for (i = 0; i < count; i++)
+        segment_run(&segs[i]);
+#endif
+
+    for (i = 0; i < count; i++) {
+        if (segs[i].res < 0)
+            failed = 1;
+        else if (i)
+            wwm_crossfade(pcm + (size_t) (segs[i].start - WWM_EXPORT_XFADE) * 2,
+                    segs[i].head, WWM_EXPORT_XFADE);
+    }
+    free(heads);
+
+    if (failed) {
+        free(pcm);
+        return (NULL);
+    }
+
+    *frames = total;
+    return (pcm);
+}
+
+int wwm_export_wav(const char *midi_file, const char *wav_file, int threads) {
+    uint8_t wav_hdr[WWM_WAV_HEADER_SIZE];
+    uint32_t frames;
+    int16_t *pcm;
+    FILE *out;
+    int res = 0;
+
+    pcm = wwm_render_parallel(midi_file, threads, &frames);
+    if (pcm == NULL)
+        return (-1);
+
+    out = fopen(wav_file, "wb");
+    if (out == NULL) {
+        perror(wav_file);
+        free(pcm);
+        return (-1);
+    }
+
+    wwm_wav_header(wav_hdr, wwm_rate(), frames * 4);
+    wwm_wav_swap(pcm, frames * 2);
+    if (fwrite(wav_hdr, WWM_WAV_HEADER_SIZE, 1, out) != 1
+            || fwrite(pcm, 4, frames, out) != frames) {
+        perror(wav_file);
+        res = -1;
+    }
+
+    if (fclose(out) != 0)
+        res = -1;
+    free(pcm);
+    return (res);
+}
@@ -0,0 +1,80 @@
+/*
+ * wwm_export.h -- faster than realtime wav export for WildWebMidi
+ *
+ * A song is cut into one time segment per thread. Every segment opens its
+ * own handle, WildMidi_FastSeek's to a little before its start and renders
+ * that pre-roll into the void, so notes and reverb are already sounding
+ * when its real output begins. Neighbouring segments overlap by
+ * WWM_EXPORT_XFADE frames which are crossfaded when they are put together.
+ *
+ * Error bound: a segment only hears notes that start after its seek
+ * position. Against a serial render the output is therefore the same except
+ * for notes still sounding at a seam that began more than
+ * WWM_EXPORT_PREROLL_MS before it, those are missing from the seam on. The
+ * crossfade keeps samples both sides agree on exact. `wwm_convert -v`
+ * measures the error of a song.
+ *
+ * Natively the segments render on pthreads, in the browser every segment
+ * goes to its own worker (see parallel_export.js) through
+ * wwm_segment_open_memory, which renders it a chunk at a time so the worker's
+ * fixed heap holds one chunk and not the whole segment.
+ */
+
+#ifndef WWM_EXPORT_H
+#define WWM_EXPORT_H
+
+#include <stdint.h>
+
+#include "wildmidi_lib.h"
+
+#define WWM_EXPORT_PREROLL_MS 5000
+#define WWM_EXPORT_XFADE 1024 /* frames */
+#define WWM_EXPORT_MAX_THREADS 64
+
+/* song length in frames, 0 when it can not be opened */
+uint32_t wwm_song_length(const char *midi_file);
+uint32_t wwm_song_length_memory(const uint8_t *data, uint32_t size);
+
+/*
+ * renders frames of stereo16 starting at frame start (pre-roll included)
+ * into out, returns frames rendered or -1. The rest of out is zeroed.
+ */
+int wwm_render_segment(const char *midi_file, uint32_t start, uint32_t frames, int16_t *out);
+
+/*
+ * opens midi_file for a segment starting at frame start, sought and with
+ * the pre-roll rendered. NULL when it can not be opened
+ */
+midi *wwm_segment_open(const char *midi_file, uint32_t start);
+midi *wwm_segment_open_memory(const uint8_t *data, uint32_t size, uint32_t start);
+
+/*
+ * renders the next frames of a segment into out, returns frames rendered
+ * or -1. The rest of out is zeroed.
+ */
+int wwm_segment_render(midi *handle, int16_t *out, uint32_t frames);
+
+void wwm_segment_close(midi *handle);
+
+/*
+ * how a song of frames is cut for threads, returns the number of segments,
+ * segment i starts at i * seg_len
+ */
+int wwm_export_split(uint32_t frames, int threads, uint32_t *seg_len);
+
+/* mixes head into the last frames of tail, linear fade */
+void wwm_crossfade(int16_t *tail, const int16_t *head, uint32_t frames);
+
+/* frames of a crossfade of length frames, from frame at of it on (chunk by chunk) */
+void wwm_crossfade_part(int16_t *tail, const int16_t *head, uint32_t frames, uint32_t at, uint32_t length);
+
+/*
+ * renders a whole song with up to threads segments into one buffer of
+ * *frames stereo16 frames, free() it when done. NULL on failure.
+ */
+int16_t *wwm_render_parallel(const char *midi_file, int threads, uint32_t *frames);
+
+/* wwm_render_parallel into a wav file, returns 0 on success */
+int wwm_export_wav(const char *midi_file, const char *wav_file, int threads);
+
+#endif /* WWM_EXPORT_H */
@@ -0,0 +1,450 @@
+/*
+ * wwm_flac.c -- streaming FLAC encoder for 16 bit stereo output
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "wwm_flac.h"
+
+#define MAX_ORDER 4
+#define MAX_PORDER 8
+#define MAX_RICE 14 /* 15 is the escape code */
+
+/* worst case is a verbatim frame: header, 16 + 17 bit subframes, crc */
+#define MAX_FRAME_BYTES (16 + 2 * (1 + (WWM_FLAC_BLOCK * 17 + 7) / 8) + 2)
+
+enum {
+    CHANNELS_LR = 1,
+    CHANNELS_LS = 8,
+    CHANNELS_SR = 9,
+    CHANNELS_MS = 10
+};
+
+struct subframe {
+    const int32_t *x;
+    int bps;
+    int type;          /* 0 constant, 1 verbatim, 8 + order fixed */
+    int porder;
+    uint8_t params[1 << MAX_PORDER];
+    uint32_t bits;
+};
+
+struct wwm_flac {
+    wwm_flac_sink sink;
+    void *ctx;
+    uint32_t rate;
+    uint64_t total;
+    uint32_t frame_number;
+    uint32_t min_frame;
+    uint32_t max_frame;
+
+    uint32_t fill;
+    int32_t left[WWM_FLAC_BLOCK];
+    int32_t right[WWM_FLAC_BLOCK];
+    int32_t mid[WWM_FLAC_BLOCK];
+    int32_t side[WWM_FLAC_BLOCK];
+    uint32_t residual[WWM_FLAC_BLOCK];
+    uint64_t costs[1 << MAX_PORDER][MAX_RICE + 1];
+
+    uint8_t out[MAX_FRAME_BYTES];
+};
+
+/*
+ Bit writer
+ */
+
+struct bits {
+    uint8_t *buf;
+    uint32_t pos;
+    uint64_t acc;
+    int count;
+};
+
+static void put_bits(struct bits *b, uint32_t value, int count) {
+    if (count == 0)
+        return;
+    if (count < 32)
+        value &= (1U << count) - 1;
+
+    b->acc = (b->acc << count) | value;
+    b->count += count;
+    while (b->count >= 8) {
+        b->count -= 8;
+        b->buf[b->pos++] = (uint8_t) (b->acc >> b->count);
+    }
+}
+
+static void put_unary(struct bits *b, uint32_t zeros) {
+    while (zeros >= 31) {
+        put_bits(b, 0, 31);
+        zeros -= 31;
+    }
+    put_bits(b, 1, zeros + 1);
+}
+
+static void put_align(struct bits *b) {
+    if (b->count)
+        put_bits(b, 0, 8 - b->count);
+}
+
+static uint8_t crc8(const uint8_t *data, uint32_t size) {
+    uint8_t crc = 0;
+    uint32_t i;
+    int j;
+
+    for (i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (j = 0; j < 8; j++)
+            crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x07) : (uint8_t) (crc << 1);
+    }
+    return (crc);
+}
+
+static uint16_t crc16(const uint8_t *data, uint32_t size) {
+    uint16_t crc = 0;
+    uint32_t i;
+    int j;
+
+    for (i = 0; i < size; i++) {
+        crc ^= (uint16_t) data[i] << 8;
+        for (j = 0; j < 8; j++)
+            crc = (crc & 0x8000) ? (uint16_t) ((crc << 1) ^ 0x8005) : (uint16_t) (crc << 1);
+    }
+    return (crc);
+}
+
+/*
+ Fixed predictors
+ */
+
+static int32_t predict(const int32_t *x, int i, int order) {
+    switch (order) {
+    case 0:
+        return x[i];
+    case 1:
+        return x[i] - x[i - 1];
+    case 2:
+        return x[i] - 2 * x[i - 1] + x[i - 2];
+    case 3:
+        return x[i] - 3 * x[i - 1] + 3 * x[i - 2] - x[i - 3];
+    default:
+        return x[i] - 4 * x[i - 1] + 6 * x[i - 2] - 4 * x[i - 3] + x[i - 4];
+    }
+}
+
+static uint32_t zigzag(int32_t e) {
+    return ((uint32_t) e << 1) ^ (uint32_t) (e >> 31);
+}
+
+/* picks the cheapest encoding of one channel, sets sub->bits */
+static void plan_subframe(wwm_flac *flac, struct subframe *sub, uint32_t n) {
+    const int32_t *x = sub->x;
+    uint64_t best_sum = UINT64_MAX;
+    uint64_t best_bits = UINT64_MAX;
+    uint32_t i, leaves, leaf_len;
+    int order = 0, o, p, pmax, k;
+
+    for (i = 1; i < n && x[i] == x[0]; i++)
+        ;
+    if (i == n) {
+        sub->type = 0;
+        sub->bits = 8 + sub->bps;
+        return;
+    }
+
+    /* the order with the smallest residual, like libFLAC does for fixed */
+    for (o = 0; o <= MAX_ORDER && (uint32_t) o < n; o++) {
+        uint64_t sum = 0;
+        for (i = o; i < n; i++) {
+            int32_t e = predict(x, i, o);
+            sum += (uint64_t) (e < 0 ? -(int64_t) e : e);
+        }
+        if (sum < best_sum) {
+            best_sum = sum;
+            order = o;
+        }
+    }
+
+    for (i = order; i < n; i++)
+        flac->residual[i] = zigzag(predict(x, i, order));
+
+    for (pmax = MAX_PORDER; pmax > 0; pmax--) {
+        if ((n & ((1U << pmax) - 1)) == 0 && (n >> pmax) > (uint32_t) order)
+            break;
+    }
+    leaves = 1U << pmax;
+    leaf_len = n >> pmax;
+
+    /* bits of every leaf partition for every rice parameter */
+    for (i = 0; i < leaves; i++) {
+        uint32_t start = (i == 0) ? (uint32_t) order : i * leaf_len;
+        uint32_t end = (i + 1) * leaf_len;
+        uint32_t j;
+
+        for (k = 0; k <= MAX_RICE; k++)
+            flac->costs[i][k] = (uint64_t) (end - start) * (k + 1);
+        for (j = start; j < end; j++) {
+            uint32_t u = flac->residual[j];
+            for (k = 0; k <= MAX_RICE; k++)
+                flac->costs[i][k] += u >> k;
+        }
+    }
+
+    /* coarser partitions just add up their leaves */
+    for (p = pmax; p >= 0; p--) {
+        uint32_t parts = 1U << p;
+        uint32_t per = leaves / parts;
+        uint8_t params[1 << MAX_PORDER];
+        uint64_t bits = 2 + 4;
+
+        for (i = 0; i < parts; i++) {
+            uint64_t best = UINT64_MAX;
+            for (k = 0; k <= MAX_RICE; k++) {
+                uint64_t sum = 0;
+                uint32_t j;
+                for (j = i * per; j < (i + 1) * per; j++)
+                    sum += flac->costs[j][k];
+                if (sum < best) {
+                    best = sum;
+                    params[i] = (uint8_t) k;
+                }
+            }
+            bits += 4 + best;
+        }
+
+        if (bits < best_bits) {
+            best_bits = bits;
+            sub->porder = p;
+            memcpy(sub->params, params, parts);
+        }
+    }
+
+    best_bits += 8 + (uint64_t) order * sub->bps;
+    if (best_bits < 8 + (uint64_t) n * sub->bps) {
+        sub->type = 8 + order;
+        sub->bits = (uint32_t) best_bits;
+    } else {
+        sub->type = 1;
+        sub->bits = 8 + n * sub->bps;
+    }
+}
+
+static void write_subframe(wwm_flac *flac, struct bits *b, const struct subframe *sub, uint32_t n) {
+    const int32_t *x = sub->x;
+    uint32_t i;
+
+    put_bits(b, (uint32_t) sub->type << 1, 8);
+
+    if (sub->type == 0) {
+        put_bits(b, (uint32_t) x[0], sub->bps);
+    } else if (sub->type == 1) {
+        for (i = 0; i < n; i++)
+            put_bits(b, (uint32_t) x[i], sub->bps);
+    } else {
+        int order = sub->type - 8;
+        uint32_t parts = 1U << sub->porder;
+        uint32_t part_len = n >> sub->porder;
+        uint32_t p;
+
+        for (i = 0; i < (uint32_t) order; i++)
+            put_bits(b, (uint32_t) x[i], sub->bps);
+        for (i = order; i < n; i++)
+            flac->residual[i] = zigzag(predict(x, i, order));
+
+        put_bits(b, 0, 2); /* rice, 4 bit parameters */
+        put_bits(b, sub->porder, 4);
+        for (p = 0; p < parts; p++) {
+            uint32_t k = sub->params[p];
+            uint32_t start = (p == 0) ? (uint32_t) order : p * part_len;
+            uint32_t end = (p + 1) * part_len;
+
+            put_bits(b, k, 4);
+            for (i = start; i < end; i++) {
+                uint32_t u = flac->residual[i];
+                put_unary(b, u >> k);
+                put_bits(b, u, k);
+            }
+        }
+    }
+}
+
+static void put_utf8(struct bits *b, uint32_t value) {
+    if (value < 0x80) {
+        put_bits(b, value, 8);
+    } else {
+        int len = (value < 0x800) ? 2 : (value < 0x10000) ? 3 :
+                  (value < 0x200000) ? 4 : (value < 0x4000000) ? 5 : 6;
+        int i;
+
+        put_bits(b, (0xFF00U >> len) | (value >> (6 * (len - 1))), 8);
+        for (i = len - 2; i >= 0; i--)
+            put_bits(b, 0x80 | ((value >> (6 * i)) & 0x3F), 8);
+    }
+}
+
+static uint32_t rate_code(uint32_t rate) {
+    switch (rate) {
+    case 88200: return 1;
+    case 176400: return 2;
+    case 192000: return 3;
+    case 8000: return 4;
+    case 16000: return 5;
+    case 22050: return 6;
+    case 24000: return 7;
+    case 32000: return 8;
+    case 44100: return 9;
+    case 48000: return 10;
+    case 96000: return 11;
+    default: return 0; /* from STREAMINFO */
+    }
+}
+
+static int encode_block(wwm_flac *flac) {
+    struct subframe subs[4];
+    struct bits b = { flac->out, 0, 0, 0 };
+    uint32_t n = flac->fill;
+    uint32_t i, header_end, size;
+    uint32_t best_bits, mode;
+    int first, second;
+    uint16_t crc;
+
+    for (i = 0; i < n; i++) {
+        flac->mid[i] = (flac->left[i] + flac->right[i]) >> 1;
+        flac->side[i] = flac->left[i] - flac->right[i];
+    }
+
+    subs[0].x = flac->left;
+    subs[0].bps = 16;
+    subs[1].x = flac->right;
+    subs[1].bps = 16;
+    subs[2].x = flac->mid;
+    subs[2].bps = 16;
+    subs[3].x = flac->side;
+    subs[3].bps = 17;
+    for (i = 0; i < 4; i++)
+        plan_subframe(flac, &subs[i], n);
+
+    mode = CHANNELS_LR;
+    first = 0;
+    second = 1;
+    best_bits = subs[0].bits + subs[1].bits;
+    if (subs[0].bits + subs[3].bits < best_bits) {
+        mode = CHANNELS_LS;
+        first = 0;
+        second = 3;
+        best_bits = subs[0].bits + subs[3].bits;
+    }
+    if (subs[3].bits + subs[1].bits < best_bits) {
+        mode = CHANNELS_SR;
+        first = 3;
+        second = 1;
+        best_bits = subs[3].bits + subs[1].bits;
+    }
+    if (subs[2].bits + subs[3].bits < best_bits) {
+        mode = CHANNELS_MS;
+        first = 2;
+        second = 3;
+    }
+
+    /* frame header, fixed blocksize stream */
+    put_bits(&b, 0xFFF8, 16);
+    if (n == WWM_FLAC_BLOCK)
+        put_bits(&b, 12, 4);
+    else
+        put_bits(&b, n <= 256 ? 6 : 7, 4);
+    put_bits(&b, rate_code(flac->rate), 4);
+    put_bits(&b, mode, 4);
+    put_bits(&b, 4, 3); /* 16 bits per sample */
+    put_bits(&b, 0, 1);
+    put_utf8(&b, flac->frame_number);
+    if (n != WWM_FLAC_BLOCK)
+        put_bits(&b, n - 1, n <= 256 ? 8 : 16);
+    header_end = b.pos;
+    put_bits(&b, crc8(flac->out, header_end), 8);
+
+    write_subframe(flac, &b, &subs[first], n);
+    write_subframe(flac, &b, &subs[second], n);
+    put_align(&b);
+
+    crc = crc16(flac->out, b.pos);
+    put_bits(&b, crc, 16);
+    size = b.pos;
+
+    if (flac->min_frame == 0 || size < flac->min_frame)
+        flac->min_frame = size;
+    if (size > flac->max_frame)
+        flac->max_frame = size;
+
+    flac->total += n;
+    flac->frame_number++;
+    flac->fill = 0;
+    return flac->sink(flac->ctx, flac->out, size);
+}
+
+wwm_flac *wwm_flac_new(uint32_t rate, wwm_flac_sink sink, void *ctx) {
+    wwm_flac *flac = calloc(1, sizeof(*flac));
+
+    if (flac == NULL)
+        return (NULL);
+    flac->rate = rate;
+    flac->sink = sink;
+    flac->ctx = ctx;
+    return (flac);
+}
+
+void wwm_flac_header(wwm_flac *flac, uint8_t *hdr) {
+    uint64_t info;
+    int i;
+
+    memset(hdr, 0, WWM_FLAC_HEADER_SIZE); /* md5 left unknown */
+    memcpy(hdr, "fLaC", 4);
+    hdr[4] = 0x80; /* last metadata block, STREAMINFO */
+    hdr[7] = 34;
+
+    hdr[8] = WWM_FLAC_BLOCK >> 8;
+    hdr[9] = WWM_FLAC_BLOCK & 0xFF;
+    hdr[10] = WWM_FLAC_BLOCK >> 8;
+    hdr[11] = WWM_FLAC_BLOCK & 0xFF;
+    for (i = 0; i < 3; i++) {
+        hdr[12 + i] = (uint8_t) (flac->min_frame >> (16 - 8 * i));
+        hdr[15 + i] = (uint8_t) (flac->max_frame >> (16 - 8 * i));
+    }
+
+    /* rate:20 channels-1:3 bps-1:5 total samples:36 */
+    info = ((uint64_t) flac->rate << 44) | ((uint64_t) 1 << 41) | ((uint64_t) 15 << 36)
+         | (flac->total & 0xFFFFFFFFFULL);
+    for (i = 0; i < 8; i++)
+        hdr[18 + i] = (uint8_t) (info >> (56 - 8 * i));
+}
+
+int wwm_flac_write(wwm_flac *flac, const int16_t *pcm, uint32_t frames) {
+    uint32_t i;
+
+    for (i = 0; i < frames; i++) {
+        flac->left[flac->fill] = pcm[i * 2];
+        flac->right[flac->fill] = pcm[i * 2 + 1];
+        if (++flac->fill == WWM_FLAC_BLOCK && encode_block(flac) == -1)
+            return (-1);
+    }
+    return (0);
+}
+
+int wwm_flac_finish(wwm_flac *flac) {
+    if (flac->fill == 0)
+        return (0);
+    return encode_block(flac);
+}
+
+void wwm_flac_free(wwm_flac *flac) {
+    free(flac);
+}
+
+int wwm_flac_filename(const char *file) {
+    size_t len = strlen(file);
+    return (len >= 5 && strcasecmp(file + len - 5, ".flac") == 0);
+}
@@ -0,0 +1,44 @@
+/*
+ * wwm_flac.h -- streaming FLAC encoder for 16 bit stereo output
+ *
+ * Small and dependency free: fixed blocks of WWM_FLAC_BLOCK frames, the
+ * best of the fixed predictors (order 0-4) per channel, left/side,
+ * side/right or mid/side stereo when that is smaller, partitioned rice
+ * residuals. Every block is encoded and handed to the sink as soon as it
+ * is full, so memory does not grow with the song.
+ *
+ * Like a wav, the header is written up front with an unknown length and
+ * rewritten at the end (wwm_flac_header), the sink does not need to seek
+ * while encoding.
+ */
+
+#ifndef WWM_FLAC_H
+#define WWM_FLAC_H
+
+#include <stdint.h>
+
+#define WWM_FLAC_HEADER_SIZE 42 /* "fLaC" + STREAMINFO */
+#define WWM_FLAC_BLOCK 4096
+
+/* receives encoded bytes, returns -1 to stop encoding */
+typedef int (*wwm_flac_sink)(void *ctx, const uint8_t *data, uint32_t size);
+
+typedef struct wwm_flac wwm_flac;
+
+wwm_flac *wwm_flac_new(uint32_t rate, wwm_flac_sink sink, void *ctx);
+
+/* fills the header for what has been encoded so far */
+void wwm_flac_header(wwm_flac *flac, uint8_t *hdr);
+
+/* encodes interleaved host-endian stereo16, returns 0 or -1 */
+int wwm_flac_write(wwm_flac *flac, const int16_t *pcm, uint32_t frames);
+
+/* encodes the last partial block, returns 0 or -1 */
+int wwm_flac_finish(wwm_flac *flac);
+
+void wwm_flac_free(wwm_flac *flac);
+
+/* whether a file name asks for flac (*.flac) */
+int wwm_flac_filename(const char *file);
+
+#endif /* WWM_FLAC_H */
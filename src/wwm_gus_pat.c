@@ -0,0 +1,398 @@
+/*
+ * wwm_gus_pat.c -- libWildMidi's gus_pat.c with a patch bank in front
+ *
+ * Built instead of wildmidi/src/gus_pat.c (see make.js). The original
+ * decoder is compiled in here under another name, _WM_load_gus_pat serves
+ * patches from the bank when it has them and decodes the .pat file
+ * otherwise. Either way a patch is decoded once however many program
+ * slots load it, the slots share its sample data.
+ */
+
+#define _WM_load_gus_pat _WM_decode_gus_pat
+#include "gus_pat.c"
+#undef _WM_load_gus_pat
+
+#include <limits.h>
+#include <stdlib.h>
+#ifndef __EMSCRIPTEN__
+#include <pthread.h>
+#endif
+
+#include "wwm_arena.h"
+#include "wwm_patbank.h"
+#include "wwm_synth.h"
+
+/* the data gus_pat.c allocates for a sample: its frames and 2 more the interpolation reads */
+#define SAMPLE_DATA_BYTES(sample) ((((sample)->data_length >> 10) + 2) * sizeof(int16_t))
+
+struct _sample *_WM_load_gus_pat(const char *filename, int fix_release);
+
+int wwm_gus_pat_sample_size(void) {
+    return (int) sizeof(struct _sample);
+}
+
+/*
+ * The sample data is used in place, only the structs are copied out, the
+ * library adjusts them for the patch. Its free of the data passes over
+ * the bank (wwm_lib_free). NULL for a record whose data is too short,
+ * the patch is decoded from its file then.
+ */
+static struct _sample *samples_from_bank(const struct wwm_bank_entry *entry) {
+    const uint8_t *base = wwm_patbank_data();
+    uint32_t record_size = WWM_BANK_RECORD_SIZE(sizeof(struct _sample));
+    struct _sample *first = NULL;
+    struct _sample **link = &first;
+    uint32_t i;
+
+    for (i = 0; i < entry->sample_count; i++) {
+        const struct wwm_bank_record *record = (const struct wwm_bank_record *)
+                (base + entry->first_record + i * record_size);
+        struct _sample *sample = malloc(sizeof(struct _sample));
+
+        if (sample == NULL) {
+            _WM_GLOBAL_ERROR(__FUNCTION__, __LINE__, WM_ERR_MEM, NULL, errno);
+            goto fail;
+        }
+        memcpy(sample, record + 1, sizeof(struct _sample));
+        sample->next = NULL;
+        sample->data = (int16_t *) (base + record->data_offset);
+        *link = sample;
+        link = &sample->next;
+
+        if (record->data_bytes < SAMPLE_DATA_BYTES(sample))
+            goto fail;
+    }
+    return (first);
+
+fail:
+    while (first) {
+        struct _sample *next = first->next;
+        free(first);
+        first = next;
+    }
+    return (NULL);
+}
+
+/*
+ * Shared patches. libWildMidi loads a patch for every program slot of the
+ * config that names it and frees each slot's samples on its own, so a
+ * config mapping many slots to one .pat file (makecfg.js maps all 127)
+ * held as many decoded copies. Patches from the bank are kept here by their
+ * bank entry, decoded ones by canonical path and by a hash of the file
+ * (only read when the path is new), every slot gets its own sample structs (the
+ * library adjusts envelopes and lengths in them) over the data decoded
+ * once. The library's free of that data (wwm_lib_free) only drops a
+ * reference, the last one frees the patch.
+ */
+#define DATA_BUCKETS 256
+
+struct shared_patch {
+    char *path;               /* canonical */
+    int fix_release;
+    const struct wwm_bank_entry *entry; /* the bank's, NULL when decoded */
+    uint64_t hash;            /* of the .pat file, 0 when it could not be read or not decoded */
+    struct _sample *samples;  /* as decoded, the slots get copies */
+    uint32_t sample_count;
+    uint32_t data_bytes;
+    uint32_t refs;            /* data pointers handed to slots, not freed yet */
+    struct shared_data *nodes; /* one per sample */
+    struct shared_patch *next;
+};
+
+/* sample data to its patch */
+struct shared_data {
+    const void *data;
+    struct shared_patch *patch;
+    struct shared_data *next;
+};
+
+static struct shared_patch *shared_patches;
+static struct shared_data *data_buckets[DATA_BUCKETS];
+
+#ifdef __EMSCRIPTEN__
+#define lock()
+#define unlock()
+#else
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#define lock() pthread_mutex_lock(&shared_lock)
+#define unlock() pthread_mutex_unlock(&shared_lock)
+#endif
+
+static struct shared_data **data_bucket(const void *data) {
+    return &data_buckets[((uintptr_t) data >> 4) % DATA_BUCKETS];
+}
+
+/* FNV-1a of the whole file, 0 when it cannot be read */
+static uint64_t hash_file(const char *filename) {
+    uint64_t hash = 14695981039346656037ULL;
+    uint8_t buffer[4096];
+    size_t res, i;
+    FILE *file = fopen(filename, "rb");
+
+    if (file == NULL)
+        return (0);
+    while ((res = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        for (i = 0; i < res; i++) {
+            hash ^= buffer[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+    fclose(file);
+    return (hash);
+}
+
+/* copies of the patch's sample structs for one slot, under the lock */
+static struct _sample *slot_samples(struct shared_patch *patch) {
+    struct _sample *first = NULL;
+    struct _sample **link = &first;
+    struct _sample *sample;
+
+    for (sample = patch->samples; sample != NULL; sample = sample->next) {
+        struct _sample *copy = malloc(sizeof(struct _sample));
+
+        if (copy == NULL)
+            goto fail;
+        memcpy(copy, sample, sizeof(struct _sample));
+        copy->next = NULL;
+        *link = copy;
+        link = &copy->next;
+    }
+    patch->refs += patch->sample_count;
+    return (first);
+
+fail:
+    _WM_GLOBAL_ERROR(__FUNCTION__, __LINE__, WM_ERR_MEM, NULL, errno);
+    while (first) {
+        sample = first->next;
+        (free)(first); /* plain heap, wwm_lib_free would take the lock again */
+        first = sample;
+    }
+    return (NULL);
+}
+
+/*
+ * The slot's samples of a patch already loaded, NULL when there is none:
+ * the one of the bank entry, or else a decoded one by hash or by path.
+ */
+static struct _sample *find_shared(const struct wwm_bank_entry *entry, const char *path, int fix_release, uint64_t hash) {
+    struct shared_patch *patch;
+    struct _sample *samples = NULL;
+
+    lock();
+    for (patch = shared_patches; patch != NULL; patch = patch->next) {
+        if (patch->entry != entry)
+            continue;
+        if (entry == NULL && (patch->fix_release != fix_release
+                || (hash ? patch->hash != hash : strcmp(patch->path, path) != 0)))
+            continue;
+        samples = slot_samples(patch);
+        break;
+    }
+    unlock();
+    return (samples);
+}
+
+static void free_samples(struct _sample *samples) {
+    while (samples) {
+        struct _sample *next = samples->next;
+        free(samples->data);
+        free(samples);
+        samples = next;
+    }
+}
+
+/* takes a patch out of the lists, under the lock */
+static void unlink_shared(struct shared_patch *patch) {
+    struct shared_data **link;
+    struct shared_patch **plink;
+    struct _sample *sample;
+
+    for (sample = patch->samples; sample != NULL; sample = sample->next) {
+        for (link = data_bucket(sample->data); (*link)->data != sample->data; link = &(*link)->next);
+        *link = (*link)->next;
+    }
+    for (plink = &shared_patches; *plink != patch; plink = &(*plink)->next);
+    *plink = patch->next;
+}
+
+/* after unlocking, these frees come back through wwm_lib_free */
+static void free_shared(struct shared_patch *patch) {
+    struct _sample *sample;
+
+    /* the synth keeps rendered notes by their data */
+    for (sample = patch->samples; sample != NULL; sample = sample->next)
+        wwm_synth_cache_forget(sample->data);
+    free_samples(patch->samples);
+    free(patch->nodes);
+    free(patch->path);
+    free(patch);
+}
+
+/* keeps samples as a shared patch and returns the slot's copies */
+static struct _sample *add_shared(const struct wwm_bank_entry *entry, const char *path, int fix_release, uint64_t hash, struct _sample *samples) {
+    struct shared_patch *patch = calloc(1, sizeof(struct shared_patch));
+    struct shared_data *nodes;
+    struct _sample *sample;
+    uint32_t i = 0;
+
+    if (patch != NULL) {
+        patch->path = strdup(path);
+        patch->fix_release = fix_release;
+        patch->entry = entry;
+        patch->hash = hash;
+        patch->samples = samples;
+        for (sample = samples; sample != NULL; sample = sample->next) {
+            patch->sample_count++;
+            patch->data_bytes += SAMPLE_DATA_BYTES(sample);
+        }
+    }
+    nodes = (patch != NULL) ? malloc(patch->sample_count * sizeof(struct shared_data)) : NULL;
+    if (patch == NULL || patch->path == NULL || nodes == NULL) {
+        _WM_GLOBAL_ERROR(__FUNCTION__, __LINE__, WM_ERR_MEM, NULL, errno);
+        if (patch != NULL)
+            free(patch->path);
+        free(patch);
+        free(nodes);
+        free_samples(samples);
+        return (NULL);
+    }
+    patch->nodes = nodes;
+
+    lock();
+    for (sample = samples; sample != NULL; sample = sample->next, i++) {
+        struct shared_data **bucket = data_bucket(sample->data);
+
+        nodes[i].data = sample->data;
+        nodes[i].patch = patch;
+        nodes[i].next = *bucket;
+        *bucket = &nodes[i];
+    }
+    patch->next = shared_patches;
+    shared_patches = patch;
+    samples = slot_samples(patch);
+    if (samples == NULL)
+        unlink_shared(patch);
+    unlock();
+
+    if (samples == NULL)
+        free_shared(patch);
+    return (samples);
+}
+
+int wwm_gus_pat_release(void *data) {
+    struct shared_data **link;
+    struct shared_patch *patch = NULL;
+
+    lock();
+    for (link = data_bucket(data); *link != NULL; link = &(*link)->next) {
+        if ((*link)->data == data) {
+            patch = (*link)->patch;
+            break;
+        }
+    }
+    if (patch == NULL || --patch->refs != 0) {
+        unlock();
+        return (patch != NULL);
+    }
+
+    /* the last slot let go of it, nothing points into it any more */
+    unlink_shared(patch);
+    unlock();
+
+    free_shared(patch);
+    return (1);
+}
+
+int wwm_patch_memory(void (*fn)(void *ctx, const struct wwm_patch_memory *patch), void *ctx) {
+    struct shared_patch *patch;
+    int count = 0;
+
+    lock();
+    for (patch = shared_patches; patch != NULL; patch = patch->next, count++) {
+        struct wwm_patch_memory memory;
+        uint32_t structs = patch->sample_count * sizeof(struct _sample);
+
+        memory.path = patch->path;
+        memory.samples = patch->sample_count;
+        memory.slots = patch->sample_count ? patch->refs / patch->sample_count : 0;
+        memory.data_bytes = patch->data_bytes;
+        memory.bytes = patch->data_bytes + structs * (memory.slots + 1);
+        memory.unshared_bytes = (patch->data_bytes + structs) * memory.slots;
+        if (fn != NULL)
+            fn(ctx, &memory);
+    }
+    unlock();
+    return (count);
+}
+
+/* patches outlive the song that loads them, so they stay out of its arena */
+struct _sample *_WM_load_gus_pat(const char *filename, int fix_release) {
+    wwm_arena *song = wwm_arena_enter(NULL);
+    char path[PATH_MAX];
+    const struct wwm_bank_entry *entry;
+    struct _sample *samples;
+    uint64_t hash = 0;
+
+    if (realpath(filename, path) == NULL) {
+        strncpy(path, filename, sizeof(path) - 1);
+        path[sizeof(path) - 1] = 0;
+    }
+
+    /* envelopes in the bank only hold at the rate it was built for */
+    entry = (wwm_patbank_rate() == _WM_SampleRate) ? wwm_patbank_find(filename, fix_release) : NULL;
+    if (entry != NULL && entry->sample_count != 0) {
+        samples = find_shared(entry, path, fix_release, 0);
+        if (samples == NULL) {
+            samples = samples_from_bank(entry);
+            if (samples != NULL)
+                samples = add_shared(entry, path, fix_release, 0, samples);
+        }
+        if (samples != NULL)
+            goto done;
+    }
+
+    /* the same path for another slot, or the same file under another path */
+    samples = find_shared(NULL, path, fix_release, 0);
+    if (samples == NULL) {
+        hash = hash_file(filename);
+        if (hash != 0)
+            samples = find_shared(NULL, path, fix_release, hash);
+    }
+    if (samples == NULL) {
+        samples = _WM_decode_gus_pat(filename, fix_release);
+        if (samples != NULL)
+            samples = add_shared(NULL, path, fix_release, hash, samples);
+    }
+
+done:
+    wwm_arena_enter(song);
+    return (samples);
+}
+
+/* for wwm_mkbank */
+int wwm_gus_pat_decode(const char *filename, int fix_release, wwm_sample_sink sink, void *ctx) {
+    struct _sample *samples = _WM_decode_gus_pat(filename, fix_release);
+    struct _sample *sample;
+    int res = 0;
+
+    if (samples == NULL)
+        return (-1);
+
+    for (sample = samples; sample != NULL && res == 0; sample = sample->next) {
+        /* no heap addresses in the bank, it builds the same every time */
+        struct _sample record;
+
+        memcpy(&record, sample, sizeof(record));
+        record.data = NULL;
+        record.next = NULL;
+        res = sink(ctx, &record, sizeof(struct _sample), sample->data, SAMPLE_DATA_BYTES(sample));
+    }
+
+    while (samples) {
+        sample = samples->next;
+        free(samples->data);
+        free(samples);
+        samples = sample;
+    }
+    return (res);
+}
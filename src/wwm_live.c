@@ -0,0 +1,255 @@
+/*
+ * wwm_live.c -- the synth as an instrument, played from midi events
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* struct _mdi and its event handlers, in the order internal_midi.c includes them */
+#include "common.h"
+#include "reverb.h"
+#include "internal_midi.h"
+
+#include "wwm.h"
+#include "wwm_live.h"
+#include "wwm_scan.h"
+
+struct wwm_live_event {
+    uint32_t frame;
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+};
+
+struct wwm_live {
+    midi *handle;
+    uint32_t clock;
+    struct wwm_live_stats stats;
+    /* free running, head is only written by the consumer, tail by the producer */
+    uint32_t head;
+    uint32_t tail;
+    struct wwm_live_event queue[WWM_LIVE_QUEUE];
+};
+
+/*
+ * A format 0 midi that plays nothing: a program change for every program
+ * and a note of every drum wanted, all at tick 0, which is what makes
+ * WildMidi_OpenBuffer load their patches.
+ */
+#define PATCH_MIDI_SIZE (14 + 8 + 128 * 3 + 128 * 8 + 4)
+
+static uint32_t patch_midi(const uint8_t *used, uint8_t *out) {
+    static const uint8_t header[] = {
+        'M', 'T', 'h', 'd', 0, 0, 0, 6, 0, 0, 0, 1, 0, 96,
+        'M', 'T', 'r', 'k', 0, 0, 0, 0
+    };
+    uint8_t *p = out + sizeof(header);
+    uint32_t track;
+    int i;
+
+    memcpy(out, header, sizeof(header));
+    for (i = 0; i < 128; i++) {
+        if (used == NULL || used[i]) {
+            *p++ = 0; *p++ = 0xC0; *p++ = (uint8_t) i;
+        }
+    }
+    for (i = 0; i < 128; i++) {
+        if (used == NULL || used[WWM_SCAN_DRUMS + i]) {
+            *p++ = 0; *p++ = 0x99; *p++ = (uint8_t) i; *p++ = 1;
+            *p++ = 0; *p++ = 0x89; *p++ = (uint8_t) i; *p++ = 0;
+        }
+    }
+    *p++ = 0; *p++ = 0xFF; *p++ = 0x2F; *p++ = 0;
+
+    track = (uint32_t) (p - out - sizeof(header));
+    out[18] = (uint8_t) (track >> 24);
+    out[19] = (uint8_t) (track >> 16);
+    out[20] = (uint8_t) (track >> 8);
+    out[21] = (uint8_t) track;
+    return ((uint32_t) (p - out));
+}
+
+/*
+ * Controllers as _WM_SetupMidiEvent maps them, the rest (sound controllers,
+ * effects depths) the file player ignores as well.
+ */
+typedef void (*control_fn)(struct _mdi *mdi, struct _event_data *data);
+
+static const control_fn controls[128] = {
+    [0] = _WM_do_control_bank_select,
+    [6] = _WM_do_control_data_entry_course,
+    [7] = _WM_do_control_channel_volume,
+    [8] = _WM_do_control_channel_balance,
+    [10] = _WM_do_control_channel_pan,
+    [11] = _WM_do_control_channel_expression,
+    [38] = _WM_do_control_data_entry_fine,
+    [64] = _WM_do_control_channel_hold,
+    [96] = _WM_do_control_data_increment,
+    [97] = _WM_do_control_data_decrement,
+    [98] = _WM_do_control_non_registered_param_fine,
+    [99] = _WM_do_control_non_registered_param_course,
+    [100] = _WM_do_control_registered_param_fine,
+    [101] = _WM_do_control_registered_param_course,
+    [120] = _WM_do_control_channel_sound_off,
+    [121] = _WM_do_control_channel_controllers_off,
+    [123] = _WM_do_control_channel_notes_off,
+};
+
+static void apply(struct _mdi *mdi, const struct wwm_live_event *event) {
+    struct _event_data data;
+
+    data.channel = event->status & 0x0f;
+    switch (event->status & 0xf0) {
+    case 0x80:
+        data.data.value = (event->data1 << 8) | event->data2;
+        _WM_do_note_off(mdi, &data);
+        break;
+    case 0x90:
+        data.data.value = (event->data1 << 8) | event->data2;
+        if (event->data2 == 0)
+            _WM_do_note_off(mdi, &data);
+        else
+            _WM_do_note_on(mdi, &data);
+        break;
+    case 0xA0:
+        data.data.value = (event->data1 << 8) | event->data2;
+        _WM_do_aftertouch(mdi, &data);
+        break;
+    case 0xB0:
+        data.data.value = event->data2;
+        if (controls[event->data1 & 0x7f] != NULL)
+            controls[event->data1 & 0x7f](mdi, &data);
+        break;
+    case 0xC0:
+        data.data.value = event->data1;
+        _WM_do_patch(mdi, &data);
+        break;
+    case 0xD0:
+        data.data.value = event->data1;
+        _WM_do_channel_pressure(mdi, &data);
+        break;
+    case 0xE0:
+        data.data.value = event->data1 | (event->data2 << 7);
+        _WM_do_pitch(mdi, &data);
+        break;
+    default:
+        break; /* system messages */
+    }
+}
+
+wwm_live *wwm_live_open(const uint8_t *used) {
+    uint8_t midi_data[PATCH_MIDI_SIZE];
+    uint32_t size = patch_midi(used, midi_data);
+    unsigned long int past_setup = 1;
+    struct _event_data data;
+    struct _mdi *mdi;
+    wwm_live *live;
+
+    live = calloc(1, sizeof(*live));
+    if (live == NULL)
+        return (NULL);
+
+    live->handle = wwm_open_handle_memory(midi_data, size);
+    if (live->handle == NULL) {
+        free(live);
+        return (NULL);
+    }
+    mdi = (struct _mdi *) live->handle;
+
+    /*
+     * Never ends. The setup events are run by seeking past them, which
+     * drops their notes, then every channel starts from its defaults.
+     */
+    mdi->extra_info.approx_total_samples = UINT32_MAX;
+    WildMidi_FastSeek(live->handle, &past_setup);
+    for (data.channel = 0; data.channel < 16; data.channel++) {
+        data.data.value = 0;
+        _WM_do_control_channel_controllers_off(mdi, &data);
+        _WM_do_patch(mdi, &data);
+    }
+    return (live);
+}
+
+void wwm_live_close(wwm_live *live) {
+    if (live == NULL)
+        return;
+
+    wwm_close_handle(live->handle);
+    free(live);
+}
+
+midi *wwm_live_handle(wwm_live *live) {
+    return (live->handle);
+}
+
+int wwm_live_push(wwm_live *live, uint32_t frame, uint8_t status, uint8_t data1, uint8_t data2) {
+    uint32_t tail = __atomic_load_n(&live->tail, __ATOMIC_RELAXED);
+    struct wwm_live_event *event;
+
+    if (tail - __atomic_load_n(&live->head, __ATOMIC_ACQUIRE) == WWM_LIVE_QUEUE) {
+        __atomic_add_fetch(&live->stats.dropped, 1, __ATOMIC_RELAXED);
+        return (-1);
+    }
+
+    event = &live->queue[tail % WWM_LIVE_QUEUE];
+    event->frame = frame;
+    event->status = status;
+    event->data1 = data1 & 0x7f;
+    event->data2 = data2 & 0x7f;
+    __atomic_store_n(&live->tail, tail + 1, __ATOMIC_RELEASE);
+    return (0);
+}
+
+/* the next queued event, NULL when there is none */
+static const struct wwm_live_event *peek(wwm_live *live) {
+    if (live->head == __atomic_load_n(&live->tail, __ATOMIC_ACQUIRE))
+        return (NULL);
+    return (&live->queue[live->head % WWM_LIVE_QUEUE]);
+}
+
+/* frames from the live clock to frame, 0 when it is due (wraps after ~27h at 44.1k) */
+static uint32_t frames_until(const wwm_live *live, uint32_t frame) {
+    int32_t ahead = (int32_t) (frame - live->clock);
+    return (ahead > 0 ? (uint32_t) ahead : 0);
+}
+
+int wwm_live_render(wwm_live *live, int16_t *out, int frames) {
+    struct _mdi *mdi = (struct _mdi *) live->handle;
+    uint32_t block_start = live->clock;
+    int done = 0;
+
+    while (done < frames) {
+        const struct wwm_live_event *event;
+        uint32_t run = (uint32_t) (frames - done);
+        int res;
+
+        while ((event = peek(live)) != NULL && frames_until(live, event->frame) == 0) {
+            if ((int32_t) (event->frame - block_start) < 0)
+                live->stats.late++;
+            apply(mdi, event);
+            live->stats.events++;
+            live->stats.last_frame = live->clock;
+            __atomic_store_n(&live->head, live->head + 1, __ATOMIC_RELEASE);
+        }
+        if (event != NULL && frames_until(live, event->frame) < run)
+            run = frames_until(live, event->frame);
+
+        res = WildMidi_GetOutput(live->handle, (int8_t *) (out + done * 2), run * 4);
+        if (res <= 0)
+            break;
+        live->clock += res / 4;
+        done += res / 4;
+    }
+    return (done);
+}
+
+uint32_t wwm_live_clock(const wwm_live *live) {
+    return (live->clock);
+}
+
+const struct wwm_live_stats *wwm_live_stats(const wwm_live *live) {
+    return (&live->stats);
+}
@@ -0,0 +1,57 @@
+/*
+ * wwm_live.h -- the synth as an instrument, played from midi events
+ *
+ * A live song is opened from a generated midi file that only loads the
+ * patches (all of them, or those of a wwm_scan_patches style list) and
+ * then plays forever. Raw midi messages go through a lock-free queue, one
+ * producer thread (Web MIDI through the worker, a sequencer thread
+ * natively) and the rendering thread as consumer. Every event carries the
+ * frame of the live clock (frames rendered since opening) it is due at,
+ * rendering splits its block there, so the event sounds on that exact
+ * sample. Events due before the block being rendered are applied at its
+ * start and counted as late.
+ *
+ * Events are applied through libWildMidi's own event handlers (struct
+ * _mdi, internal_midi.h), the same the file player runs.
+ */
+
+#ifndef WWM_LIVE_H
+#define WWM_LIVE_H
+
+#include <stdint.h>
+
+#include "wildmidi_lib.h"
+
+#define WWM_LIVE_QUEUE 1024 /* events, a power of two */
+
+typedef struct wwm_live wwm_live;
+
+struct wwm_live_stats {
+    uint32_t events;        /* applied */
+    uint32_t late;          /* applied after the frame they were due at */
+    uint32_t dropped;       /* the queue was full */
+    uint32_t last_frame;    /* live clock the last event was applied at */
+};
+
+/*
+ * After wwm_init. used: 256 flags as filled by wwm_scan_patches (programs,
+ * then drum notes), NULL loads every patch of the config.
+ */
+wwm_live *wwm_live_open(const uint8_t *used);
+void wwm_live_close(wwm_live *live);
+
+/* the handle, for options and voices, closed with the live song */
+midi *wwm_live_handle(wwm_live *live);
+
+/* producer: a midi channel message due at frame, in frame order. 0 or -1 when full */
+int wwm_live_push(wwm_live *live, uint32_t frame, uint8_t status, uint8_t data1, uint8_t data2);
+
+/* consumer: renders frames of stereo16 with the events due in them, returns frames */
+int wwm_live_render(wwm_live *live, int16_t *out, int frames);
+
+/* frames rendered so far */
+uint32_t wwm_live_clock(const wwm_live *live);
+
+const struct wwm_live_stats *wwm_live_stats(const wwm_live *live);
+
+#endif /* WWM_LIVE_H */
@@ -0,0 +1,259 @@
+/*
+ * wwm_mixer.c -- several songs mixed into one output
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* struct _mdi and the reverb, in the order internal_midi.c includes them */
+#include "common.h"
+#include "reverb.h"
+#include "internal_midi.h"
+
+#include "wwm.h"
+#include "wwm_mixer.h"
+#include "wwm_pcm.h"
+#include "wwm_seek.h"
+#include "wwm_synth.h"
+
+#define BLOCK_FRAMES 1024
+
+struct stream {
+    midi *handle;             /* NULL for a free slot */
+    wwm_seek_index *seek;
+    uint32_t start;           /* mixer frame it starts sounding at */
+    int16_t gain;             /* Q14 */
+    uint32_t loop_start;
+    uint32_t loop_end;        /* 0 for the end of the song */
+    int loops;                /* passes left, -1 forever */
+    uint32_t pass_frames;     /* rendered since the last loop */
+    int done;
+};
+
+struct wwm_mixer {
+    struct _rvb *reverb;      /* NULL when off */
+    uint32_t position;
+    struct stream streams[WWM_MIXER_STREAMS];
+    int32_t mix[BLOCK_FRAMES * 2];
+};
+
+static struct stream *stream_of(const wwm_mixer *mixer, int id) {
+    if (id < 0 || id >= WWM_MIXER_STREAMS || mixer->streams[id].handle == NULL)
+        return (NULL);
+    return ((struct stream *) &mixer->streams[id]);
+}
+
+static uint32_t song_position(const struct stream *stream) {
+    return ((struct _mdi *) stream->handle)->extra_info.current_sample;
+}
+
+wwm_mixer *wwm_mixer_new(int reverb) {
+    wwm_mixer *mixer;
+
+    if (!wwm_initialized())
+        return (NULL);
+
+    mixer = calloc(1, sizeof(*mixer));
+    if (mixer == NULL)
+        return (NULL);
+
+    /* the room of the config, as WildMidi_Open sets it up for a song */
+    if (reverb) {
+        mixer->reverb = _WM_init_reverb(wwm_rate(), _WM_reverb_room_width, _WM_reverb_room_length,
+                                        _WM_reverb_listen_posx, _WM_reverb_listen_posy);
+        if (mixer->reverb == NULL) {
+            free(mixer);
+            return (NULL);
+        }
+    }
+    return (mixer);
+}
+
+void wwm_mixer_free(wwm_mixer *mixer) {
+    int i;
+
+    if (mixer == NULL)
+        return;
+
+    for (i = 0; i < WWM_MIXER_STREAMS; i++)
+        wwm_mixer_remove(mixer, i);
+    if (mixer->reverb != NULL)
+        _WM_free_reverb(mixer->reverb);
+    free(mixer);
+}
+
+static int add_stream(wwm_mixer *mixer, midi *handle, uint32_t start) {
+    struct stream *stream = NULL;
+    int id;
+
+    if (handle == NULL)
+        return (-1);
+
+    for (id = 0; id < WWM_MIXER_STREAMS; id++) {
+        if (mixer->streams[id].handle == NULL) {
+            stream = &mixer->streams[id];
+            break;
+        }
+    }
+    if (stream == NULL) {
+        wwm_close_handle(handle);
+        return (-1);
+    }
+
+    /* the mixer has the reverb */
+    WildMidi_SetOption(handle, WM_MO_REVERB, 0);
+
+    memset(stream, 0, sizeof(*stream));
+    stream->handle = handle;
+    stream->seek = wwm_seek_new(handle, (uint32_t) ((uint64_t) wwm_rate() * WWM_SEEK_INTERVAL_MS / 1000));
+    stream->start = start;
+    stream->gain = WWM_GAIN_UNITY;
+    return (id);
+}
+
+int wwm_mixer_add(wwm_mixer *mixer, const char *midi_file, uint32_t start) {
+    return add_stream(mixer, wwm_open_handle(midi_file), start);
+}
+
+int wwm_mixer_add_memory(wwm_mixer *mixer, const uint8_t *data, uint32_t size, uint32_t start) {
+    return add_stream(mixer, wwm_open_handle_memory(data, size), start);
+}
+
+void wwm_mixer_remove(wwm_mixer *mixer, int id) {
+    struct stream *stream = stream_of(mixer, id);
+
+    if (stream == NULL)
+        return;
+
+    wwm_seek_free(stream->seek);
+    wwm_close_handle(stream->handle);
+    stream->handle = NULL;
+}
+
+void wwm_mixer_set_gain(wwm_mixer *mixer, int id, float gain) {
+    struct stream *stream = stream_of(mixer, id);
+    float q14 = gain * WWM_GAIN_UNITY;
+
+    if (stream == NULL)
+        return;
+
+    stream->gain = q14 <= 0 ? 0 : q14 >= 32767 ? 32767 : (int16_t) (q14 + 0.5f);
+}
+
+void wwm_mixer_set_loop(wwm_mixer *mixer, int id, uint32_t loop_start, uint32_t loop_end, int count) {
+    struct stream *stream = stream_of(mixer, id);
+
+    if (stream == NULL)
+        return;
+
+    if (loop_end != 0 && loop_end <= loop_start)
+        count = 0;
+    stream->loop_start = loop_start;
+    stream->loop_end = loop_end;
+    stream->loops = count < 0 ? -1 : count;
+    stream->pass_frames = 0;
+}
+
+int wwm_mixer_playing(const wwm_mixer *mixer, int id) {
+    const struct stream *stream = stream_of(mixer, id);
+
+    return (stream != NULL && !stream->done);
+}
+
+static void loop_back(struct stream *stream) {
+    unsigned long int sample = stream->loop_start;
+
+    /* a loop that renders nothing would spin forever */
+    if (stream->pass_frames == 0) {
+        stream->done = 1;
+        return;
+    }
+    if (stream->loops > 0)
+        stream->loops--;
+    stream->pass_frames = 0;
+
+    if (stream->seek != NULL ? wwm_seek_to(stream->seek, stream->loop_start) == -1
+                             : WildMidi_FastSeek(stream->handle, &sample) == -1)
+        stream->done = 1;
+}
+
+/* adds up to frames of the stream into mix, before any clipping */
+static void mix_stream(struct stream *stream, int32_t *mix, int frames) {
+    while (frames > 0 && !stream->done) {
+        uint32_t current = song_position(stream);
+        int want = frames;
+        int res;
+
+        if (stream->loops != 0 && stream->loop_end != 0) {
+            if (current >= stream->loop_end) {
+                loop_back(stream);
+                continue;
+            }
+            if (stream->loop_end - current < (uint32_t) want)
+                want = stream->loop_end - current;
+        }
+
+        res = wwm_synth_mix(stream->handle, mix, want, stream->gain);
+        if (res <= 0) {
+            /* the end of the song */
+            if (stream->loops != 0)
+                loop_back(stream);
+            else
+                stream->done = 1;
+            continue;
+        }
+
+        if (stream->seek != NULL)
+            wwm_seek_record(stream->seek);
+        stream->pass_frames += res;
+        mix += res * 2;
+        frames -= res;
+    }
+}
+
+void wwm_mixer_render(wwm_mixer *mixer, int16_t *out, int frames) {
+    while (frames > 0) {
+        int block = frames < BLOCK_FRAMES ? frames : BLOCK_FRAMES;
+        int i;
+
+        memset(mixer->mix, 0, block * 2 * sizeof(int32_t));
+        for (i = 0; i < WWM_MIXER_STREAMS; i++) {
+            struct stream *stream = &mixer->streams[i];
+            uint32_t wait;
+
+            if (stream->handle == NULL || stream->done)
+                continue;
+
+            wait = stream->start > mixer->position ? stream->start - mixer->position : 0;
+            if (wait < (uint32_t) block)
+                mix_stream(stream, mixer->mix + wait * 2, block - wait);
+        }
+
+        /* the pass every song would have run on its own */
+        if (mixer->reverb != NULL)
+            _WM_do_reverb(mixer->reverb, mixer->mix, block * 2);
+
+        /* the streams' sum is clipped once, here */
+        wwm_mix_to_s16(mixer->mix, out, block);
+        mixer->position += block;
+        out += block * 2;
+        frames -= block;
+    }
+}
+
+uint32_t wwm_mixer_position(const wwm_mixer *mixer) {
+    return (mixer->position);
+}
+
+int wwm_mixer_voices(const wwm_mixer *mixer) {
+    int voices = 0, i;
+
+    for (i = 0; i < WWM_MIXER_STREAMS; i++) {
+        if (mixer->streams[i].handle != NULL)
+            voices += wwm_voices(mixer->streams[i].handle);
+    }
+    return (voices);
+}
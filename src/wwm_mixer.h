@@ -0,0 +1,71 @@
+/*
+ * wwm_mixer.h -- several songs mixed into one output
+ *
+ * Background music with stingers on top, all in the one synth of wwm.c:
+ * the streams share its loaded patches, render dry and get one reverb pass
+ * over their mix, so the cost grows with the voices sounding rather than
+ * with the number of streams. They add into the mix before clipping
+ * (wwm_synth_mix), only the sum is clipped to stereo16.
+ *
+ * Every stream has a gain, the mixer frame it starts at and optionally a
+ * loop. A loop jumps back to its start through the stream's seek index
+ * (wwm_seek.h), sample exact; notes sounding at the loop end are cut as a
+ * FastSeek cuts them.
+ *
+ * A mixer is rendered from one thread, add and remove streams on that
+ * thread between renders.
+ */
+
+#ifndef WWM_MIXER_H
+#define WWM_MIXER_H
+
+#include <stdint.h>
+
+#define WWM_MIXER_STREAMS 16
+
+typedef struct wwm_mixer wwm_mixer;
+
+/* after wwm_init, at its rate. reverb: one reverb pass over the mix */
+wwm_mixer *wwm_mixer_new(int reverb);
+
+/* closes the streams still in it */
+void wwm_mixer_free(wwm_mixer *mixer);
+
+/*
+ * Opens a song as a stream that starts sounding at mixer frame start (now
+ * when that has passed), gain 1, no loop. Returns the stream id or -1.
+ */
+int wwm_mixer_add(wwm_mixer *mixer, const char *midi_file, uint32_t start);
+
+/* the same for a song in memory, data may be freed once it returns */
+int wwm_mixer_add_memory(wwm_mixer *mixer, const uint8_t *data, uint32_t size, uint32_t start);
+
+/* closes a stream, finished or not */
+void wwm_mixer_remove(wwm_mixer *mixer, int id);
+
+/* linear, 1.0 leaves the song as rendered, up to 2.0 */
+void wwm_mixer_set_gain(wwm_mixer *mixer, int id, float gain);
+
+/*
+ * Plays loop_start to loop_end (song frames, 0 for the end of the song)
+ * count more times after the first pass, forever for -1. count 0 ends
+ * looping.
+ */
+void wwm_mixer_set_loop(wwm_mixer *mixer, int id, uint32_t loop_start, uint32_t loop_end, int count);
+
+/* whether a stream still has frames to play (waiting for its start counts) */
+int wwm_mixer_playing(const wwm_mixer *mixer, int id);
+
+/*
+ * Renders frames of interleaved stereo16, silence where no stream plays.
+ * Finished streams stay in the mixer until they are removed.
+ */
+void wwm_mixer_render(wwm_mixer *mixer, int16_t *out, int frames);
+
+/* frames rendered so far */
+uint32_t wwm_mixer_position(const wwm_mixer *mixer);
+
+/* voices sounding over all streams */
+int wwm_mixer_voices(const wwm_mixer *mixer);
+
+#endif /* WWM_MIXER_H */
@@ -0,0 +1,322 @@
+/*
+ * wwm_mkbank.c -- builds a pre-decoded patch bank (see wwm_patbank.h)
+ *
+ *   node make native
+ *   ./wwm_mkbank -c freepats/freepats.cfg -o freepats-48000.bank -R 48000
+ *
+ * Envelope rates are decoded for an output rate, a bank only serves synths
+ * running at the rate it was built for.
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "wildmidi_lib.h"
+#include "wildwebmidi.h"
+#include "wwm_patbank.h"
+
+#define MAX_PATCHES 1024
+
+struct bank_sample {
+    uint8_t *sample;
+    uint8_t *data;
+    uint32_t data_bytes;
+    struct bank_sample *next;
+};
+
+struct bank_patch {
+    char *name;
+    uint32_t sample_count;
+    struct bank_sample *first;
+    struct bank_sample **last;
+};
+
+static struct bank_patch patches[MAX_PATCHES];
+static int patch_count;
+static int fix_release;
+
+static void add_patch(const char *dir, const char *file) {
+    char name[1024];
+    int i;
+
+    snprintf(name, sizeof(name), "%s%s%s", dir, dir[0] ? "/" : "", file);
+    if (strlen(name) < 4 || strcasecmp(&name[strlen(name) - 4], ".pat") != 0)
+        strncat(name, ".pat", sizeof(name) - strlen(name) - 1);
+
+    for (i = 0; i < patch_count; i++) {
+        if (strcmp(patches[i].name, name) == 0)
+            return;
+    }
+    if (patch_count == MAX_PATCHES) {
+        fprintf(stderr, "Warning: too many patches, skipping %s\n", name);
+        return;
+    }
+
+    patches[patch_count].name = strdup(name);
+    patches[patch_count].last = &patches[patch_count].first;
+    patch_count++;
+}
+
+/* collects the patch files of every bank and drumset in a timidity style config */
+static int read_config(const char *config_file) {
+    char line[1024];
+    char dir[1024] = "";
+    FILE *cfg = fopen(config_file, "r");
+
+    if (cfg == NULL) {
+        fprintf(stderr, "Error: unable to open %s\n", config_file);
+        return (-1);
+    }
+
+    while (fgets(line, sizeof(line), cfg)) {
+        char *words[2];
+        char *save = NULL;
+
+        if (strchr(line, '#'))
+            *strchr(line, '#') = '\0';
+        words[0] = strtok_r(line, " \t\r\n", &save);
+        words[1] = strtok_r(NULL, " \t\r\n", &save);
+        if (words[0] == NULL)
+            continue;
+
+        if (strcmp(words[0], "dir") == 0 && words[1]) {
+            snprintf(dir, sizeof(dir), "%s", words[1]);
+        } else if (strcmp(words[0], "guspat_editor_author_cant_read_so_fix_release_time_for_me") == 0) {
+            fix_release = 1;
+        } else if (isdigit((unsigned char) words[0][0]) && words[1]) {
+            add_patch(dir, words[1]);
+        }
+    }
+
+    fclose(cfg);
+    return (0);
+}
+
+static void free_sample(struct bank_sample *bs) {
+    free(bs->sample);
+    free(bs->data);
+    free(bs);
+}
+
+/* drops what was collected of a patch, for one that failed to decode */
+static void free_patch_samples(struct bank_patch *patch) {
+    while (patch->first) {
+        struct bank_sample *next = patch->first->next;
+        free_sample(patch->first);
+        patch->first = next;
+    }
+    patch->last = &patch->first;
+    patch->sample_count = 0;
+}
+
+static int collect_sample(void *ctx, const void *sample, uint32_t sample_size,
+                          const int16_t *data, uint32_t data_bytes) {
+    struct bank_patch *patch = ctx;
+    struct bank_sample *bs = calloc(1, sizeof(*bs));
+
+    if (bs == NULL || (bs->sample = malloc(sample_size)) == NULL
+            || (bs->data = malloc(data_bytes)) == NULL) {
+        fprintf(stderr, "Error: not enough memory\n");
+        if (bs != NULL)
+            free_sample(bs);
+        return (-1);
+    }
+    memcpy(bs->sample, sample, sample_size);
+    memcpy(bs->data, data, data_bytes);
+    bs->data_bytes = data_bytes;
+
+    *patch->last = bs;
+    patch->last = &bs->next;
+    patch->sample_count++;
+    return (0);
+}
+
+static void write_padding(FILE *out, uint32_t *pos, uint32_t to) {
+    while (*pos < to) {
+        fputc(0, out);
+        (*pos)++;
+    }
+}
+
+static int write_bank(const char *bank_file, int rate) {
+    uint32_t sample_size = wwm_gus_pat_sample_size();
+    uint32_t record_size = WWM_BANK_RECORD_SIZE(sample_size);
+    struct wwm_bank_header header;
+    uint32_t records, data, names;
+    uint32_t sample_count = 0;
+    uint32_t pos, offset;
+    uint8_t *record;
+    FILE *out;
+    int i;
+
+    for (i = 0; i < patch_count; i++)
+        sample_count += patches[i].sample_count;
+
+    records = WWM_BANK_ALIGN(sizeof(header) + patch_count * sizeof(struct wwm_bank_entry));
+    data = records + sample_count * record_size;
+
+    names = data;
+    for (i = 0; i < patch_count; i++) {
+        struct bank_sample *bs;
+        for (bs = patches[i].first; bs; bs = bs->next)
+            names += WWM_BANK_ALIGN(bs->data_bytes);
+    }
+
+    out = fopen(bank_file, "wb");
+    if (out == NULL) {
+        fprintf(stderr, "Error: unable to open %s for writing\n", bank_file);
+        return (-1);
+    }
+
+    memcpy(header.magic, WWM_BANK_MAGIC, 4);
+    header.version = WWM_BANK_VERSION;
+    header.sample_size = sample_size;
+    header.entry_count = patch_count;
+    header.rate = rate;
+    fwrite(&header, sizeof(header), 1, out);
+    pos = sizeof(header);
+
+    /* entries */
+    offset = 0;
+    for (i = 0; i < patch_count; i++) {
+        struct wwm_bank_entry entry;
+        entry.name_offset = names;
+        entry.fix_release = fix_release;
+        entry.sample_count = patches[i].sample_count;
+        entry.first_record = records + offset * record_size;
+        fwrite(&entry, sizeof(entry), 1, out);
+        pos += sizeof(entry);
+
+        names += strlen(patches[i].name) + 1;
+        offset += patches[i].sample_count;
+    }
+    write_padding(out, &pos, records);
+
+    /* records */
+    record = calloc(1, record_size);
+    offset = data;
+    for (i = 0; i < patch_count; i++) {
+        struct bank_sample *bs;
+        for (bs = patches[i].first; bs; bs = bs->next) {
+            struct wwm_bank_record *rec = (struct wwm_bank_record *) record;
+            rec->data_offset = offset;
+            rec->data_bytes = bs->data_bytes;
+            memcpy(rec + 1, bs->sample, sample_size);
+            fwrite(record, record_size, 1, out);
+            pos += record_size;
+            offset += WWM_BANK_ALIGN(bs->data_bytes);
+        }
+    }
+    free(record);
+
+    /* sample data */
+    for (i = 0; i < patch_count; i++) {
+        struct bank_sample *bs;
+        for (bs = patches[i].first; bs; bs = bs->next) {
+            fwrite(bs->data, bs->data_bytes, 1, out);
+            pos += bs->data_bytes;
+            write_padding(out, &pos, WWM_BANK_ALIGN(pos));
+        }
+    }
+
+    /* names */
+    for (i = 0; i < patch_count; i++)
+        fwrite(patches[i].name, strlen(patches[i].name) + 1, 1, out);
+
+    if (fclose(out) != 0) {
+        fprintf(stderr, "Error: failed writing %s\n", bank_file);
+        return (-1);
+    }
+
+    printf("%s: %d patches, %u samples, %u bytes at %d Hz\n", bank_file, patch_count,
+           sample_count, names, rate);
+    return (0);
+}
+
+static void do_help(void) {
+    printf("Usage: wwm_mkbank [-c config] [-o bankfile]\n\n");
+    printf("  -c --config   config file (default freepats/freepats.cfg)\n");
+    printf("  -o --output   bank file (default freepats.bank)\n");
+    printf("  -R --rate     output rate the patches are decoded for (default %d)\n", WWM_DEFAULT_RATE);
+}
+
+static struct option const long_options[] = {
+    { "config", 1, 0, 'c' },
+    { "output", 1, 0, 'o' },
+    { "rate", 1, 0, 'R' },
+    { "help", 0, 0, 'h' },
+    { NULL, 0, NULL, 0 }
+};
+
+int main(int argc, char **argv) {
+    char *config_file = "freepats/freepats.cfg";
+    char *bank_file = "freepats.bank";
+    int rate = WWM_DEFAULT_RATE;
+    int res;
+    char config_dir[1024];
+    char *slash;
+    int i, c;
+
+    while ((c = getopt_long(argc, argv, "c:o:R:h", long_options, NULL)) != -1) {
+        switch (c) {
+        case 'c':
+            config_file = optarg;
+            break;
+        case 'o':
+            bank_file = optarg;
+            break;
+        case 'R':
+            rate = atoi(optarg);
+            break;
+        case 'h':
+            do_help();
+            return (0);
+        default:
+            do_help();
+            return (1);
+        }
+    }
+
+    if (rate < WWM_MIN_RATE || rate > WWM_MAX_RATE) {
+        fprintf(stderr, "Error: rate must be %d - %d\n", WWM_MIN_RATE, WWM_MAX_RATE);
+        return (1);
+    }
+    if (read_config(config_file) == -1)
+        return (1);
+
+    /* the decoder works out envelope rates for the library's output rate */
+    if (WildMidi_Init(config_file, rate, 0) == -1) {
+        fprintf(stderr, "Error: unable to initialize libWildMidi with %s\n", config_file);
+        return (1);
+    }
+
+    /* patch paths are relative to the config */
+    snprintf(config_dir, sizeof(config_dir), "%s", config_file);
+    slash = strrchr(config_dir, '/');
+    if (slash)
+        slash[1] = '\0';
+    else
+        config_dir[0] = '\0';
+
+    for (i = 0; i < patch_count; i++) {
+        char path[2048];
+
+        if (patches[i].name[0] == '/')
+            snprintf(path, sizeof(path), "%s", patches[i].name);
+        else
+            snprintf(path, sizeof(path), "%s%s", config_dir, patches[i].name);
+
+        if (wwm_gus_pat_decode(path, fix_release, collect_sample, &patches[i]) == -1) {
+            fprintf(stderr, "Warning: unable to decode %s, leaving it out\n", path);
+            free_patch_samples(&patches[i]);
+        }
+    }
+
+    res = write_bank(bank_file, rate);
+    WildMidi_Shutdown();
+    return (res == -1);
+}
@@ -0,0 +1,151 @@
+/*
+ * wwm_patbank.c -- pre-decoded patch bank
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "wwm_patbank.h"
+
+static const uint8_t *bank;
+static uint32_t bank_size;
+static int bank_mapped;
+
+static int check_bank(const uint8_t *data, uint32_t size) {
+    const struct wwm_bank_header *header = (const struct wwm_bank_header *) data;
+    const struct wwm_bank_entry *entry;
+    uint32_t record_size;
+    uint32_t i, j;
+
+    if (size < sizeof(*header) || memcmp(header->magic, WWM_BANK_MAGIC, 4) != 0) {
+        fprintf(stderr, "Error: not a patch bank\r\n");
+        return (-1);
+    }
+    if (header->version != WWM_BANK_VERSION
+            || header->sample_size != (uint32_t) wwm_gus_pat_sample_size()) {
+        fprintf(stderr, "Error: patch bank was built for another version, rebuild it\r\n");
+        return (-1);
+    }
+    if (sizeof(*header) + (uint64_t) header->entry_count * sizeof(struct wwm_bank_entry) > size) {
+        fprintf(stderr, "Error: truncated patch bank\r\n");
+        return (-1);
+    }
+
+    /* every record, its data and every name within the blob */
+    record_size = WWM_BANK_RECORD_SIZE(header->sample_size);
+    entry = (const struct wwm_bank_entry *) (data + sizeof(*header));
+    for (i = 0; i < header->entry_count; i++, entry++) {
+        if (entry->name_offset >= size
+                || memchr(data + entry->name_offset, 0, size - entry->name_offset) == NULL
+                || entry->first_record + (uint64_t) entry->sample_count * record_size > size)
+            goto corrupt;
+        for (j = 0; j < entry->sample_count; j++) {
+            const struct wwm_bank_record *record = (const struct wwm_bank_record *)
+                    (data + entry->first_record + j * record_size);
+
+            if (record->data_offset + (uint64_t) record->data_bytes > size)
+                goto corrupt;
+        }
+    }
+    return (0);
+
+corrupt:
+    fprintf(stderr, "Error: corrupt patch bank\r\n");
+    return (-1);
+}
+
+int wwm_patbank_use(const uint8_t *data, uint32_t size) {
+    wwm_patbank_close();
+
+    if (check_bank(data, size) == -1)
+        return (-1);
+
+    bank = data;
+    bank_size = size;
+    return (0);
+}
+
+int wwm_patbank_open(const char *bank_file) {
+    struct stat st;
+    void *data;
+    int fd;
+
+    fd = open(bank_file, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        fprintf(stderr, "Error: unable to open patch bank %s\r\n", bank_file);
+        if (fd >= 0)
+            close(fd);
+        return (-1);
+    }
+
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "Error: unable to map patch bank %s\r\n", bank_file);
+        return (-1);
+    }
+
+    if (wwm_patbank_use(data, st.st_size) == -1) {
+        munmap(data, st.st_size);
+        return (-1);
+    }
+    bank_mapped = 1;
+    return (0);
+}
+
+void wwm_patbank_close(void) {
+    if (bank_mapped)
+        munmap((void *) bank, bank_size);
+    bank = NULL;
+    bank_size = 0;
+    bank_mapped = 0;
+}
+
+const uint8_t *wwm_patbank_data(void) {
+    return bank;
+}
+
+int wwm_patbank_owns(const void *ptr) {
+    return (bank != NULL && (const uint8_t *) ptr >= bank && (const uint8_t *) ptr < bank + bank_size);
+}
+
+uint32_t wwm_patbank_rate(void) {
+    if (bank == NULL)
+        return (0);
+    return (((const struct wwm_bank_header *) bank)->rate);
+}
+
+/* names are relative to the config, filename is whatever the config resolved to */
+static int name_matches(const char *filename, const char *name) {
+    size_t flen = strlen(filename);
+    size_t nlen = strlen(name);
+
+    if (nlen > flen || strcmp(filename + flen - nlen, name) != 0)
+        return (0);
+    return (nlen == flen || filename[flen - nlen - 1] == '/');
+}
+
+const struct wwm_bank_entry *wwm_patbank_find(const char *filename, int fix_release) {
+    const struct wwm_bank_header *header;
+    const struct wwm_bank_entry *entry;
+    uint32_t i;
+
+    if (bank == NULL)
+        return (NULL);
+
+    header = (const struct wwm_bank_header *) bank;
+    entry = (const struct wwm_bank_entry *) (bank + sizeof(*header));
+
+    for (i = 0; i < header->entry_count; i++, entry++) {
+        if (entry->fix_release != (uint32_t) fix_release || entry->name_offset >= bank_size)
+            continue;
+        if (name_matches(filename, (const char *) bank + entry->name_offset))
+            return (entry);
+    }
+    return (NULL);
+}
@@ -0,0 +1,112 @@
+/*
+ * wwm_patbank.h -- pre-decoded patch bank
+ *
+ * A single blob holding GUS patches already run through libWildMidi's
+ * decoder (8/16 bit conversion, envelopes, loop unrolling), built offline
+ * by wwm_mkbank. With a bank loaded, patches found in it are copied out
+ * instead of being read and decoded from their .pat files.
+ *
+ * Layout, host endian, every block 16 byte aligned:
+ *
+ *   header   magic "WWMB", version, sizeof(struct _sample), entry count,
+ *            the output rate the envelopes were decoded for
+ *   entries  name offset, fix_release, sample count, first record offset
+ *   records  data offset, data bytes, then struct _sample as decoded
+ *   data     the decoded 16 bit sample data of every record
+ *   names    nul terminated patch paths relative to the config
+ */
+
+#ifndef WWM_PATBANK_H
+#define WWM_PATBANK_H
+
+#include <stdint.h>
+
+#define WWM_BANK_MAGIC "WWMB"
+#define WWM_BANK_VERSION 2
+#define WWM_BANK_ALIGN(x) (((x) + 15) & ~15u)
+
+struct wwm_bank_header {
+    char magic[4];
+    uint32_t version;
+    uint32_t sample_size;
+    uint32_t entry_count;
+    uint32_t rate;
+};
+
+struct wwm_bank_entry {
+    uint32_t name_offset;
+    uint32_t fix_release;
+    uint32_t sample_count;
+    uint32_t first_record;
+};
+
+struct wwm_bank_record {
+    uint32_t data_offset;
+    uint32_t data_bytes;
+    /* followed by sample_size bytes of struct _sample */
+};
+
+#define WWM_BANK_RECORD_SIZE(sample_size) \
+    WWM_BANK_ALIGN(sizeof(struct wwm_bank_record) + (sample_size))
+
+/*
+ * A bank only serves patches while the library runs at the bank's rate,
+ * at any other rate they are decoded from their files. Patches use the
+ * sample data in the bank in place, close it or use another one only
+ * while no song is open (after wwm_shutdown).
+ */
+
+/* maps a bank file (natively, or from MEMFS) */
+int wwm_patbank_open(const char *bank_file);
+
+/* uses a bank already in memory, data must stay valid until closed */
+int wwm_patbank_use(const uint8_t *data, uint32_t size);
+
+void wwm_patbank_close(void);
+
+/*
+ * bank base and the entry for a patch path, NULL when there is no bank or
+ * the patch is not in it
+ */
+const uint8_t *wwm_patbank_data(void);
+uint32_t wwm_patbank_rate(void);
+
+/* whether ptr lies in the bank, wwm_lib_free leaves those alone */
+int wwm_patbank_owns(const void *ptr);
+const struct wwm_bank_entry *wwm_patbank_find(const char *filename, int fix_release);
+
+/*
+ * sample decoding, lives next to libWildMidi's gus_pat.c as it needs
+ * struct _sample (wwm_gus_pat.c)
+ */
+typedef int (*wwm_sample_sink)(void *ctx, const void *sample, uint32_t sample_size,
+                               const int16_t *data, uint32_t data_bytes);
+
+int wwm_gus_pat_sample_size(void);
+int wwm_gus_pat_decode(const char *filename, int fix_release, wwm_sample_sink sink, void *ctx);
+
+/*
+ * A patch is decoded once for all program slots that load it, by canonical
+ * path or by the content of its file, the slots share the sample data.
+ * wwm_lib_free hands sample data back through wwm_gus_pat_release, which
+ * returns 0 for anything else.
+ */
+int wwm_gus_pat_release(void *data);
+
+/* a loaded patch, bytes with the data shared against every slot decoding its own */
+struct wwm_patch_memory {
+    const char *path;
+    uint32_t slots;
+    uint32_t samples;
+    uint32_t data_bytes;
+    uint32_t bytes;
+    uint32_t unshared_bytes;
+};
+
+/*
+ * Calls fn (when not NULL) for every patch loaded now and returns their
+ * count. path is only valid in fn, which must not load patches.
+ */
+int wwm_patch_memory(void (*fn)(void *ctx, const struct wwm_patch_memory *patch), void *ctx);
+
+#endif /* WWM_PATBANK_H */
@@ -0,0 +1,567 @@
+/*
+ * wwm_pcm.c -- sample format conversion and mixing for the player outputs
+ */
+
+#include <string.h>
+
+#include "wwm_pcm.h"
+
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define PCM_SIMD128 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define PCM_X86 1
+#endif
+
+#define S16_SCALE (1.0f / 32768.0f)
+#define GAIN_SHIFT 14 /* WWM_GAIN_UNITY */
+
+/* libWildMidi's sample position fraction, and the volume of an envelope level */
+#define VOICE_FRAC 1023
+#define VOICE_ENV(env) ((env) >> 12)
+
+/*
+ Scalar kernels, also finish the frames the SIMD loops leave over
+ */
+static void s16_to_f32_scalar(const int16_t *in, float *left, float *right, int frames) {
+    int i;
+
+    for (i = 0; i < frames; i++) {
+        left[i] = in[2 * i] * S16_SCALE;
+        right[i] = in[2 * i + 1] * S16_SCALE;
+    }
+}
+
+static void mix_s16_scalar(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r) {
+    int i;
+
+    for (i = 0; i < frames * 2; i += 2) {
+        mix[i] += (in[i] * gain_l) >> GAIN_SHIFT;
+        mix[i + 1] += (in[i + 1] * gain_r) >> GAIN_SHIFT;
+    }
+}
+
+static void mix_to_s16_scalar(const int32_t *mix, int16_t *out, int frames) {
+    int i;
+
+    for (i = 0; i < frames * 2; i++) {
+        int32_t v = mix[i];
+        out[i] = (v > 32767) ? 32767 : (v < -32768) ? -32768 : v;
+    }
+}
+
+/* the voice i frames on, where the SIMD loops hand over */
+static struct wwm_voice voice_at(const struct wwm_voice *voice, int i) {
+    struct wwm_voice at = *voice;
+
+    at.pos += (uint32_t) i * voice->inc;
+    at.env += i * voice->env_inc;
+    return (at);
+}
+
+/* the sample at the position and the next one, as one little-endian pair */
+static inline int32_t sample_pair(const int16_t *data, uint32_t pos) {
+    int32_t pair;
+
+    memcpy(&pair, data + (pos >> 10), sizeof(pair));
+    return (pair);
+}
+
+static void voice_linear_scalar(int32_t *premix, const struct wwm_voice *voice, int frames) {
+    uint32_t pos = voice->pos;
+    int32_t env = voice->env;
+    int i;
+
+    for (i = 0; i < frames; i++) {
+        const int16_t *data = voice->data + (pos >> 10);
+        int32_t sample = data[0] + (data[1] - data[0]) * (int32_t) (pos & VOICE_FRAC) / 1024;
+
+        premix[i] = sample * VOICE_ENV(env) / 1024;
+        pos += voice->inc;
+        env += voice->env_inc;
+    }
+}
+
+static void voice_gauss_scalar(int32_t *premix, const struct wwm_voice *voice, const double *table, int taps, int frames) {
+    uint32_t pos = voice->pos;
+    int32_t env = voice->env;
+    int i, j;
+
+    for (i = 0; i < frames; i++) {
+        const int16_t *data = voice->data + (pos >> 10) - ((taps - 1) >> 1);
+        const double *row = table + (pos & VOICE_FRAC) * taps;
+        double y = 0;
+
+        for (j = 0; j < taps; j++)
+            y += data[j] * row[j];
+        premix[i] = (int32_t) ((y * VOICE_ENV(env)) / 1024);
+        pos += voice->inc;
+        env += voice->env_inc;
+    }
+}
+
+static void voice_mix_scalar(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right) {
+    int i;
+
+    for (i = 0; i < frames; i++) {
+        mix[2 * i] += premix[i] * left;
+        mix[2 * i + 1] += premix[i] * right;
+    }
+}
+
+static const struct wwm_pcm_kernels kernels_scalar = {
+    "scalar", s16_to_f32_scalar, mix_s16_scalar, mix_to_s16_scalar,
+    voice_linear_scalar, voice_gauss_scalar, voice_mix_scalar
+};
+
+/*
+ * In the s16_to_f32 kernels each 32bit lane holds one L/R pair, left in
+ * the low half as both targets are little-endian. Shifting sign extends
+ * either half to int32, then convert and scale.
+ */
+#ifdef PCM_SIMD128
+static void s16_to_f32_simd128(const int16_t *in, float *left, float *right, int frames) {
+    v128_t scale = wasm_f32x4_splat(S16_SCALE);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        v128_t v = wasm_v128_load(in + 2 * i);
+        v128_t l = wasm_i32x4_shr(wasm_i32x4_shl(v, 16), 16);
+        v128_t r = wasm_i32x4_shr(v, 16);
+        wasm_v128_store(left + i, wasm_f32x4_mul(wasm_f32x4_convert_i32x4(l), scale));
+        wasm_v128_store(right + i, wasm_f32x4_mul(wasm_f32x4_convert_i32x4(r), scale));
+    }
+    s16_to_f32_scalar(in + 2 * i, left + i, right + i, frames - i);
+}
+
+static void mix_s16_simd128(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r) {
+    v128_t gain = wasm_i32x4_make(gain_l, gain_r, gain_l, gain_r);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        v128_t v = wasm_v128_load(in + 2 * i);
+        v128_t p0 = wasm_i32x4_shr(wasm_i32x4_mul(wasm_i32x4_extend_low_i16x8(v), gain), GAIN_SHIFT);
+        v128_t p1 = wasm_i32x4_shr(wasm_i32x4_mul(wasm_i32x4_extend_high_i16x8(v), gain), GAIN_SHIFT);
+        wasm_v128_store(mix + 2 * i, wasm_i32x4_add(wasm_v128_load(mix + 2 * i), p0));
+        wasm_v128_store(mix + 2 * i + 4, wasm_i32x4_add(wasm_v128_load(mix + 2 * i + 4), p1));
+    }
+    mix_s16_scalar(mix + 2 * i, in + 2 * i, frames - i, gain_l, gain_r);
+}
+
+static void mix_to_s16_simd128(const int32_t *mix, int16_t *out, int frames) {
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        v128_t a = wasm_v128_load(mix + 2 * i);
+        v128_t b = wasm_v128_load(mix + 2 * i + 4);
+        wasm_v128_store(out + 2 * i, wasm_i16x8_narrow_i32x4(a, b));
+    }
+    mix_to_s16_scalar(mix + 2 * i, out + 2 * i, frames - i);
+}
+
+/*
+ * The voice kernels render 4 frames at once (2 for gauss, in doubles). wasm
+ * has no gathers, the samples are loaded a frame at a time. Dividing by 1024
+ * rounds toward zero like C does, negative values are biased by 1023 first.
+ */
+static inline v128_t div1024_simd128(v128_t v) {
+    return wasm_i32x4_shr(wasm_i32x4_add(v, wasm_u32x4_shr(wasm_i32x4_shr(v, 31), 22)), 10);
+}
+
+static void voice_linear_simd128(int32_t *premix, const struct wwm_voice *voice, int frames) {
+    v128_t step = wasm_i32x4_splat(voice->env_inc * 4);
+    v128_t env = wasm_i32x4_add(wasm_i32x4_splat(voice->env),
+            wasm_i32x4_mul(wasm_i32x4_make(0, 1, 2, 3), wasm_i32x4_splat(voice->env_inc)));
+    uint32_t inc = voice->inc, pos = voice->pos;
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        uint32_t p1 = pos + inc, p2 = p1 + inc, p3 = p2 + inc;
+        v128_t pairs = wasm_i32x4_make(sample_pair(voice->data, pos), sample_pair(voice->data, p1),
+                sample_pair(voice->data, p2), sample_pair(voice->data, p3));
+        v128_t frac = wasm_v128_and(wasm_i32x4_make(pos, p1, p2, p3), wasm_i32x4_splat(VOICE_FRAC));
+        v128_t d0 = wasm_i32x4_shr(wasm_i32x4_shl(pairs, 16), 16);
+        v128_t d1 = wasm_i32x4_shr(pairs, 16);
+        v128_t sample = wasm_i32x4_add(d0, div1024_simd128(wasm_i32x4_mul(wasm_i32x4_sub(d1, d0), frac)));
+
+        wasm_v128_store(premix + i, div1024_simd128(wasm_i32x4_mul(sample, wasm_i32x4_shr(env, 12))));
+        env = wasm_i32x4_add(env, step);
+        pos = p3 + inc;
+    }
+    if (i < frames) {
+        struct wwm_voice rest = voice_at(voice, i);
+        voice_linear_scalar(premix + i, &rest, frames - i);
+    }
+}
+
+static void voice_gauss_simd128(int32_t *premix, const struct wwm_voice *voice, const double *table, int taps, int frames) {
+    uint32_t inc = voice->inc, pos = voice->pos;
+    int32_t env = voice->env;
+    int i = 0, j;
+
+    for (; i + 2 <= frames; i += 2) {
+        uint32_t p1 = pos + inc;
+        const int16_t *d0 = voice->data + (pos >> 10) - ((taps - 1) >> 1);
+        const int16_t *d1 = voice->data + (p1 >> 10) - ((taps - 1) >> 1);
+        const double *r0 = table + (pos & VOICE_FRAC) * taps;
+        const double *r1 = table + (p1 & VOICE_FRAC) * taps;
+        v128_t y = wasm_f64x2_splat(0);
+        v128_t level = wasm_f64x2_make(VOICE_ENV(env), VOICE_ENV(env + voice->env_inc));
+
+        for (j = 0; j < taps; j++)
+            y = wasm_f64x2_add(y, wasm_f64x2_mul(wasm_f64x2_make(d0[j], d1[j]), wasm_f64x2_make(r0[j], r1[j])));
+        y = wasm_f64x2_div(wasm_f64x2_mul(y, level), wasm_f64x2_splat(1024));
+        premix[i] = (int32_t) wasm_f64x2_extract_lane(y, 0);
+        premix[i + 1] = (int32_t) wasm_f64x2_extract_lane(y, 1);
+        env += 2 * voice->env_inc;
+        pos = p1 + inc;
+    }
+    if (i < frames) {
+        struct wwm_voice rest = voice_at(voice, i);
+        voice_gauss_scalar(premix + i, &rest, table, taps, frames - i);
+    }
+}
+
+static void voice_mix_simd128(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right) {
+    v128_t adjust = wasm_i32x4_make(left, right, left, right);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        v128_t p = wasm_v128_load(premix + i);
+        v128_t p0 = wasm_i32x4_mul(wasm_i32x4_shuffle(p, p, 0, 0, 1, 1), adjust);
+        v128_t p1 = wasm_i32x4_mul(wasm_i32x4_shuffle(p, p, 2, 2, 3, 3), adjust);
+        wasm_v128_store(mix + 2 * i, wasm_i32x4_add(wasm_v128_load(mix + 2 * i), p0));
+        wasm_v128_store(mix + 2 * i + 4, wasm_i32x4_add(wasm_v128_load(mix + 2 * i + 4), p1));
+    }
+    voice_mix_scalar(mix + 2 * i, premix + i, frames - i, left, right);
+}
+
+static const struct wwm_pcm_kernels kernels_simd128 = {
+    "simd128", s16_to_f32_simd128, mix_s16_simd128, mix_to_s16_simd128,
+    voice_linear_simd128, voice_gauss_simd128, voice_mix_simd128
+};
+#endif /* PCM_SIMD128 */
+
+#ifdef PCM_X86
+__attribute__((target("sse2")))
+static void s16_to_f32_sse2(const int16_t *in, float *left, float *right, int frames) {
+    __m128 scale = _mm_set1_ps(S16_SCALE);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (in + 2 * i));
+        __m128i l = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+        __m128i r = _mm_srai_epi32(v, 16);
+        _mm_storeu_ps(left + i, _mm_mul_ps(_mm_cvtepi32_ps(l), scale));
+        _mm_storeu_ps(right + i, _mm_mul_ps(_mm_cvtepi32_ps(r), scale));
+    }
+    s16_to_f32_scalar(in + 2 * i, left + i, right + i, frames - i);
+}
+
+/* mullo and mulhi are the two halves of the 32bit products, unpacking puts them together */
+__attribute__((target("sse2")))
+static void mix_s16_sse2(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r) {
+    __m128i gain = _mm_set1_epi32((int32_t) ((uint16_t) gain_l | ((uint32_t) (uint16_t) gain_r << 16)));
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *) (in + 2 * i));
+        __m128i lo = _mm_mullo_epi16(v, gain);
+        __m128i hi = _mm_mulhi_epi16(v, gain);
+        __m128i p0 = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), GAIN_SHIFT);
+        __m128i p1 = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), GAIN_SHIFT);
+        __m128i *m = (__m128i *) (mix + 2 * i);
+        _mm_storeu_si128(m, _mm_add_epi32(_mm_loadu_si128(m), p0));
+        _mm_storeu_si128(m + 1, _mm_add_epi32(_mm_loadu_si128(m + 1), p1));
+    }
+    mix_s16_scalar(mix + 2 * i, in + 2 * i, frames - i, gain_l, gain_r);
+}
+
+__attribute__((target("sse2")))
+static void mix_to_s16_sse2(const int32_t *mix, int16_t *out, int frames) {
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *) (mix + 2 * i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (mix + 2 * i + 4));
+        _mm_storeu_si128((__m128i *) (out + 2 * i), _mm_packs_epi32(a, b));
+    }
+    mix_to_s16_scalar(mix + 2 * i, out + 2 * i, frames - i);
+}
+
+/*
+ * SSE2 has no 32bit mullo, the even and odd lanes are multiplied as 64bit
+ * and their low halves put back together. Dividing by 1024 rounds toward
+ * zero like C does, negative values are biased by 1023 first.
+ */
+__attribute__((target("sse2")))
+static inline __m128i mullo_sse2(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i div1024_sse2(__m128i v) {
+    return _mm_srai_epi32(_mm_add_epi32(v, _mm_srli_epi32(_mm_srai_epi32(v, 31), 22)), 10);
+}
+
+/* 4 frames at once, the samples are loaded a frame at a time */
+__attribute__((target("sse2")))
+static void voice_linear_sse2(int32_t *premix, const struct wwm_voice *voice, int frames) {
+    __m128i step = _mm_set1_epi32(voice->env_inc * 4);
+    __m128i env = _mm_add_epi32(_mm_set1_epi32(voice->env),
+            mullo_sse2(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(voice->env_inc)));
+    uint32_t inc = voice->inc, pos = voice->pos;
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        uint32_t p1 = pos + inc, p2 = p1 + inc, p3 = p2 + inc;
+        __m128i pairs = _mm_setr_epi32(sample_pair(voice->data, pos), sample_pair(voice->data, p1),
+                sample_pair(voice->data, p2), sample_pair(voice->data, p3));
+        __m128i frac = _mm_and_si128(_mm_setr_epi32(pos, p1, p2, p3), _mm_set1_epi32(VOICE_FRAC));
+        __m128i d0 = _mm_srai_epi32(_mm_slli_epi32(pairs, 16), 16);
+        __m128i d1 = _mm_srai_epi32(pairs, 16);
+        __m128i sample = _mm_add_epi32(d0, div1024_sse2(mullo_sse2(_mm_sub_epi32(d1, d0), frac)));
+
+        _mm_storeu_si128((__m128i *) (premix + i), div1024_sse2(mullo_sse2(sample, _mm_srai_epi32(env, 12))));
+        env = _mm_add_epi32(env, step);
+        pos = p3 + inc;
+    }
+    if (i < frames) {
+        struct wwm_voice rest = voice_at(voice, i);
+        voice_linear_scalar(premix + i, &rest, frames - i);
+    }
+}
+
+__attribute__((target("sse2")))
+static void voice_mix_sse2(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right) {
+    __m128i adjust = _mm_setr_epi32(left, right, left, right);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        __m128i p = _mm_loadu_si128((const __m128i *) (premix + i));
+        __m128i p0 = mullo_sse2(_mm_unpacklo_epi32(p, p), adjust);
+        __m128i p1 = mullo_sse2(_mm_unpackhi_epi32(p, p), adjust);
+        __m128i *m = (__m128i *) (mix + 2 * i);
+        _mm_storeu_si128(m, _mm_add_epi32(_mm_loadu_si128(m), p0));
+        _mm_storeu_si128(m + 1, _mm_add_epi32(_mm_loadu_si128(m + 1), p1));
+    }
+    voice_mix_scalar(mix + 2 * i, premix + i, frames - i, left, right);
+}
+
+/*
+ * No voice_gauss here: two frames a register, or four interleaved, came
+ * out slower than the scalar loop, which waits on the table rows anyway.
+ */
+static const struct wwm_pcm_kernels kernels_sse2 = {
+    "sse2", s16_to_f32_sse2, mix_s16_sse2, mix_to_s16_sse2,
+    voice_linear_sse2, voice_gauss_scalar, voice_mix_sse2
+};
+
+__attribute__((target("avx2")))
+static void s16_to_f32_avx2(const int16_t *in, float *left, float *right, int frames) {
+    __m256 scale = _mm256_set1_ps(S16_SCALE);
+    int i = 0;
+
+    for (; i + 8 <= frames; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) (in + 2 * i));
+        __m256i l = _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+        __m256i r = _mm256_srai_epi32(v, 16);
+        _mm256_storeu_ps(left + i, _mm256_mul_ps(_mm256_cvtepi32_ps(l), scale));
+        _mm256_storeu_ps(right + i, _mm256_mul_ps(_mm256_cvtepi32_ps(r), scale));
+    }
+    s16_to_f32_scalar(in + 2 * i, left + i, right + i, frames - i);
+}
+
+__attribute__((target("avx2")))
+static void mix_s16_avx2(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r) {
+    __m256i gain = _mm256_setr_epi32(gain_l, gain_r, gain_l, gain_r, gain_l, gain_r, gain_l, gain_r);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        __m256i v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) (in + 2 * i)));
+        __m256i p = _mm256_srai_epi32(_mm256_mullo_epi32(v, gain), GAIN_SHIFT);
+        __m256i *m = (__m256i *) (mix + 2 * i);
+        _mm256_storeu_si256(m, _mm256_add_epi32(_mm256_loadu_si256(m), p));
+    }
+    mix_s16_scalar(mix + 2 * i, in + 2 * i, frames - i, gain_l, gain_r);
+}
+
+/* packs works per 128bit lane, the permute puts the 64bit quarters back in order */
+__attribute__((target("avx2")))
+static void mix_to_s16_avx2(const int32_t *mix, int16_t *out, int frames) {
+    int i = 0;
+
+    for (; i + 8 <= frames; i += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) (mix + 2 * i));
+        __m256i b = _mm256_loadu_si256((const __m256i *) (mix + 2 * i + 8));
+        __m256i p = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+        _mm256_storeu_si256((__m256i *) (out + 2 * i), p);
+    }
+    mix_to_s16_scalar(mix + 2 * i, out + 2 * i, frames - i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i div1024_avx2(__m256i v) {
+    return _mm256_srai_epi32(_mm256_add_epi32(v, _mm256_srli_epi32(_mm256_srai_epi32(v, 31), 22)), 10);
+}
+
+/*
+ * 8 frames at once. One gather of 32bit words at the sample positions
+ * loads both samples around each, the one at the position in the low half.
+ */
+__attribute__((target("avx2")))
+static void voice_linear_avx2(int32_t *premix, const struct wwm_voice *voice, int frames) {
+    __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i pos = _mm256_add_epi32(_mm256_set1_epi32(voice->pos), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(voice->inc)));
+    __m256i env = _mm256_add_epi32(_mm256_set1_epi32(voice->env), _mm256_mullo_epi32(lanes, _mm256_set1_epi32(voice->env_inc)));
+    __m256i pos_step = _mm256_set1_epi32(voice->inc * 8);
+    __m256i env_step = _mm256_set1_epi32(voice->env_inc * 8);
+    int i = 0;
+
+    for (; i + 8 <= frames; i += 8) {
+        __m256i pairs = _mm256_i32gather_epi32((const int *) voice->data, _mm256_srli_epi32(pos, 10), 2);
+        __m256i frac = _mm256_and_si256(pos, _mm256_set1_epi32(VOICE_FRAC));
+        __m256i d0 = _mm256_srai_epi32(_mm256_slli_epi32(pairs, 16), 16);
+        __m256i d1 = _mm256_srai_epi32(pairs, 16);
+        __m256i sample = _mm256_add_epi32(d0, div1024_avx2(_mm256_mullo_epi32(_mm256_sub_epi32(d1, d0), frac)));
+
+        _mm256_storeu_si256((__m256i *) (premix + i), div1024_avx2(_mm256_mullo_epi32(sample, _mm256_srai_epi32(env, 12))));
+        pos = _mm256_add_epi32(pos, pos_step);
+        env = _mm256_add_epi32(env, env_step);
+    }
+    if (i < frames) {
+        struct wwm_voice rest = voice_at(voice, i);
+        voice_linear_scalar(premix + i, &rest, frames - i);
+    }
+}
+
+/*
+ * 8 frames at once in doubles, two registers of 4, each frame adds up its
+ * taps in the scalar order. The rows are loaded lane by lane: gathers of
+ * them measured slower, the table does not stay in cache whichever way.
+ */
+__attribute__((target("avx2")))
+static void voice_gauss_avx2(int32_t *premix, const struct wwm_voice *voice, const double *table, int taps, int frames) {
+    uint32_t pos = voice->pos;
+    int32_t env = voice->env;
+    int i = 0, j, l;
+
+    for (; i + 8 <= frames; i += 8) {
+        const int16_t *d[8];
+        const double *r[8];
+        int32_t level[8];
+        __m256d y0 = _mm256_setzero_pd(), y1 = _mm256_setzero_pd();
+        __m256d k = _mm256_set1_pd(1024);
+
+        for (l = 0; l < 8; l++) {
+            uint32_t p = pos + l * voice->inc;
+            d[l] = voice->data + (p >> 10) - ((taps - 1) >> 1);
+            r[l] = table + (p & VOICE_FRAC) * taps;
+            level[l] = VOICE_ENV(env + l * voice->env_inc);
+        }
+        for (j = 0; j < taps; j++) {
+            __m256d s0 = _mm256_cvtepi32_pd(_mm_setr_epi32(d[0][j], d[1][j], d[2][j], d[3][j]));
+            __m256d s1 = _mm256_cvtepi32_pd(_mm_setr_epi32(d[4][j], d[5][j], d[6][j], d[7][j]));
+            __m256d w0 = _mm256_setr_pd(r[0][j], r[1][j], r[2][j], r[3][j]);
+            __m256d w1 = _mm256_setr_pd(r[4][j], r[5][j], r[6][j], r[7][j]);
+            y0 = _mm256_add_pd(y0, _mm256_mul_pd(s0, w0));
+            y1 = _mm256_add_pd(y1, _mm256_mul_pd(s1, w1));
+        }
+        y0 = _mm256_div_pd(_mm256_mul_pd(y0, _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *) level))), k);
+        y1 = _mm256_div_pd(_mm256_mul_pd(y1, _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *) (level + 4)))), k);
+        _mm_storeu_si128((__m128i *) (premix + i), _mm256_cvttpd_epi32(y0));
+        _mm_storeu_si128((__m128i *) (premix + i + 4), _mm256_cvttpd_epi32(y1));
+        pos += 8 * voice->inc;
+        env += 8 * voice->env_inc;
+    }
+    if (i < frames) {
+        struct wwm_voice rest = voice_at(voice, i);
+        voice_gauss_scalar(premix + i, &rest, table, taps, frames - i);
+    }
+}
+
+__attribute__((target("avx2")))
+static void voice_mix_avx2(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right) {
+    __m256i adjust = _mm256_setr_epi32(left, right, left, right, left, right, left, right);
+    __m256i pairs = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+    int i = 0;
+
+    for (; i + 4 <= frames; i += 4) {
+        __m256i p = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (premix + i)));
+        __m256i v = _mm256_mullo_epi32(_mm256_permutevar8x32_epi32(p, pairs), adjust);
+        __m256i *m = (__m256i *) (mix + 2 * i);
+        _mm256_storeu_si256(m, _mm256_add_epi32(_mm256_loadu_si256(m), v));
+    }
+    voice_mix_scalar(mix + 2 * i, premix + i, frames - i, left, right);
+}
+
+static const struct wwm_pcm_kernels kernels_avx2 = {
+    "avx2", s16_to_f32_avx2, mix_s16_avx2, mix_to_s16_avx2,
+    voice_linear_avx2, voice_gauss_avx2, voice_mix_avx2
+};
+#endif /* PCM_X86 */
+
+#ifdef PCM_SIMD128
+static const struct wwm_pcm_kernels *active = &kernels_simd128;
+#else
+static const struct wwm_pcm_kernels *active = &kernels_scalar;
+#endif
+
+#ifdef PCM_X86
+/* before main, so threads rendering later only ever read active */
+__attribute__((constructor))
+static void pick_kernels(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        active = &kernels_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        active = &kernels_sse2;
+}
+#endif
+
+int wwm_pcm_kernel_sets(const struct wwm_pcm_kernels **sets, int max) {
+    const struct wwm_pcm_kernels *all[4];
+    int count = 0, i;
+
+    all[count++] = &kernels_scalar;
+#ifdef PCM_SIMD128
+    all[count++] = &kernels_simd128;
+#endif
+#ifdef PCM_X86
+    if (active != &kernels_scalar)
+        all[count++] = &kernels_sse2;
+    if (active == &kernels_avx2)
+        all[count++] = &kernels_avx2;
+#endif
+
+    for (i = 0; i < count && i < max; i++)
+        sets[i] = all[i];
+    return (i);
+}
+
+void wwm_s16_to_f32(const int16_t *in, float *left, float *right, int frames) {
+    active->s16_to_f32(in, left, right, frames);
+}
+
+void wwm_mix_s16(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r) {
+    active->mix_s16(mix, in, frames, gain_l, gain_r);
+}
+
+void wwm_mix_to_s16(const int32_t *mix, int16_t *out, int frames) {
+    active->mix_to_s16(mix, out, frames);
+}
+
+void wwm_voice_linear(int32_t *premix, const struct wwm_voice *voice, int frames) {
+    active->voice_linear(premix, voice, frames);
+}
+
+void wwm_voice_gauss(int32_t *premix, const struct wwm_voice *voice, const double *table, int taps, int frames) {
+    active->voice_gauss(premix, voice, table, taps, frames);
+}
+
+void wwm_voice_mix(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right) {
+    active->voice_mix(mix, premix, frames, left, right);
+}
@@ -0,0 +1,80 @@
+/*
+ * wwm_pcm.h -- sample format conversion and mixing for the player outputs
+ *
+ * Every kernel has a scalar version and SIMD ones: simd128 when built for
+ * wasm with -msimd128 (wasm has no cpu detection, see make.js SIMD), SSE2
+ * and AVX2 natively on x86, picked at startup from what the cpu supports.
+ * All of them are integer math or float math done in the same order, so
+ * every version gives bit-identical results (wwm_bench -k checks that).
+ */
+
+#ifndef WWM_PCM_H
+#define WWM_PCM_H
+
+#include <stdint.h>
+
+/* unity for the Q14 gains of wwm_mix_s16 */
+#define WWM_GAIN_UNITY 16384
+
+/*
+ * Splits interleaved stereo16 frames (what WildMidi_GetOutput renders) into
+ * planar float32 left/right, scaled to [-1, 1).
+ */
+void wwm_s16_to_f32(const int16_t *in, float *left, float *right, int frames);
+
+/*
+ * Adds interleaved stereo16 frames into an interleaved int32 mix, left and
+ * right scaled by Q14 gains (volume and pan, WWM_GAIN_UNITY is 1.0, the
+ * product is rounded down).
+ */
+void wwm_mix_s16(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r);
+
+/* clamps an interleaved int32 mix to stereo16 */
+void wwm_mix_to_s16(const int32_t *mix, int16_t *out, int frames);
+
+/*
+ * One note of the synth (wwm_synth.c) over frames where nothing happens to
+ * it but its sample position and envelope level moving on by their steps.
+ * The voice kernels render what libWildMidi's mixer makes of it before the
+ * note's left and right volume, its premix, one int32 a frame, with the
+ * library's integer math (and its double math for gauss), so they are exact
+ * against it too.
+ */
+struct wwm_voice {
+    const int16_t *data;
+    uint32_t pos;       /* sample position, 10 fraction bits */
+    uint32_t inc;
+    int32_t env;        /* envelope level */
+    int32_t env_inc;
+};
+
+/* linear interpolation between the two samples around the position */
+void wwm_voice_linear(int32_t *premix, const struct wwm_voice *voice, int frames);
+
+/*
+ * gauss interpolation over taps samples, from (taps - 1) / 2 before the
+ * position on, weighted by the row of taps of table for the fraction
+ */
+void wwm_voice_gauss(int32_t *premix, const struct wwm_voice *voice, const double *table, int taps, int frames);
+
+/* adds a premix into an interleaved int32 mix, times the note's left and right volume */
+void wwm_voice_mix(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right);
+
+/* one implementation of every kernel */
+struct wwm_pcm_kernels {
+    const char *name;
+    void (*s16_to_f32)(const int16_t *in, float *left, float *right, int frames);
+    void (*mix_s16)(int32_t *mix, const int16_t *in, int frames, int16_t gain_l, int16_t gain_r);
+    void (*mix_to_s16)(const int32_t *mix, int16_t *out, int frames);
+    void (*voice_linear)(int32_t *premix, const struct wwm_voice *voice, int frames);
+    void (*voice_gauss)(int32_t *premix, const struct wwm_voice *voice, const double *table, int taps, int frames);
+    void (*voice_mix)(int32_t *mix, const int32_t *premix, int frames, int32_t left, int32_t right);
+};
+
+/*
+ * The kernel sets built in that this cpu runs, scalar first and the one in
+ * use last. Returns how many were stored in sets (at most max).
+ */
+int wwm_pcm_kernel_sets(const struct wwm_pcm_kernels **sets, int max);
+
+#endif /* WWM_PCM_H */
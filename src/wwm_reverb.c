@@ -0,0 +1,781 @@
+/*
+ * wwm_reverb.c -- block reverb with quality tiers
+ *
+ * Built instead of wildmidi/src/reverb.c (see make.js and wwm_reverb.h).
+ */
+
+#include "config.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef __EMSCRIPTEN__
+#include <pthread.h>
+#endif
+
+#include "wwm_arena.h"
+#include "wwm_reverb.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+/*
+ * libWildMidi's reverb api, as reverb.h declares it. reverb.h itself is
+ * left out: its struct _rvb is the state of the library's reverb, this
+ * file has its own and the library only ever passes the pointer on.
+ */
+struct _rvb;
+void _WM_reset_reverb(struct _rvb *rvb);
+struct _rvb *_WM_init_reverb(int rate, float room_x, float room_y, float listen_x, float listen_y);
+void _WM_free_reverb(struct _rvb *rvb);
+void _WM_do_reverb(struct _rvb *rvb, signed int *buffer, int size);
+
+#define BLOCK 128               /* frames per pass, no delay line is shorter */
+#define MAX_LINES 8
+#define TAPS 8                  /* per ear: 4 walls for each speaker */
+
+#define SPEED_OF_SOUND 343.0f   /* m/s */
+#define ROOM_HEIGHT 4.0f        /* m, the config only has the floor */
+#define ABSORPTION 0.3f         /* of the walls, for the decay time */
+
+/* the hall of the convolution tier */
+#define PART 512                /* frames per partition */
+#define FFT_SIZE (PART * 2)
+#define IR_SECONDS 1.6f
+#define IR_DECAY 1.8f           /* s to fall 60 dB */
+
+static int tier = WWM_REVERB_ROOM;
+
+static const char *const tier_names[WWM_REVERB_TIERS] = { "room", "light", "convolution" };
+
+/* a delay line (or an input history), read and written at pos */
+struct line {
+    float *buf;
+    uint32_t len;
+    uint32_t pos;
+    float gain;                 /* per trip round the network, for the decay time */
+    float state;                /* of the damping lowpass */
+};
+
+/* a wall reflection: the input of one channel, delay frames late */
+struct tap {
+    uint32_t delay;
+    float gain;
+    int source;
+};
+
+/*
+ * The impulse response of the convolution tier, as the spectra of its
+ * partitions with the left channel real and the right one imaginary: one
+ * complex multiply and one inverse FFT give both. Shared by every reverb
+ * at the same rate.
+ */
+struct ir {
+    uint32_t rate;
+    int refs;
+    int parts;
+    float *re;                  /* parts * FFT_SIZE */
+    float *im;
+    float cos_table[FFT_SIZE / 2];
+    float sin_table[FFT_SIZE / 2];
+    uint16_t reverse[FFT_SIZE];
+    struct ir *next;
+};
+
+struct _rvb {
+    int tier;
+    float level;                /* of the wet signal */
+
+    /* feedback delay network */
+    int lines;
+    float damp;
+    float feed;                 /* input into each line */
+    struct line line[MAX_LINES];
+
+    /* room: early reflections off the input history */
+    struct line history[2];
+    struct tap taps[2][TAPS];
+
+    /* convolution */
+    struct ir *ir;
+    int fill;                   /* frames of the current partition in */
+    int slot;                   /* newest input spectrum */
+    float *in;                  /* FFT_SIZE: the last partition, then the current one */
+    float *wet;                 /* 2 * PART: the last partition convolved, left then right */
+    float *x_re;                /* parts * FFT_SIZE input spectra, from the first pass on */
+    float *x_im;
+    float *spectra;             /* both of them */
+    float *y_re;                /* FFT_SIZE */
+    float *y_im;
+
+    /* every delay line and buffer above but the spectra, back to back */
+    float *memory;
+    size_t memory_floats;
+
+    float dry[2][BLOCK];
+    float early[2][BLOCK];
+    float out[2][BLOCK];
+    float work[MAX_LINES][BLOCK];
+};
+
+int wwm_reverb_set_tier(int new_tier) {
+    if (new_tier < 0 || new_tier >= WWM_REVERB_TIERS)
+        return (-1);
+    tier = new_tier;
+    return (0);
+}
+
+int wwm_reverb_tier(void) {
+    return (tier);
+}
+
+const char *wwm_reverb_name(int t) {
+    return (t >= 0 && t < WWM_REVERB_TIERS) ? tier_names[t] : NULL;
+}
+
+int wwm_reverb_find(const char *name) {
+    int i;
+
+    for (i = 0; i < WWM_REVERB_TIERS; i++) {
+        if (strcmp(tier_names[i], name) == 0)
+            return (i);
+    }
+    return (-1);
+}
+
+/*
+ Ring buffers: count <= len samples starting at start, in at most two runs
+ */
+static void ring_read(const struct line *line, uint32_t start, float *out, int count) {
+    uint32_t first = line->len - start;
+
+    if (first >= (uint32_t) count) {
+        memcpy(out, line->buf + start, count * sizeof(float));
+    } else {
+        memcpy(out, line->buf + start, first * sizeof(float));
+        memcpy(out + first, line->buf, (count - first) * sizeof(float));
+    }
+}
+
+static void ring_write(struct line *line, const float *in, int count) {
+    uint32_t first = line->len - line->pos;
+
+    if (first >= (uint32_t) count) {
+        memcpy(line->buf + line->pos, in, count * sizeof(float));
+    } else {
+        memcpy(line->buf + line->pos, in, first * sizeof(float));
+        memcpy(line->buf, in + first, (count - first) * sizeof(float));
+    }
+    line->pos += count;
+    if (line->pos >= line->len)
+        line->pos -= line->len;
+}
+
+/* hands out n floats of the reverb's memory */
+static float *carve(struct _rvb *rvb, size_t *used, size_t n) {
+    float *p = rvb->memory + *used;
+
+    *used += n;
+    return (p);
+}
+
+/*
+ Feedback delay network: every line is at least BLOCK long, so a pass reads
+ a whole block out of every line before anything is written back.
+ */
+static void fdn_pass(struct _rvb *rvb, float (*in)[BLOCK], float (*wet)[BLOCK], int n) {
+    float (*work)[BLOCK] = rvb->work;
+    float norm = 1.0f / sqrtf((float) rvb->lines);
+    int h, i, j, k;
+
+    for (i = 0; i < rvb->lines; i++) {
+        struct line *line = &rvb->line[i];
+        float state = line->state;
+
+        ring_read(line, line->pos, work[i], n);
+        for (k = 0; k < n; k++) {
+            state += rvb->damp * (work[i][k] - state);
+            work[i][k] = state * line->gain;
+        }
+        line->state = state;
+    }
+
+    /* even lines to the left, odd ones to the right */
+    memcpy(wet[0], work[0], n * sizeof(float));
+    memcpy(wet[1], work[1], n * sizeof(float));
+    for (i = 2; i < rvb->lines; i += 2) {
+        for (k = 0; k < n; k++) {
+            wet[0][k] += work[i][k];
+            wet[1][k] += work[i + 1][k];
+        }
+    }
+
+    /* Hadamard feedback matrix, orthogonal once scaled by norm */
+    for (h = 1; h < rvb->lines; h *= 2) {
+        for (i = 0; i < rvb->lines; i += h * 2) {
+            for (j = i; j < i + h; j++) {
+                for (k = 0; k < n; k++) {
+                    float a = work[j][k], b = work[j + h][k];
+                    work[j][k] = a + b;
+                    work[j + h][k] = a - b;
+                }
+            }
+        }
+    }
+
+    /* a channel feeds pairs of lines, so it ends up on both sides */
+    for (i = 0; i < rvb->lines; i++) {
+        const float *feed = in[(i >> 1) & 1];
+
+        for (k = 0; k < n; k++)
+            work[i][k] = work[i][k] * norm + feed[k] * rvb->feed;
+        ring_write(&rvb->line[i], work[i], n);
+    }
+}
+
+/* delays in frames, odd and at least a block */
+static uint32_t line_length(float seconds, int rate) {
+    uint32_t len = (uint32_t) (seconds * rate) | 1;
+
+    return (len < BLOCK ? BLOCK + 1 : len);
+}
+
+static void fdn_setup(struct _rvb *rvb, const float *seconds, int lines, float decay, float cutoff, int rate) {
+    int i;
+
+    rvb->lines = lines;
+    rvb->damp = 1.0f - expf(-2.0f * (float) M_PI * cutoff / rate);
+    for (i = 0; i < lines; i++) {
+        rvb->line[i].len = line_length(seconds[i], rate);
+        rvb->line[i].gain = powf(10.0f, -3.0f * rvb->line[i].len / (decay * rate));
+    }
+}
+
+/*
+ Room: the first reflections off the 4 walls are precomputed taps into the
+ input history, they also feed the network that makes the tail.
+ */
+static void early_pass(struct _rvb *rvb, int n) {
+    int ear, t, k;
+
+    ring_write(&rvb->history[0], rvb->dry[0], n);
+    ring_write(&rvb->history[1], rvb->dry[1], n);
+
+    for (ear = 0; ear < 2; ear++) {
+        float *early = rvb->early[ear];
+
+        memset(early, 0, n * sizeof(float));
+        for (t = 0; t < TAPS; t++) {
+            const struct tap *tap = &rvb->taps[ear][t];
+            const struct line *history = &rvb->history[tap->source];
+            /* the block just written starts n frames back */
+            uint32_t start = (history->pos + 2 * history->len - n - tap->delay) % history->len;
+
+            ring_read(history, start, rvb->work[0], n);
+            for (k = 0; k < n; k++)
+                early[k] += rvb->work[0][k] * tap->gain;
+        }
+    }
+}
+
+static float distance(float x0, float y0, float x1, float y1) {
+    return sqrtf((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+}
+
+static float clampf(float v, float lo, float hi) {
+    return (v < lo ? lo : v > hi ? hi : v);
+}
+
+/* the speakers stand 2 m to the sides and 3 m in front of the listener */
+static uint32_t room_taps(struct _rvb *rvb, int rate, float room_x, float room_y, float listen_x, float listen_y) {
+    uint32_t longest = 0;
+    int ear, speaker, wall;
+
+    for (ear = 0; ear < 2; ear++) {
+        float ex = listen_x + (ear ? 0.1f : -0.1f);
+
+        for (speaker = 0; speaker < 2; speaker++) {
+            float sx = clampf(listen_x + (speaker ? 2.0f : -2.0f), 0.5f, room_x - 0.5f);
+            float sy = clampf(listen_y - 3.0f, 0.5f, room_y - 0.5f);
+            float direct = distance(sx, sy, ex, listen_y);
+
+            for (wall = 0; wall < 4; wall++) {
+                /* the speaker mirrored in the wall */
+                float ix = wall == 0 ? -sx : wall == 1 ? 2 * room_x - sx : sx;
+                float iy = wall == 2 ? -sy : wall == 3 ? 2 * room_y - sy : sy;
+                float path = distance(ix, iy, ex, listen_y);
+                struct tap *tap = &rvb->taps[ear][speaker * 4 + wall];
+
+                tap->delay = (uint32_t) ((path - direct) / SPEED_OF_SOUND * rate + 0.5f);
+                tap->gain = (1.0f - ABSORPTION) * direct / path;
+                tap->source = speaker;
+                if (tap->delay > longest)
+                    longest = tap->delay;
+            }
+        }
+    }
+    return (longest);
+}
+
+static int room_setup(struct _rvb *rvb, int rate, float room_x, float room_y, float listen_x, float listen_y) {
+    /* spread around the mean free path, no two share a factor that matters */
+    static const float spread[MAX_LINES] = { 1.000f, 1.131f, 1.257f, 1.389f, 1.523f, 1.651f, 1.783f, 1.917f };
+    float seconds[MAX_LINES];
+    float volume, surface, decay, free_path;
+    uint32_t longest;
+    size_t used = 0;
+    int i;
+
+    room_x = room_x > 1.0f ? room_x : 1.0f;
+    room_y = room_y > 1.0f ? room_y : 1.0f;
+    listen_x = clampf(listen_x, 0.0f, room_x);
+    listen_y = clampf(listen_y, 0.0f, room_y);
+
+    /* Sabine */
+    volume = room_x * room_y * ROOM_HEIGHT;
+    surface = 2.0f * (room_x * room_y + room_x * ROOM_HEIGHT + room_y * ROOM_HEIGHT);
+    decay = clampf(0.161f * volume / (surface * ABSORPTION), 0.3f, 3.0f);
+    free_path = 4.0f * volume / surface;
+
+    for (i = 0; i < MAX_LINES; i++)
+        seconds[i] = free_path / SPEED_OF_SOUND * spread[i];
+    fdn_setup(rvb, seconds, MAX_LINES, decay, 6000.0f, rate);
+    rvb->feed = 0.25f;
+    rvb->level = 0.55f;
+
+    longest = room_taps(rvb, rate, room_x, room_y, listen_x, listen_y);
+    rvb->history[0].len = rvb->history[1].len = longest + BLOCK;
+
+    rvb->memory_floats = 2 * (size_t) rvb->history[0].len;
+    for (i = 0; i < rvb->lines; i++)
+        rvb->memory_floats += rvb->line[i].len;
+    rvb->memory = calloc(rvb->memory_floats, sizeof(float));
+    if (rvb->memory == NULL)
+        return (-1);
+
+    rvb->history[0].buf = carve(rvb, &used, rvb->history[0].len);
+    rvb->history[1].buf = carve(rvb, &used, rvb->history[1].len);
+    for (i = 0; i < rvb->lines; i++)
+        rvb->line[i].buf = carve(rvb, &used, rvb->line[i].len);
+    return (0);
+}
+
+/* no reflections, 4 lines with the decay time of the room */
+static int light_setup(struct _rvb *rvb, int rate, float room_x, float room_y) {
+    static const float seconds[4] = { 0.0297f, 0.0371f, 0.0411f, 0.0437f };
+    float volume, surface;
+    size_t used = 0;
+    int i;
+
+    room_x = room_x > 1.0f ? room_x : 1.0f;
+    room_y = room_y > 1.0f ? room_y : 1.0f;
+    volume = room_x * room_y * ROOM_HEIGHT;
+    surface = 2.0f * (room_x * room_y + room_x * ROOM_HEIGHT + room_y * ROOM_HEIGHT);
+
+    fdn_setup(rvb, seconds, 4, clampf(0.161f * volume / (surface * ABSORPTION), 0.3f, 3.0f), 4500.0f, rate);
+    rvb->feed = 0.5f;
+    rvb->level = 0.5f;
+
+    rvb->memory_floats = 0;
+    for (i = 0; i < rvb->lines; i++)
+        rvb->memory_floats += rvb->line[i].len;
+    rvb->memory = calloc(rvb->memory_floats, sizeof(float));
+    if (rvb->memory == NULL)
+        return (-1);
+
+    for (i = 0; i < rvb->lines; i++)
+        rvb->line[i].buf = carve(rvb, &used, rvb->line[i].len);
+    return (0);
+}
+
+/*
+ Convolution: uniformly partitioned, overlap-save. A partition is convolved
+ once it is complete and played during the next one, which delays the wet
+ signal by PART frames; the first PART frames of the hall are left out of
+ the impulse response to make up for it. The input spectra are most of a
+ reverb's memory, they are allocated once it first renders, a song that is
+ only opened (for its info, or ahead of playing) does not hold them.
+ */
+static void fft(const struct ir *ir, float *re, float *im, int inverse) {
+    int size, i, k;
+
+    for (i = 0; i < FFT_SIZE; i++) {
+        int j = ir->reverse[i];
+
+        if (j > i) {
+            float t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    for (size = 2; size <= FFT_SIZE; size *= 2) {
+        int half = size / 2, step = FFT_SIZE / size;
+
+        for (i = 0; i < FFT_SIZE; i += size) {
+            for (k = 0; k < half; k++) {
+                float wr = ir->cos_table[k * step];
+                float wi = inverse ? ir->sin_table[k * step] : -ir->sin_table[k * step];
+                int a = i + k, b = a + half;
+                float tr = re[b] * wr - im[b] * wi;
+                float ti = re[b] * wi + im[b] * wr;
+
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
+
+/* a fixed seed, every build gets the same hall */
+static float noise(uint32_t *seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return ((float) (*seed >> 8) / 8388608.0f - 1.0f);
+}
+
+/*
+ * Decaying noise, its own per channel, that darkens as it decays, after a
+ * few sparse early reflections. Scaled to the wet energy of the other tiers.
+ */
+static void hall(float *h, uint32_t length, uint32_t rate, uint32_t seed) {
+    uint32_t fade_in = rate / 40, fade_out = length / 10;
+    float state = 0, alpha = 0, energy = 0, scale;
+    uint32_t n;
+    int i;
+
+    for (n = 0; n < length; n++) {
+        float t = (float) n / rate;
+        float v;
+
+        if ((n & 63) == 0)
+            alpha = 1.0f - expf(-2.0f * (float) M_PI * (1500.0f + 9000.0f * expf(-t / 0.8f)) / rate);
+        state += alpha * (noise(&seed) - state);
+
+        v = state * expf(-6.9078f * t / IR_DECAY);
+        if (n < fade_in)
+            v *= (float) n / fade_in;
+        if (n > length - fade_out)
+            v *= (float) (length - n) / fade_out;
+        h[n] = v;
+    }
+
+    for (i = 0; i < 12; i++) {
+        uint32_t at = (uint32_t) ((noise(&seed) * 0.5f + 0.5f) * 0.08f * rate);
+
+        if (at < length)
+            h[at] += noise(&seed) * 0.6f * expf(-(float) at / rate / 0.05f);
+    }
+
+    for (n = 0; n < length; n++)
+        energy += h[n] * h[n];
+    scale = energy > 0 ? sqrtf(0.12f / energy) : 0;
+    for (n = 0; n < length; n++)
+        h[n] *= scale;
+}
+
+static struct ir *ir_build(uint32_t rate) {
+    uint32_t length = (uint32_t) (IR_SECONDS * rate);
+    struct ir *ir = calloc(1, sizeof(*ir));
+    uint32_t hall_length;
+    float *h;
+    int bits = 0, i, p;
+
+    if (ir == NULL)
+        return (NULL);
+    ir->rate = rate;
+    ir->parts = (length + PART - 1) / PART;
+    length = ir->parts * PART;
+    hall_length = PART + length;
+    ir->re = calloc((size_t) ir->parts * FFT_SIZE, sizeof(float));
+    ir->im = calloc((size_t) ir->parts * FFT_SIZE, sizeof(float));
+    h = calloc((size_t) hall_length * 2, sizeof(float));
+    if (ir->re == NULL || ir->im == NULL || h == NULL) {
+        free(ir->re);
+        free(ir->im);
+        free(ir);
+        free(h);
+        return (NULL);
+    }
+
+    for (i = 0; i < FFT_SIZE / 2; i++) {
+        ir->cos_table[i] = cosf(2.0f * (float) M_PI * i / FFT_SIZE);
+        ir->sin_table[i] = sinf(2.0f * (float) M_PI * i / FFT_SIZE);
+    }
+    while ((1 << bits) < FFT_SIZE)
+        bits++;
+    for (i = 0; i < FFT_SIZE; i++) {
+        int r = 0, b;
+
+        for (b = 0; b < bits; b++)
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        ir->reverse[i] = (uint16_t) r;
+    }
+
+    hall(h, hall_length, rate, 0x5eed1e57u);
+    hall(h + hall_length, hall_length, rate, 0x0dd5eedu);
+
+    /* zero padded partitions from PART on, with the 1 / FFT_SIZE of the inverse */
+    for (p = 0; p < ir->parts; p++) {
+        float *re = ir->re + p * FFT_SIZE, *im = ir->im + p * FFT_SIZE;
+
+        for (i = 0; i < PART; i++) {
+            re[i] = h[PART + p * PART + i] / FFT_SIZE;
+            im[i] = h[hall_length + PART + p * PART + i] / FFT_SIZE;
+        }
+        fft(ir, re, im, 0);
+    }
+    free(h);
+    return (ir);
+}
+
+static struct ir *irs;
+
+#ifndef __EMSCRIPTEN__
+static pthread_mutex_t irs_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void lock_irs(void) {
+    pthread_mutex_lock(&irs_lock);
+}
+
+static void unlock_irs(void) {
+    pthread_mutex_unlock(&irs_lock);
+}
+#else
+static void lock_irs(void) {
+}
+
+static void unlock_irs(void) {
+}
+#endif
+
+static struct ir *ir_acquire(uint32_t rate) {
+    struct ir *ir;
+    wwm_arena *song;
+
+    lock_irs();
+    for (ir = irs; ir != NULL && ir->rate != rate; ir = ir->next)
+        ;
+    if (ir == NULL) {
+        /* outlives the song that builds it */
+        song = wwm_arena_enter(NULL);
+        ir = ir_build(rate);
+        wwm_arena_enter(song);
+        if (ir != NULL) {
+            ir->next = irs;
+            irs = ir;
+        }
+    }
+    if (ir != NULL)
+        ir->refs++;
+    unlock_irs();
+    return (ir);
+}
+
+static void ir_release(struct ir *ir) {
+    struct ir **link;
+
+    lock_irs();
+    if (--ir->refs == 0) {
+        for (link = &irs; *link != ir; link = &(*link)->next)
+            ;
+        *link = ir->next;
+        free(ir->re);
+        free(ir->im);
+        free(ir);
+    }
+    unlock_irs();
+}
+
+static int convolution_setup(struct _rvb *rvb, int rate) {
+    size_t used = 0;
+
+    rvb->ir = ir_acquire((uint32_t) rate);
+    if (rvb->ir == NULL)
+        return (-1);
+    rvb->level = 1.0f;
+
+    rvb->memory_floats = (size_t) FFT_SIZE * 3 + 2 * PART;
+    rvb->memory = calloc(rvb->memory_floats, sizeof(float));
+    if (rvb->memory == NULL)
+        return (-1);
+
+    rvb->in = carve(rvb, &used, FFT_SIZE);
+    rvb->wet = carve(rvb, &used, 2 * PART);
+    rvb->y_re = carve(rvb, &used, FFT_SIZE);
+    rvb->y_im = carve(rvb, &used, FFT_SIZE);
+    return (0);
+}
+
+static int convolution_spectra(struct _rvb *rvb) {
+    size_t floats = (size_t) rvb->ir->parts * FFT_SIZE;
+
+    rvb->spectra = calloc(floats * 2, sizeof(float));
+    if (rvb->spectra == NULL)
+        return (-1);
+    rvb->x_re = rvb->spectra;
+    rvb->x_im = rvb->spectra + floats;
+    return (0);
+}
+
+static void convolve_partition(struct _rvb *rvb) {
+    const struct ir *ir = rvb->ir;
+    float *x_re, *x_im;
+    int slot, p, k;
+
+    rvb->slot = (rvb->slot + 1) % ir->parts;
+    x_re = rvb->x_re + rvb->slot * FFT_SIZE;
+    x_im = rvb->x_im + rvb->slot * FFT_SIZE;
+    memcpy(x_re, rvb->in, FFT_SIZE * sizeof(float));
+    memset(x_im, 0, FFT_SIZE * sizeof(float));
+    fft(ir, x_re, x_im, 0);
+
+    /* the newest input against the first partition, the oldest against the last */
+    memset(rvb->y_re, 0, FFT_SIZE * sizeof(float));
+    memset(rvb->y_im, 0, FFT_SIZE * sizeof(float));
+    slot = rvb->slot;
+    for (p = 0; p < ir->parts; p++) {
+        const float *h_re = ir->re + p * FFT_SIZE, *h_im = ir->im + p * FFT_SIZE;
+        const float *a_re = rvb->x_re + slot * FFT_SIZE, *a_im = rvb->x_im + slot * FFT_SIZE;
+
+        for (k = 0; k < FFT_SIZE; k++) {
+            rvb->y_re[k] += a_re[k] * h_re[k] - a_im[k] * h_im[k];
+            rvb->y_im[k] += a_re[k] * h_im[k] + a_im[k] * h_re[k];
+        }
+        slot = slot ? slot - 1 : ir->parts - 1;
+    }
+    fft(ir, rvb->y_re, rvb->y_im, 1);
+
+    /* the second half is what the current partition convolves to */
+    memcpy(rvb->wet, rvb->y_re + PART, PART * sizeof(float));
+    memcpy(rvb->wet + PART, rvb->y_im + PART, PART * sizeof(float));
+    memmove(rvb->in, rvb->in + PART, PART * sizeof(float));
+}
+
+static void convolution_pass(struct _rvb *rvb, int n) {
+    int done = 0, k;
+
+    /* no memory for the spectra: dry only, and again next time */
+    if (rvb->spectra == NULL && convolution_spectra(rvb) == -1) {
+        memset(rvb->out, 0, sizeof(rvb->out));
+        return;
+    }
+
+    while (done < n) {
+        int run = (n - done < PART - rvb->fill) ? n - done : PART - rvb->fill;
+        float *in = rvb->in + PART + rvb->fill;
+
+        for (k = 0; k < run; k++) {
+            in[k] = (rvb->dry[0][done + k] + rvb->dry[1][done + k]) * 0.5f;
+            rvb->out[0][done + k] = rvb->wet[rvb->fill + k];
+            rvb->out[1][done + k] = rvb->wet[PART + rvb->fill + k];
+        }
+        rvb->fill += run;
+        done += run;
+        if (rvb->fill == PART) {
+            convolve_partition(rvb);
+            rvb->fill = 0;
+        }
+    }
+}
+
+/*
+ libWildMidi's entry points
+ */
+struct _rvb *_WM_init_reverb(int rate, float room_x, float room_y, float listen_x, float listen_y) {
+    struct _rvb *rvb = calloc(1, sizeof(*rvb));
+    int res;
+
+    if (rvb == NULL)
+        return (NULL);
+
+    rvb->tier = tier;
+    switch (rvb->tier) {
+    case WWM_REVERB_LIGHT:
+        res = light_setup(rvb, rate, room_x, room_y);
+        break;
+    case WWM_REVERB_CONVOLUTION:
+        res = convolution_setup(rvb, rate);
+        break;
+    default:
+        res = room_setup(rvb, rate, room_x, room_y, listen_x, listen_y);
+        break;
+    }
+
+    if (res == -1) {
+        _WM_free_reverb(rvb);
+        return (NULL);
+    }
+    return (rvb);
+}
+
+void _WM_free_reverb(struct _rvb *rvb) {
+    if (rvb == NULL)
+        return;
+
+    if (rvb->ir != NULL)
+        ir_release(rvb->ir);
+    free(rvb->spectra);
+    free(rvb->memory);
+    free(rvb);
+}
+
+void _WM_reset_reverb(struct _rvb *rvb) {
+    int i;
+
+    if (rvb == NULL)
+        return;
+
+    if (rvb->memory != NULL)
+        memset(rvb->memory, 0, rvb->memory_floats * sizeof(float));
+    if (rvb->spectra != NULL)
+        memset(rvb->spectra, 0, (size_t) rvb->ir->parts * FFT_SIZE * 2 * sizeof(float));
+    for (i = 0; i < rvb->lines; i++)
+        rvb->line[i].state = 0;
+    rvb->fill = 0;
+    rvb->slot = 0;
+}
+
+/* size: samples of interleaved stereo, the mix before it is clipped to 16 bit */
+void _WM_do_reverb(struct _rvb *rvb, signed int *buffer, int size) {
+    int frames = size / 2;
+
+    if (rvb == NULL)
+        return;
+
+    while (frames > 0) {
+        int n = frames < BLOCK ? frames : BLOCK;
+        int k;
+
+        for (k = 0; k < n; k++) {
+            rvb->dry[0][k] = (float) buffer[k * 2];
+            rvb->dry[1][k] = (float) buffer[k * 2 + 1];
+        }
+
+        switch (rvb->tier) {
+        case WWM_REVERB_LIGHT:
+            fdn_pass(rvb, rvb->dry, rvb->out, n);
+            break;
+        case WWM_REVERB_CONVOLUTION:
+            convolution_pass(rvb, n);
+            break;
+        default:
+            early_pass(rvb, n);
+            fdn_pass(rvb, rvb->early, rvb->out, n);
+            for (k = 0; k < n; k++) {
+                rvb->out[0][k] += rvb->early[0][k];
+                rvb->out[1][k] += rvb->early[1][k];
+            }
+            break;
+        }
+
+        for (k = 0; k < n; k++) {
+            buffer[k * 2] += (signed int) lrintf(rvb->out[0][k] * rvb->level);
+            buffer[k * 2 + 1] += (signed int) lrintf(rvb->out[1][k] * rvb->level);
+        }
+        buffer += n * 2;
+        frames -= n;
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * wwm_reverb.h -- block reverb with quality tiers
+ *
+ * Built instead of wildmidi/src/reverb.c (see make.js): libWildMidi's
+ * reverb entry points (_WM_init_reverb, _WM_do_reverb, ... of reverb.h)
+ * are served by wwm_reverb.c, so songs get it through WM_MO_REVERB and
+ * the mixer (wwm_mixer.c) through the same calls as before. The library's
+ * reverb ran 8 reflections through 6 filters each, sample by sample. The
+ * tiers here work on blocks of frames out of contiguous float delay lines,
+ * everything that depends on the room is worked out when a reverb is set
+ * up:
+ *
+ *   room         the reflections off the 4 walls of the config's room
+ *                (reverb_room_width etc.) as delay taps, feeding an 8 line
+ *                feedback delay network with the room's decay time. The
+ *                default, the closest to the library's.
+ *   light        a 4 line feedback delay network without reflections, for
+ *                phones.
+ *   convolution  a built-in hall impulse response, uniformly partitioned
+ *                FFT convolution. For offline renders, costs the most.
+ *
+ * A reverb takes the tier set when it is set up, for a song that is when
+ * it opens. wwm_bench -v reports what every tier costs.
+ */
+
+#ifndef WWM_REVERB_H
+#define WWM_REVERB_H
+
+#define WWM_REVERB_ROOM 0
+#define WWM_REVERB_LIGHT 1
+#define WWM_REVERB_CONVOLUTION 2
+#define WWM_REVERB_TIERS 3
+
+/* for reverbs set up from now on, returns 0 or -1 for an unknown tier */
+int wwm_reverb_set_tier(int tier);
+int wwm_reverb_tier(void);
+
+/* "room", "light", "convolution", NULL for an unknown tier */
+const char *wwm_reverb_name(int tier);
+
+/* the tier of a name, -1 when unknown */
+int wwm_reverb_find(const char *name);
+
+#endif /* WWM_REVERB_H */
@@ -0,0 +1,194 @@
+/*
+ * wwm_scan.c -- find the patches a midi file needs before opening it
+ *
+ * Used to only download the patches a song plays instead of the whole bank.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wwm_scan.h"
+
+#define DRUM_CHANNEL 9
+
+static uint32_t read_be(const uint8_t *p, int bytes) {
+    uint32_t value = 0;
+    while (bytes--)
+        value = (value << 8) | *p++;
+    return (value);
+}
+
+/* returns the variable length quantity at *pos, -1 past end */
+static int32_t read_varlen(const uint8_t *data, uint32_t size, uint32_t *pos) {
+    uint32_t value = 0;
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        if (*pos >= size)
+            return (-1);
+        value = (value << 7) | (data[*pos] & 0x7F);
+        if (!(data[(*pos)++] & 0x80))
+            return ((int32_t) value);
+    }
+    return (-1);
+}
+
+/*
+ * returns 0 once the track is read to its end, -1 when it stops on
+ * something it cannot read (truncated, a data byte without a status)
+ */
+static int scan_track(const uint8_t *data, uint32_t size, uint8_t *used) {
+    /* no program change seen yet on this channel in this track */
+    uint8_t program[16];
+    uint8_t program_set[16];
+    uint32_t pos = 0;
+    uint8_t status;
+    uint8_t running = 0; /* meta and sysex events keep it, as libWildMidi does */
+
+    memset(program, 0, sizeof(program));
+    memset(program_set, 0, sizeof(program_set));
+
+    while (pos < size) {
+        uint8_t channel;
+        int32_t len;
+
+        if (read_varlen(data, size, &pos) < 0) /* delta time */
+            return (-1);
+        if (pos >= size)
+            return (-1);
+
+        if (data[pos] & 0x80) {
+            status = data[pos++];
+        } else if (running == 0) {
+            return (-1); /* running status without status */
+        } else {
+            status = running;
+        }
+
+        if (status == 0xFF) { /* meta event */
+            if (pos >= size)
+                return (-1);
+            if (data[pos++] == 0x2F) /* end of track */
+                return (0);
+            if ((len = read_varlen(data, size, &pos)) < 0)
+                return (-1);
+            pos += len;
+            continue;
+        }
+        if (status == 0xF0 || status == 0xF7) { /* sysex */
+            if ((len = read_varlen(data, size, &pos)) < 0)
+                return (-1);
+            pos += len;
+            continue;
+        }
+        if (status >= 0xF0) /* no system common or realtime messages in files */
+            return (-1);
+
+        running = status;
+        channel = status & 0x0F;
+        switch (status & 0xF0) {
+        case 0x90: /* note on */
+            if (pos + 2 > size)
+                return (-1);
+            if (data[pos + 1] != 0) {
+                if (channel == DRUM_CHANNEL) {
+                    used[WWM_SCAN_DRUMS + data[pos]] = 1;
+                } else {
+                    /*
+                     * the program may come from another track in format 1
+                     * files, so this marks program 0 more often than needed
+                     */
+                    used[program[channel]] = 1;
+                }
+            }
+            pos += 2;
+            break;
+        case 0xC0: /* program change */
+            if (pos + 1 > size)
+                return (-1);
+            program[channel] = data[pos] & 0x7F;
+            program_set[channel] = 1;
+            if (channel != DRUM_CHANNEL)
+                used[program[channel]] = 1;
+            pos += 1;
+            break;
+        case 0xD0: /* channel pressure */
+            pos += 1;
+            break;
+        default: /* note off, aftertouch, controller, pitch bend */
+            pos += 2;
+            break;
+        }
+    }
+
+    /* the last event must not run past the track */
+    return (pos == size ? 0 : -1);
+}
+
+int wwm_scan_patches_buffer(const uint8_t *data, uint32_t size, uint8_t *used) {
+    uint32_t pos;
+    uint32_t tracks;
+
+    memset(used, 0, 256);
+
+    /* RIFF wrapped midi */
+    if (size >= 20 && memcmp(data, "RIFF", 4) == 0 && memcmp(&data[8], "RMID", 4) == 0) {
+        data += 20;
+        size -= 20;
+    }
+
+    if (size < 14 || memcmp(data, "MThd", 4) != 0)
+        return (-1);
+
+    pos = 8 + read_be(&data[4], 4);
+    tracks = read_be(&data[10], 2);
+
+    /*
+     * A track that cannot be read to its end could play anything after
+     * that, the caller loads every patch instead.
+     */
+    while (tracks && pos + 8 <= size) {
+        uint32_t len = read_be(&data[pos + 4], 4);
+        if (len > size - pos - 8)
+            return (-1);
+
+        if (memcmp(&data[pos], "MTrk", 4) == 0) {
+            if (scan_track(&data[pos + 8], len, used) == -1)
+                return (-1);
+            tracks--;
+        }
+        pos += 8 + len;
+    }
+
+    return (tracks ? -1 : 0);
+}
+
+int wwm_scan_patches(const char *midi_file, uint8_t *used) {
+    FILE *file;
+    uint8_t *data;
+    long size;
+    int res = -1;
+
+    file = fopen(midi_file, "rb");
+    if (file == NULL) {
+        memset(used, 0, 256);
+        return (-1);
+    }
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc(size > 0 ? size : 1);
+    if (data != NULL && fread(data, 1, size, file) == (size_t) size) {
+        res = wwm_scan_patches_buffer(data, size, used);
+    } else {
+        memset(used, 0, 256);
+    }
+
+    free(data);
+    fclose(file);
+    return (res);
+}
@@ -0,0 +1,24 @@
+/*
+ * wwm_scan.h -- find the patches a midi file needs before opening it
+ */
+
+#ifndef WWM_SCAN_H
+#define WWM_SCAN_H
+
+#include <stdint.h>
+
+#define WWM_SCAN_DRUMS 128
+
+/*
+ * Marks used[program] for every melodic program and
+ * used[WWM_SCAN_DRUMS + note] for every drum note (channel 10) the file
+ * plays, used must hold 256 entries. Errs on the side of marking too much.
+ *
+ * returns 0, or -1 when the file is not a standard midi file (xmi, mus, hmp
+ * and hmi are not scanned) or a track of it cannot be read to its end, load
+ * everything for those. used is only complete when it returns 0.
+ */
+int wwm_scan_patches(const char *midi_file, uint8_t *used);
+int wwm_scan_patches_buffer(const uint8_t *data, uint32_t size, uint8_t *used);
+
+#endif /* WWM_SCAN_H */
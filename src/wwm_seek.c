@@ -0,0 +1,154 @@
+/*
+ * wwm_seek.c -- checkpoint index for fast seeking within a song
+ *
+ * Reads and restores libWildMidi's struct _mdi directly. Between two
+ * WildMidi_GetOutput calls the song is at a consistent point: the next
+ * event to run, the samples left until it and the channel state the events
+ * so far have set. That is all FastSeek looks at when it seeks forward.
+ */
+
+#include "config.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* struct _mdi, in the order internal_midi.c includes them */
+#include "common.h"
+#include "reverb.h"
+#include "internal_midi.h"
+
+#include "wwm_seek.h"
+
+struct checkpoint {
+    uint32_t sample;
+    uint32_t samples_to_mix;
+    struct _event *event;
+    struct _channel channel[16];
+};
+
+struct wwm_seek_index {
+    struct _mdi *mdi;
+    uint32_t interval;
+    uint32_t count;
+    uint32_t size;
+    struct checkpoint *points; /* ascending, points[0] is the start */
+};
+
+static void snapshot(struct _mdi *mdi, struct checkpoint *point) {
+    point->sample = mdi->extra_info.current_sample;
+    point->samples_to_mix = mdi->samples_to_mix;
+    point->event = mdi->current_event;
+    memcpy(point->channel, mdi->channel, sizeof(point->channel));
+}
+
+/* what FastSeek leaves behind: no notes, a clean reverb */
+static void restore(struct _mdi *mdi, const struct checkpoint *point) {
+    struct _note *note;
+
+    for (note = mdi->note; note != NULL; note = note->next) {
+        note->active = 0;
+        note->replay = NULL;
+    }
+    mdi->note = NULL;
+
+    mdi->extra_info.current_sample = point->sample;
+    mdi->samples_to_mix = point->samples_to_mix;
+    mdi->current_event = point->event;
+    memcpy(mdi->channel, point->channel, sizeof(mdi->channel));
+    _WM_reset_reverb(mdi->reverb);
+}
+
+wwm_seek_index *wwm_seek_new(midi *handle, uint32_t interval) {
+    wwm_seek_index *index;
+
+    index = calloc(1, sizeof(*index));
+    if (index == NULL)
+        return (NULL);
+
+    index->size = 16;
+    index->points = malloc(index->size * sizeof(struct checkpoint));
+    if (index->points == NULL) {
+        free(index);
+        return (NULL);
+    }
+
+    index->mdi = handle;
+    index->interval = interval ? interval : 1;
+    snapshot(index->mdi, &index->points[0]);
+    index->count = 1;
+    return (index);
+}
+
+void wwm_seek_record(wwm_seek_index *index) {
+    struct checkpoint *last = &index->points[index->count - 1];
+
+    /* only past the end of the index, which keeps it contiguous */
+    if (index->mdi->extra_info.current_sample < last->sample + index->interval)
+        return;
+
+    if (index->count == index->size) {
+        struct checkpoint *points = realloc(index->points, index->size * 2 * sizeof(struct checkpoint));
+        if (points == NULL)
+            return; /* seeks past here just replay more */
+        index->points = points;
+        index->size *= 2;
+    }
+    snapshot(index->mdi, &index->points[index->count++]);
+}
+
+/* last checkpoint at or before sample */
+static const struct checkpoint *find(const wwm_seek_index *index, uint32_t sample) {
+    uint32_t lo = 0, hi = index->count;
+
+    while (hi - lo > 1) {
+        uint32_t mid = (lo + hi) / 2;
+        if (index->points[mid].sample <= sample)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return (&index->points[lo]);
+}
+
+int wwm_seek_to(wwm_seek_index *index, uint32_t sample) {
+    struct _mdi *mdi = index->mdi;
+    const struct checkpoint *point = find(index, sample);
+    uint32_t current = mdi->extra_info.current_sample;
+
+    /* backwards, or a checkpoint saves replaying from here */
+    if (sample < current || point->sample > current)
+        restore(mdi, point);
+
+    /*
+     * Forward from here FastSeek only replays the delta, in steps of the
+     * interval where the index does not reach yet.
+     */
+    for (;;) {
+        const struct checkpoint *last = &index->points[index->count - 1];
+        unsigned long int step = sample;
+
+        current = mdi->extra_info.current_sample;
+        if (last->sample + index->interval > current && last->sample + index->interval < sample)
+            step = last->sample + index->interval;
+
+        if (WildMidi_FastSeek((midi *) mdi, &step) == -1)
+            return (-1);
+        wwm_seek_record(index);
+
+        /* done, or clamped at the end of the song */
+        if (step >= sample || mdi->extra_info.current_sample <= current)
+            return (0);
+    }
+}
+
+uint32_t wwm_seek_checkpoints(const wwm_seek_index *index) {
+    return (index->count);
+}
+
+void wwm_seek_free(wwm_seek_index *index) {
+    if (index == NULL)
+        return;
+    free(index->points);
+    free(index);
+}
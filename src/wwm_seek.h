@@ -0,0 +1,42 @@
+/*
+ * wwm_seek.h -- checkpoint index for fast seeking within a song
+ *
+ * WildMidi_FastSeek replays the events from the start of the song for every
+ * seek backwards. The index snapshots the event position and channel state
+ * (program, controllers, pitch bend) every interval samples as the song
+ * plays or seeks forward, a seek restores the nearest checkpoint before the
+ * target and has FastSeek replay only the rest. The index grows lazily, so
+ * the first pass over a part of the song costs what a FastSeek does.
+ *
+ * Seeks land on the exact sample and leave the song as FastSeek does: the
+ * channel state of that point, no notes sounding.
+ */
+
+#ifndef WWM_SEEK_H
+#define WWM_SEEK_H
+
+#include <stdint.h>
+
+#include "wildmidi_lib.h"
+
+#define WWM_SEEK_INTERVAL_MS 5000
+
+typedef struct wwm_seek_index wwm_seek_index;
+
+/*
+ * right after opening handle, before anything is rendered. interval in
+ * samples, NULL when out of memory (seek with WildMidi_FastSeek then).
+ */
+wwm_seek_index *wwm_seek_new(midi *handle, uint32_t interval);
+
+/* records a checkpoint if the song got far enough, call after rendering */
+void wwm_seek_record(wwm_seek_index *index);
+
+/* seeks to sample (clamped to the song), returns 0 or -1 */
+int wwm_seek_to(wwm_seek_index *index, uint32_t sample);
+
+uint32_t wwm_seek_checkpoints(const wwm_seek_index *index);
+
+void wwm_seek_free(wwm_seek_index *index);
+
+#endif /* WWM_SEEK_H */
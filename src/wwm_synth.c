@@ -0,0 +1,860 @@
+/*
+ * wwm_synth.c -- libWildMidi's wildmidi_lib.c with the output loop on the voice kernels
+ *
+ * Built instead of wildmidi/src/wildmidi_lib.c (see make.js). The library
+ * mixes a frame at a time, every note for each frame, and steps the note's
+ * position and envelope as it goes. Here a note is mixed for the whole run
+ * between two events at once: until its position passes the loop end, its
+ * envelope reaches the next target or the gauss window the end of the
+ * sample, nothing but the position and the envelope level move, by their
+ * steps, and the wwm_pcm voice kernels render those frames in one call.
+ * The frames where something happens to the note are stepped one at a time
+ * like the library does. The notes add into the mix in another order, the
+ * sums are the same integers, so the output is the library's to the bit.
+ */
+
+#define WildMidi_GetOutput _WM_lib_GetOutput
+#define WildMidi_Close _WM_lib_Close
+#include "wildmidi_lib.c"
+#undef WildMidi_Close
+#undef WildMidi_GetOutput
+
+/* the rest is WildWebMidi's, on libc's heap and not the song's arena */
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+#ifndef __EMSCRIPTEN__
+#include <pthread.h>
+#endif
+
+#include "wwm_pcm.h"
+#include "wwm_synth.h"
+
+/* frames mixed, reverbed and clipped at once */
+#define SYNTH_BLOCK 256
+
+/* the library puts an envelope level above this back on its target */
+#define ENV_CEILING 4194304
+
+enum { STEP_NEXT, STEP_AGAIN, STEP_END };
+
+/* the samples gauss interpolates over at pos, it falls back to Newton when fewer than gauss_n */
+static int synth_window(const struct _sample *sample, uint32_t pos) {
+    int left = pos >> FPBITS;
+    int right = (sample->data_length >> FPBITS) - left - 1;
+    int n = (right << 1) - 1;
+
+    if (n <= 0)
+        n = 1;
+    if (n > (left << 1) + 1)
+        n = (left << 1) + 1;
+    return (n);
+}
+
+/* the premix of one frame of a note, at its position */
+static int32_t synth_premix(const struct _note *note, int gauss) {
+    struct wwm_voice voice = {
+        note->sample->data, note->sample_pos, note->sample_inc, note->env_level, note->env_inc
+    };
+    const int16_t *sptr;
+    double y = 0, xd;
+    int32_t premix;
+    int n, ii, jj;
+
+    if (!gauss) {
+        wwm_voice_linear(&premix, &voice, 1);
+        return (premix);
+    }
+
+    n = synth_window(note->sample, note->sample_pos);
+    if (n >= gauss_n) {
+        wwm_voice_gauss(&premix, &voice, gauss_table, gauss_n + 1, 1);
+        return (premix);
+    }
+
+    /* near either end of the sample, Newton over the samples there are */
+    xd = note->sample_pos & FPMASK;
+    xd /= (1L << FPBITS);
+    xd += n >> 1;
+    sptr = note->sample->data + (note->sample_pos >> FPBITS) - (n >> 1);
+    for (ii = n; ii;) {
+        for (jj = 0; jj <= ii; jj++)
+            y += sptr[jj] * newt_coeffs[ii][jj];
+        y *= xd - --ii;
+    }
+    y += *sptr;
+    return ((int32_t) ((y * (note->env_level >> 12)) / 1024));
+}
+
+/*
+ * One frame of a note the way the library's loop does it: mix its premix,
+ * step the position and the envelope, move on to the next envelope stage
+ * or end the note. STEP_AGAIN when the library mixes the note once more in the
+ * same frame (a clamped note going into its release).
+ */
+static int synth_step(struct _note *note, int32_t *mix, int32_t premix) {
+    struct _sample *sample = note->sample;
+
+    mix[0] += premix * (int32_t) note->left_mix_volume;
+    mix[1] += premix * (int32_t) note->right_mix_volume;
+
+    note->sample_pos += note->sample_inc;
+    if (note->sample_pos > sample->loop_end) {
+        if (note->modes & SAMPLE_LOOP)
+            note->sample_pos = sample->loop_start + ((note->sample_pos - sample->loop_start) % sample->loop_size);
+        else if (note->sample_pos >= sample->data_length)
+            return (STEP_END);
+    }
+
+    if (note->env_inc == 0)
+        return (STEP_NEXT);
+
+    note->env_level += note->env_inc;
+    if (note->env_level > ENV_CEILING)
+        note->env_level = sample->env_target[note->env];
+    if ((note->env_inc < 0 && note->env_level > sample->env_target[note->env])
+            || (note->env_inc > 0 && note->env_level < sample->env_target[note->env]))
+        return (STEP_NEXT);
+
+    note->env_level = sample->env_target[note->env];
+    switch (note->env) {
+    case 0:
+        if (!(note->modes & SAMPLE_ENVELOPE)) {
+            note->env_inc = 0;
+            return (STEP_NEXT);
+        }
+        break;
+    case 2:
+        if (note->modes & SAMPLE_SUSTAIN) {
+            note->env_inc = 0;
+            return (STEP_NEXT);
+        } else if (note->modes & SAMPLE_CLAMPED) {
+            note->env = 5;
+            note->env_inc = (note->env_level > sample->env_target[5]) ? -sample->env_rate[5] : sample->env_rate[5];
+            return (STEP_AGAIN);
+        }
+        break;
+    case 5:
+        if (note->env_level == 0)
+            return (STEP_END);
+        /* sample release */
+        if (note->modes & SAMPLE_LOOP)
+            note->modes ^= SAMPLE_LOOP;
+        note->env_inc = 0;
+        return (STEP_NEXT);
+    case 6:
+        return (STEP_END);
+    }
+
+    note->env++;
+    if (note->is_off == 1)
+        _WM_do_note_off_extra(note);
+    else if (note->env_level > sample->env_target[note->env])
+        note->env_inc = -sample->env_rate[note->env];
+    else
+        note->env_inc = sample->env_rate[note->env];
+    return (STEP_NEXT);
+}
+
+/*
+ * The frames from the note's position on, at most max, that do nothing
+ * but step it: the position stays within the loop end (the sample end when
+ * it does not loop, passing the loop end does nothing then), the envelope
+ * level short of its target and the ceiling and, for gauss, the window
+ * within the sample.
+ */
+static uint32_t synth_quiet(const struct _note *note, int gauss, uint32_t max) {
+    const struct _sample *sample = note->sample;
+    uint32_t end = sample->loop_end;
+    uint32_t quiet = max;
+
+    if (!(note->modes & SAMPLE_LOOP) && sample->data_length - 1 > end)
+        end = sample->data_length - 1;
+    if (note->sample_pos > end)
+        return (0);
+    if (note->sample_inc != 0 && (end - note->sample_pos) / note->sample_inc < quiet)
+        quiet = (end - note->sample_pos) / note->sample_inc;
+
+    if (note->env_inc != 0) {
+        int32_t target = sample->env_target[note->env];
+        int64_t room;
+
+        if (note->env_inc > 0)
+            room = (int64_t) ((target - 1 < ENV_CEILING) ? target - 1 : ENV_CEILING) - note->env_level;
+        else
+            room = (note->env_level > ENV_CEILING) ? -1 : (int64_t) note->env_level - target - 1;
+        if (room < 0)
+            return (0);
+        room /= (note->env_inc > 0) ? note->env_inc : -(int64_t) note->env_inc;
+        if (room < quiet)
+            quiet = (uint32_t) room;
+    }
+
+    if (gauss && quiet) {
+        /* the last sample the whole window fits around, see synth_window */
+        int64_t last = (int64_t) (sample->data_length >> FPBITS) - 1 - (gauss_n + 2) / 2;
+        uint64_t frames;
+
+        if (synth_window(sample, note->sample_pos) < gauss_n || last < (note->sample_pos >> FPBITS))
+            return (0);
+        if (note->sample_inc != 0) {
+            frames = ((((uint64_t) last << FPBITS) | FPMASK) - note->sample_pos) / note->sample_inc + 1;
+            if (frames < quiet)
+                quiet = (uint32_t) frames;
+        }
+    }
+    return (quiet);
+}
+
+/*
+ Rendered one-shots, see wwm_synth.h. A note gets a take when it starts
+ without a loop: the kept premix of a note like it to play back, or a new
+ entry to record its premix into while it is rendered. Its position and
+ envelope still step along either way (the events read them), only the
+ kernels are left out. Between two runs nothing but the library's events
+ touch a note, so a take checks the note is as it left it and drops out
+ otherwise. An entry is complete once its note ended while recording,
+ only complete ones play back; the one being recorded or played is not
+ evicted.
+ */
+#define CACHE_BUCKETS 256
+#define CACHE_TAKES 256        /* per song, a note hashing onto a busy take is rendered */
+#define CACHE_MAX_SECONDS 4    /* longer notes are not kept */
+
+/* everything the premix of a note depends on, but its samples */
+struct cache_key {
+    const int16_t *data;
+    uint32_t data_length;
+    uint32_t loop_start;
+    uint32_t loop_end;
+    int32_t env_rate[7];
+    int32_t env_target[7];
+    uint32_t sample_inc;
+    int32_t env_inc;
+    uint32_t rate;
+    uint8_t modes;
+    uint8_t gauss;
+};
+
+struct cache_entry {
+    struct cache_key key;
+    uint32_t hash;
+    int32_t *premix;
+    uint32_t length;           /* premixes recorded */
+    uint32_t size;             /* room for */
+    int complete;
+    int refs;                  /* takes on it */
+    struct cache_entry *next;  /* in the bucket */
+    struct cache_entry *newer;
+    struct cache_entry *older;
+};
+
+struct cache_take {
+    const struct _note *note;  /* NULL for a free take */
+    struct cache_entry *entry;
+    int playing;               /* else recording */
+    uint32_t at;               /* premixes into the entry */
+    uint32_t cached;           /* of them played back */
+    uint32_t seen;             /* the song's call it was last mixed in */
+    /* the note as the last run left it */
+    const struct _sample *sample;
+    uint32_t sample_pos;
+    uint32_t sample_inc;
+    int32_t env_inc;
+    int32_t env_level;
+    uint8_t env;
+    uint8_t modes;
+    uint8_t is_off;
+    uint8_t gauss;
+};
+
+/* the takes of one song, from its first output with the cache on to its close */
+struct cache_song {
+    const struct _mdi *mdi;
+    uint32_t calls;
+    struct cache_take takes[CACHE_TAKES];
+    struct cache_song *next;
+};
+
+static struct {
+    uint32_t budget;           /* bytes, 0 when off */
+    uint32_t bytes;
+    struct cache_entry *buckets[CACHE_BUCKETS];
+    struct cache_entry *newest;
+    struct cache_entry *oldest;
+    struct cache_song *songs;
+    struct wwm_synth_cache_stats stats;
+} cache;
+
+#ifdef __EMSCRIPTEN__
+#define cache_lock()
+#define cache_unlock()
+#else
+static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define cache_lock() pthread_mutex_lock(&cache_mutex)
+#define cache_unlock() pthread_mutex_unlock(&cache_mutex)
+#endif
+
+/* FNV-1a of the key, zeroed padding included */
+static uint32_t cache_hash(const struct cache_key *key) {
+    const uint8_t *p = (const uint8_t *) key;
+    uint32_t hash = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < sizeof(*key); i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+    return (hash);
+}
+
+static void cache_key(struct cache_key *key, const struct _note *note, int gauss) {
+    const struct _sample *sample = note->sample;
+
+    memset(key, 0, sizeof(*key));
+    key->data = sample->data;
+    key->data_length = sample->data_length;
+    key->loop_start = sample->loop_start;
+    key->loop_end = sample->loop_end;
+    memcpy(key->env_rate, sample->env_rate, sizeof(key->env_rate));
+    memcpy(key->env_target, sample->env_target, sizeof(key->env_target));
+    key->sample_inc = note->sample_inc;
+    key->env_inc = note->env_inc;
+    key->rate = _WM_SampleRate;
+    key->modes = note->modes;
+    key->gauss = (uint8_t) gauss;
+}
+
+/* the rest under the lock */
+static void cache_unlink(struct cache_entry *entry) {
+    struct cache_entry **link = &cache.buckets[entry->hash % CACHE_BUCKETS];
+
+    while (*link != entry)
+        link = &(*link)->next;
+    *link = entry->next;
+    if (entry->newer != NULL)
+        entry->newer->older = entry->older;
+    else
+        cache.newest = entry->older;
+    if (entry->older != NULL)
+        entry->older->newer = entry->newer;
+    else
+        cache.oldest = entry->newer;
+    cache.bytes -= entry->size * sizeof(int32_t);
+    cache.stats.entries--;
+    free(entry->premix);
+    free(entry);
+}
+
+static void cache_touch(struct cache_entry *entry) {
+    if (cache.newest == entry)
+        return;
+    entry->newer->older = entry->older;
+    if (entry->older != NULL)
+        entry->older->newer = entry->newer;
+    else
+        cache.oldest = entry->newer;
+    entry->older = cache.newest;
+    entry->newer = NULL;
+    cache.newest->newer = entry;
+    cache.newest = entry;
+}
+
+/* evicts the oldest entries no take is on until bytes more fit, 0 when they do */
+static int cache_room(uint32_t bytes) {
+    struct cache_entry *entry = cache.oldest;
+
+    while (cache.bytes + (uint64_t) bytes > cache.budget && entry != NULL) {
+        struct cache_entry *newer = entry->newer;
+
+        if (entry->refs == 0) {
+            cache_unlink(entry);
+            cache.stats.evictions++;
+        }
+        entry = newer;
+    }
+    return (cache.bytes + (uint64_t) bytes <= cache.budget) ? 0 : -1;
+}
+
+static struct cache_entry *cache_add(const struct cache_key *key, uint32_t hash, uint32_t size) {
+    struct cache_entry *entry;
+
+    if (cache_room(size * sizeof(int32_t)) == -1)
+        return (NULL);
+
+    entry = calloc(1, sizeof(*entry));
+    if (entry != NULL)
+        entry->premix = malloc(size * sizeof(int32_t));
+    if (entry == NULL || entry->premix == NULL) {
+        free(entry);
+        return (NULL);
+    }
+
+    entry->key = *key;
+    entry->hash = hash;
+    entry->size = size;
+    entry->next = cache.buckets[hash % CACHE_BUCKETS];
+    cache.buckets[hash % CACHE_BUCKETS] = entry;
+    entry->older = cache.newest;
+    if (cache.newest != NULL)
+        cache.newest->newer = entry;
+    else
+        cache.oldest = entry;
+    cache.newest = entry;
+    cache.bytes += size * sizeof(int32_t);
+    cache.stats.entries++;
+    return (entry);
+}
+
+/*
+ * Lets go of a take: its note ended (a recording is complete then) or was
+ * changed. An entry left with nothing recorded in full goes, and so does
+ * one forgotten or over a smaller budget.
+ */
+static void cache_end(struct cache_take *take, int ended) {
+    struct cache_entry *entry = take->entry;
+
+    if (!ended)
+        cache.stats.changed++;
+    else if (!take->playing) {
+        entry->complete = 1;
+        entry->length = take->at;
+    }
+    if (ended) {
+        cache.stats.frames += take->at;
+        cache.stats.cached_frames += take->cached;
+    }
+    take->note = NULL;
+    take->entry = NULL;
+
+    if (--entry->refs == 0 && (!entry->complete || entry->key.data == NULL || cache.bytes > cache.budget))
+        cache_unlink(entry);
+}
+
+static void cache_drop(struct cache_take *take, int ended) {
+    cache_lock();
+    cache_end(take, ended);
+    cache_unlock();
+}
+
+/* a note that starts without a loop, frames and envelope untouched yet */
+static int cache_fresh(const struct _note *note) {
+    return (note->sample_pos == 0 && note->env == 0 && note->env_level == 0 && !note->is_off
+            && !(note->modes & SAMPLE_LOOP) && note->sample_inc != 0);
+}
+
+static void cache_save(struct cache_take *take, const struct _note *note, int gauss) {
+    take->sample = note->sample;
+    take->sample_pos = note->sample_pos;
+    take->sample_inc = note->sample_inc;
+    take->env_inc = note->env_inc;
+    take->env_level = note->env_level;
+    take->env = note->env;
+    take->modes = note->modes;
+    take->is_off = note->is_off;
+    take->gauss = (uint8_t) gauss;
+}
+
+static int cache_same(const struct cache_take *take, const struct _note *note, int gauss) {
+    return (take->sample == note->sample && take->sample_pos == note->sample_pos
+            && take->sample_inc == note->sample_inc && take->env_inc == note->env_inc
+            && take->env_level == note->env_level && take->env == note->env
+            && take->modes == note->modes && take->is_off == note->is_off && take->gauss == gauss);
+}
+
+/* the take of a note for this run, NULL to render it as it is */
+static struct cache_take *cache_take(struct cache_song *song, const struct _note *note, int gauss) {
+    struct cache_take *take = &song->takes[((uintptr_t) note >> 4) % CACHE_TAKES];
+    struct cache_entry *entry;
+    struct cache_key key;
+    uint64_t size;
+    uint32_t hash;
+
+    if (take->note == note) {
+        if (cache_same(take, note, gauss)) {
+            take->seen = song->calls;
+            return (take);
+        }
+        cache_drop(take, 0);
+    }
+    if (take->note != NULL || !cache_fresh(note))
+        return (NULL);
+
+    /* every frame to the end of the data (or a loop end past it), and a few twice (STEP_AGAIN) */
+    size = note->sample->data_length;
+    if (note->sample->loop_end > size)
+        size = note->sample->loop_end;
+    size = size / note->sample_inc + 8;
+    if (size > (uint64_t) _WM_SampleRate * CACHE_MAX_SECONDS)
+        return (NULL);
+
+    cache_key(&key, note, gauss);
+    hash = cache_hash(&key);
+    cache_lock();
+    cache.stats.notes++;
+    for (entry = cache.buckets[hash % CACHE_BUCKETS]; entry != NULL; entry = entry->next)
+        if (entry->hash == hash && memcmp(&entry->key, &key, sizeof(key)) == 0)
+            break;
+    if (entry == NULL)
+        entry = cache_add(&key, hash, (uint32_t) size);
+    else if (entry->complete)
+        cache.stats.hits++;
+    else
+        entry = NULL; /* another note is recording it */
+    if (entry != NULL) {
+        entry->refs++;
+        cache_touch(entry);
+    }
+    cache_unlock();
+    if (entry == NULL)
+        return (NULL);
+
+    memset(take, 0, sizeof(*take));
+    take->note = note;
+    take->entry = entry;
+    take->playing = entry->complete;
+    take->seen = song->calls;
+    cache_save(take, note, gauss);
+    return (take);
+}
+
+/*
+ * The premixes of count frames of a note from its position on: played
+ * back, or rendered (and recorded) by the kernels for a quiet run, by
+ * synth_premix for one stepped frame.
+ */
+static const int32_t *synth_premixes(struct _note *note, struct cache_take *take, int32_t *premix,
+                                     uint32_t count, int gauss, int quiet) {
+    if (take != NULL && take->note == note && take->playing) {
+        if (take->at + count <= take->entry->length) {
+            const int32_t *kept = take->entry->premix + take->at;
+
+            take->at += count;
+            take->cached += count;
+            return (kept);
+        }
+        cache_drop(take, 0);
+    }
+
+    if (!quiet) {
+        premix[0] = synth_premix(note, gauss);
+    } else {
+        struct wwm_voice voice = {
+            note->sample->data, note->sample_pos, note->sample_inc, note->env_level, note->env_inc
+        };
+
+        if (gauss)
+            wwm_voice_gauss(premix, &voice, gauss_table, gauss_n + 1, count);
+        else
+            wwm_voice_linear(premix, &voice, count);
+    }
+
+    if (take != NULL && take->note == note) {
+        if (take->at + count <= take->entry->size) {
+            memcpy(take->entry->premix + take->at, premix, count * sizeof(int32_t));
+            take->at += count;
+        } else {
+            cache_drop(take, 0);
+        }
+    }
+    return (premix);
+}
+
+/*
+ * The song's takes, NULL when the cache is off: a song it was just turned
+ * off for lets go of them.
+ */
+static struct cache_song *cache_song(const struct _mdi *mdi) {
+    struct cache_song **link, *song;
+    int i;
+
+    cache_lock();
+    for (link = &cache.songs; *link != NULL && (*link)->mdi != mdi; link = &(*link)->next)
+        ;
+    song = *link;
+    if (song != NULL && cache.budget == 0) {
+        *link = song->next;
+        for (i = 0; i < CACHE_TAKES; i++)
+            if (song->takes[i].note != NULL)
+                cache_end(&song->takes[i], 0);
+        free(song);
+        song = NULL;
+    } else if (song == NULL && cache.budget != 0) {
+        song = calloc(1, sizeof(*song));
+        if (song != NULL) {
+            song->mdi = mdi;
+            song->next = cache.songs;
+            cache.songs = song;
+        }
+    }
+    cache_unlock();
+    if (song != NULL)
+        song->calls++;
+    return (song);
+}
+
+/* after a call: the takes of notes that left the list without ending in it */
+static void cache_sweep(struct cache_song *song) {
+    int i;
+
+    for (i = 0; i < CACHE_TAKES; i++)
+        if (song->takes[i].note != NULL && song->takes[i].seen != song->calls)
+            cache_drop(&song->takes[i], 0);
+}
+
+static void cache_close(const struct _mdi *mdi) {
+    struct cache_song **link, *song;
+    int i;
+
+    cache_lock();
+    for (link = &cache.songs; *link != NULL && (*link)->mdi != mdi; link = &(*link)->next)
+        ;
+    song = *link;
+    if (song != NULL) {
+        *link = song->next;
+        for (i = 0; i < CACHE_TAKES; i++)
+            if (song->takes[i].note != NULL)
+                cache_end(&song->takes[i], 0);
+    }
+    cache_unlock();
+    free(song);
+}
+
+void wwm_synth_set_cache(uint32_t bytes) {
+    cache_lock();
+    cache.budget = bytes;
+    cache_room(0);
+    cache_unlock();
+}
+
+void wwm_synth_cache_stats(struct wwm_synth_cache_stats *stats) {
+    cache_lock();
+    *stats = cache.stats;
+    stats->bytes = cache.bytes;
+    cache_unlock();
+}
+
+void wwm_synth_cache_forget(const void *data) {
+    struct cache_entry *entry, *next;
+    int i;
+
+    cache_lock();
+    for (i = 0; i < CACHE_BUCKETS; i++) {
+        for (entry = cache.buckets[i]; entry != NULL; entry = next) {
+            next = entry->next;
+            if (entry->key.data != data)
+                continue;
+            if (entry->refs == 0)
+                cache_unlink(entry);
+            else
+                entry->key.data = NULL; /* no new takes, it goes with the last one */
+        }
+    }
+    cache_unlock();
+}
+
+/*
+ * Mixes a note from frame on to frames, returns the frame it ended in
+ * (mixed in that frame still) or frames when it plays on. take is the
+ * note's or NULL.
+ */
+static uint32_t synth_note(struct _note *note, int32_t *mix, uint32_t frame, uint32_t frames, int gauss,
+                           struct cache_take *take) {
+    int32_t premix[SYNTH_BLOCK];
+
+    while (frame < frames) {
+        uint32_t quiet = synth_quiet(note, gauss, frames - frame);
+
+        if (quiet) {
+            wwm_voice_mix(mix + 2 * frame, synth_premixes(note, take, premix, quiet, gauss, 1), quiet,
+                    (int32_t) note->left_mix_volume, (int32_t) note->right_mix_volume);
+            note->sample_pos += quiet * note->sample_inc;
+            note->env_level += (int32_t) quiet * note->env_inc;
+            frame += quiet;
+            continue;
+        }
+
+        switch (synth_step(note, mix + 2 * frame, *synth_premixes(note, take, premix, 1, gauss, 0))) {
+        case STEP_END:
+            return (frame);
+        case STEP_NEXT:
+            frame++;
+            break;
+        }
+    }
+    return (frames);
+}
+
+/*
+ * Every note over a run of frames. A note that ends hands its place in the
+ * list to its replay, which plays from the frame it ended in, as in the
+ * library. song holds the takes, NULL when the cache is off.
+ */
+static void synth_run(struct _mdi *mdi, int32_t *mix, uint32_t frames, int gauss, struct cache_song *song) {
+    struct _note **link = &mdi->note;
+
+    while (*link != NULL) {
+        struct _note *note = *link;
+        uint32_t frame = 0;
+
+        for (;;) {
+            struct cache_take *take = (song != NULL) ? cache_take(song, note, gauss) : NULL;
+
+            frame = synth_note(note, mix, frame, frames, gauss, take);
+            if (take != NULL && take->note == note) {
+                if (frame == frames)
+                    cache_save(take, note, gauss);
+                else
+                    cache_drop(take, 1);
+            }
+            if (frame == frames) {
+                link = &note->next;
+                break;
+            }
+            note->active = 0;
+            if (note->replay == NULL) {
+                *link = note->next;
+                break;
+            }
+            note->replay->next = note->next;
+            *link = note->replay;
+            note = note->replay;
+            note->active = 1;
+        }
+    }
+}
+
+/*
+ * The library's output loop over size bytes of stereo16. Each block of the
+ * mix is scaled and reverbed as the library does it, then clipped into out,
+ * or with out NULL added into bus times gain (Q14) for the caller to clip.
+ * Returns the bytes rendered.
+ */
+static int synth_output(struct _mdi *mdi, int16_t *out, int32_t *bus, int32_t gain, uint32_t size) {
+    int32_t mix[SYNTH_BLOCK * 2];
+    struct cache_song *song;
+    struct _event *event;
+    uint32_t buffer_used = 0;
+    int gauss = (mdi->extra_info.mixer_options & WM_MO_ENHANCED_RESAMPLING) != 0;
+    int ended = 0;
+
+    _WM_Lock(&mdi->lock);
+    song = cache_song(mdi);
+    event = mdi->current_event;
+
+    while (size && !ended) {
+        uint32_t block = (size >> 2) < SYNTH_BLOCK ? (size >> 2) : SYNTH_BLOCK;
+        uint32_t done = 0, i;
+
+        memset(mix, 0, block * 2 * sizeof(int32_t));
+        while (done < block) {
+            uint32_t frames;
+
+            /* the library's event loop, size is what is left of the whole buffer */
+            if (!mdi->samples_to_mix) {
+                while (!mdi->samples_to_mix && event->do_event) {
+                    event->do_event(mdi, &event->event_data);
+                    if ((mdi->extra_info.mixer_options & WM_MO_LOOP) && event[0].do_event == _WM_do_meta_endoftrack) {
+                        _WM_ResetToStart(mdi);
+                        event = mdi->current_event;
+                    } else {
+                        mdi->samples_to_mix = event->samples_to_next;
+                        event++;
+                        mdi->current_event = event;
+                    }
+                }
+
+                if (!mdi->samples_to_mix) {
+                    if (mdi->extra_info.current_sample >= mdi->extra_info.approx_total_samples) {
+                        ended = 1;
+                        break;
+                    } else if ((mdi->extra_info.approx_total_samples - mdi->extra_info.current_sample) > (size >> 2)) {
+                        mdi->samples_to_mix = size >> 2;
+                    } else {
+                        mdi->samples_to_mix = mdi->extra_info.approx_total_samples - mdi->extra_info.current_sample;
+                    }
+                }
+            }
+
+            frames = block - done;
+            if (mdi->samples_to_mix < frames)
+                frames = mdi->samples_to_mix;
+            if (frames == 0)
+                continue;
+
+            synth_run(mdi, mix + 2 * done, frames, gauss, song);
+            done += frames;
+            size -= frames << 2;
+            mdi->extra_info.current_sample += frames;
+            mdi->samples_to_mix -= frames;
+        }
+
+        /* the library scales every frame down once all notes are in */
+        for (i = 0; i < done * 2; i++)
+            mix[i] /= 1024;
+        if (mdi->extra_info.mixer_options & WM_MO_REVERB)
+            _WM_do_reverb(mdi->reverb, mix, done * 2);
+        if (out != NULL) {
+            wwm_mix_to_s16(mix, out, done);
+            out += done * 2;
+        } else {
+            /* rounded down like wwm_mix_s16 */
+            for (i = 0; i < done * 2; i++)
+                bus[i] += (int32_t) (((int64_t) mix[i] * gain) >> 14);
+            bus += done * 2;
+        }
+        buffer_used += done * 4;
+    }
+
+    if (song != NULL)
+        cache_sweep(song);
+    _WM_Unlock(&mdi->lock);
+    return (buffer_used);
+}
+
+/* whether the loop above can render the song, else the library's own does */
+static int synth_ready(const struct _mdi *mdi) {
+    return (gauss_table != NULL || !(mdi->extra_info.mixer_options & WM_MO_ENHANCED_RESAMPLING));
+}
+
+int WildMidi_GetOutput(midi *handle, int8_t *buffer, uint32_t size) {
+    /* errors are reported by the library */
+    if (handle == NULL || buffer == NULL || size == 0 || (size % 4) || !synth_ready((struct _mdi *) handle))
+        return (_WM_lib_GetOutput(handle, buffer, size));
+
+    memset(buffer, 0, size);
+    return synth_output((struct _mdi *) handle, (int16_t *) buffer, NULL, 0, size);
+}
+
+int wwm_synth_mix(midi *handle, int32_t *bus, uint32_t frames, int16_t gain) {
+    int16_t pcm[SYNTH_BLOCK * 2];
+    uint32_t done = 0;
+    int res;
+
+    if (frames == 0)
+        return (0);
+    if (handle != NULL && bus != NULL && synth_ready((struct _mdi *) handle))
+        return (synth_output((struct _mdi *) handle, NULL, bus, gain, frames * 4) / 4);
+    if (bus == NULL)
+        return (-1);
+
+    /* through the library's loop, clipped by it */
+    do {
+        uint32_t block = (frames - done) < SYNTH_BLOCK ? (frames - done) : SYNTH_BLOCK;
+
+        res = _WM_lib_GetOutput(handle, (int8_t *) pcm, block * 4);
+        if (res < 0)
+            return (done ? (int) done : -1);
+        wwm_mix_s16(bus + done * 2, pcm, res / 4, gain, gain);
+        done += res / 4;
+    } while (res > 0 && done < frames);
+    return (done);
+}
+
+int WildMidi_Close(midi *handle) {
+    if (handle != NULL)
+        cache_close((struct _mdi *) handle);
+    return (_WM_lib_Close(handle));
+}
@@ -0,0 +1,59 @@
+/*
+ * wwm_synth.h -- libWildMidi's output loop on the voice kernels of wwm_pcm
+ *
+ * WildMidi_GetOutput of this tree (wwm_synth.c) mixes every note a run of
+ * frames at a time instead of every frame a note at a time, the output is
+ * the same. The library's own loop is still built in, to check against.
+ */
+
+#ifndef WWM_SYNTH_H
+#define WWM_SYNTH_H
+
+#include <stdint.h>
+
+#include "wildmidi_lib.h"
+
+/*
+ * libWildMidi's WildMidi_GetOutput under another name, a frame at a time.
+ * wwm_bench -x renders songs through both and compares them.
+ */
+int _WM_lib_GetOutput(midi *handle, int8_t *buffer, uint32_t size);
+
+/*
+ * WildMidi_GetOutput short of the clipping: the song's next frames, scaled
+ * and reverbed as the library does, are added into the interleaved int32
+ * bus times a Q14 gain (WWM_GAIN_UNITY is 1.0). Returns the frames added,
+ * 0 at the end of the song or -1. wwm_mixer sums its streams with it and
+ * clips the sum once.
+ */
+int wwm_synth_mix(midi *handle, int32_t *bus, uint32_t frames, int16_t gain);
+
+/*
+ * Rendered one-shots: a note without a loop (a drum hit mostly) makes the
+ * same premix whenever it plays the same sample at the same pitch and
+ * rate, its velocity, volume and pan only go into the mix volumes. With a
+ * cache of bytes (0, the default, turns it off and drops it), the premix
+ * of such a note is kept the first time, in an LRU shared by every song,
+ * and later ones mix it from there instead of resampling. A note changed
+ * while it plays (a pitch bend, a note off) is rendered from there on. The
+ * output is the same to the bit, wwm_bench -C checks that.
+ */
+void wwm_synth_set_cache(uint32_t bytes);
+
+struct wwm_synth_cache_stats {
+    uint64_t notes;          /* one-shots started with the cache on */
+    uint64_t hits;           /* of those, mixed from a kept premix */
+    uint64_t changed;        /* changed while recorded or played back */
+    uint64_t frames;         /* premix frames of the notes that ended */
+    uint64_t cached_frames;  /* of those, from the cache */
+    uint32_t entries;
+    uint32_t bytes;
+    uint32_t evictions;
+};
+
+void wwm_synth_cache_stats(struct wwm_synth_cache_stats *stats);
+
+/* drops what is kept of the sample data, before it is freed */
+void wwm_synth_cache_forget(const void *data);
+
+#endif /* WWM_SYNTH_H */
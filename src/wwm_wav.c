@@ -0,0 +1,53 @@
+/*
+ * wwm_wav.c -- RIFF/WAVE header for 16 bit stereo output
+ */
+
+#include "config.h"
+
+#include <string.h>
+
+#include "wwm_wav.h"
+
+static void put_le32(uint8_t *p, uint32_t value) {
+    p[0] = (value) & 0xFF;
+    p[1] = (value >> 8) & 0xFF;
+    p[2] = (value >> 16) & 0xFF;
+    p[3] = (value >> 24) & 0xFF;
+}
+
+void wwm_wav_header(uint8_t *wav_hdr, uint32_t rate, uint32_t data_size) {
+    static const uint8_t template[WWM_WAV_HEADER_SIZE] = {
+        0x52, 0x49, 0x46, 0x46, /* "RIFF"  */
+        0x00, 0x00, 0x00, 0x00, /* riffsize: pcm size + 36 */
+        0x57, 0x41, 0x56, 0x45, /* "WAVE"  */
+        0x66, 0x6D, 0x74, 0x20, /* "fmt "  */
+        0x10, 0x00, 0x00, 0x00, /* length of this RIFF block: 16  */
+        0x01, 0x00,             /* wave format == 1 (WAVE_FORMAT_PCM)  */
+        0x02, 0x00,             /* channels == 2  */
+        0x00, 0x00, 0x00, 0x00, /* sample rate  */
+        0x00, 0x00, 0x00, 0x00, /* bytes_per_sec: rate * channels * format bytes  */
+        0x04, 0x00,             /* block alignment: channels * format bytes == 4  */
+        0x10, 0x00,             /* format bits == 16  */
+        0x64, 0x61, 0x74, 0x61, /* "data"  */
+        0x00, 0x00, 0x00, 0x00  /* datasize: the pcm size */
+    };
+
+    memcpy(wav_hdr, template, WWM_WAV_HEADER_SIZE);
+    put_le32(&wav_hdr[4], data_size + 36);
+    put_le32(&wav_hdr[24], rate);
+    put_le32(&wav_hdr[28], rate * 4);
+    put_le32(&wav_hdr[40], data_size);
+}
+
+void wwm_wav_swap(int16_t *data, uint32_t samples) {
+#ifdef WORDS_BIGENDIAN
+    uint16_t *swp = (uint16_t *) data;
+    uint32_t i;
+    for (i = 0; i < samples; i++) {
+        swp[i] = (swp[i] << 8) | (swp[i] >> 8);
+    }
+#else
+    (void) data;
+    (void) samples;
+#endif
+}
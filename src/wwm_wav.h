@@ -0,0 +1,18 @@
+/*
+ * wwm_wav.h -- RIFF/WAVE header for 16 bit stereo output
+ */
+
+#ifndef WWM_WAV_H
+#define WWM_WAV_H
+
+#include <stdint.h>
+
+#define WWM_WAV_HEADER_SIZE 44
+
+/* fills a 44 byte header, data_size is the pcm size in bytes */
+void wwm_wav_header(uint8_t *wav_hdr, uint32_t rate, uint32_t data_size);
+
+/* libWildMidi outputs host-endian, *.wav must have little-endian */
+void wwm_wav_swap(int16_t *data, uint32_t samples);
+
+#endif /* WWM_WAV_H */
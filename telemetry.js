@@ -0,0 +1,86 @@
+/*
+ * Player telemetry in a SharedArrayBuffer: where the song is and how
+ * rendering goes (struct wwm_telemetry and struct wwm_stats in
+ * src/wildwebmidi.h). The worker publishes it after every pump, the page
+ * reads it once per animation frame, instead of a message per chunk.
+ *
+ * A seqlock, the worker is the only writer and SEQ is odd while it writes.
+ * A read that overlaps a write is dropped, the next frame reads the newer
+ * values anyway.
+ */
+function Telemetry(sab) {
+	this.words = new Uint32Array(sab);
+	this.seen = -1;
+	this.values = {};
+}
+
+// SEQ to RENDER_NS are struct wwm_telemetry word for word
+Telemetry.SEQ = 0;
+Telemetry.SONG = 1;
+Telemetry.PLAYING = 2;
+Telemetry.CURRENT = 3;
+Telemetry.TOTAL = 4;
+Telemetry.VOICES = 5;
+Telemetry.RENDER_NS = 6;
+Telemetry.UNDERRUNS = 7;   // the worklet's, since the song started
+Telemetry.CHUNKS = 8;      // from here on struct wwm_stats
+Telemetry.PEAK_VOICES = 9;
+Telemetry.PEAK_RENDER_US = 10;
+Telemetry.LATE_CHUNKS = 11;
+Telemetry.DEGRADED = 12;
+Telemetry.VOICE_LIMIT = 13;
+Telemetry.STOLEN = 14;
+Telemetry.WORDS = 15;
+
+Telemetry.create = function() {
+	return new SharedArrayBuffer(Telemetry.WORDS * 4);
+};
+
+// worker side: telemetry and stats are the addresses of the C structs in heap (HEAPU32)
+Telemetry.prototype.publish = function(heap, telemetry, stats, underruns) {
+	var w = this.words;
+	var t = telemetry >> 2;
+	var s = stats >> 2;
+	var seq = w[Telemetry.SEQ];
+
+	Atomics.store(w, Telemetry.SEQ, seq + 1);
+	for (var i = Telemetry.SONG; i <= Telemetry.RENDER_NS; i++) {
+		Atomics.store(w, i, heap[t + i]);
+	}
+	Atomics.store(w, Telemetry.UNDERRUNS, underruns);
+	Atomics.store(w, Telemetry.CHUNKS, heap[s]);
+	Atomics.store(w, Telemetry.PEAK_VOICES, heap[s + 2]);
+	Atomics.store(w, Telemetry.PEAK_RENDER_US, heap[s + 4]);
+	Atomics.store(w, Telemetry.LATE_CHUNKS, heap[s + 5]);
+	Atomics.store(w, Telemetry.DEGRADED, heap[s + 6]);
+	Atomics.store(w, Telemetry.VOICE_LIMIT, heap[s + 7]);
+	Atomics.store(w, Telemetry.STOLEN, heap[s + 8]);
+	Atomics.store(w, Telemetry.SEQ, seq + 2);
+};
+
+// page side: the values, null when nothing changed since the last read or the worker was writing
+Telemetry.prototype.read = function() {
+	var w = this.words;
+	var v = this.values;
+	var seq = Atomics.load(w, Telemetry.SEQ);
+	if (seq & 1 || seq === this.seen) return null;
+
+	v.song = Atomics.load(w, Telemetry.SONG);
+	v.playing = Atomics.load(w, Telemetry.PLAYING) !== 0;
+	v.current = Atomics.load(w, Telemetry.CURRENT);
+	v.total = Atomics.load(w, Telemetry.TOTAL);
+	v.voices = Atomics.load(w, Telemetry.VOICES);
+	v.renderMs = Atomics.load(w, Telemetry.RENDER_NS) / 1e6;
+	v.underruns = Atomics.load(w, Telemetry.UNDERRUNS);
+	v.chunks = Atomics.load(w, Telemetry.CHUNKS);
+	v.peakVoices = Atomics.load(w, Telemetry.PEAK_VOICES);
+	v.peakRenderMs = Atomics.load(w, Telemetry.PEAK_RENDER_US) / 1000;
+	v.lateChunks = Atomics.load(w, Telemetry.LATE_CHUNKS);
+	v.degraded = Atomics.load(w, Telemetry.DEGRADED);
+	v.voiceLimit = Atomics.load(w, Telemetry.VOICE_LIMIT);
+	v.stolen = Atomics.load(w, Telemetry.STOLEN);
+
+	if (Atomics.load(w, Telemetry.SEQ) !== seq) return null;
+	this.seen = seq;
+	return v;
+};
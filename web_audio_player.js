@@ -1,122 +1,106 @@
 /*
- * Circular Web Audio Buffer Queue
+ * Web Audio Stuff
+ *
+ * Audio is rendered by wwm_worker.js into a PcmRing (pcm_ring.js) which the
+ * wildwebmidi audio worklet (wwm_worklet.js) plays from. SharedArrayBuffer
+ * needs the page to be cross-origin isolated (COOP/COEP headers).
  */
-function CircularAudioBuffer(slots, audioCtx) {
-	slots = slots || 24; // number of buffers
-	this.slots = slots;
-	this.buffers = new Array(slots);
-
-	this.reset();
-
-	for (var i = 0; i < slots; i++) {
-		var buffer = audioCtx.createBuffer(channels, BUFFER, SAMPLE_RATE);
-		this.buffers[i] = buffer;
-	}
-}
-
-// pseudo empty all buffers
-CircularAudioBuffer.prototype.reset = function() {
-	this.used = 0;
-	this.filled = 0;
-};
-
-// returns number of buffers that are filled
-CircularAudioBuffer.prototype.filledBuffers = function() {
-	var fills = this.filled - this.used;
-	if (fills < 0) fills += this.slots;
-	return fills;
-}
-
-// returns whether buffers are all filled
-CircularAudioBuffer.prototype.full = function() {
-	return this.filledBuffers() >= this.slots - 1;
-}
-
-// returns a reference to next available buffer to be filled
-CircularAudioBuffer.prototype.prepare = function() {
-	if (this.full()) {
-		console.log('buffers full!!')
-		return
-	}
-	var buffer = this.buffers[this.filled++];
-	this.filled %= this.slots;
-	return buffer;
-}
-
-// returns the next buffer in the queue
-CircularAudioBuffer.prototype.use = function() {
-	if (!this.filledBuffers()) return;
-	var buffer = this.buffers[this.used++];
-	this.used %= this.slots;
-	return buffer;
-}
-
 
 /*
- * Web Audio Stuff
+ * Latency profiles: frames rendered per chunk and chunks queued ahead in
+ * the ring, which is the latency the player adds (same as the profiles in
+ * src/wildwebmidi.c). live is for playing the synth from midi input,
+ * batch is for conversions, where only throughput counts. Queues are
+ * powers of two frames (PcmRing).
  */
+var PROFILES = {
+	'live': { chunk: 64, queue: 4 },
+	'low-latency': { chunk: 256, queue: 4 },
+	'balanced': { chunk: 1024, queue: 8 },
+	'batch': { chunk: 16384, queue: 2 }
+};
+
+// what WildMidi_Init accepts (WWM_MIN_RATE, WWM_MAX_RATE), else FALLBACK_RATE is asked for
+var MIN_RATE = 11025;
+var MAX_RATE = 65000;
+var FALLBACK_RATE = 48000;
 
-var SAMPLE_RATE = 44100;
-var BUFFER = 4096; // buffer sample
+var SAMPLE_RATE = 44100; // the AudioContext rate once initAudio ran
 var channels = 2;
 
-// Create AudioContext and buffer source
+// Create AudioContext and worklet node
 var audioCtx;
-var source;
-var scriptNode;
-var circularBuffer;
-var emptyBuffer;
+var playerNode;
+var ringBuffer;
 var audioIsInitted = false;
+var onPlaying = null; // called when the worklet plays the first frames of a song
 
-function initAudio() {
-    audioCtx = new window.AudioContext();
-    scriptNode = audioCtx.createScriptProcessor(BUFFER, 0, channels);
-    scriptNode.onaudioprocess = onAudioProcess;
-
-    source = audioCtx.createBufferSource();
-    circularBuffer = new CircularAudioBuffer(4, audioCtx);
-    emptyBuffer = audioCtx.createBuffer(channels, BUFFER, SAMPLE_RATE);
-
-    source.connect(scriptNode);
-    source.start(0);
+/*
+ * creates the shared ring for a profile (PROFILES), returns a promise for
+ * the worklet node. The synth renders at the rate of the audio device, so
+ * nothing is resampled on the way out. Calling it again replaces the
+ * context, eg. for another profile.
+ */
+function initAudio(renderWorker, profileName) {
+	var profile = PROFILES[profileName] || PROFILES.balanced;
+	var latencyHint = profile.chunk * profile.queue <= 2048 ? 'interactive' : 'playback';
+
+	if (audioCtx) audioCtx.close();
+	audioIsInitted = true;
+	audioCtx = new window.AudioContext({ latencyHint: latencyHint });
+	if (audioCtx.sampleRate < MIN_RATE || audioCtx.sampleRate > MAX_RATE) {
+		audioCtx.close();
+		audioCtx = new window.AudioContext({ latencyHint: latencyHint, sampleRate: FALLBACK_RATE });
+	}
+	SAMPLE_RATE = audioCtx.sampleRate;
+	ringBuffer = PcmRing.create(profile.chunk * profile.queue);
+
+	// the worklet tells the worker directly when there is room to render into
+	var demand = new MessageChannel();
+	renderWorker.postMessage({
+		type: 'init', sab: ringBuffer, port: demand.port2, rate: SAMPLE_RATE, chunk: profile.chunk
+	}, [demand.port2]);
+
+	return audioCtx.audioWorklet.addModule('pcm_ring.js').then(function() {
+		return audioCtx.audioWorklet.addModule('wwm_worklet.js');
+	}).then(function() {
+		playerNode = new AudioWorkletNode(audioCtx, 'wildwebmidi', {
+			numberOfInputs: 0,
+			outputChannelCount: [channels],
+			processorOptions: { sab: ringBuffer }
+		});
+		playerNode.port.onmessage = onPlayerMessage;
+		playerNode.port.postMessage({ type: 'demand', port: demand.port1 }, [demand.port1]);
+		return playerNode;
+	});
 }
 
-
 function startAudio() {
-	scriptNode.connect(audioCtx.destination);
+	playerNode.connect(audioCtx.destination);
 }
 
 function pauseAudio() {
-	scriptNode.disconnect();
+	playerNode.disconnect();
 }
 
-// Give the node a function to process audio events
-function onAudioProcess(audioProcessingEvent) {
-	var generated = circularBuffer.use();
+// hold (or resume) playback, the worker sleeps while the ring is full
+function setPaused(paused) {
+	playerNode.port.postMessage({ type: 'pause', paused: paused });
+}
 
-	if (!generated && pauseAudioAfterDrainingBuffer) {
-		// wait for remaining buffer to drain before disconnect audio
+function onPlayerMessage(e) {
+	switch (e.data.type) {
+	case 'drained':
+		// remaining buffer has drained, disconnect audio
 		pauseAudio();
-		pauseAudioAfterDrainingBuffer = false;
-		signalStop = 0;
 		if (callbackOnStop) callbackOnStop();
 		callbackOnStop = null;
-		return;
-	}
-	if (!generated) {
-		console.log('buffer under run!!')
-		generated = emptyBuffer;
+		break;
+	case 'playing':
+		if (onPlaying) onPlaying();
+		break;
+	case 'underrun':
+		console.log('buffer under run!!');
+		break;
 	}
-
-	var outputBuffer = audioProcessingEvent.outputBuffer;
-	var offset = 0;
-	outputBuffer.copyToChannel(generated.getChannelData(0), 0, offset);
-	outputBuffer.copyToChannel(generated.getChannelData(1), 1, offset);
 }
-
-/*
-// debugging stats
-setInterval(function() {
-	console.log('audio queue', circularBuffer.filledBuffers());
-}, 5000);
-*/
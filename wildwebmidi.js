@@ -1,16 +0,0 @@
-var Module;if(typeof Module==="undefined")Module={};if(!Module.expectedDataFileDownloads){Module.expectedDataFileDownloads=0;Module.finishedDataFileDownloads=0}Module.expectedDataFileDownloads++;((function(){var loadPackage=(function(metadata){var PACKAGE_PATH;if(typeof window==="object"){PACKAGE_PATH=window["encodeURIComponent"](window.location.pathname.toString().substring(0,window.location.pathname.toString().lastIndexOf("/"))+"/")}else if(typeof location!=="undefined"){PACKAGE_PATH=encodeURIComponent(location.pathname.toString().substring(0,location.pathname.toString().lastIndexOf("/"))+"/")}else{throw"using preloaded data can only be done on a web page or in a web worker"}var PACKAGE_NAME="wildwebmidi.data";var REMOTE_PACKAGE_BASE="wildwebmidi.data";if(typeof Module["locateFilePackage"]==="function"&&!Module["locateFile"]){Module["locateFile"]=Module["locateFilePackage"];Module.printErr("warning: you defined Module.locateFilePackage, that has been renamed to Module.locateFile (using your locateFilePackage for now)")}var REMOTE_PACKAGE_NAME=typeof Module["locateFile"]==="function"?Module["locateFile"](REMOTE_PACKAGE_BASE):(Module["filePackagePrefixURL"]||"")+REMOTE_PACKAGE_BASE;var REMOTE_PACKAGE_SIZE=1844969;var PACKAGE_UUID="3f29fab8-2005-4a10-a54c-1098a11d7097";function fetchRemotePackage(packageName,packageSize,callback,errback){var xhr=new XMLHttpRequest;xhr.open("GET",packageName,true);xhr.responseType="arraybuffer";xhr.onprogress=(function(event){var url=packageName;var size=packageSize;if(event.total)size=event.total;if(event.loaded){if(!xhr.addedTotal){xhr.addedTotal=true;if(!Module.dataFileDownloads)Module.dataFileDownloads={};Module.dataFileDownloads[url]={loaded:event.loaded,total:size}}else{Module.dataFileDownloads[url].loaded=event.loaded}var total=0;var loaded=0;var num=0;for(var download in Module.dataFileDownloads){var data=Module.dataFileDownloads[download];total+=data.total;loaded+=data.loaded;num++}total=Math.ceil(total*Module.expectedDataFileDownloads/num);if(Module["setStatus"])Module["setStatus"]("Downloading data... ("+loaded+"/"+total+")")}else if(!Module.dataFileDownloads){if(Module["setStatus"])Module["setStatus"]("Downloading data...")}});xhr.onload=(function(event){var packageData=xhr.response;callback(packageData)});xhr.send(null)}function handleError(error){console.error("package error:",error)}var fetched=null,fetchedCallback=null;fetchRemotePackage(REMOTE_PACKAGE_NAME,REMOTE_PACKAGE_SIZE,(function(data){if(fetchedCallback){fetchedCallback(data);fetchedCallback=null}else{fetched=data}}),handleError);function runWithFS(){function assert(check,msg){if(!check)throw msg+(new Error).stack}Module["FS_createPath"]("/","freepats",true,true);Module["FS_createPath"]("/freepats","Tone_000",true,true);function DataRequest(start,end,crunched,audio){this.start=start;this.end=end;this.crunched=crunched;this.audio=audio}DataRequest.prototype={requests:{},open:(function(mode,name){this.name=name;this.requests[name]=this;Module["addRunDependency"]("fp "+this.name)}),send:(function(){}),onload:(function(){var byteArray=this.byteArray.subarray(this.start,this.end);this.finish(byteArray)}),finish:(function(byteArray){var that=this;Module["FS_createPreloadedFile"](this.name,null,byteArray,true,true,(function(){Module["removeRunDependency"]("fp "+that.name)}),(function(){if(that.audio){Module["removeRunDependency"]("fp "+that.name)}else{Module.printErr("Preloading file "+that.name+" failed")}}),false,true);this.requests[this.name]=null})};(new DataRequest(0,8196,0,0)).open("GET","/freepats/.DS_Store");(new DataRequest(8196,45892,0,0)).open("GET","/freepats/chpn_op66.mid");(new DataRequest(45892,64002,0,0)).open("GET","/freepats/COPYING");(new DataRequest(64002,81114,0,0)).open("GET","/freepats/deb_clai.mid");(new DataRequest(81114,95251,0,0)).open("GET","/freepats/ENTERTNR.MID");(new DataRequest(95251,115753,0,0)).open("GET","/freepats/etude_10_4_(c)finley.mid");(new DataRequest(115753,150744,0,0)).open("GET","/freepats/ff3chocobo.mid");(new DataRequest(150744,158389,0,0)).open("GET","/freepats/freepats.cfg");(new DataRequest(158389,197412,0,0)).open("GET","/freepats/liz_et3.mid");(new DataRequest(197412,309013,0,0)).open("GET","/freepats/melodies_of_life.mid");(new DataRequest(309013,407115,0,0)).open("GET","/freepats/prelude.mid");(new DataRequest(407115,413171,0,0)).open("GET","/freepats/README");(new DataRequest(413171,478232,0,0)).open("GET","/freepats/STRIVING.MID");(new DataRequest(478232,486741,0,0)).open("GET","/freepats/Super_Mario_Bros_-_Overworld_Theme_by_BlueSCD.mid");(new DataRequest(486741,502458,0,0)).open("GET","/freepats/TOCATTA.MID");(new DataRequest(502458,508606,0,0)).open("GET","/freepats/Tone_000/.DS_Store");(new DataRequest(508606,1844969,0,0)).open("GET","/freepats/Tone_000/000_Acoustic_Grand_Piano.pat");function processPackageData(arrayBuffer){Module.finishedDataFileDownloads++;assert(arrayBuffer,"Loading data file failed.");var byteArray=new Uint8Array(arrayBuffer);var curr;var ptr=Module["getMemory"](byteArray.length);Module["HEAPU8"].set(byteArray,ptr);DataRequest.prototype.byteArray=Module["HEAPU8"].subarray(ptr,ptr+byteArray.length);DataRequest.prototype.requests["/freepats/.DS_Store"].onload();DataRequest.prototype.requests["/freepats/chpn_op66.mid"].onload();DataRequest.prototype.requests["/freepats/COPYING"].onload();DataRequest.prototype.requests["/freepats/deb_clai.mid"].onload();DataRequest.prototype.requests["/freepats/ENTERTNR.MID"].onload();DataRequest.prototype.requests["/freepats/etude_10_4_(c)finley.mid"].onload();DataRequest.prototype.requests["/freepats/ff3chocobo.mid"].onload();DataRequest.prototype.requests["/freepats/freepats.cfg"].onload();DataRequest.prototype.requests["/freepats/liz_et3.mid"].onload();DataRequest.prototype.requests["/freepats/melodies_of_life.mid"].onload();DataRequest.prototype.requests["/freepats/prelude.mid"].onload();DataRequest.prototype.requests["/freepats/README"].onload();DataRequest.prototype.requests["/freepats/STRIVING.MID"].onload();DataRequest.prototype.requests["/freepats/Super_Mario_Bros_-_Overworld_Theme_by_BlueSCD.mid"].onload();DataRequest.prototype.requests["/freepats/TOCATTA.MID"].onload();DataRequest.prototype.requests["/freepats/Tone_000/.DS_Store"].onload();DataRequest.prototype.requests["/freepats/Tone_000/000_Acoustic_Grand_Piano.pat"].onload();Module["removeRunDependency"]("datafile_wildwebmidi.data")}Module["addRunDependency"]("datafile_wildwebmidi.data");if(!Module.preloadResults)Module.preloadResults={};Module.preloadResults[PACKAGE_NAME]={fromCache:false};if(fetched){processPackageData(fetched);fetched=null}else{fetchedCallback=processPackageData}}if(Module["calledRun"]){runWithFS()}else{if(!Module["preRun"])Module["preRun"]=[];Module["preRun"].push(runWithFS)}});loadPackage()}))();var Module;if(!Module)Module=(typeof Module!=="undefined"?Module:null)||{};var moduleOverrides={};for(var key in Module){if(Module.hasOwnProperty(key)){moduleOverrides[key]=Module[key]}}var ENVIRONMENT_IS_WEB=typeof window==="object";var ENVIRONMENT_IS_NODE=typeof process==="object"&&typeof require==="function"&&!ENVIRONMENT_IS_WEB;var ENVIRONMENT_IS_WORKER=typeof importScripts==="function";var ENVIRONMENT_IS_SHELL=!ENVIRONMENT_IS_WEB&&!ENVIRONMENT_IS_NODE&&!ENVIRONMENT_IS_WORKER;if(ENVIRONMENT_IS_NODE){if(!Module["print"])Module["print"]=function print(x){process["stdout"].write(x+"\n")};if(!Module["printErr"])Module["printErr"]=function printErr(x){process["stderr"].write(x+"\n")};var nodeFS=require("fs");var nodePath=require("path");Module["read"]=function read(filename,binary){filename=nodePath["normalize"](filename);var ret=nodeFS["readFileSync"](filename);if(!ret&&filename!=nodePath["resolve"](filename)){filename=path.join(__dirname,"..","src",filename);ret=nodeFS["readFileSync"](filename)}if(ret&&!binary)ret=ret.toString();return ret};Module["readBinary"]=function readBinary(filename){return Module["read"](filename,true)};Module["load"]=function load(f){globalEval(read(f))};if(!Module["thisProgram"]){if(process["argv"].length>1){Module["thisProgram"]=process["argv"][1].replace(/\\/g,"/")}else{Module["thisProgram"]="unknown-program"}}Module["arguments"]=process["argv"].slice(2);if(typeof module!=="undefined"){module["exports"]=Module}process["on"]("uncaughtException",(function(ex){if(!(ex instanceof ExitStatus)){throw ex}}));Module["inspect"]=(function(){return"[Emscripten Module object]"})}else if(ENVIRONMENT_IS_SHELL){if(!Module["print"])Module["print"]=print;if(typeof printErr!="undefined")Module["printErr"]=printErr;if(typeof read!="undefined"){Module["read"]=read}else{Module["read"]=function read(){throw"no read() available (jsc?)"}}Module["readBinary"]=function readBinary(f){if(typeof readbuffer==="function"){return new Uint8Array(readbuffer(f))}var data=read(f,"binary");assert(typeof data==="object");return data};if(typeof scriptArgs!="undefined"){Module["arguments"]=scriptArgs}else if(typeof arguments!="undefined"){Module["arguments"]=arguments}}else if(ENVIRONMENT_IS_WEB||ENVIRONMENT_IS_WORKER){Module["read"]=function read(url){var xhr=new XMLHttpRequest;xhr.open("GET",url,false);xhr.send(null);return xhr.responseText};if(typeof arguments!="undefined"){Module["arguments"]=arguments}if(typeof console!=="undefined"){if(!Module["print"])Module["print"]=function print(x){console.log(x)};if(!Module["printErr"])Module["printErr"]=function printErr(x){console.log(x)}}else{var TRY_USE_DUMP=false;if(!Module["print"])Module["print"]=TRY_USE_DUMP&&typeof dump!=="undefined"?(function(x){dump(x)}):(function(x){})}if(ENVIRONMENT_IS_WORKER){Module["load"]=importScripts}if(typeof Module["setWindowTitle"]==="undefined"){Module["setWindowTitle"]=(function(title){document.title=title})}}else{throw"Unknown runtime environment. Where are we?"}function globalEval(x){eval.call(null,x)}if(!Module["load"]&&Module["read"]){Module["load"]=function load(f){globalEval(Module["read"](f))}}if(!Module["print"]){Module["print"]=(function(){})}if(!Module["printErr"]){Module["printErr"]=Module["print"]}if(!Module["arguments"]){Module["arguments"]=[]}if(!Module["thisProgram"]){Module["thisProgram"]="./this.program"}Module.print=Module["print"];Module.printErr=Module["printErr"];Module["preRun"]=[];Module["postRun"]=[];for(var key in moduleOverrides){if(moduleOverrides.hasOwnProperty(key)){Module[key]=moduleOverrides[key]}}var Runtime={setTempRet0:(function(value){tempRet0=value}),getTempRet0:(function(){return tempRet0}),stackSave:(function(){return STACKTOP}),stackRestore:(function(stackTop){STACKTOP=stackTop}),getNativeTypeSize:(function(type){switch(type){case"i1":case"i8":return 1;case"i16":return 2;case"i32":return 4;case"i64":return 8;case"float":return 4;case"double":return 8;default:{if(type[type.length-1]==="*"){return Runtime.QUANTUM_SIZE}else if(type[0]==="i"){var bits=parseInt(type.substr(1));assert(bits%8===0);return bits/8}else{return 0}}}}),getNativeFieldSize:(function(type){return Math.max(Runtime.getNativeTypeSize(type),Runtime.QUANTUM_SIZE)}),STACK_ALIGN:16,prepVararg:(function(ptr,type){if(type==="double"||type==="i64"){if(ptr&7){assert((ptr&7)===4);ptr+=4}}else{assert((ptr&3)===0)}return ptr}),getAlignSize:(function(type,size,vararg){if(!vararg&&(type=="i64"||type=="double"))return 8;if(!type)return Math.min(size,8);return Math.min(size||(type?Runtime.getNativeFieldSize(type):0),Runtime.QUANTUM_SIZE)}),dynCall:(function(sig,ptr,args){if(args&&args.length){if(!args.splice)args=Array.prototype.slice.call(args);args.splice(0,0,ptr);return Module["dynCall_"+sig].apply(null,args)}else{return Module["dynCall_"+sig].call(null,ptr)}}),functionPointers:[],addFunction:(function(func){for(var i=0;i<Runtime.functionPointers.length;i++){if(!Runtime.functionPointers[i]){Runtime.functionPointers[i]=func;return 2*(1+i)}}throw"Finished up all reserved function pointers. Use a higher value for RESERVED_FUNCTION_POINTERS."}),removeFunction:(function(index){Runtime.functionPointers[(index-2)/2]=null}),warnOnce:(function(text){if(!Runtime.warnOnce.shown)Runtime.warnOnce.shown={};if(!Runtime.warnOnce.shown[text]){Runtime.warnOnce.shown[text]=1;Module.printErr(text)}}),funcWrappers:{},getFuncWrapper:(function(func,sig){assert(sig);if(!Runtime.funcWrappers[sig]){Runtime.funcWrappers[sig]={}}var sigCache=Runtime.funcWrappers[sig];if(!sigCache[func]){sigCache[func]=function dynCall_wrapper(){return Runtime.dynCall(sig,func,arguments)}}return sigCache[func]}),getCompilerSetting:(function(name){throw"You must build with -s RETAIN_COMPILER_SETTINGS=1 for Runtime.getCompilerSetting or emscripten_get_compiler_setting to work"}),stackAlloc:(function(size){var ret=STACKTOP;STACKTOP=STACKTOP+size|0;STACKTOP=STACKTOP+15&-16;return ret}),staticAlloc:(function(size){var ret=STATICTOP;STATICTOP=STATICTOP+size|0;STATICTOP=STATICTOP+15&-16;return ret}),dynamicAlloc:(function(size){var ret=DYNAMICTOP;DYNAMICTOP=DYNAMICTOP+size|0;DYNAMICTOP=DYNAMICTOP+15&-16;if(DYNAMICTOP>=TOTAL_MEMORY){var success=enlargeMemory();if(!success){DYNAMICTOP=ret;return 0}}return ret}),alignMemory:(function(size,quantum){var ret=size=Math.ceil(size/(quantum?quantum:16))*(quantum?quantum:16);return ret}),makeBigInt:(function(low,high,unsigned){var ret=unsigned?+(low>>>0)+ +(high>>>0)*+4294967296:+(low>>>0)+ +(high|0)*+4294967296;return ret}),GLOBAL_BASE:8,QUANTUM_SIZE:4,__dummy__:0};Module["Runtime"]=Runtime;var __THREW__=0;var ABORT=false;var EXITSTATUS=0;var undef=0;var tempValue,tempInt,tempBigInt,tempInt2,tempBigInt2,tempPair,tempBigIntI,tempBigIntR,tempBigIntS,tempBigIntP,tempBigIntD,tempDouble,tempFloat;var tempI64,tempI64b;var tempRet0,tempRet1,tempRet2,tempRet3,tempRet4,tempRet5,tempRet6,tempRet7,tempRet8,tempRet9;function assert(condition,text){if(!condition){abort("Assertion failed: "+text)}}var globalScope=this;function getCFunc(ident){var func=Module["_"+ident];if(!func){try{func=eval("_"+ident)}catch(e){}}assert(func,"Cannot call unknown function "+ident+" (perhaps LLVM optimizations or closure removed it?)");return func}var cwrap,ccall;((function(){var JSfuncs={"stackSave":(function(){Runtime.stackSave()}),"stackRestore":(function(){Runtime.stackRestore()}),"arrayToC":(function(arr){var ret=Runtime.stackAlloc(arr.length);writeArrayToMemory(arr,ret);return ret}),"stringToC":(function(str){var ret=0;if(str!==null&&str!==undefined&&str!==0){ret=Runtime.stackAlloc((str.length<<2)+1);writeStringToMemory(str,ret)}return ret})};var toC={"string":JSfuncs["stringToC"],"array":JSfuncs["arrayToC"]};ccall=function ccallFunc(ident,returnType,argTypes,args,opts){var func=getCFunc(ident);var cArgs=[];var stack=0;if(args){for(var i=0;i<args.length;i++){var converter=toC[argTypes[i]];if(converter){if(stack===0)stack=Runtime.stackSave();cArgs[i]=converter(args[i])}else{cArgs[i]=args[i]}}}var ret=func.apply(null,cArgs);if(returnType==="string")ret=Pointer_stringify(ret);if(stack!==0){if(opts&&opts.async){EmterpreterAsync.asyncFinalizers.push((function(){Runtime.stackRestore(stack)}));return}Runtime.stackRestore(stack)}return ret};var sourceRegex=/^function\s*\(([^)]*)\)\s*{\s*([^*]*?)[\s;]*(?:return\s*(.*?)[;\s]*)?}$/;function parseJSFunc(jsfunc){var parsed=jsfunc.toString().match(sourceRegex).slice(1);return{arguments:parsed[0],body:parsed[1],returnValue:parsed[2]}}var JSsource={};for(var fun in JSfuncs){if(JSfuncs.hasOwnProperty(fun)){JSsource[fun]=parseJSFunc(JSfuncs[fun])}}cwrap=function cwrap(ident,returnType,argTypes){argTypes=argTypes||[];var cfunc=getCFunc(ident);var numericArgs=argTypes.every((function(type){return type==="number"}));var numericRet=returnType!=="string";if(numericRet&&numericArgs){return cfunc}var argNames=argTypes.map((function(x,i){return"$"+i}));var funcstr="(function("+argNames.join(",")+") {";var nargs=argTypes.length;if(!numericArgs){funcstr+="var stack = "+JSsource["stackSave"].body+";";for(var i=0;i<nargs;i++){var arg=argNames[i],type=argTypes[i];if(type==="number")continue;var convertCode=JSsource[type+"ToC"];funcstr+="var "+convertCode.arguments+" = "+arg+";";funcstr+=convertCode.body+";";funcstr+=arg+"="+convertCode.returnValue+";"}}var cfuncname=parseJSFunc((function(){return cfunc})).returnValue;funcstr+="var ret = "+cfuncname+"("+argNames.join(",")+");";if(!numericRet){var strgfy=parseJSFunc((function(){return Pointer_stringify})).returnValue;funcstr+="ret = "+strgfy+"(ret);"}if(!numericArgs){funcstr+=JSsource["stackRestore"].body.replace("()","(stack)")+";"}funcstr+="return ret})";return eval(funcstr)}}))();Module["cwrap"]=cwrap;Module["ccall"]=ccall;function setValue(ptr,value,type,noSafe){type=type||"i8";if(type.charAt(type.length-1)==="*")type="i32";switch(type){case"i1":HEAP8[ptr>>0]=value;break;case"i8":HEAP8[ptr>>0]=value;break;case"i16":HEAP16[ptr>>1]=value;break;case"i32":HEAP32[ptr>>2]=value;break;case"i64":tempI64=[value>>>0,(tempDouble=value,+Math_abs(tempDouble)>=+1?tempDouble>+0?(Math_min(+Math_floor(tempDouble/+4294967296),+4294967295)|0)>>>0:~~+Math_ceil((tempDouble- +(~~tempDouble>>>0))/+4294967296)>>>0:0)],HEAP32[ptr>>2]=tempI64[0],HEAP32[ptr+4>>2]=tempI64[1];break;case"float":HEAPF32[ptr>>2]=value;break;case"double":HEAPF64[ptr>>3]=value;break;default:abort("invalid type for setValue: "+type)}}Module["setValue"]=setValue;function getValue(ptr,type,noSafe){type=type||"i8";if(type.charAt(type.length-1)==="*")type="i32";switch(type){case"i1":return HEAP8[ptr>>0];case"i8":return HEAP8[ptr>>0];case"i16":return HEAP16[ptr>>1];case"i32":return HEAP32[ptr>>2];case"i64":return HEAP32[ptr>>2];case"float":return HEAPF32[ptr>>2];case"double":return HEAPF64[ptr>>3];default:abort("invalid type for setValue: "+type)}return null}Module["getValue"]=getValue;var ALLOC_NORMAL=0;var ALLOC_STACK=1;var ALLOC_STATIC=2;var ALLOC_DYNAMIC=3;var ALLOC_NONE=4;Module["ALLOC_NORMAL"]=ALLOC_NORMAL;Module["ALLOC_STACK"]=ALLOC_STACK;Module["ALLOC_STATIC"]=ALLOC_STATIC;Module["ALLOC_DYNAMIC"]=ALLOC_DYNAMIC;Module["ALLOC_NONE"]=ALLOC_NONE;function allocate(slab,types,allocator,ptr){var zeroinit,size;if(typeof slab==="number"){zeroinit=true;size=slab}else{zeroinit=false;size=slab.length}var singleType=typeof types==="string"?types:null;var ret;if(allocator==ALLOC_NONE){ret=ptr}else{ret=[_malloc,Runtime.stackAlloc,Runtime.staticAlloc,Runtime.dynamicAlloc][allocator===undefined?ALLOC_STATIC:allocator](Math.max(size,singleType?1:types.length))}if(zeroinit){var ptr=ret,stop;assert((ret&3)==0);stop=ret+(size&~3);for(;ptr<stop;ptr+=4){HEAP32[ptr>>2]=0}stop=ret+size;while(ptr<stop){HEAP8[ptr++>>0]=0}return ret}if(singleType==="i8"){if(slab.subarray||slab.slice){HEAPU8.set(slab,ret)}else{HEAPU8.set(new Uint8Array(slab),ret)}return ret}var i=0,type,typeSize,previousType;while(i<size){var curr=slab[i];if(typeof curr==="function"){curr=Runtime.getFunctionIndex(curr)}type=singleType||types[i];if(type===0){i++;continue}if(type=="i64")type="i32";setValue(ret+i,curr,type);if(previousType!==type){typeSize=Runtime.getNativeTypeSize(type);previousType=type}i+=typeSize}return ret}Module["allocate"]=allocate;function getMemory(size){if(!staticSealed)return Runtime.staticAlloc(size);if(typeof _sbrk!=="undefined"&&!_sbrk.called||!runtimeInitialized)return Runtime.dynamicAlloc(size);return _malloc(size)}Module["getMemory"]=getMemory;function Pointer_stringify(ptr,length){if(length===0||!ptr)return"";var hasUtf=0;var t;var i=0;while(1){t=HEAPU8[ptr+i>>0];hasUtf|=t;if(t==0&&!length)break;i++;if(length&&i==length)break}if(!length)length=i;var ret="";if(hasUtf<128){var MAX_CHUNK=1024;var curr;while(length>0){curr=String.fromCharCode.apply(String,HEAPU8.subarray(ptr,ptr+Math.min(length,MAX_CHUNK)));ret=ret?ret+curr:curr;ptr+=MAX_CHUNK;length-=MAX_CHUNK}return ret}return Module["UTF8ToString"](ptr)}Module["Pointer_stringify"]=Pointer_stringify;function AsciiToString(ptr){var str="";while(1){var ch=HEAP8[ptr++>>0];if(!ch)return str;str+=String.fromCharCode(ch)}}Module["AsciiToString"]=AsciiToString;function stringToAscii(str,outPtr){return writeAsciiToMemory(str,outPtr,false)}Module["stringToAscii"]=stringToAscii;function UTF8ArrayToString(u8Array,idx){var u0,u1,u2,u3,u4,u5;var str="";while(1){u0=u8Array[idx++];if(!u0)return str;if(!(u0&128)){str+=String.fromCharCode(u0);continue}u1=u8Array[idx++]&63;if((u0&224)==192){str+=String.fromCharCode((u0&31)<<6|u1);continue}u2=u8Array[idx++]&63;if((u0&240)==224){u0=(u0&15)<<12|u1<<6|u2}else{u3=u8Array[idx++]&63;if((u0&248)==240){u0=(u0&7)<<18|u1<<12|u2<<6|u3}else{u4=u8Array[idx++]&63;if((u0&252)==248){u0=(u0&3)<<24|u1<<18|u2<<12|u3<<6|u4}else{u5=u8Array[idx++]&63;u0=(u0&1)<<30|u1<<24|u2<<18|u3<<12|u4<<6|u5}}}if(u0<65536){str+=String.fromCharCode(u0)}else{var ch=u0-65536;str+=String.fromCharCode(55296|ch>>10,56320|ch&1023)}}}Module["UTF8ArrayToString"]=UTF8ArrayToString;function UTF8ToString(ptr){return UTF8ArrayToString(HEAPU8,ptr)}Module["UTF8ToString"]=UTF8ToString;function stringToUTF8Array(str,outU8Array,outIdx,maxBytesToWrite){if(!(maxBytesToWrite>0))return 0;var startIdx=outIdx;var endIdx=outIdx+maxBytesToWrite-1;for(var i=0;i<str.length;++i){var u=str.charCodeAt(i);if(u>=55296&&u<=57343)u=65536+((u&1023)<<10)|str.charCodeAt(++i)&1023;if(u<=127){if(outIdx>=endIdx)break;outU8Array[outIdx++]=u}else if(u<=2047){if(outIdx+1>=endIdx)break;outU8Array[outIdx++]=192|u>>6;outU8Array[outIdx++]=128|u&63}else if(u<=65535){if(outIdx+2>=endIdx)break;outU8Array[outIdx++]=224|u>>12;outU8Array[outIdx++]=128|u>>6&63;outU8Array[outIdx++]=128|u&63}else if(u<=2097151){if(outIdx+3>=endIdx)break;outU8Array[outIdx++]=240|u>>18;outU8Array[outIdx++]=128|u>>12&63;outU8Array[outIdx++]=128|u>>6&63;outU8Array[outIdx++]=128|u&63}else if(u<=67108863){if(outIdx+4>=endIdx)break;outU8Array[outIdx++]=248|u>>24;outU8Array[outIdx++]=128|u>>18&63;outU8Array[outIdx++]=128|u>>12&63;outU8Array[outIdx++]=128|u>>6&63;outU8Array[outIdx++]=128|u&63}else{if(outIdx+5>=endIdx)break;outU8Array[outIdx++]=252|u>>30;outU8Array[outIdx++]=128|u>>24&63;outU8Array[outIdx++]=128|u>>18&63;outU8Array[outIdx++]=128|u>>12&63;outU8Array[outIdx++]=128|u>>6&63;outU8Array[outIdx++]=128|u&63}}outU8Array[outIdx]=0;return outIdx-startIdx}Module["stringToUTF8Array"]=stringToUTF8Array;function stringToUTF8(str,outPtr,maxBytesToWrite){return stringToUTF8Array(str,HEAPU8,outPtr,maxBytesToWrite)}Module["stringToUTF8"]=stringToUTF8;function lengthBytesUTF8(str){var len=0;for(var i=0;i<str.length;++i){var u=str.charCodeAt(i);if(u>=55296&&u<=57343)u=65536+((u&1023)<<10)|str.charCodeAt(++i)&1023;if(u<=127){++len}else if(u<=2047){len+=2}else if(u<=65535){len+=3}else if(u<=2097151){len+=4}else if(u<=67108863){len+=5}else{len+=6}}return len}Module["lengthBytesUTF8"]=lengthBytesUTF8;function UTF16ToString(ptr){var i=0;var str="";while(1){var codeUnit=HEAP16[ptr+i*2>>1];if(codeUnit==0)return str;++i;str+=String.fromCharCode(codeUnit)}}Module["UTF16ToString"]=UTF16ToString;function stringToUTF16(str,outPtr,maxBytesToWrite){if(maxBytesToWrite===undefined){maxBytesToWrite=2147483647}if(maxBytesToWrite<2)return 0;maxBytesToWrite-=2;var startPtr=outPtr;var numCharsToWrite=maxBytesToWrite<str.length*2?maxBytesToWrite/2:str.length;for(var i=0;i<numCharsToWrite;++i){var codeUnit=str.charCodeAt(i);HEAP16[outPtr>>1]=codeUnit;outPtr+=2}HEAP16[outPtr>>1]=0;return outPtr-startPtr}Module["stringToUTF16"]=stringToUTF16;function lengthBytesUTF16(str){return str.length*2}Module["lengthBytesUTF16"]=lengthBytesUTF16;function UTF32ToString(ptr){var i=0;var str="";while(1){var utf32=HEAP32[ptr+i*4>>2];if(utf32==0)return str;++i;if(utf32>=65536){var ch=utf32-65536;str+=String.fromCharCode(55296|ch>>10,56320|ch&1023)}else{str+=String.fromCharCode(utf32)}}}Module["UTF32ToString"]=UTF32ToString;function stringToUTF32(str,outPtr,maxBytesToWrite){if(maxBytesToWrite===undefined){maxBytesToWrite=2147483647}if(maxBytesToWrite<4)return 0;var startPtr=outPtr;var endPtr=startPtr+maxBytesToWrite-4;for(var i=0;i<str.length;++i){var codeUnit=str.charCodeAt(i);if(codeUnit>=55296&&codeUnit<=57343){var trailSurrogate=str.charCodeAt(++i);codeUnit=65536+((codeUnit&1023)<<10)|trailSurrogate&1023}HEAP32[outPtr>>2]=codeUnit;outPtr+=4;if(outPtr+4>endPtr)break}HEAP32[outPtr>>2]=0;return outPtr-startPtr}Module["stringToUTF32"]=stringToUTF32;function lengthBytesUTF32(str){var len=0;for(var i=0;i<str.length;++i){var codeUnit=str.charCodeAt(i);if(codeUnit>=55296&&codeUnit<=57343)++i;len+=4}return len}Module["lengthBytesUTF32"]=lengthBytesUTF32;function demangle(func){var hasLibcxxabi=!!Module["___cxa_demangle"];if(hasLibcxxabi){try{var buf=_malloc(func.length);writeStringToMemory(func.substr(1),buf);var status=_malloc(4);var ret=Module["___cxa_demangle"](buf,0,0,status);if(getValue(status,"i32")===0&&ret){return Pointer_stringify(ret)}}catch(e){}finally{if(buf)_free(buf);if(status)_free(status);if(ret)_free(ret)}}var i=3;var basicTypes={"v":"void","b":"bool","c":"char","s":"short","i":"int","l":"long","f":"float","d":"double","w":"wchar_t","a":"signed char","h":"unsigned char","t":"unsigned short","j":"unsigned int","m":"unsigned long","x":"long long","y":"unsigned long long","z":"..."};var subs=[];var first=true;function dump(x){if(x)Module.print(x);Module.print(func);var pre="";for(var a=0;a<i;a++)pre+=" ";Module.print(pre+"^")}function parseNested(){i++;if(func[i]==="K")i++;var parts=[];while(func[i]!=="E"){if(func[i]==="S"){i++;var next=func.indexOf("_",i);var num=func.substring(i,next)||0;parts.push(subs[num]||"?");i=next+1;continue}if(func[i]==="C"){parts.push(parts[parts.length-1]);i+=2;continue}var size=parseInt(func.substr(i));var pre=size.toString().length;if(!size||!pre){i--;break}var curr=func.substr(i+pre,size);parts.push(curr);subs.push(curr);i+=pre+size}i++;return parts}function parse(rawList,limit,allowVoid){limit=limit||Infinity;var ret="",list=[];function flushList(){return"("+list.join(", ")+")"}var name;if(func[i]==="N"){name=parseNested().join("::");limit--;if(limit===0)return rawList?[name]:name}else{if(func[i]==="K"||first&&func[i]==="L")i++;var size=parseInt(func.substr(i));if(size){var pre=size.toString().length;name=func.substr(i+pre,size);i+=pre+size}}first=false;if(func[i]==="I"){i++;var iList=parse(true);var iRet=parse(true,1,true);ret+=iRet[0]+" "+name+"<"+iList.join(", ")+">"}else{ret=name}paramLoop:while(i<func.length&&limit-->0){var c=func[i++];if(c in basicTypes){list.push(basicTypes[c])}else{switch(c){case"P":list.push(parse(true,1,true)[0]+"*");break;case"R":list.push(parse(true,1,true)[0]+"&");break;case"L":{i++;var end=func.indexOf("E",i);var size=end-i;list.push(func.substr(i,size));i+=size+2;break};case"A":{var size=parseInt(func.substr(i));i+=size.toString().length;if(func[i]!=="_")throw"?";i++;list.push(parse(true,1,true)[0]+" ["+size+"]");break};case"E":break paramLoop;default:ret+="?"+c;break paramLoop}}}if(!allowVoid&&list.length===1&&list[0]==="void")list=[];if(rawList){if(ret){list.push(ret+"?")}return list}else{return ret+flushList()}}var parsed=func;try{if(func=="Object._main"||func=="_main"){return"main()"}if(typeof func==="number")func=Pointer_stringify(func);if(func[0]!=="_")return func;if(func[1]!=="_")return func;if(func[2]!=="Z")return func;switch(func[3]){case"n":return"operator new()";case"d":return"operator delete()"}parsed=parse()}catch(e){parsed+="?"}if(parsed.indexOf("?")>=0&&!hasLibcxxabi){Runtime.warnOnce("warning: a problem occurred in builtin C++ name demangling; build with  -s DEMANGLE_SUPPORT=1  to link in libcxxabi demangling")}return parsed}function demangleAll(text){return text.replace(/__Z[\w\d_]+/g,(function(x){var y=demangle(x);return x===y?x:x+" ["+y+"]"}))}function jsStackTrace(){var err=new Error;if(!err.stack){try{throw new Error(0)}catch(e){err=e}if(!err.stack){return"(no stack trace available)"}}return err.stack.toString()}function stackTrace(){return demangleAll(jsStackTrace())}Module["stackTrace"]=stackTrace;var PAGE_SIZE=4096;function alignMemoryPage(x){if(x%4096>0){x+=4096-x%4096}return x}var HEAP;var HEAP8,HEAPU8,HEAP16,HEAPU16,HEAP32,HEAPU32,HEAPF32,HEAPF64;var STATIC_BASE=0,STATICTOP=0,staticSealed=false;var STACK_BASE=0,STACKTOP=0,STACK_MAX=0;var DYNAMIC_BASE=0,DYNAMICTOP=0;function enlargeMemory(){abort("Cannot enlarge memory arrays. Either (1) compile with -s TOTAL_MEMORY=X with X higher than the current value "+TOTAL_MEMORY+", (2) compile with ALLOW_MEMORY_GROWTH which adjusts the size at runtime but prevents some optimizations, or (3) set Module.TOTAL_MEMORY before the program runs.")}var TOTAL_STACK=Module["TOTAL_STACK"]||5242880;var TOTAL_MEMORY=Module["TOTAL_MEMORY"]||67108864;var totalMemory=64*1024;while(totalMemory<TOTAL_MEMORY||totalMemory<2*TOTAL_STACK){if(totalMemory<16*1024*1024){totalMemory*=2}else{totalMemory+=16*1024*1024}}if(totalMemory!==TOTAL_MEMORY){Module.printErr("increasing TOTAL_MEMORY to "+totalMemory+" to be compliant with the asm.js spec (and given that TOTAL_STACK="+TOTAL_STACK+")");TOTAL_MEMORY=totalMemory}assert(typeof Int32Array!=="undefined"&&typeof Float64Array!=="undefined"&&!!(new Int32Array(1))["subarray"]&&!!(new Int32Array(1))["set"],"JS engine does not provide full typed array support");var buffer;buffer=new ArrayBuffer(TOTAL_MEMORY);HEAP8=new Int8Array(buffer);HEAP16=new Int16Array(buffer);HEAP32=new Int32Array(buffer);HEAPU8=new Uint8Array(buffer);HEAPU16=new Uint16Array(buffer);HEAPU32=new Uint32Array(buffer);HEAPF32=new Float32Array(buffer);HEAPF64=new Float64Array(buffer);HEAP32[0]=255;assert(HEAPU8[0]===255&&HEAPU8[3]===0,"Typed arrays 2 must be run on a little-endian system");Module["HEAP"]=HEAP;Module["buffer"]=buffer;Module["HEAP8"]=HEAP8;Module["HEAP16"]=HEAP16;Module["HEAP32"]=HEAP32;Module["HEAPU8"]=HEAPU8;Module["HEAPU16"]=HEAPU16;Module["HEAPU32"]=HEAPU32;Module["HEAPF32"]=HEAPF32;Module["HEAPF64"]=HEAPF64;function callRuntimeCallbacks(callbacks){while(callbacks.length>0){var callback=callbacks.shift();if(typeof callback=="function"){callback();continue}var func=callback.func;if(typeof func==="number"){if(callback.arg===undefined){Runtime.dynCall("v",func)}else{Runtime.dynCall("vi",func,[callback.arg])}}else{func(callback.arg===undefined?null:callback.arg)}}}var __ATPRERUN__=[];var __ATINIT__=[];var __ATMAIN__=[];var __ATEXIT__=[];var __ATPOSTRUN__=[];var runtimeInitialized=false;var runtimeExited=false;function preRun(){if(Module["preRun"]){if(typeof Module["preRun"]=="function")Module["preRun"]=[Module["preRun"]];while(Module["preRun"].length){addOnPreRun(Module["preRun"].shift())}}callRuntimeCallbacks(__ATPRERUN__)}function ensureInitRuntime(){if(runtimeInitialized)return;runtimeInitialized=true;callRuntimeCallbacks(__ATINIT__)}function preMain(){callRuntimeCallbacks(__ATMAIN__)}function exitRuntime(){callRuntimeCallbacks(__ATEXIT__);runtimeExited=true}function postRun(){if(Module["postRun"]){if(typeof Module["postRun"]=="function")Module["postRun"]=[Module["postRun"]];while(Module["postRun"].length){addOnPostRun(Module["postRun"].shift())}}callRuntimeCallbacks(__ATPOSTRUN__)}function addOnPreRun(cb){__ATPRERUN__.unshift(cb)}Module["addOnPreRun"]=Module.addOnPreRun=addOnPreRun;function addOnInit(cb){__ATINIT__.unshift(cb)}Module["addOnInit"]=Module.addOnInit=addOnInit;function addOnPreMain(cb){__ATMAIN__.unshift(cb)}Module["addOnPreMain"]=Module.addOnPreMain=addOnPreMain;function addOnExit(cb){__ATEXIT__.unshift(cb)}Module["addOnExit"]=Module.addOnExit=addOnExit;function addOnPostRun(cb){__ATPOSTRUN__.unshift(cb)}Module["addOnPostRun"]=Module.addOnPostRun=addOnPostRun;function intArrayFromString(stringy,dontAddNull,length){var len=length>0?length:lengthBytesUTF8(stringy)+1;var u8array=new Array(len);var numBytesWritten=stringToUTF8Array(stringy,u8array,0,u8array.length);if(dontAddNull)u8array.length=numBytesWritten;return u8array}Module["intArrayFromString"]=intArrayFromString;function intArrayToString(array){var ret=[];for(var i=0;i<array.length;i++){var chr=array[i];if(chr>255){chr&=255}ret.push(String.fromCharCode(chr))}return ret.join("")}Module["intArrayToString"]=intArrayToString;function writeStringToMemory(string,buffer,dontAddNull){var array=intArrayFromString(string,dontAddNull);var i=0;while(i<array.length){var chr=array[i];HEAP8[buffer+i>>0]=chr;i=i+1}}Module["writeStringToMemory"]=writeStringToMemory;function writeArrayToMemory(array,buffer){for(var i=0;i<array.length;i++){HEAP8[buffer++>>0]=array[i]}}Module["writeArrayToMemory"]=writeArrayToMemory;function writeAsciiToMemory(str,buffer,dontAddNull){for(var i=0;i<str.length;++i){HEAP8[buffer++>>0]=str.charCodeAt(i)}if(!dontAddNull)HEAP8[buffer>>0]=0}Module["writeAsciiToMemory"]=writeAsciiToMemory;function unSign(value,bits,ignore){if(value>=0){return value}return bits<=32?2*Math.abs(1<<bits-1)+value:Math.pow(2,bits)+value}function reSign(value,bits,ignore){if(value<=0){return value}var half=bits<=32?Math.abs(1<<bits-1):Math.pow(2,bits-1);if(value>=half&&(bits<=32||value>half)){value=-2*half+value}return value}if(!Math["imul"]||Math["imul"](4294967295,5)!==-5)Math["imul"]=function imul(a,b){var ah=a>>>16;var al=a&65535;var bh=b>>>16;var bl=b&65535;return al*bl+(ah*bl+al*bh<<16)|0};Math.imul=Math["imul"];if(!Math["clz32"])Math["clz32"]=(function(x){x=x>>>0;for(var i=0;i<32;i++){if(x&1<<31-i)return i}return 32});Math.clz32=Math["clz32"];var Math_abs=Math.abs;var Math_cos=Math.cos;var Math_sin=Math.sin;var Math_tan=Math.tan;var Math_acos=Math.acos;var Math_asin=Math.asin;var Math_atan=Math.atan;var Math_atan2=Math.atan2;var Math_exp=Math.exp;var Math_log=Math.log;var Math_sqrt=Math.sqrt;var Math_ceil=Math.ceil;var Math_floor=Math.floor;var Math_pow=Math.pow;var Math_imul=Math.imul;var Math_fround=Math.fround;var Math_min=Math.min;var Math_clz32=Math.clz32;var runDependencies=0;var runDependencyWatcher=null;var dependenciesFulfilled=null;function getUniqueRunDependency(id){return id}function addRunDependency(id){runDependencies++;if(Module["monitorRunDependencies"]){Module["monitorRunDependencies"](runDependencies)}}Module["addRunDependency"]=addRunDependency;function removeRunDependency(id){runDependencies--;if(Module["monitorRunDependencies"]){Module["monitorRunDependencies"](runDependencies)}if(runDependencies==0){if(runDependencyWatcher!==null){clearInterval(runDependencyWatcher);runDependencyWatcher=null}if(dependenciesFulfilled){var callback=dependenciesFulfilled;dependenciesFulfilled=null;callback()}}}Module["removeRunDependency"]=removeRunDependency;Module["preloadedImages"]={};Module["preloadedAudios"]={};var memoryInitializer=null;var ASM_CONSTS=[(function(){completeConversion(status)}),(function(){{return signalStop}}),(function(){{if(seekSamples<ULONG_MAX){var tmp=seekSamples;seekSamples=ULONG_MAX;circularBuffer.reset();return tmp}return ULONG_MAX}}),(function(){{return circularBuffer.full()}}),(function($0,$1,$2){{updateProgress($0,$1,$2)}}),(function($0,$1){{processAudio($0,$1)}})];function _emscripten_asm_const_0(code){return ASM_CONSTS[code]()|0}function _emscripten_asm_const_2(code,a0,a1){return ASM_CONSTS[code](a0,a1)|0}function _emscripten_asm_const_3(code,a0,a1,a2){return ASM_CONSTS[code](a0,a1,a2)|0}STATIC_BASE=8;STATICTOP=STATIC_BASE+40928;__ATINIT__.push();memoryInitializer="wildwebmidi.js.mem";var tempDoublePtr=Runtime.alignMemory(allocate(12,"i8",ALLOC_STATIC),8);assert(tempDoublePtr%8==0);function copyTempFloat(ptr){HEAP8[tempDoublePtr]=HEAP8[ptr];HEAP8[tempDoublePtr+1]=HEAP8[ptr+1];HEAP8[tempDoublePtr+2]=HEAP8[ptr+2];HEAP8[tempDoublePtr+3]=HEAP8[ptr+3]}function copyTempDouble(ptr){HEAP8[tempDoublePtr]=HEAP8[ptr];HEAP8[tempDoublePtr+1]=HEAP8[ptr+1];HEAP8[tempDoublePtr+2]=HEAP8[ptr+2];HEAP8[tempDoublePtr+3]=HEAP8[ptr+3];HEAP8[tempDoublePtr+4]=HEAP8[ptr+4];HEAP8[tempDoublePtr+5]=HEAP8[ptr+5];HEAP8[tempDoublePtr+6]=HEAP8[ptr+6];HEAP8[tempDoublePtr+7]=HEAP8[ptr+7]}var EMTSTACKTOP=getMemory(1048576);var EMT_STACK_MAX=EMTSTACKTOP+1048576;var eb=getMemory(1896);__ATPRERUN__.push((function(){HEAPU8.set([140,3,35,0,0,0,0,0,2,27,0,0,250,37,0,0,2,28,0,0,20,38,0,0,2,29,0,0,18,38,0,0,1,3,0,0,1,3,0,0,136,30,0,0,0,4,30,0,136,30,0,0,1,31,176,0,3,30,30,31,137,30,0,0,25,5,4,112,25,6,4,8,25,7,4,80,25,8,4,96,25,9,4,72,25,10,4,88,25,11,4,104,25,12,4,56,25,13,4,48,25,14,4,16,25,15,4,32,25,16,4,64,0,17,4,0,25,18,4,40,25,19,4,120,25,20,4,116,2,30,0,0,144,151,0,0,2,31,0,0,120,151,0,0,85,30,31,0,2,30,0,0,152,151,0,0,135,31,0,0,30,0,0,0,78,31,1,0,33,21,31,0,121,21,91,0,0,22,19,0,2,23,0,0,184,151,0,0,25,24,22,44,78,31,23,0,83,22,31,0,25,22,22,1,25,23,23,1,54,31,22,24,192,0,0,0,1,31,180,1,85,18,31,0,1,31,66,2,135,23,1,0,1,31,18,0,2,31,0,0,232,151,0,0,85,31,23,0,34,31,23,0,121,31,13,0,130,31,0,0,82,22,31,0,135,30,2,0,82,30,30,0,135,31,3,0,30,0,0,0,85,17,31,0,2,30,0,0,240,151,0,0,135,31,4,0,22,30,17,0,119,0,48,0,1,30,68,0,107,19,24,30,1,31,172,255,107,19,25,31,1,30,16,0,107,19,28,30,1,31,177,255,107,19,29,31,1,30,2,0,107,19,30,30,1,31,0,0,107,19,31,31,1,30,44,0,135,31,5,0,23,19,30,0,34,31,31,0,121,31,22,0,130,31,0,0,82,22,31,0,135,30,2,0,82,30,30,0,135,31,3,0,30,0,0,0,85,16,31,0,2,30,0,0,32,152,0,0,135,31,4,0,22,30,16,0,2,30,0,0,232,151,0,0,82,30,30,0,135,31,6,0,30,0,0,0,2,31,0,0,232,151,0,0,1,30,255,255,85,31,30,0,119,0,10,0,2,30,0,0,72,152,0,0,1,31,0,0,85,30,31,0,2,31,0,0,80,152,0,0,1,30,17,0,85,31,30,0,119,0,16,0,2,31,0,0,88,152,0,0,135,30,7,0,31,15,0,0,1,31,0,0,135,30,8,0,31,0,0,0,1,25,1,0,137,4,0,0,139,25,0,0,119,0,5,0,2,30,0,0,80,152,0,0,1,31,18,0,85,30,31,0,135,15,9,0,43,31,15,16,1,30,255,0,19,31,31,30,85,14,31,0,43,30,15,8,1,32,255,0,19,30,30,32,109,14,4,30,1,31,255,0,19,31,15,31,109,14,8,31,2,30,0,0,144,152,0,0,135,31,7,0,30,14,0,0,2,30,0,0,144,151,0,0,82,30,30,0,1,32,68,172,1,33,0,0,135,31,10,0,30,32,33,0,32,31,31,255,121,31,11,0,2,33,0,0,184,152,0,0,135,31,7,0,33,13,0,0,1,33,0,0,135,31,8,0,33,0,0,0,1,25,1,0,137,4,0,0,139,25,0,0,1,31,0,64,135,13,11,0,31,0,0,0,120,13,16,0,2,33,0,0,208,152,0,0,1,32,27,0,1,30,1,0,130,34,0,0,82,34,34,0,135,31,12,0,33,32,30,34,135,31,13,0,1,34,0,0,135,31,8,0,34,0,0,0,1,25,1,0,137,4,0,0,139,25,0,0,1,34,127,0,135,31,14,0,34,0,0,0,135,31,15,0,85,12,0,0,2,34,0,0,240,152,0,0,135,31,7,0,34,12,0,0,135,12,16,0,0,0,0,0,2,31,0,0,16,155,0,0,2,34,0,0,16,155,0,0,82,34,34,0,25,34,34,1,85,31,34,0,120,12,7,0,135,34,17,0,85,11,34,0,2,31,0,0,0,153,0,0,135,34,7,0,31,11,0,0,135,11,18,0,12,0,0,0,25,0,11,8,82,14,0,0,1,31,6,0,1,30,6,0,135,34,19,0,12,31,30,0,2,34,0,0,240,95,40,0,7,34,14,34,85,10,34,0,2,30,0,0,240,95,40,0,9,30,14,30,2,31,0,0,68,172,0,0,7,30,30,31,109,10,4,30,2,34,0,0,32,153,0,0,135,30,7,0,34,10,0,0,130,30,0,0,82,14,30,0,1,34,13,0,135,30,20,0,34,14,0,0,82,15,0,0,25,16,11,4,82,11,16,0,45,30,15,11,240,3,0,0,1,3,29,0,119,0,84,0,1,30,255,255,15,19,30,2,4,17,15,11,0,18,0,0,0,1,16,0,121,21,3,0,0,26,17,0,119,0,30,0,0,23,17,0,1,34,1,0,135,30,21,0,34,0,0,0,120,30,71,0,1,30,2,0,135,22,21,0,30,0,0,0,85,20,22,0,33,30,22,255,121,30,3,0,135,30,22,0,12,20,0,0,1,34,3,0,135,30,21,0,34,0,0,0,120,30,3,0,0,26,23,0,119,0,11,0,135,30,23,0,2,0,0,0,82,22,18,0,82,24,1,0,45,30,22,24,124,4,0,0,1,3,29,0,119,0,49,0,4,23,22,24,119,0,229,255,1,34,255,15,48,34,34,26,156,4,0,0,1,34,0,64,0,30,34,0,119,0,3,0,41,34,26,2,0,30,34,0,135,23,24,0,12,13,30,0,34,30,23,1,121,30,3,0,1,3,29,0,119,0,33,0,135,24,18,0,12,0,0,0,25,1,24,4,25,18,24,8,1,34,4,0,82,31,1,0,82,32,18,0,106,33,24,16,135,30,25,0,34,31,32,33,2,33,0,0,80,152,0,0,82,33,33,0,38,33,33,31,135,30,26,0,33,13,23,0,34,30,30,0,120,30,12,0,121,19,3,0,135,30,23,0,2,0,0,0,82,23,18,0,82,24,1,0,45,30,23,24,40,5,0,0,1,3,29,0,119,0,6,0,4,17,23,24,119,0,182,255,1,33,13,0,135,30,27,0,33,0,0,0,32,30,3,29,121,30,15,0,135,30,28,0,12,0,0,0,32,30,30,255,121,30,7,0,135,30,17,0,85,9,30,0,2,33,0,0,64,154,0,0,135,30,4,0,14,33,9,0,1,33,0,0,1,32,0,64,135,30,29,0,13,33,32,0,1,30,0,0,2,32,0,0,232,151,0,0,82,32,32,0,49,30,30,32,16,7,0,0,2,32,0,0,104,154,0,0,135,30,7,0,32,8,0,0,2,30,0,0,72,152,0,0,82,8,30,0,83,10,8,0,25,9,10,1,43,30,8,8,83,9,30,0,25,12,10,2,43,30,8,16,83,12,30,0,25,3,10,3,43,30,8,24,83,3,30,0,2,32,0,0,232,151,0,0,82,32,32,0,1,33,40,0,1,31,0,0,135,30,30,0,32,33,31,0,2,31,0,0,232,151,0,0,82,31,31,0,1,33,4,0,135,30,5,0,31,10,33,0,34,30,30,0,121,30,11,0,135,33,2,0,82,33,33,0,135,30,3,0,33,0,0,0,85,7,30,0,2,33,0,0,144,154,0,0,135,30,4,0,14,33,7,0,119,0,39,0,2,30,0,0,72,152,0,0,82,30,30,0,25,7,30,36,2,30,0,0,72,152,0,0,85,30,7,0,83,10,7,0,43,30,7,8,83,9,30,0,43,30,7,16,83,12,30,0,43,30,7,24,83,3,30,0,2,33,0,0,232,151,0,0,82,33,33,0,1,31,4,0,1,32,0,0,135,30,30,0,33,31,32,0,2,32,0,0,232,151,0,0,82,32,32,0,1,31,4,0,135,30,5,0,32,10,31,0,34,30,30,0,121,30,10,0,135,31,2,0,82,31,31,0,135,30,3,0,31,0,0,0,85,6,30,0,2,31,0,0,144,154,0,0,135,30,4,0,14,31,6,0,1,31,10,0,135,30,27,0,31,0,0,0,2,30,0,0,232,151,0,0,82,6,30,0,1,30,255,255,47,30,30,6,0,7,0,0,135,30,6,0,6,0,0,0,2,30,0,0,232,151,0,0,1,31,255,255,85,30,31,0,135,31,31,0,13,0,0,0,135,31,13,0,32,31,31,255,121,31,8,0,135,31,17,0,85,5,31,0,2,30,0,0,184,154,0,0,135,31,4,0,14,30,5,0,135,31,15,0,2,30,0,0,232,154,0,0,135,31,0,0,30,0,0,0,1,30,0,0,135,31,8,0,30,0,0,0,1,25,0,0,137,4,0,0,139,25,0,0],eb+0);var relocations=[];relocations=relocations.concat([212,996,1136,1164,1308,1424,1780]);for(var i=0;i<relocations.length;i++){HEAPU32[eb+relocations[i]>>2]+=eb}}));var ERRNO_CODES={EPERM:1,ENOENT:2,ESRCH:3,EINTR:4,EIO:5,ENXIO:6,E2BIG:7,ENOEXEC:8,EBADF:9,ECHILD:10,EAGAIN:11,EWOULDBLOCK:11,ENOMEM:12,EACCES:13,EFAULT:14,ENOTBLK:15,EBUSY:16,EEXIST:17,EXDEV:18,ENODEV:19,ENOTDIR:20,EISDIR:21,EINVAL:22,ENFILE:23,EMFILE:24,ENOTTY:25,ETXTBSY:26,EFBIG:27,ENOSPC:28,ESPIPE:29,EROFS:30,EMLINK:31,EPIPE:32,EDOM:33,ERANGE:34,ENOMSG:42,EIDRM:43,ECHRNG:44,EL2NSYNC:45,EL3HLT:46,EL3RST:47,ELNRNG:48,EUNATCH:49,ENOCSI:50,EL2HLT:51,EDEADLK:35,ENOLCK:37,EBADE:52,EBADR:53,EXFULL:54,ENOANO:55,EBADRQC:56,EBADSLT:57,EDEADLOCK:35,EBFONT:59,ENOSTR:60,ENODATA:61,ETIME:62,ENOSR:63,ENONET:64,ENOPKG:65,EREMOTE:66,ENOLINK:67,EADV:68,ESRMNT:69,ECOMM:70,EPROTO:71,EMULTIHOP:72,EDOTDOT:73,EBADMSG:74,ENOTUNIQ:76,EBADFD:77,EREMCHG:78,ELIBACC:79,ELIBBAD:80,ELIBSCN:81,ELIBMAX:82,ELIBEXEC:83,ENOSYS:38,ENOTEMPTY:39,ENAMETOOLONG:36,ELOOP:40,EOPNOTSUPP:95,EPFNOSUPPORT:96,ECONNRESET:104,ENOBUFS:105,EAFNOSUPPORT:97,EPROTOTYPE:91,ENOTSOCK:88,ENOPROTOOPT:92,ESHUTDOWN:108,ECONNREFUSED:111,EADDRINUSE:98,ECONNABORTED:103,ENETUNREACH:101,ENETDOWN:100,ETIMEDOUT:110,EHOSTDOWN:112,EHOSTUNREACH:113,EINPROGRESS:115,EALREADY:114,EDESTADDRREQ:89,EMSGSIZE:90,EPROTONOSUPPORT:93,ESOCKTNOSUPPORT:94,EADDRNOTAVAIL:99,ENETRESET:102,EISCONN:106,ENOTCONN:107,ETOOMANYREFS:109,EUSERS:87,EDQUOT:122,ESTALE:116,ENOTSUP:95,ENOMEDIUM:123,EILSEQ:84,EOVERFLOW:75,ECANCELED:125,ENOTRECOVERABLE:131,EOWNERDEAD:130,ESTRPIPE:86};var ERRNO_MESSAGES={0:"Success",1:"Not super-user",2:"No such file or directory",3:"No such process",4:"Interrupted system call",5:"I/O error",6:"No such device or address",7:"Arg list too long",8:"Exec format error",9:"Bad file number",10:"No children",11:"No more processes",12:"Not enough core",13:"Permission denied",14:"Bad address",15:"Block device required",16:"Mount device busy",17:"File exists",18:"Cross-device link",19:"No such device",20:"Not a directory",21:"Is a directory",22:"Invalid argument",23:"Too many open files in system",24:"Too many open files",25:"Not a typewriter",26:"Text file busy",27:"File too large",28:"No space left on device",29:"Illegal seek",30:"Read only file system",31:"Too many links",32:"Broken pipe",33:"Math arg out of domain of func",34:"Math result not representable",35:"File locking deadlock error",36:"File or path name too long",37:"No record locks available",38:"Function not implemented",39:"Directory not empty",40:"Too many symbolic links",42:"No message of desired type",43:"Identifier removed",44:"Channel number out of range",45:"Level 2 not synchronized",46:"Level 3 halted",47:"Level 3 reset",48:"Link number out of range",49:"Protocol driver not attached",50:"No CSI structure available",51:"Level 2 halted",52:"Invalid exchange",53:"Invalid request descriptor",54:"Exchange full",55:"No anode",56:"Invalid request code",57:"Invalid slot",59:"Bad font file fmt",60:"Device not a stream",61:"No data (for no delay io)",62:"Timer expired",63:"Out of streams resources",64:"Machine is not on the network",65:"Package not installed",66:"The object is remote",67:"The link has been severed",68:"Advertise error",69:"Srmount error",70:"Communication error on send",71:"Protocol error",72:"Multihop attempted",73:"Cross mount point (not really error)",74:"Trying to read unreadable message",75:"Value too large for defined data type",76:"Given log. name not unique",77:"f.d. invalid for this operation",78:"Remote address changed",79:"Can   access a needed shared lib",80:"Accessing a corrupted shared lib",81:".lib section in a.out corrupted",82:"Attempting to link in too many libs",83:"Attempting to exec a shared library",84:"Illegal byte sequence",86:"Streams pipe error",87:"Too many users",88:"Socket operation on non-socket",89:"Destination address required",90:"Message too long",91:"Protocol wrong type for socket",92:"Protocol not available",93:"Unknown protocol",94:"Socket type not supported",95:"Not supported",96:"Protocol family not supported",97:"Address family not supported by protocol family",98:"Address already in use",99:"Address not available",100:"Network interface is not configured",101:"Network is unreachable",102:"Connection reset by network",103:"Connection aborted",104:"Connection reset by peer",105:"No buffer space available",106:"Socket is already connected",107:"Socket is not connected",108:"Can't send after socket shutdown",109:"Too many references",110:"Connection timed out",111:"Connection refused",112:"Host is down",113:"Host is unreachable",114:"Socket already connected",115:"Connection already in progress",116:"Stale file handle",122:"Quota exceeded",123:"No medium (in tape drive)",125:"Operation canceled",130:"Previous owner died",131:"State not recoverable"};var ___errno_state=0;function ___setErrNo(value){HEAP32[___errno_state>>2]=value;return value}var PATH={splitPath:(function(filename){var splitPathRe=/^(\/?|)([\s\S]*?)((?:\.{1,2}|[^\/]+?|)(\.[^.\/]*|))(?:[\/]*)$/;return splitPathRe.exec(filename).slice(1)}),normalizeArray:(function(parts,allowAboveRoot){var up=0;for(var i=parts.length-1;i>=0;i--){var last=parts[i];if(last==="."){parts.splice(i,1)}else if(last===".."){parts.splice(i,1);up++}else if(up){parts.splice(i,1);up--}}if(allowAboveRoot){for(;up--;up){parts.unshift("..")}}return parts}),normalize:(function(path){var isAbsolute=path.charAt(0)==="/",trailingSlash=path.substr(-1)==="/";path=PATH.normalizeArray(path.split("/").filter((function(p){return!!p})),!isAbsolute).join("/");if(!path&&!isAbsolute){path="."}if(path&&trailingSlash){path+="/"}return(isAbsolute?"/":"")+path}),dirname:(function(path){var result=PATH.splitPath(path),root=result[0],dir=result[1];if(!root&&!dir){return"."}if(dir){dir=dir.substr(0,dir.length-1)}return root+dir}),basename:(function(path){if(path==="/")return"/";var lastSlash=path.lastIndexOf("/");if(lastSlash===-1)return path;return path.substr(lastSlash+1)}),extname:(function(path){return PATH.splitPath(path)[3]}),join:(function(){var paths=Array.prototype.slice.call(arguments,0);return PATH.normalize(paths.join("/"))}),join2:(function(l,r){return PATH.normalize(l+"/"+r)}),resolve:(function(){var resolvedPath="",resolvedAbsolute=false;for(var i=arguments.length-1;i>=-1&&!resolvedAbsolute;i--){var path=i>=0?arguments[i]:FS.cwd();if(typeof path!=="string"){throw new TypeError("Arguments to path.resolve must be strings")}else if(!path){return""}resolvedPath=path+"/"+resolvedPath;resolvedAbsolute=path.charAt(0)==="/"}resolvedPath=PATH.normalizeArray(resolvedPath.split("/").filter((function(p){return!!p})),!resolvedAbsolute).join("/");return(resolvedAbsolute?"/":"")+resolvedPath||"."}),relative:(function(from,to){from=PATH.resolve(from).substr(1);to=PATH.resolve(to).substr(1);function trim(arr){var start=0;for(;start<arr.length;start++){if(arr[start]!=="")break}var end=arr.length-1;for(;end>=0;end--){if(arr[end]!=="")break}if(start>end)return[];return arr.slice(start,end-start+1)}var fromParts=trim(from.split("/"));var toParts=trim(to.split("/"));var length=Math.min(fromParts.length,toParts.length);var samePartsLength=length;for(var i=0;i<length;i++){if(fromParts[i]!==toParts[i]){samePartsLength=i;break}}var outputParts=[];for(var i=samePartsLength;i<fromParts.length;i++){outputParts.push("..")}outputParts=outputParts.concat(toParts.slice(samePartsLength));return outputParts.join("/")})};var TTY={ttys:[],init:(function(){}),shutdown:(function(){}),register:(function(dev,ops){TTY.ttys[dev]={input:[],output:[],ops:ops};FS.registerDevice(dev,TTY.stream_ops)}),stream_ops:{open:(function(stream){var tty=TTY.ttys[stream.node.rdev];if(!tty){throw new FS.ErrnoError(ERRNO_CODES.ENODEV)}stream.tty=tty;stream.seekable=false}),close:(function(stream){stream.tty.ops.flush(stream.tty)}),flush:(function(stream){stream.tty.ops.flush(stream.tty)}),read:(function(stream,buffer,offset,length,pos){if(!stream.tty||!stream.tty.ops.get_char){throw new FS.ErrnoError(ERRNO_CODES.ENXIO)}var bytesRead=0;for(var i=0;i<length;i++){var result;try{result=stream.tty.ops.get_char(stream.tty)}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EIO)}if(result===undefined&&bytesRead===0){throw new FS.ErrnoError(ERRNO_CODES.EAGAIN)}if(result===null||result===undefined)break;bytesRead++;buffer[offset+i]=result}if(bytesRead){stream.node.timestamp=Date.now()}return bytesRead}),write:(function(stream,buffer,offset,length,pos){if(!stream.tty||!stream.tty.ops.put_char){throw new FS.ErrnoError(ERRNO_CODES.ENXIO)}for(var i=0;i<length;i++){try{stream.tty.ops.put_char(stream.tty,buffer[offset+i])}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EIO)}}if(length){stream.node.timestamp=Date.now()}return i})},default_tty_ops:{get_char:(function(tty){if(!tty.input.length){var result=null;if(ENVIRONMENT_IS_NODE){var BUFSIZE=256;var buf=new Buffer(BUFSIZE);var bytesRead=0;var fd=process.stdin.fd;var usingDevice=false;try{fd=fs.openSync("/dev/stdin","r");usingDevice=true}catch(e){}bytesRead=fs.readSync(fd,buf,0,BUFSIZE,null);if(usingDevice){fs.closeSync(fd)}if(bytesRead>0){result=buf.slice(0,bytesRead).toString("utf-8")}else{result=null}}else if(typeof window!="undefined"&&typeof window.prompt=="function"){result=window.prompt("Input: ");if(result!==null){result+="\n"}}else if(typeof readline=="function"){result=readline();if(result!==null){result+="\n"}}if(!result){return null}tty.input=intArrayFromString(result,true)}return tty.input.shift()}),put_char:(function(tty,val){if(val===null||val===10){Module["print"](UTF8ArrayToString(tty.output,0));tty.output=[]}else{if(val!=0)tty.output.push(val)}}),flush:(function(tty){if(tty.output&&tty.output.length>0){Module["print"](UTF8ArrayToString(tty.output,0));tty.output=[]}})},default_tty1_ops:{put_char:(function(tty,val){if(val===null||val===10){Module["printErr"](UTF8ArrayToString(tty.output,0));tty.output=[]}else{if(val!=0)tty.output.push(val)}}),flush:(function(tty){if(tty.output&&tty.output.length>0){Module["printErr"](UTF8ArrayToString(tty.output,0));tty.output=[]}})}};var MEMFS={ops_table:null,mount:(function(mount){return MEMFS.createNode(null,"/",16384|511,0)}),createNode:(function(parent,name,mode,dev){if(FS.isBlkdev(mode)||FS.isFIFO(mode)){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}if(!MEMFS.ops_table){MEMFS.ops_table={dir:{node:{getattr:MEMFS.node_ops.getattr,setattr:MEMFS.node_ops.setattr,lookup:MEMFS.node_ops.lookup,mknod:MEMFS.node_ops.mknod,rename:MEMFS.node_ops.rename,unlink:MEMFS.node_ops.unlink,rmdir:MEMFS.node_ops.rmdir,readdir:MEMFS.node_ops.readdir,symlink:MEMFS.node_ops.symlink},stream:{llseek:MEMFS.stream_ops.llseek}},file:{node:{getattr:MEMFS.node_ops.getattr,setattr:MEMFS.node_ops.setattr},stream:{llseek:MEMFS.stream_ops.llseek,read:MEMFS.stream_ops.read,write:MEMFS.stream_ops.write,allocate:MEMFS.stream_ops.allocate,mmap:MEMFS.stream_ops.mmap,msync:MEMFS.stream_ops.msync}},link:{node:{getattr:MEMFS.node_ops.getattr,setattr:MEMFS.node_ops.setattr,readlink:MEMFS.node_ops.readlink},stream:{}},chrdev:{node:{getattr:MEMFS.node_ops.getattr,setattr:MEMFS.node_ops.setattr},stream:FS.chrdev_stream_ops}}}var node=FS.createNode(parent,name,mode,dev);if(FS.isDir(node.mode)){node.node_ops=MEMFS.ops_table.dir.node;node.stream_ops=MEMFS.ops_table.dir.stream;node.contents={}}else if(FS.isFile(node.mode)){node.node_ops=MEMFS.ops_table.file.node;node.stream_ops=MEMFS.ops_table.file.stream;node.usedBytes=0;node.contents=null}else if(FS.isLink(node.mode)){node.node_ops=MEMFS.ops_table.link.node;node.stream_ops=MEMFS.ops_table.link.stream}else if(FS.isChrdev(node.mode)){node.node_ops=MEMFS.ops_table.chrdev.node;node.stream_ops=MEMFS.ops_table.chrdev.stream}node.timestamp=Date.now();if(parent){parent.contents[name]=node}return node}),getFileDataAsRegularArray:(function(node){if(node.contents&&node.contents.subarray){var arr=[];for(var i=0;i<node.usedBytes;++i)arr.push(node.contents[i]);return arr}return node.contents}),getFileDataAsTypedArray:(function(node){if(!node.contents)return new Uint8Array;if(node.contents.subarray)return node.contents.subarray(0,node.usedBytes);return new Uint8Array(node.contents)}),expandFileStorage:(function(node,newCapacity){if(node.contents&&node.contents.subarray&&newCapacity>node.contents.length){node.contents=MEMFS.getFileDataAsRegularArray(node);node.usedBytes=node.contents.length}if(!node.contents||node.contents.subarray){var prevCapacity=node.contents?node.contents.buffer.byteLength:0;if(prevCapacity>=newCapacity)return;var CAPACITY_DOUBLING_MAX=1024*1024;newCapacity=Math.max(newCapacity,prevCapacity*(prevCapacity<CAPACITY_DOUBLING_MAX?2:1.125)|0);if(prevCapacity!=0)newCapacity=Math.max(newCapacity,256);var oldContents=node.contents;node.contents=new Uint8Array(newCapacity);if(node.usedBytes>0)node.contents.set(oldContents.subarray(0,node.usedBytes),0);return}if(!node.contents&&newCapacity>0)node.contents=[];while(node.contents.length<newCapacity)node.contents.push(0)}),resizeFileStorage:(function(node,newSize){if(node.usedBytes==newSize)return;if(newSize==0){node.contents=null;node.usedBytes=0;return}if(!node.contents||node.contents.subarray){var oldContents=node.contents;node.contents=new Uint8Array(new ArrayBuffer(newSize));if(oldContents){node.contents.set(oldContents.subarray(0,Math.min(newSize,node.usedBytes)))}node.usedBytes=newSize;return}if(!node.contents)node.contents=[];if(node.contents.length>newSize)node.contents.length=newSize;else while(node.contents.length<newSize)node.contents.push(0);node.usedBytes=newSize}),node_ops:{getattr:(function(node){var attr={};attr.dev=FS.isChrdev(node.mode)?node.id:1;attr.ino=node.id;attr.mode=node.mode;attr.nlink=1;attr.uid=0;attr.gid=0;attr.rdev=node.rdev;if(FS.isDir(node.mode)){attr.size=4096}else if(FS.isFile(node.mode)){attr.size=node.usedBytes}else if(FS.isLink(node.mode)){attr.size=node.link.length}else{attr.size=0}attr.atime=new Date(node.timestamp);attr.mtime=new Date(node.timestamp);attr.ctime=new Date(node.timestamp);attr.blksize=4096;attr.blocks=Math.ceil(attr.size/attr.blksize);return attr}),setattr:(function(node,attr){if(attr.mode!==undefined){node.mode=attr.mode}if(attr.timestamp!==undefined){node.timestamp=attr.timestamp}if(attr.size!==undefined){MEMFS.resizeFileStorage(node,attr.size)}}),lookup:(function(parent,name){throw FS.genericErrors[ERRNO_CODES.ENOENT]}),mknod:(function(parent,name,mode,dev){return MEMFS.createNode(parent,name,mode,dev)}),rename:(function(old_node,new_dir,new_name){if(FS.isDir(old_node.mode)){var new_node;try{new_node=FS.lookupNode(new_dir,new_name)}catch(e){}if(new_node){for(var i in new_node.contents){throw new FS.ErrnoError(ERRNO_CODES.ENOTEMPTY)}}}delete old_node.parent.contents[old_node.name];old_node.name=new_name;new_dir.contents[new_name]=old_node;old_node.parent=new_dir}),unlink:(function(parent,name){delete parent.contents[name]}),rmdir:(function(parent,name){var node=FS.lookupNode(parent,name);for(var i in node.contents){throw new FS.ErrnoError(ERRNO_CODES.ENOTEMPTY)}delete parent.contents[name]}),readdir:(function(node){var entries=[".",".."];for(var key in node.contents){if(!node.contents.hasOwnProperty(key)){continue}entries.push(key)}return entries}),symlink:(function(parent,newname,oldpath){var node=MEMFS.createNode(parent,newname,511|40960,0);node.link=oldpath;return node}),readlink:(function(node){if(!FS.isLink(node.mode)){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}return node.link})},stream_ops:{read:(function(stream,buffer,offset,length,position){var contents=stream.node.contents;if(position>=stream.node.usedBytes)return 0;var size=Math.min(stream.node.usedBytes-position,length);assert(size>=0);if(size>8&&contents.subarray){buffer.set(contents.subarray(position,position+size),offset)}else{for(var i=0;i<size;i++)buffer[offset+i]=contents[position+i]}return size}),write:(function(stream,buffer,offset,length,position,canOwn){if(!length)return 0;var node=stream.node;node.timestamp=Date.now();if(buffer.subarray&&(!node.contents||node.contents.subarray)){if(canOwn){node.contents=buffer.subarray(offset,offset+length);node.usedBytes=length;return length}else if(node.usedBytes===0&&position===0){node.contents=new Uint8Array(buffer.subarray(offset,offset+length));node.usedBytes=length;return length}else if(position+length<=node.usedBytes){node.contents.set(buffer.subarray(offset,offset+length),position);return length}}MEMFS.expandFileStorage(node,position+length);if(node.contents.subarray&&buffer.subarray)node.contents.set(buffer.subarray(offset,offset+length),position);else{for(var i=0;i<length;i++){node.contents[position+i]=buffer[offset+i]}}node.usedBytes=Math.max(node.usedBytes,position+length);return length}),llseek:(function(stream,offset,whence){var position=offset;if(whence===1){position+=stream.position}else if(whence===2){if(FS.isFile(stream.node.mode)){position+=stream.node.usedBytes}}if(position<0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}return position}),allocate:(function(stream,offset,length){MEMFS.expandFileStorage(stream.node,offset+length);stream.node.usedBytes=Math.max(stream.node.usedBytes,offset+length)}),mmap:(function(stream,buffer,offset,length,position,prot,flags){if(!FS.isFile(stream.node.mode)){throw new FS.ErrnoError(ERRNO_CODES.ENODEV)}var ptr;var allocated;var contents=stream.node.contents;if(!(flags&2)&&(contents.buffer===buffer||contents.buffer===buffer.buffer)){allocated=false;ptr=contents.byteOffset}else{if(position>0||position+length<stream.node.usedBytes){if(contents.subarray){contents=contents.subarray(position,position+length)}else{contents=Array.prototype.slice.call(contents,position,position+length)}}allocated=true;ptr=_malloc(length);if(!ptr){throw new FS.ErrnoError(ERRNO_CODES.ENOMEM)}buffer.set(contents,ptr)}return{ptr:ptr,allocated:allocated}}),msync:(function(stream,buffer,offset,length,mmapFlags){if(!FS.isFile(stream.node.mode)){throw new FS.ErrnoError(ERRNO_CODES.ENODEV)}if(mmapFlags&2){return 0}var bytesWritten=MEMFS.stream_ops.write(stream,buffer,0,length,offset,false);return 0})}};var IDBFS={dbs:{},indexedDB:(function(){if(typeof indexedDB!=="undefined")return indexedDB;var ret=null;if(typeof window==="object")ret=window.indexedDB||window.mozIndexedDB||window.webkitIndexedDB||window.msIndexedDB;assert(ret,"IDBFS used, but indexedDB not supported");return ret}),DB_VERSION:21,DB_STORE_NAME:"FILE_DATA",mount:(function(mount){return MEMFS.mount.apply(null,arguments)}),syncfs:(function(mount,populate,callback){IDBFS.getLocalSet(mount,(function(err,local){if(err)return callback(err);IDBFS.getRemoteSet(mount,(function(err,remote){if(err)return callback(err);var src=populate?remote:local;var dst=populate?local:remote;IDBFS.reconcile(src,dst,callback)}))}))}),getDB:(function(name,callback){var db=IDBFS.dbs[name];if(db){return callback(null,db)}var req;try{req=IDBFS.indexedDB().open(name,IDBFS.DB_VERSION)}catch(e){return callback(e)}req.onupgradeneeded=(function(e){var db=e.target.result;var transaction=e.target.transaction;var fileStore;if(db.objectStoreNames.contains(IDBFS.DB_STORE_NAME)){fileStore=transaction.objectStore(IDBFS.DB_STORE_NAME)}else{fileStore=db.createObjectStore(IDBFS.DB_STORE_NAME)}if(!fileStore.indexNames.contains("timestamp")){fileStore.createIndex("timestamp","timestamp",{unique:false})}});req.onsuccess=(function(){db=req.result;IDBFS.dbs[name]=db;callback(null,db)});req.onerror=(function(e){callback(this.error);e.preventDefault()})}),getLocalSet:(function(mount,callback){var entries={};function isRealDir(p){return p!=="."&&p!==".."}function toAbsolute(root){return(function(p){return PATH.join2(root,p)})}var check=FS.readdir(mount.mountpoint).filter(isRealDir).map(toAbsolute(mount.mountpoint));while(check.length){var path=check.pop();var stat;try{stat=FS.stat(path)}catch(e){return callback(e)}if(FS.isDir(stat.mode)){check.push.apply(check,FS.readdir(path).filter(isRealDir).map(toAbsolute(path)))}entries[path]={timestamp:stat.mtime}}return callback(null,{type:"local",entries:entries})}),getRemoteSet:(function(mount,callback){var entries={};IDBFS.getDB(mount.mountpoint,(function(err,db){if(err)return callback(err);var transaction=db.transaction([IDBFS.DB_STORE_NAME],"readonly");transaction.onerror=(function(e){callback(this.error);e.preventDefault()});var store=transaction.objectStore(IDBFS.DB_STORE_NAME);var index=store.index("timestamp");index.openKeyCursor().onsuccess=(function(event){var cursor=event.target.result;if(!cursor){return callback(null,{type:"remote",db:db,entries:entries})}entries[cursor.primaryKey]={timestamp:cursor.key};cursor.continue()})}))}),loadLocalEntry:(function(path,callback){var stat,node;try{var lookup=FS.lookupPath(path);node=lookup.node;stat=FS.stat(path)}catch(e){return callback(e)}if(FS.isDir(stat.mode)){return callback(null,{timestamp:stat.mtime,mode:stat.mode})}else if(FS.isFile(stat.mode)){node.contents=MEMFS.getFileDataAsTypedArray(node);return callback(null,{timestamp:stat.mtime,mode:stat.mode,contents:node.contents})}else{return callback(new Error("node type not supported"))}}),storeLocalEntry:(function(path,entry,callback){try{if(FS.isDir(entry.mode)){FS.mkdir(path,entry.mode)}else if(FS.isFile(entry.mode)){FS.writeFile(path,entry.contents,{encoding:"binary",canOwn:true})}else{return callback(new Error("node type not supported"))}FS.chmod(path,entry.mode);FS.utime(path,entry.timestamp,entry.timestamp)}catch(e){return callback(e)}callback(null)}),removeLocalEntry:(function(path,callback){try{var lookup=FS.lookupPath(path);var stat=FS.stat(path);if(FS.isDir(stat.mode)){FS.rmdir(path)}else if(FS.isFile(stat.mode)){FS.unlink(path)}}catch(e){return callback(e)}callback(null)}),loadRemoteEntry:(function(store,path,callback){var req=store.get(path);req.onsuccess=(function(event){callback(null,event.target.result)});req.onerror=(function(e){callback(this.error);e.preventDefault()})}),storeRemoteEntry:(function(store,path,entry,callback){var req=store.put(entry,path);req.onsuccess=(function(){callback(null)});req.onerror=(function(e){callback(this.error);e.preventDefault()})}),removeRemoteEntry:(function(store,path,callback){var req=store.delete(path);req.onsuccess=(function(){callback(null)});req.onerror=(function(e){callback(this.error);e.preventDefault()})}),reconcile:(function(src,dst,callback){var total=0;var create=[];Object.keys(src.entries).forEach((function(key){var e=src.entries[key];var e2=dst.entries[key];if(!e2||e.timestamp>e2.timestamp){create.push(key);total++}}));var remove=[];Object.keys(dst.entries).forEach((function(key){var e=dst.entries[key];var e2=src.entries[key];if(!e2){remove.push(key);total++}}));if(!total){return callback(null)}var errored=false;var completed=0;var db=src.type==="remote"?src.db:dst.db;var transaction=db.transaction([IDBFS.DB_STORE_NAME],"readwrite");var store=transaction.objectStore(IDBFS.DB_STORE_NAME);function done(err){if(err){if(!done.errored){done.errored=true;return callback(err)}return}if(++completed>=total){return callback(null)}}transaction.onerror=(function(e){done(this.error);e.preventDefault()});create.sort().forEach((function(path){if(dst.type==="local"){IDBFS.loadRemoteEntry(store,path,(function(err,entry){if(err)return done(err);IDBFS.storeLocalEntry(path,entry,done)}))}else{IDBFS.loadLocalEntry(path,(function(err,entry){if(err)return done(err);IDBFS.storeRemoteEntry(store,path,entry,done)}))}}));remove.sort().reverse().forEach((function(path){if(dst.type==="local"){IDBFS.removeLocalEntry(path,done)}else{IDBFS.removeRemoteEntry(store,path,done)}}))})};var NODEFS={isWindows:false,staticInit:(function(){NODEFS.isWindows=!!process.platform.match(/^win/)}),mount:(function(mount){assert(ENVIRONMENT_IS_NODE);return NODEFS.createNode(null,"/",NODEFS.getMode(mount.opts.root),0)}),createNode:(function(parent,name,mode,dev){if(!FS.isDir(mode)&&!FS.isFile(mode)&&!FS.isLink(mode)){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var node=FS.createNode(parent,name,mode);node.node_ops=NODEFS.node_ops;node.stream_ops=NODEFS.stream_ops;return node}),getMode:(function(path){var stat;try{stat=fs.lstatSync(path);if(NODEFS.isWindows){stat.mode=stat.mode|(stat.mode&146)>>1}}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}return stat.mode}),realPath:(function(node){var parts=[];while(node.parent!==node){parts.push(node.name);node=node.parent}parts.push(node.mount.opts.root);parts.reverse();return PATH.join.apply(null,parts)}),flagsToPermissionStringMap:{0:"r",1:"r+",2:"r+",64:"r",65:"r+",66:"r+",129:"rx+",193:"rx+",514:"w+",577:"w",578:"w+",705:"wx",706:"wx+",1024:"a",1025:"a",1026:"a+",1089:"a",1090:"a+",1153:"ax",1154:"ax+",1217:"ax",1218:"ax+",4096:"rs",4098:"rs+"},flagsToPermissionString:(function(flags){if(flags in NODEFS.flagsToPermissionStringMap){return NODEFS.flagsToPermissionStringMap[flags]}else{return flags}}),node_ops:{getattr:(function(node){var path=NODEFS.realPath(node);var stat;try{stat=fs.lstatSync(path)}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}if(NODEFS.isWindows&&!stat.blksize){stat.blksize=4096}if(NODEFS.isWindows&&!stat.blocks){stat.blocks=(stat.size+stat.blksize-1)/stat.blksize|0}return{dev:stat.dev,ino:stat.ino,mode:stat.mode,nlink:stat.nlink,uid:stat.uid,gid:stat.gid,rdev:stat.rdev,size:stat.size,atime:stat.atime,mtime:stat.mtime,ctime:stat.ctime,blksize:stat.blksize,blocks:stat.blocks}}),setattr:(function(node,attr){var path=NODEFS.realPath(node);try{if(attr.mode!==undefined){fs.chmodSync(path,attr.mode);node.mode=attr.mode}if(attr.timestamp!==undefined){var date=new Date(attr.timestamp);fs.utimesSync(path,date,date)}if(attr.size!==undefined){fs.truncateSync(path,attr.size)}}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),lookup:(function(parent,name){var path=PATH.join2(NODEFS.realPath(parent),name);var mode=NODEFS.getMode(path);return NODEFS.createNode(parent,name,mode)}),mknod:(function(parent,name,mode,dev){var node=NODEFS.createNode(parent,name,mode,dev);var path=NODEFS.realPath(node);try{if(FS.isDir(node.mode)){fs.mkdirSync(path,node.mode)}else{fs.writeFileSync(path,"",{mode:node.mode})}}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}return node}),rename:(function(oldNode,newDir,newName){var oldPath=NODEFS.realPath(oldNode);var newPath=PATH.join2(NODEFS.realPath(newDir),newName);try{fs.renameSync(oldPath,newPath)}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),unlink:(function(parent,name){var path=PATH.join2(NODEFS.realPath(parent),name);try{fs.unlinkSync(path)}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),rmdir:(function(parent,name){var path=PATH.join2(NODEFS.realPath(parent),name);try{fs.rmdirSync(path)}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),readdir:(function(node){var path=NODEFS.realPath(node);try{return fs.readdirSync(path)}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),symlink:(function(parent,newName,oldPath){var newPath=PATH.join2(NODEFS.realPath(parent),newName);try{fs.symlinkSync(oldPath,newPath)}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),readlink:(function(node){var path=NODEFS.realPath(node);try{path=fs.readlinkSync(path);path=NODEJS_PATH.relative(NODEJS_PATH.resolve(node.mount.opts.root),path);return path}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}})},stream_ops:{open:(function(stream){var path=NODEFS.realPath(stream.node);try{if(FS.isFile(stream.node.mode)){stream.nfd=fs.openSync(path,NODEFS.flagsToPermissionString(stream.flags))}}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),close:(function(stream){try{if(FS.isFile(stream.node.mode)&&stream.nfd){fs.closeSync(stream.nfd)}}catch(e){if(!e.code)throw e;throw new FS.ErrnoError(ERRNO_CODES[e.code])}}),read:(function(stream,buffer,offset,length,position){if(length===0)return 0;var nbuffer=new Buffer(length);var res;try{res=fs.readSync(stream.nfd,nbuffer,0,length,position)}catch(e){throw new FS.ErrnoError(ERRNO_CODES[e.code])}if(res>0){for(var i=0;i<res;i++){buffer[offset+i]=nbuffer[i]}}return res}),write:(function(stream,buffer,offset,length,position){var nbuffer=new Buffer(buffer.subarray(offset,offset+length));var res;try{res=fs.writeSync(stream.nfd,nbuffer,0,length,position)}catch(e){throw new FS.ErrnoError(ERRNO_CODES[e.code])}return res}),llseek:(function(stream,offset,whence){var position=offset;if(whence===1){position+=stream.position}else if(whence===2){if(FS.isFile(stream.node.mode)){try{var stat=fs.fstatSync(stream.nfd);position+=stat.size}catch(e){throw new FS.ErrnoError(ERRNO_CODES[e.code])}}}if(position<0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}return position})}};var _stdin=allocate(1,"i32*",ALLOC_STATIC);var _stdout=allocate(1,"i32*",ALLOC_STATIC);var _stderr=allocate(1,"i32*",ALLOC_STATIC);function _fflush(stream){}var FS={root:null,mounts:[],devices:[null],streams:[],nextInode:1,nameTable:null,currentPath:"/",initialized:false,ignorePermissions:true,trackingDelegate:{},tracking:{openFlags:{READ:1,WRITE:2}},ErrnoError:null,genericErrors:{},handleFSError:(function(e){if(!(e instanceof FS.ErrnoError))throw e+" : "+stackTrace();return ___setErrNo(e.errno)}),lookupPath:(function(path,opts){path=PATH.resolve(FS.cwd(),path);opts=opts||{};if(!path)return{path:"",node:null};var defaults={follow_mount:true,recurse_count:0};for(var key in defaults){if(opts[key]===undefined){opts[key]=defaults[key]}}if(opts.recurse_count>8){throw new FS.ErrnoError(ERRNO_CODES.ELOOP)}var parts=PATH.normalizeArray(path.split("/").filter((function(p){return!!p})),false);var current=FS.root;var current_path="/";for(var i=0;i<parts.length;i++){var islast=i===parts.length-1;if(islast&&opts.parent){break}current=FS.lookupNode(current,parts[i]);current_path=PATH.join2(current_path,parts[i]);if(FS.isMountpoint(current)){if(!islast||islast&&opts.follow_mount){current=current.mounted.root}}if(!islast||opts.follow){var count=0;while(FS.isLink(current.mode)){var link=FS.readlink(current_path);current_path=PATH.resolve(PATH.dirname(current_path),link);var lookup=FS.lookupPath(current_path,{recurse_count:opts.recurse_count});current=lookup.node;if(count++>40){throw new FS.ErrnoError(ERRNO_CODES.ELOOP)}}}}return{path:current_path,node:current}}),getPath:(function(node){var path;while(true){if(FS.isRoot(node)){var mount=node.mount.mountpoint;if(!path)return mount;return mount[mount.length-1]!=="/"?mount+"/"+path:mount+path}path=path?node.name+"/"+path:node.name;node=node.parent}}),hashName:(function(parentid,name){var hash=0;for(var i=0;i<name.length;i++){hash=(hash<<5)-hash+name.charCodeAt(i)|0}return(parentid+hash>>>0)%FS.nameTable.length}),hashAddNode:(function(node){var hash=FS.hashName(node.parent.id,node.name);node.name_next=FS.nameTable[hash];FS.nameTable[hash]=node}),hashRemoveNode:(function(node){var hash=FS.hashName(node.parent.id,node.name);if(FS.nameTable[hash]===node){FS.nameTable[hash]=node.name_next}else{var current=FS.nameTable[hash];while(current){if(current.name_next===node){current.name_next=node.name_next;break}current=current.name_next}}}),lookupNode:(function(parent,name){var err=FS.mayLookup(parent);if(err){throw new FS.ErrnoError(err,parent)}var hash=FS.hashName(parent.id,name);for(var node=FS.nameTable[hash];node;node=node.name_next){var nodeName=node.name;if(node.parent.id===parent.id&&nodeName===name){return node}}return FS.lookup(parent,name)}),createNode:(function(parent,name,mode,rdev){if(!FS.FSNode){FS.FSNode=(function(parent,name,mode,rdev){if(!parent){parent=this}this.parent=parent;this.mount=parent.mount;this.mounted=null;this.id=FS.nextInode++;this.name=name;this.mode=mode;this.node_ops={};this.stream_ops={};this.rdev=rdev});FS.FSNode.prototype={};var readMode=292|73;var writeMode=146;Object.defineProperties(FS.FSNode.prototype,{read:{get:(function(){return(this.mode&readMode)===readMode}),set:(function(val){val?this.mode|=readMode:this.mode&=~readMode})},write:{get:(function(){return(this.mode&writeMode)===writeMode}),set:(function(val){val?this.mode|=writeMode:this.mode&=~writeMode})},isFolder:{get:(function(){return FS.isDir(this.mode)})},isDevice:{get:(function(){return FS.isChrdev(this.mode)})}})}var node=new FS.FSNode(parent,name,mode,rdev);FS.hashAddNode(node);return node}),destroyNode:(function(node){FS.hashRemoveNode(node)}),isRoot:(function(node){return node===node.parent}),isMountpoint:(function(node){return!!node.mounted}),isFile:(function(mode){return(mode&61440)===32768}),isDir:(function(mode){return(mode&61440)===16384}),isLink:(function(mode){return(mode&61440)===40960}),isChrdev:(function(mode){return(mode&61440)===8192}),isBlkdev:(function(mode){return(mode&61440)===24576}),isFIFO:(function(mode){return(mode&61440)===4096}),isSocket:(function(mode){return(mode&49152)===49152}),flagModes:{"r":0,"rs":1052672,"r+":2,"w":577,"wx":705,"xw":705,"w+":578,"wx+":706,"xw+":706,"a":1089,"ax":1217,"xa":1217,"a+":1090,"ax+":1218,"xa+":1218},modeStringToFlags:(function(str){var flags=FS.flagModes[str];if(typeof flags==="undefined"){throw new Error("Unknown file open mode: "+str)}return flags}),flagsToPermissionString:(function(flag){var accmode=flag&2097155;var perms=["r","w","rw"][accmode];if(flag&512){perms+="w"}return perms}),nodePermissions:(function(node,perms){if(FS.ignorePermissions){return 0}if(perms.indexOf("r")!==-1&&!(node.mode&292)){return ERRNO_CODES.EACCES}else if(perms.indexOf("w")!==-1&&!(node.mode&146)){return ERRNO_CODES.EACCES}else if(perms.indexOf("x")!==-1&&!(node.mode&73)){return ERRNO_CODES.EACCES}return 0}),mayLookup:(function(dir){var err=FS.nodePermissions(dir,"x");if(err)return err;if(!dir.node_ops.lookup)return ERRNO_CODES.EACCES;return 0}),mayCreate:(function(dir,name){try{var node=FS.lookupNode(dir,name);return ERRNO_CODES.EEXIST}catch(e){}return FS.nodePermissions(dir,"wx")}),mayDelete:(function(dir,name,isdir){var node;try{node=FS.lookupNode(dir,name)}catch(e){return e.errno}var err=FS.nodePermissions(dir,"wx");if(err){return err}if(isdir){if(!FS.isDir(node.mode)){return ERRNO_CODES.ENOTDIR}if(FS.isRoot(node)||FS.getPath(node)===FS.cwd()){return ERRNO_CODES.EBUSY}}else{if(FS.isDir(node.mode)){return ERRNO_CODES.EISDIR}}return 0}),mayOpen:(function(node,flags){if(!node){return ERRNO_CODES.ENOENT}if(FS.isLink(node.mode)){return ERRNO_CODES.ELOOP}else if(FS.isDir(node.mode)){if((flags&2097155)!==0||flags&512){return ERRNO_CODES.EISDIR}}return FS.nodePermissions(node,FS.flagsToPermissionString(flags))}),MAX_OPEN_FDS:4096,nextfd:(function(fd_start,fd_end){fd_start=fd_start||0;fd_end=fd_end||FS.MAX_OPEN_FDS;for(var fd=fd_start;fd<=fd_end;fd++){if(!FS.streams[fd]){return fd}}throw new FS.ErrnoError(ERRNO_CODES.EMFILE)}),getStream:(function(fd){return FS.streams[fd]}),createStream:(function(stream,fd_start,fd_end){if(!FS.FSStream){FS.FSStream=(function(){});FS.FSStream.prototype={};Object.defineProperties(FS.FSStream.prototype,{object:{get:(function(){return this.node}),set:(function(val){this.node=val})},isRead:{get:(function(){return(this.flags&2097155)!==1})},isWrite:{get:(function(){return(this.flags&2097155)!==0})},isAppend:{get:(function(){return this.flags&1024})}})}var newStream=new FS.FSStream;for(var p in stream){newStream[p]=stream[p]}stream=newStream;var fd=FS.nextfd(fd_start,fd_end);stream.fd=fd;FS.streams[fd]=stream;return stream}),closeStream:(function(fd){FS.streams[fd]=null}),getStreamFromPtr:(function(ptr){return FS.streams[ptr-1]}),getPtrForStream:(function(stream){return stream?stream.fd+1:0}),chrdev_stream_ops:{open:(function(stream){var device=FS.getDevice(stream.node.rdev);stream.stream_ops=device.stream_ops;if(stream.stream_ops.open){stream.stream_ops.open(stream)}}),llseek:(function(){throw new FS.ErrnoError(ERRNO_CODES.ESPIPE)})},major:(function(dev){return dev>>8}),minor:(function(dev){return dev&255}),makedev:(function(ma,mi){return ma<<8|mi}),registerDevice:(function(dev,ops){FS.devices[dev]={stream_ops:ops}}),getDevice:(function(dev){return FS.devices[dev]}),getMounts:(function(mount){var mounts=[];var check=[mount];while(check.length){var m=check.pop();mounts.push(m);check.push.apply(check,m.mounts)}return mounts}),syncfs:(function(populate,callback){if(typeof populate==="function"){callback=populate;populate=false}var mounts=FS.getMounts(FS.root.mount);var completed=0;function done(err){if(err){if(!done.errored){done.errored=true;return callback(err)}return}if(++completed>=mounts.length){callback(null)}}mounts.forEach((function(mount){if(!mount.type.syncfs){return done(null)}mount.type.syncfs(mount,populate,done)}))}),mount:(function(type,opts,mountpoint){var root=mountpoint==="/";var pseudo=!mountpoint;var node;if(root&&FS.root){throw new FS.ErrnoError(ERRNO_CODES.EBUSY)}else if(!root&&!pseudo){var lookup=FS.lookupPath(mountpoint,{follow_mount:false});mountpoint=lookup.path;node=lookup.node;if(FS.isMountpoint(node)){throw new FS.ErrnoError(ERRNO_CODES.EBUSY)}if(!FS.isDir(node.mode)){throw new FS.ErrnoError(ERRNO_CODES.ENOTDIR)}}var mount={type:type,opts:opts,mountpoint:mountpoint,mounts:[]};var mountRoot=type.mount(mount);mountRoot.mount=mount;mount.root=mountRoot;if(root){FS.root=mountRoot}else if(node){node.mounted=mount;if(node.mount){node.mount.mounts.push(mount)}}return mountRoot}),unmount:(function(mountpoint){var lookup=FS.lookupPath(mountpoint,{follow_mount:false});if(!FS.isMountpoint(lookup.node)){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var node=lookup.node;var mount=node.mounted;var mounts=FS.getMounts(mount);Object.keys(FS.nameTable).forEach((function(hash){var current=FS.nameTable[hash];while(current){var next=current.name_next;if(mounts.indexOf(current.mount)!==-1){FS.destroyNode(current)}current=next}}));node.mounted=null;var idx=node.mount.mounts.indexOf(mount);assert(idx!==-1);node.mount.mounts.splice(idx,1)}),lookup:(function(parent,name){return parent.node_ops.lookup(parent,name)}),mknod:(function(path,mode,dev){var lookup=FS.lookupPath(path,{parent:true});var parent=lookup.node;var name=PATH.basename(path);if(!name||name==="."||name===".."){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var err=FS.mayCreate(parent,name);if(err){throw new FS.ErrnoError(err)}if(!parent.node_ops.mknod){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}return parent.node_ops.mknod(parent,name,mode,dev)}),create:(function(path,mode){mode=mode!==undefined?mode:438;mode&=4095;mode|=32768;return FS.mknod(path,mode,0)}),mkdir:(function(path,mode){mode=mode!==undefined?mode:511;mode&=511|512;mode|=16384;return FS.mknod(path,mode,0)}),mkdev:(function(path,mode,dev){if(typeof dev==="undefined"){dev=mode;mode=438}mode|=8192;return FS.mknod(path,mode,dev)}),symlink:(function(oldpath,newpath){if(!PATH.resolve(oldpath)){throw new FS.ErrnoError(ERRNO_CODES.ENOENT)}var lookup=FS.lookupPath(newpath,{parent:true});var parent=lookup.node;if(!parent){throw new FS.ErrnoError(ERRNO_CODES.ENOENT)}var newname=PATH.basename(newpath);var err=FS.mayCreate(parent,newname);if(err){throw new FS.ErrnoError(err)}if(!parent.node_ops.symlink){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}return parent.node_ops.symlink(parent,newname,oldpath)}),rename:(function(old_path,new_path){var old_dirname=PATH.dirname(old_path);var new_dirname=PATH.dirname(new_path);var old_name=PATH.basename(old_path);var new_name=PATH.basename(new_path);var lookup,old_dir,new_dir;try{lookup=FS.lookupPath(old_path,{parent:true});old_dir=lookup.node;lookup=FS.lookupPath(new_path,{parent:true});new_dir=lookup.node}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EBUSY)}if(!old_dir||!new_dir)throw new FS.ErrnoError(ERRNO_CODES.ENOENT);if(old_dir.mount!==new_dir.mount){throw new FS.ErrnoError(ERRNO_CODES.EXDEV)}var old_node=FS.lookupNode(old_dir,old_name);var relative=PATH.relative(old_path,new_dirname);if(relative.charAt(0)!=="."){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}relative=PATH.relative(new_path,old_dirname);if(relative.charAt(0)!=="."){throw new FS.ErrnoError(ERRNO_CODES.ENOTEMPTY)}var new_node;try{new_node=FS.lookupNode(new_dir,new_name)}catch(e){}if(old_node===new_node){return}var isdir=FS.isDir(old_node.mode);var err=FS.mayDelete(old_dir,old_name,isdir);if(err){throw new FS.ErrnoError(err)}err=new_node?FS.mayDelete(new_dir,new_name,isdir):FS.mayCreate(new_dir,new_name);if(err){throw new FS.ErrnoError(err)}if(!old_dir.node_ops.rename){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}if(FS.isMountpoint(old_node)||new_node&&FS.isMountpoint(new_node)){throw new FS.ErrnoError(ERRNO_CODES.EBUSY)}if(new_dir!==old_dir){err=FS.nodePermissions(old_dir,"w");if(err){throw new FS.ErrnoError(err)}}try{if(FS.trackingDelegate["willMovePath"]){FS.trackingDelegate["willMovePath"](old_path,new_path)}}catch(e){console.log("FS.trackingDelegate['willMovePath']('"+old_path+"', '"+new_path+"') threw an exception: "+e.message)}FS.hashRemoveNode(old_node);try{old_dir.node_ops.rename(old_node,new_dir,new_name)}catch(e){throw e}finally{FS.hashAddNode(old_node)}try{if(FS.trackingDelegate["onMovePath"])FS.trackingDelegate["onMovePath"](old_path,new_path)}catch(e){console.log("FS.trackingDelegate['onMovePath']('"+old_path+"', '"+new_path+"') threw an exception: "+e.message)}}),rmdir:(function(path){var lookup=FS.lookupPath(path,{parent:true});var parent=lookup.node;var name=PATH.basename(path);var node=FS.lookupNode(parent,name);var err=FS.mayDelete(parent,name,true);if(err){throw new FS.ErrnoError(err)}if(!parent.node_ops.rmdir){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}if(FS.isMountpoint(node)){throw new FS.ErrnoError(ERRNO_CODES.EBUSY)}try{if(FS.trackingDelegate["willDeletePath"]){FS.trackingDelegate["willDeletePath"](path)}}catch(e){console.log("FS.trackingDelegate['willDeletePath']('"+path+"') threw an exception: "+e.message)}parent.node_ops.rmdir(parent,name);FS.destroyNode(node);try{if(FS.trackingDelegate["onDeletePath"])FS.trackingDelegate["onDeletePath"](path)}catch(e){console.log("FS.trackingDelegate['onDeletePath']('"+path+"') threw an exception: "+e.message)}}),readdir:(function(path){var lookup=FS.lookupPath(path,{follow:true});var node=lookup.node;if(!node.node_ops.readdir){throw new FS.ErrnoError(ERRNO_CODES.ENOTDIR)}return node.node_ops.readdir(node)}),unlink:(function(path){var lookup=FS.lookupPath(path,{parent:true});var parent=lookup.node;var name=PATH.basename(path);var node=FS.lookupNode(parent,name);var err=FS.mayDelete(parent,name,false);if(err){if(err===ERRNO_CODES.EISDIR)err=ERRNO_CODES.EPERM;throw new FS.ErrnoError(err)}if(!parent.node_ops.unlink){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}if(FS.isMountpoint(node)){throw new FS.ErrnoError(ERRNO_CODES.EBUSY)}try{if(FS.trackingDelegate["willDeletePath"]){FS.trackingDelegate["willDeletePath"](path)}}catch(e){console.log("FS.trackingDelegate['willDeletePath']('"+path+"') threw an exception: "+e.message)}parent.node_ops.unlink(parent,name);FS.destroyNode(node);try{if(FS.trackingDelegate["onDeletePath"])FS.trackingDelegate["onDeletePath"](path)}catch(e){console.log("FS.trackingDelegate['onDeletePath']('"+path+"') threw an exception: "+e.message)}}),readlink:(function(path){var lookup=FS.lookupPath(path);var link=lookup.node;if(!link){throw new FS.ErrnoError(ERRNO_CODES.ENOENT)}if(!link.node_ops.readlink){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}return PATH.resolve(FS.getPath(lookup.node.parent),link.node_ops.readlink(link))}),stat:(function(path,dontFollow){var lookup=FS.lookupPath(path,{follow:!dontFollow});var node=lookup.node;if(!node){throw new FS.ErrnoError(ERRNO_CODES.ENOENT)}if(!node.node_ops.getattr){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}return node.node_ops.getattr(node)}),lstat:(function(path){return FS.stat(path,true)}),chmod:(function(path,mode,dontFollow){var node;if(typeof path==="string"){var lookup=FS.lookupPath(path,{follow:!dontFollow});node=lookup.node}else{node=path}if(!node.node_ops.setattr){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}node.node_ops.setattr(node,{mode:mode&4095|node.mode&~4095,timestamp:Date.now()})}),lchmod:(function(path,mode){FS.chmod(path,mode,true)}),fchmod:(function(fd,mode){var stream=FS.getStream(fd);if(!stream){throw new FS.ErrnoError(ERRNO_CODES.EBADF)}FS.chmod(stream.node,mode)}),chown:(function(path,uid,gid,dontFollow){var node;if(typeof path==="string"){var lookup=FS.lookupPath(path,{follow:!dontFollow});node=lookup.node}else{node=path}if(!node.node_ops.setattr){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}node.node_ops.setattr(node,{timestamp:Date.now()})}),lchown:(function(path,uid,gid){FS.chown(path,uid,gid,true)}),fchown:(function(fd,uid,gid){var stream=FS.getStream(fd);if(!stream){throw new FS.ErrnoError(ERRNO_CODES.EBADF)}FS.chown(stream.node,uid,gid)}),truncate:(function(path,len){if(len<0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var node;if(typeof path==="string"){var lookup=FS.lookupPath(path,{follow:true});node=lookup.node}else{node=path}if(!node.node_ops.setattr){throw new FS.ErrnoError(ERRNO_CODES.EPERM)}if(FS.isDir(node.mode)){throw new FS.ErrnoError(ERRNO_CODES.EISDIR)}if(!FS.isFile(node.mode)){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var err=FS.nodePermissions(node,"w");if(err){throw new FS.ErrnoError(err)}node.node_ops.setattr(node,{size:len,timestamp:Date.now()})}),ftruncate:(function(fd,len){var stream=FS.getStream(fd);if(!stream){throw new FS.ErrnoError(ERRNO_CODES.EBADF)}if((stream.flags&2097155)===0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}FS.truncate(stream.node,len)}),utime:(function(path,atime,mtime){var lookup=FS.lookupPath(path,{follow:true});var node=lookup.node;node.node_ops.setattr(node,{timestamp:Math.max(atime,mtime)})}),open:(function(path,flags,mode,fd_start,fd_end){if(path===""){throw new FS.ErrnoError(ERRNO_CODES.ENOENT)}flags=typeof flags==="string"?FS.modeStringToFlags(flags):flags;mode=typeof mode==="undefined"?438:mode;if(flags&64){mode=mode&4095|32768}else{mode=0}var node;if(typeof path==="object"){node=path}else{path=PATH.normalize(path);try{var lookup=FS.lookupPath(path,{follow:!(flags&131072)});node=lookup.node}catch(e){}}var created=false;if(flags&64){if(node){if(flags&128){throw new FS.ErrnoError(ERRNO_CODES.EEXIST)}}else{node=FS.mknod(path,mode,0);created=true}}if(!node){throw new FS.ErrnoError(ERRNO_CODES.ENOENT)}if(FS.isChrdev(node.mode)){flags&=~512}if(!created){var err=FS.mayOpen(node,flags);if(err){throw new FS.ErrnoError(err)}}if(flags&512){FS.truncate(node,0)}flags&=~(128|512);var stream=FS.createStream({node:node,path:FS.getPath(node),flags:flags,seekable:true,position:0,stream_ops:node.stream_ops,ungotten:[],error:false},fd_start,fd_end);if(stream.stream_ops.open){stream.stream_ops.open(stream)}if(Module["logReadFiles"]&&!(flags&1)){if(!FS.readFiles)FS.readFiles={};if(!(path in FS.readFiles)){FS.readFiles[path]=1;Module["printErr"]("read file: "+path)}}try{if(FS.trackingDelegate["onOpenFile"]){var trackingFlags=0;if((flags&2097155)!==1){trackingFlags|=FS.tracking.openFlags.READ}if((flags&2097155)!==0){trackingFlags|=FS.tracking.openFlags.WRITE}FS.trackingDelegate["onOpenFile"](path,trackingFlags)}}catch(e){console.log("FS.trackingDelegate['onOpenFile']('"+path+"', flags) threw an exception: "+e.message)}return stream}),close:(function(stream){try{if(stream.stream_ops.close){stream.stream_ops.close(stream)}}catch(e){throw e}finally{FS.closeStream(stream.fd)}}),llseek:(function(stream,offset,whence){if(!stream.seekable||!stream.stream_ops.llseek){throw new FS.ErrnoError(ERRNO_CODES.ESPIPE)}stream.position=stream.stream_ops.llseek(stream,offset,whence);stream.ungotten=[];return stream.position}),read:(function(stream,buffer,offset,length,position){if(length<0||position<0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}if((stream.flags&2097155)===1){throw new FS.ErrnoError(ERRNO_CODES.EBADF)}if(FS.isDir(stream.node.mode)){throw new FS.ErrnoError(ERRNO_CODES.EISDIR)}if(!stream.stream_ops.read){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var seeking=true;if(typeof position==="undefined"){position=stream.position;seeking=false}else if(!stream.seekable){throw new FS.ErrnoError(ERRNO_CODES.ESPIPE)}var bytesRead=stream.stream_ops.read(stream,buffer,offset,length,position);if(!seeking)stream.position+=bytesRead;return bytesRead}),write:(function(stream,buffer,offset,length,position,canOwn){if(length<0||position<0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}if((stream.flags&2097155)===0){throw new FS.ErrnoError(ERRNO_CODES.EBADF)}if(FS.isDir(stream.node.mode)){throw new FS.ErrnoError(ERRNO_CODES.EISDIR)}if(!stream.stream_ops.write){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}if(stream.flags&1024){FS.llseek(stream,0,2)}var seeking=true;if(typeof position==="undefined"){position=stream.position;seeking=false}else if(!stream.seekable){throw new FS.ErrnoError(ERRNO_CODES.ESPIPE)}var bytesWritten=stream.stream_ops.write(stream,buffer,offset,length,position,canOwn);if(!seeking)stream.position+=bytesWritten;try{if(stream.path&&FS.trackingDelegate["onWriteToFile"])FS.trackingDelegate["onWriteToFile"](stream.path)}catch(e){console.log("FS.trackingDelegate['onWriteToFile']('"+path+"') threw an exception: "+e.message)}return bytesWritten}),allocate:(function(stream,offset,length){if(offset<0||length<=0){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}if((stream.flags&2097155)===0){throw new FS.ErrnoError(ERRNO_CODES.EBADF)}if(!FS.isFile(stream.node.mode)&&!FS.isDir(node.mode)){throw new FS.ErrnoError(ERRNO_CODES.ENODEV)}if(!stream.stream_ops.allocate){throw new FS.ErrnoError(ERRNO_CODES.EOPNOTSUPP)}stream.stream_ops.allocate(stream,offset,length)}),mmap:(function(stream,buffer,offset,length,position,prot,flags){if((stream.flags&2097155)===1){throw new FS.ErrnoError(ERRNO_CODES.EACCES)}if(!stream.stream_ops.mmap){throw new FS.ErrnoError(ERRNO_CODES.ENODEV)}return stream.stream_ops.mmap(stream,buffer,offset,length,position,prot,flags)}),msync:(function(stream,buffer,offset,length,mmapFlags){if(!stream||!stream.stream_ops.msync){return 0}return stream.stream_ops.msync(stream,buffer,offset,length,mmapFlags)}),munmap:(function(stream){return 0}),ioctl:(function(stream,cmd,arg){if(!stream.stream_ops.ioctl){throw new FS.ErrnoError(ERRNO_CODES.ENOTTY)}return stream.stream_ops.ioctl(stream,cmd,arg)}),readFile:(function(path,opts){opts=opts||{};opts.flags=opts.flags||"r";opts.encoding=opts.encoding||"binary";if(opts.encoding!=="utf8"&&opts.encoding!=="binary"){throw new Error('Invalid encoding type "'+opts.encoding+'"')}var ret;var stream=FS.open(path,opts.flags);var stat=FS.stat(path);var length=stat.size;var buf=new Uint8Array(length);FS.read(stream,buf,0,length,0);if(opts.encoding==="utf8"){ret=UTF8ArrayToString(buf,0)}else if(opts.encoding==="binary"){ret=buf}FS.close(stream);return ret}),writeFile:(function(path,data,opts){opts=opts||{};opts.flags=opts.flags||"w";opts.encoding=opts.encoding||"utf8";if(opts.encoding!=="utf8"&&opts.encoding!=="binary"){throw new Error('Invalid encoding type "'+opts.encoding+'"')}var stream=FS.open(path,opts.flags,opts.mode);if(opts.encoding==="utf8"){var buf=new Uint8Array(lengthBytesUTF8(data)+1);var actualNumBytes=stringToUTF8Array(data,buf,0,buf.length);FS.write(stream,buf,0,actualNumBytes,0,opts.canOwn)}else if(opts.encoding==="binary"){FS.write(stream,data,0,data.length,0,opts.canOwn)}FS.close(stream)}),cwd:(function(){return FS.currentPath}),chdir:(function(path){var lookup=FS.lookupPath(path,{follow:true});if(!FS.isDir(lookup.node.mode)){throw new FS.ErrnoError(ERRNO_CODES.ENOTDIR)}var err=FS.nodePermissions(lookup.node,"x");if(err){throw new FS.ErrnoError(err)}FS.currentPath=lookup.path}),createDefaultDirectories:(function(){FS.mkdir("/tmp");FS.mkdir("/home");FS.mkdir("/home/web_user")}),createDefaultDevices:(function(){FS.mkdir("/dev");FS.registerDevice(FS.makedev(1,3),{read:(function(){return 0}),write:(function(stream,buffer,offset,length,pos){return length})});FS.mkdev("/dev/null",FS.makedev(1,3));TTY.register(FS.makedev(5,0),TTY.default_tty_ops);TTY.register(FS.makedev(6,0),TTY.default_tty1_ops);FS.mkdev("/dev/tty",FS.makedev(5,0));FS.mkdev("/dev/tty1",FS.makedev(6,0));var random_device;if(typeof crypto!=="undefined"){var randomBuffer=new Uint8Array(1);random_device=(function(){crypto.getRandomValues(randomBuffer);return randomBuffer[0]})}else if(ENVIRONMENT_IS_NODE){random_device=(function(){return require("crypto").randomBytes(1)[0]})}else{random_device=(function(){return Math.random()*256|0})}FS.createDevice("/dev","random",random_device);FS.createDevice("/dev","urandom",random_device);FS.mkdir("/dev/shm");FS.mkdir("/dev/shm/tmp")}),createStandardStreams:(function(){if(Module["stdin"]){FS.createDevice("/dev","stdin",Module["stdin"])}else{FS.symlink("/dev/tty","/dev/stdin")}if(Module["stdout"]){FS.createDevice("/dev","stdout",null,Module["stdout"])}else{FS.symlink("/dev/tty","/dev/stdout")}if(Module["stderr"]){FS.createDevice("/dev","stderr",null,Module["stderr"])}else{FS.symlink("/dev/tty1","/dev/stderr")}var stdin=FS.open("/dev/stdin","r");HEAP32[_stdin>>2]=FS.getPtrForStream(stdin);assert(stdin.fd===0,"invalid handle for stdin ("+stdin.fd+")");var stdout=FS.open("/dev/stdout","w");HEAP32[_stdout>>2]=FS.getPtrForStream(stdout);assert(stdout.fd===1,"invalid handle for stdout ("+stdout.fd+")");var stderr=FS.open("/dev/stderr","w");HEAP32[_stderr>>2]=FS.getPtrForStream(stderr);assert(stderr.fd===2,"invalid handle for stderr ("+stderr.fd+")")}),ensureErrnoError:(function(){if(FS.ErrnoError)return;FS.ErrnoError=function ErrnoError(errno,node){this.node=node;this.setErrno=(function(errno){this.errno=errno;for(var key in ERRNO_CODES){if(ERRNO_CODES[key]===errno){this.code=key;break}}});this.setErrno(errno);this.message=ERRNO_MESSAGES[errno]};FS.ErrnoError.prototype=new Error;FS.ErrnoError.prototype.constructor=FS.ErrnoError;[ERRNO_CODES.ENOENT].forEach((function(code){FS.genericErrors[code]=new FS.ErrnoError(code);FS.genericErrors[code].stack="<generic error, no stack>"}))}),staticInit:(function(){FS.ensureErrnoError();FS.nameTable=new Array(4096);FS.mount(MEMFS,{},"/");FS.createDefaultDirectories();FS.createDefaultDevices()}),init:(function(input,output,error){assert(!FS.init.initialized,"FS.init was previously called. If you want to initialize later with custom parameters, remove any earlier calls (note that one is automatically added to the generated code)");FS.init.initialized=true;FS.ensureErrnoError();Module["stdin"]=input||Module["stdin"];Module["stdout"]=output||Module["stdout"];Module["stderr"]=error||Module["stderr"];FS.createStandardStreams()}),quit:(function(){FS.init.initialized=false;for(var i=0;i<FS.streams.length;i++){var stream=FS.streams[i];if(!stream){continue}FS.close(stream)}}),getMode:(function(canRead,canWrite){var mode=0;if(canRead)mode|=292|73;if(canWrite)mode|=146;return mode}),joinPath:(function(parts,forceRelative){var path=PATH.join.apply(null,parts);if(forceRelative&&path[0]=="/")path=path.substr(1);return path}),absolutePath:(function(relative,base){return PATH.resolve(base,relative)}),standardizePath:(function(path){return PATH.normalize(path)}),findObject:(function(path,dontResolveLastLink){var ret=FS.analyzePath(path,dontResolveLastLink);if(ret.exists){return ret.object}else{___setErrNo(ret.error);return null}}),analyzePath:(function(path,dontResolveLastLink){try{var lookup=FS.lookupPath(path,{follow:!dontResolveLastLink});path=lookup.path}catch(e){}var ret={isRoot:false,exists:false,error:0,name:null,path:null,object:null,parentExists:false,parentPath:null,parentObject:null};try{var lookup=FS.lookupPath(path,{parent:true});ret.parentExists=true;ret.parentPath=lookup.path;ret.parentObject=lookup.node;ret.name=PATH.basename(path);lookup=FS.lookupPath(path,{follow:!dontResolveLastLink});ret.exists=true;ret.path=lookup.path;ret.object=lookup.node;ret.name=lookup.node.name;ret.isRoot=lookup.path==="/"}catch(e){ret.error=e.errno}return ret}),createFolder:(function(parent,name,canRead,canWrite){var path=PATH.join2(typeof parent==="string"?parent:FS.getPath(parent),name);var mode=FS.getMode(canRead,canWrite);return FS.mkdir(path,mode)}),createPath:(function(parent,path,canRead,canWrite){parent=typeof parent==="string"?parent:FS.getPath(parent);var parts=path.split("/").reverse();while(parts.length){var part=parts.pop();if(!part)continue;var current=PATH.join2(parent,part);try{FS.mkdir(current)}catch(e){}parent=current}return current}),createFile:(function(parent,name,properties,canRead,canWrite){var path=PATH.join2(typeof parent==="string"?parent:FS.getPath(parent),name);var mode=FS.getMode(canRead,canWrite);return FS.create(path,mode)}),createDataFile:(function(parent,name,data,canRead,canWrite,canOwn){var path=name?PATH.join2(typeof parent==="string"?parent:FS.getPath(parent),name):parent;var mode=FS.getMode(canRead,canWrite);var node=FS.create(path,mode);if(data){if(typeof data==="string"){var arr=new Array(data.length);for(var i=0,len=data.length;i<len;++i)arr[i]=data.charCodeAt(i);data=arr}FS.chmod(node,mode|146);var stream=FS.open(node,"w");FS.write(stream,data,0,data.length,0,canOwn);FS.close(stream);FS.chmod(node,mode)}return node}),createDevice:(function(parent,name,input,output){var path=PATH.join2(typeof parent==="string"?parent:FS.getPath(parent),name);var mode=FS.getMode(!!input,!!output);if(!FS.createDevice.major)FS.createDevice.major=64;var dev=FS.makedev(FS.createDevice.major++,0);FS.registerDevice(dev,{open:(function(stream){stream.seekable=false}),close:(function(stream){if(output&&output.buffer&&output.buffer.length){output(10)}}),read:(function(stream,buffer,offset,length,pos){var bytesRead=0;for(var i=0;i<length;i++){var result;try{result=input()}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EIO)}if(result===undefined&&bytesRead===0){throw new FS.ErrnoError(ERRNO_CODES.EAGAIN)}if(result===null||result===undefined)break;bytesRead++;buffer[offset+i]=result}if(bytesRead){stream.node.timestamp=Date.now()}return bytesRead}),write:(function(stream,buffer,offset,length,pos){for(var i=0;i<length;i++){try{output(buffer[offset+i])}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EIO)}}if(length){stream.node.timestamp=Date.now()}return i})});return FS.mkdev(path,mode,dev)}),createLink:(function(parent,name,target,canRead,canWrite){var path=PATH.join2(typeof parent==="string"?parent:FS.getPath(parent),name);return FS.symlink(target,path)}),forceLoadFile:(function(obj){if(obj.isDevice||obj.isFolder||obj.link||obj.contents)return true;var success=true;if(typeof XMLHttpRequest!=="undefined"){throw new Error("Lazy loading should have been performed (contents set) in createLazyFile, but it was not. Lazy loading only works in web workers. Use --embed-file or --preload-file in emcc on the main thread.")}else if(Module["read"]){try{obj.contents=intArrayFromString(Module["read"](obj.url),true);obj.usedBytes=obj.contents.length}catch(e){success=false}}else{throw new Error("Cannot load without read() or XMLHttpRequest.")}if(!success)___setErrNo(ERRNO_CODES.EIO);return success}),createLazyFile:(function(parent,name,url,canRead,canWrite){function LazyUint8Array(){this.lengthKnown=false;this.chunks=[]}LazyUint8Array.prototype.get=function LazyUint8Array_get(idx){if(idx>this.length-1||idx<0){return undefined}var chunkOffset=idx%this.chunkSize;var chunkNum=idx/this.chunkSize|0;return this.getter(chunkNum)[chunkOffset]};LazyUint8Array.prototype.setDataGetter=function LazyUint8Array_setDataGetter(getter){this.getter=getter};LazyUint8Array.prototype.cacheLength=function LazyUint8Array_cacheLength(){var xhr=new XMLHttpRequest;xhr.open("HEAD",url,false);xhr.send(null);if(!(xhr.status>=200&&xhr.status<300||xhr.status===304))throw new Error("Couldn't load "+url+". Status: "+xhr.status);var datalength=Number(xhr.getResponseHeader("Content-length"));var header;var hasByteServing=(header=xhr.getResponseHeader("Accept-Ranges"))&&header==="bytes";var chunkSize=1024*1024;if(!hasByteServing)chunkSize=datalength;var doXHR=(function(from,to){if(from>to)throw new Error("invalid range ("+from+", "+to+") or no bytes requested!");if(to>datalength-1)throw new Error("only "+datalength+" bytes available! programmer error!");var xhr=new XMLHttpRequest;xhr.open("GET",url,false);if(datalength!==chunkSize)xhr.setRequestHeader("Range","bytes="+from+"-"+to);if(typeof Uint8Array!="undefined")xhr.responseType="arraybuffer";if(xhr.overrideMimeType){xhr.overrideMimeType("text/plain; charset=x-user-defined")}xhr.send(null);if(!(xhr.status>=200&&xhr.status<300||xhr.status===304))throw new Error("Couldn't load "+url+". Status: "+xhr.status);if(xhr.response!==undefined){return new Uint8Array(xhr.response||[])}else{return intArrayFromString(xhr.responseText||"",true)}});var lazyArray=this;lazyArray.setDataGetter((function(chunkNum){var start=chunkNum*chunkSize;var end=(chunkNum+1)*chunkSize-1;end=Math.min(end,datalength-1);if(typeof lazyArray.chunks[chunkNum]==="undefined"){lazyArray.chunks[chunkNum]=doXHR(start,end)}if(typeof lazyArray.chunks[chunkNum]==="undefined")throw new Error("doXHR failed!");return lazyArray.chunks[chunkNum]}));this._length=datalength;this._chunkSize=chunkSize;this.lengthKnown=true};if(typeof XMLHttpRequest!=="undefined"){if(!ENVIRONMENT_IS_WORKER)throw"Cannot do synchronous binary XHRs outside webworkers in modern browsers. Use --embed-file or --preload-file in emcc";var lazyArray=new LazyUint8Array;Object.defineProperty(lazyArray,"length",{get:(function(){if(!this.lengthKnown){this.cacheLength()}return this._length})});Object.defineProperty(lazyArray,"chunkSize",{get:(function(){if(!this.lengthKnown){this.cacheLength()}return this._chunkSize})});var properties={isDevice:false,contents:lazyArray}}else{var properties={isDevice:false,url:url}}var node=FS.createFile(parent,name,properties,canRead,canWrite);if(properties.contents){node.contents=properties.contents}else if(properties.url){node.contents=null;node.url=properties.url}Object.defineProperty(node,"usedBytes",{get:(function(){return this.contents.length})});var stream_ops={};var keys=Object.keys(node.stream_ops);keys.forEach((function(key){var fn=node.stream_ops[key];stream_ops[key]=function forceLoadLazyFile(){if(!FS.forceLoadFile(node)){throw new FS.ErrnoError(ERRNO_CODES.EIO)}return fn.apply(null,arguments)}}));stream_ops.read=function stream_ops_read(stream,buffer,offset,length,position){if(!FS.forceLoadFile(node)){throw new FS.ErrnoError(ERRNO_CODES.EIO)}var contents=stream.node.contents;if(position>=contents.length)return 0;var size=Math.min(contents.length-position,length);assert(size>=0);if(contents.slice){for(var i=0;i<size;i++){buffer[offset+i]=contents[position+i]}}else{for(var i=0;i<size;i++){buffer[offset+i]=contents.get(position+i)}}return size};node.stream_ops=stream_ops;return node}),createPreloadedFile:(function(parent,name,url,canRead,canWrite,onload,onerror,dontCreateFile,canOwn,preFinish){Browser.init();var fullname=name?PATH.resolve(PATH.join2(parent,name)):parent;var dep=getUniqueRunDependency("cp "+fullname);function processData(byteArray){function finish(byteArray){if(preFinish)preFinish();if(!dontCreateFile){FS.createDataFile(parent,name,byteArray,canRead,canWrite,canOwn)}if(onload)onload();removeRunDependency(dep)}var handled=false;Module["preloadPlugins"].forEach((function(plugin){if(handled)return;if(plugin["canHandle"](fullname)){plugin["handle"](byteArray,fullname,finish,(function(){if(onerror)onerror();removeRunDependency(dep)}));handled=true}}));if(!handled)finish(byteArray)}addRunDependency(dep);if(typeof url=="string"){Browser.asyncLoad(url,(function(byteArray){processData(byteArray)}),onerror)}else{processData(url)}}),indexedDB:(function(){return window.indexedDB||window.mozIndexedDB||window.webkitIndexedDB||window.msIndexedDB}),DB_NAME:(function(){return"EM_FS_"+window.location.pathname}),DB_VERSION:20,DB_STORE_NAME:"FILE_DATA",saveFilesToDB:(function(paths,onload,onerror){onload=onload||(function(){});onerror=onerror||(function(){});var indexedDB=FS.indexedDB();try{var openRequest=indexedDB.open(FS.DB_NAME(),FS.DB_VERSION)}catch(e){return onerror(e)}openRequest.onupgradeneeded=function openRequest_onupgradeneeded(){console.log("creating db");var db=openRequest.result;db.createObjectStore(FS.DB_STORE_NAME)};openRequest.onsuccess=function openRequest_onsuccess(){var db=openRequest.result;var transaction=db.transaction([FS.DB_STORE_NAME],"readwrite");var files=transaction.objectStore(FS.DB_STORE_NAME);var ok=0,fail=0,total=paths.length;function finish(){if(fail==0)onload();else onerror()}paths.forEach((function(path){var putRequest=files.put(FS.analyzePath(path).object.contents,path);putRequest.onsuccess=function putRequest_onsuccess(){ok++;if(ok+fail==total)finish()};putRequest.onerror=function putRequest_onerror(){fail++;if(ok+fail==total)finish()}}));transaction.onerror=onerror};openRequest.onerror=onerror}),loadFilesFromDB:(function(paths,onload,onerror){onload=onload||(function(){});onerror=onerror||(function(){});var indexedDB=FS.indexedDB();try{var openRequest=indexedDB.open(FS.DB_NAME(),FS.DB_VERSION)}catch(e){return onerror(e)}openRequest.onupgradeneeded=onerror;openRequest.onsuccess=function openRequest_onsuccess(){var db=openRequest.result;try{var transaction=db.transaction([FS.DB_STORE_NAME],"readonly")}catch(e){onerror(e);return}var files=transaction.objectStore(FS.DB_STORE_NAME);var ok=0,fail=0,total=paths.length;function finish(){if(fail==0)onload();else onerror()}paths.forEach((function(path){var getRequest=files.get(path);getRequest.onsuccess=function getRequest_onsuccess(){if(FS.analyzePath(path).exists){FS.unlink(path)}FS.createDataFile(PATH.dirname(path),PATH.basename(path),getRequest.result,true,true,true);ok++;if(ok+fail==total)finish()};getRequest.onerror=function getRequest_onerror(){fail++;if(ok+fail==total)finish()}}));transaction.onerror=onerror};openRequest.onerror=onerror})};function _lseek(fildes,offset,whence){var stream=FS.getStream(fildes);if(!stream){___setErrNo(ERRNO_CODES.EBADF);return-1}try{return FS.llseek(stream,offset,whence)}catch(e){FS.handleFSError(e);return-1}}Module["_i64Subtract"]=_i64Subtract;function _sysconf(name){switch(name){case 30:return PAGE_SIZE;case 85:return totalMemory/PAGE_SIZE;case 132:case 133:case 12:case 137:case 138:case 15:case 235:case 16:case 17:case 18:case 19:case 20:case 149:case 13:case 10:case 236:case 153:case 9:case 21:case 22:case 159:case 154:case 14:case 77:case 78:case 139:case 80:case 81:case 82:case 68:case 67:case 164:case 11:case 29:case 47:case 48:case 95:case 52:case 51:case 46:return 200809;case 79:return 0;case 27:case 246:case 127:case 128:case 23:case 24:case 160:case 161:case 181:case 182:case 242:case 183:case 184:case 243:case 244:case 245:case 165:case 178:case 179:case 49:case 50:case 168:case 169:case 175:case 170:case 171:case 172:case 97:case 76:case 32:case 173:case 35:return-1;case 176:case 177:case 7:case 155:case 8:case 157:case 125:case 126:case 92:case 93:case 129:case 130:case 131:case 94:case 91:return 1;case 74:case 60:case 69:case 70:case 4:return 1024;case 31:case 42:case 72:return 32;case 87:case 26:case 33:return 2147483647;case 34:case 1:return 47839;case 38:case 36:return 99;case 43:case 37:return 2048;case 0:return 2097152;case 3:return 65536;case 28:return 32768;case 44:return 32767;case 75:return 16384;case 39:return 1e3;case 89:return 700;case 71:return 256;case 40:return 255;case 2:return 100;case 180:return 64;case 25:return 20;case 5:return 16;case 6:return 6;case 73:return 4;case 84:{if(typeof navigator==="object")return navigator["hardwareConcurrency"]||1;return 1}}___setErrNo(ERRNO_CODES.EINVAL);return-1}Module["_memset"]=_memset;var _BDtoILow=true;Module["_strlen"]=_strlen;Module["_strcat"]=_strcat;function _strerror_r(errnum,strerrbuf,buflen){if(errnum in ERRNO_MESSAGES){if(ERRNO_MESSAGES[errnum].length>buflen-1){return ___setErrNo(ERRNO_CODES.ERANGE)}else{var msg=ERRNO_MESSAGES[errnum];writeAsciiToMemory(msg,strerrbuf);return 0}}else{return ___setErrNo(ERRNO_CODES.EINVAL)}}function _strerror(errnum){if(!_strerror.buffer)_strerror.buffer=_malloc(256);_strerror_r(errnum,_strerror.buffer,256);return _strerror.buffer}Module["_bitshift64Shl"]=_bitshift64Shl;function _mkport(){throw"TODO"}var SOCKFS={mount:(function(mount){Module["websocket"]=Module["websocket"]&&"object"===typeof Module["websocket"]?Module["websocket"]:{};Module["websocket"]._callbacks={};Module["websocket"]["on"]=(function(event,callback){if("function"===typeof callback){this._callbacks[event]=callback}return this});Module["websocket"].emit=(function(event,param){if("function"===typeof this._callbacks[event]){this._callbacks[event].call(this,param)}});return FS.createNode(null,"/",16384|511,0)}),createSocket:(function(family,type,protocol){var streaming=type==1;if(protocol){assert(streaming==(protocol==6))}var sock={family:family,type:type,protocol:protocol,server:null,error:null,peers:{},pending:[],recv_queue:[],sock_ops:SOCKFS.websocket_sock_ops};var name=SOCKFS.nextname();var node=FS.createNode(SOCKFS.root,name,49152,0);node.sock=sock;var stream=FS.createStream({path:name,node:node,flags:FS.modeStringToFlags("r+"),seekable:false,stream_ops:SOCKFS.stream_ops});sock.stream=stream;return sock}),getSocket:(function(fd){var stream=FS.getStream(fd);if(!stream||!FS.isSocket(stream.node.mode)){return null}return stream.node.sock}),stream_ops:{poll:(function(stream){var sock=stream.node.sock;return sock.sock_ops.poll(sock)}),ioctl:(function(stream,request,varargs){var sock=stream.node.sock;return sock.sock_ops.ioctl(sock,request,varargs)}),read:(function(stream,buffer,offset,length,position){var sock=stream.node.sock;var msg=sock.sock_ops.recvmsg(sock,length);if(!msg){return 0}buffer.set(msg.buffer,offset);return msg.buffer.length}),write:(function(stream,buffer,offset,length,position){var sock=stream.node.sock;return sock.sock_ops.sendmsg(sock,buffer,offset,length)}),close:(function(stream){var sock=stream.node.sock;sock.sock_ops.close(sock)})},nextname:(function(){if(!SOCKFS.nextname.current){SOCKFS.nextname.current=0}return"socket["+SOCKFS.nextname.current++ +"]"}),websocket_sock_ops:{createPeer:(function(sock,addr,port){var ws;if(typeof addr==="object"){ws=addr;addr=null;port=null}if(ws){if(ws._socket){addr=ws._socket.remoteAddress;port=ws._socket.remotePort}else{var result=/ws[s]?:\/\/([^:]+):(\d+)/.exec(ws.url);if(!result){throw new Error("WebSocket URL must be in the format ws(s)://address:port")}addr=result[1];port=parseInt(result[2],10)}}else{try{var runtimeConfig=Module["websocket"]&&"object"===typeof Module["websocket"];var url="ws:#".replace("#","//");if(runtimeConfig){if("string"===typeof Module["websocket"]["url"]){url=Module["websocket"]["url"]}}if(url==="ws://"||url==="wss://"){var parts=addr.split("/");url=url+parts[0]+":"+port+"/"+parts.slice(1).join("/")}var subProtocols="binary";if(runtimeConfig){if("string"===typeof Module["websocket"]["subprotocol"]){subProtocols=Module["websocket"]["subprotocol"]}}subProtocols=subProtocols.replace(/^ +| +$/g,"").split(/ *, */);var opts=ENVIRONMENT_IS_NODE?{"protocol":subProtocols.toString()}:subProtocols;var WebSocket=ENVIRONMENT_IS_NODE?require("ws"):window["WebSocket"];ws=new WebSocket(url,opts);ws.binaryType="arraybuffer"}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EHOSTUNREACH)}}var peer={addr:addr,port:port,socket:ws,dgram_send_queue:[]};SOCKFS.websocket_sock_ops.addPeer(sock,peer);SOCKFS.websocket_sock_ops.handlePeerEvents(sock,peer);if(sock.type===2&&typeof sock.sport!=="undefined"){peer.dgram_send_queue.push(new Uint8Array([255,255,255,255,"p".charCodeAt(0),"o".charCodeAt(0),"r".charCodeAt(0),"t".charCodeAt(0),(sock.sport&65280)>>8,sock.sport&255]))}return peer}),getPeer:(function(sock,addr,port){return sock.peers[addr+":"+port]}),addPeer:(function(sock,peer){sock.peers[peer.addr+":"+peer.port]=peer}),removePeer:(function(sock,peer){delete sock.peers[peer.addr+":"+peer.port]}),handlePeerEvents:(function(sock,peer){var first=true;var handleOpen=(function(){Module["websocket"].emit("open",sock.stream.fd);try{var queued=peer.dgram_send_queue.shift();while(queued){peer.socket.send(queued);queued=peer.dgram_send_queue.shift()}}catch(e){peer.socket.close()}});function handleMessage(data){assert(typeof data!=="string"&&data.byteLength!==undefined);data=new Uint8Array(data);var wasfirst=first;first=false;if(wasfirst&&data.length===10&&data[0]===255&&data[1]===255&&data[2]===255&&data[3]===255&&data[4]==="p".charCodeAt(0)&&data[5]==="o".charCodeAt(0)&&data[6]==="r".charCodeAt(0)&&data[7]==="t".charCodeAt(0)){var newport=data[8]<<8|data[9];SOCKFS.websocket_sock_ops.removePeer(sock,peer);peer.port=newport;SOCKFS.websocket_sock_ops.addPeer(sock,peer);return}sock.recv_queue.push({addr:peer.addr,port:peer.port,data:data});Module["websocket"].emit("message",sock.stream.fd)}if(ENVIRONMENT_IS_NODE){peer.socket.on("open",handleOpen);peer.socket.on("message",(function(data,flags){if(!flags.binary){return}handleMessage((new Uint8Array(data)).buffer)}));peer.socket.on("close",(function(){Module["websocket"].emit("close",sock.stream.fd)}));peer.socket.on("error",(function(error){sock.error=ERRNO_CODES.ECONNREFUSED;Module["websocket"].emit("error",[sock.stream.fd,sock.error,"ECONNREFUSED: Connection refused"])}))}else{peer.socket.onopen=handleOpen;peer.socket.onclose=(function(){Module["websocket"].emit("close",sock.stream.fd)});peer.socket.onmessage=function peer_socket_onmessage(event){handleMessage(event.data)};peer.socket.onerror=(function(error){sock.error=ERRNO_CODES.ECONNREFUSED;Module["websocket"].emit("error",[sock.stream.fd,sock.error,"ECONNREFUSED: Connection refused"])})}}),poll:(function(sock){if(sock.type===1&&sock.server){return sock.pending.length?64|1:0}var mask=0;var dest=sock.type===1?SOCKFS.websocket_sock_ops.getPeer(sock,sock.daddr,sock.dport):null;if(sock.recv_queue.length||!dest||dest&&dest.socket.readyState===dest.socket.CLOSING||dest&&dest.socket.readyState===dest.socket.CLOSED){mask|=64|1}if(!dest||dest&&dest.socket.readyState===dest.socket.OPEN){mask|=4}if(dest&&dest.socket.readyState===dest.socket.CLOSING||dest&&dest.socket.readyState===dest.socket.CLOSED){mask|=16}return mask}),ioctl:(function(sock,request,arg){switch(request){case 21531:var bytes=0;if(sock.recv_queue.length){bytes=sock.recv_queue[0].data.length}HEAP32[arg>>2]=bytes;return 0;default:return ERRNO_CODES.EINVAL}}),close:(function(sock){if(sock.server){try{sock.server.close()}catch(e){}sock.server=null}var peers=Object.keys(sock.peers);for(var i=0;i<peers.length;i++){var peer=sock.peers[peers[i]];try{peer.socket.close()}catch(e){}SOCKFS.websocket_sock_ops.removePeer(sock,peer)}return 0}),bind:(function(sock,addr,port){if(typeof sock.saddr!=="undefined"||typeof sock.sport!=="undefined"){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}sock.saddr=addr;sock.sport=port||_mkport();if(sock.type===2){if(sock.server){sock.server.close();sock.server=null}try{sock.sock_ops.listen(sock,0)}catch(e){if(!(e instanceof FS.ErrnoError))throw e;if(e.errno!==ERRNO_CODES.EOPNOTSUPP)throw e}}}),connect:(function(sock,addr,port){if(sock.server){throw new FS.ErrnoError(ERRNO_CODES.EOPNOTSUPP)}if(typeof sock.daddr!=="undefined"&&typeof sock.dport!=="undefined"){var dest=SOCKFS.websocket_sock_ops.getPeer(sock,sock.daddr,sock.dport);if(dest){if(dest.socket.readyState===dest.socket.CONNECTING){throw new FS.ErrnoError(ERRNO_CODES.EALREADY)}else{throw new FS.ErrnoError(ERRNO_CODES.EISCONN)}}}var peer=SOCKFS.websocket_sock_ops.createPeer(sock,addr,port);sock.daddr=peer.addr;sock.dport=peer.port;throw new FS.ErrnoError(ERRNO_CODES.EINPROGRESS)}),listen:(function(sock,backlog){if(!ENVIRONMENT_IS_NODE){throw new FS.ErrnoError(ERRNO_CODES.EOPNOTSUPP)}if(sock.server){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var WebSocketServer=require("ws").Server;var host=sock.saddr;sock.server=new WebSocketServer({host:host,port:sock.sport});Module["websocket"].emit("listen",sock.stream.fd);sock.server.on("connection",(function(ws){if(sock.type===1){var newsock=SOCKFS.createSocket(sock.family,sock.type,sock.protocol);var peer=SOCKFS.websocket_sock_ops.createPeer(newsock,ws);newsock.daddr=peer.addr;newsock.dport=peer.port;sock.pending.push(newsock);Module["websocket"].emit("connection",newsock.stream.fd)}else{SOCKFS.websocket_sock_ops.createPeer(sock,ws);Module["websocket"].emit("connection",sock.stream.fd)}}));sock.server.on("closed",(function(){Module["websocket"].emit("close",sock.stream.fd);sock.server=null}));sock.server.on("error",(function(error){sock.error=ERRNO_CODES.EHOSTUNREACH;Module["websocket"].emit("error",[sock.stream.fd,sock.error,"EHOSTUNREACH: Host is unreachable"])}))}),accept:(function(listensock){if(!listensock.server){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}var newsock=listensock.pending.shift();newsock.stream.flags=listensock.stream.flags;return newsock}),getname:(function(sock,peer){var addr,port;if(peer){if(sock.daddr===undefined||sock.dport===undefined){throw new FS.ErrnoError(ERRNO_CODES.ENOTCONN)}addr=sock.daddr;port=sock.dport}else{addr=sock.saddr||0;port=sock.sport||0}return{addr:addr,port:port}}),sendmsg:(function(sock,buffer,offset,length,addr,port){if(sock.type===2){if(addr===undefined||port===undefined){addr=sock.daddr;port=sock.dport}if(addr===undefined||port===undefined){throw new FS.ErrnoError(ERRNO_CODES.EDESTADDRREQ)}}else{addr=sock.daddr;port=sock.dport}var dest=SOCKFS.websocket_sock_ops.getPeer(sock,addr,port);if(sock.type===1){if(!dest||dest.socket.readyState===dest.socket.CLOSING||dest.socket.readyState===dest.socket.CLOSED){throw new FS.ErrnoError(ERRNO_CODES.ENOTCONN)}else if(dest.socket.readyState===dest.socket.CONNECTING){throw new FS.ErrnoError(ERRNO_CODES.EAGAIN)}}var data;if(buffer instanceof Array||buffer instanceof ArrayBuffer){data=buffer.slice(offset,offset+length)}else{data=buffer.buffer.slice(buffer.byteOffset+offset,buffer.byteOffset+offset+length)}if(sock.type===2){if(!dest||dest.socket.readyState!==dest.socket.OPEN){if(!dest||dest.socket.readyState===dest.socket.CLOSING||dest.socket.readyState===dest.socket.CLOSED){dest=SOCKFS.websocket_sock_ops.createPeer(sock,addr,port)}dest.dgram_send_queue.push(data);return length}}try{dest.socket.send(data);return length}catch(e){throw new FS.ErrnoError(ERRNO_CODES.EINVAL)}}),recvmsg:(function(sock,length){if(sock.type===1&&sock.server){throw new FS.ErrnoError(ERRNO_CODES.ENOTCONN)}var queued=sock.recv_queue.shift();if(!queued){if(sock.type===1){var dest=SOCKFS.websocket_sock_ops.getPeer(sock,sock.daddr,sock.dport);if(!dest){throw new FS.ErrnoError(ERRNO_CODES.ENOTCONN)}else if(dest.socket.readyState===dest.socket.CLOSING||dest.socket.readyState===dest.socket.CLOSED){return null}else{throw new FS.ErrnoError(ERRNO_CODES.EAGAIN)}}else{throw new FS.ErrnoError(ERRNO_CODES.EAGAIN)}}var queuedLength=queued.data.byteLength||queued.data.length;var queuedOffset=queued.data.byteOffset||0;var queuedBuffer=queued.data.buffer||queued.data;var bytesRead=Math.min(length,queuedLength);var res={buffer:new Uint8Array(queuedBuffer,queuedOffset,bytesRead),addr:queued.addr,port:queued.port};if(sock.type===1&&bytesRead<queuedLength){var bytesRemaining=queuedLength-bytesRead;queued.data=new Uint8Array(queuedBuffer,queuedOffset+bytesRead,bytesRemaining);sock.recv_queue.unshift(queued)}return res})}};function _send(fd,buf,len,flags){var sock=SOCKFS.getSocket(fd);if(!sock){___setErrNo(ERRNO_CODES.EBADF);return-1}return _write(fd,buf,len)}function _pwrite(fildes,buf,nbyte,offset){var stream=FS.getStream(fildes);if(!stream){___setErrNo(ERRNO_CODES.EBADF);return-1}try{var slab=HEAP8;return FS.write(stream,slab,buf,nbyte,offset)}catch(e){FS.handleFSError(e);return-1}}function _write(fildes,buf,nbyte){var stream=FS.getStream(fildes);if(!stream){___setErrNo(ERRNO_CODES.EBADF);return-1}try{var slab=HEAP8;return FS.write(stream,slab,buf,nbyte)}catch(e){FS.handleFSError(e);return-1}}function _fileno(stream){stream=FS.getStreamFromPtr(stream);if(!stream)return-1;return stream.fd}function _fwrite(ptr,size,nitems,stream){var bytesToWrite=nitems*size;if(bytesToWrite==0)return 0;var fd=_fileno(stream);var bytesWritten=_write(fd,ptr,bytesToWrite);if(bytesWritten==-1){var streamObj=FS.getStreamFromPtr(stream);if(streamObj)streamObj.error=true;return 0}else{return bytesWritten/size|0}}function _abort(){Module["abort"]()}function __reallyNegative(x){return x<0||x===0&&1/x===-Infinity}function __formatString(format,varargs){assert((varargs&3)===0);var textIndex=format;var argIndex=0;function getNextArg(type){var ret;argIndex=Runtime.prepVararg(argIndex,type);if(type==="double"){ret=(HEAP32[tempDoublePtr>>2]=HEAP32[varargs+argIndex>>2],HEAP32[tempDoublePtr+4>>2]=HEAP32[varargs+(argIndex+4)>>2],+HEAPF64[tempDoublePtr>>3]);argIndex+=8}else if(type=="i64"){ret=[HEAP32[varargs+argIndex>>2],HEAP32[varargs+(argIndex+4)>>2]];argIndex+=8}else{assert((argIndex&3)===0);type="i32";ret=HEAP32[varargs+argIndex>>2];argIndex+=4}return ret}var ret=[];var curr,next,currArg;while(1){var startTextIndex=textIndex;curr=HEAP8[textIndex>>0];if(curr===0)break;next=HEAP8[textIndex+1>>0];if(curr==37){var flagAlwaysSigned=false;var flagLeftAlign=false;var flagAlternative=false;var flagZeroPad=false;var flagPadSign=false;flagsLoop:while(1){switch(next){case 43:flagAlwaysSigned=true;break;case 45:flagLeftAlign=true;break;case 35:flagAlternative=true;break;case 48:if(flagZeroPad){break flagsLoop}else{flagZeroPad=true;break};case 32:flagPadSign=true;break;default:break flagsLoop}textIndex++;next=HEAP8[textIndex+1>>0]}var width=0;if(next==42){width=getNextArg("i32");textIndex++;next=HEAP8[textIndex+1>>0]}else{while(next>=48&&next<=57){width=width*10+(next-48);textIndex++;next=HEAP8[textIndex+1>>0]}}var precisionSet=false,precision=-1;if(next==46){precision=0;precisionSet=true;textIndex++;next=HEAP8[textIndex+1>>0];if(next==42){precision=getNextArg("i32");textIndex++}else{while(1){var precisionChr=HEAP8[textIndex+1>>0];if(precisionChr<48||precisionChr>57)break;precision=precision*10+(precisionChr-48);textIndex++}}next=HEAP8[textIndex+1>>0]}if(precision<0){precision=6;precisionSet=false}var argSize;switch(String.fromCharCode(next)){case"h":var nextNext=HEAP8[textIndex+2>>0];if(nextNext==104){textIndex++;argSize=1}else{argSize=2}break;case"l":var nextNext=HEAP8[textIndex+2>>0];if(nextNext==108){textIndex++;argSize=8}else{argSize=4}break;case"L":case"q":case"j":argSize=8;break;case"z":case"t":case"I":argSize=4;break;default:argSize=null}if(argSize)textIndex++;next=HEAP8[textIndex+1>>0];switch(String.fromCharCode(next)){case"d":case"i":case"u":case"o":case"x":case"X":case"p":{var signed=next==100||next==105;argSize=argSize||4;var currArg=getNextArg("i"+argSize*8);var origArg=currArg;var argText;if(argSize==8){currArg=Runtime.makeBigInt(currArg[0],currArg[1],next==117)}if(argSize<=4){var limit=Math.pow(256,argSize)-1;currArg=(signed?reSign:unSign)(currArg&limit,argSize*8)}var currAbsArg=Math.abs(currArg);var prefix="";if(next==100||next==105){if(argSize==8&&i64Math)argText=i64Math.stringify(origArg[0],origArg[1],null);else argText=reSign(currArg,8*argSize,1).toString(10)}else if(next==117){if(argSize==8&&i64Math)argText=i64Math.stringify(origArg[0],origArg[1],true);else argText=unSign(currArg,8*argSize,1).toString(10);currArg=Math.abs(currArg)}else if(next==111){argText=(flagAlternative?"0":"")+currAbsArg.toString(8)}else if(next==120||next==88){prefix=flagAlternative&&currArg!=0?"0x":"";if(argSize==8&&i64Math){if(origArg[1]){argText=(origArg[1]>>>0).toString(16);var lower=(origArg[0]>>>0).toString(16);while(lower.length<8)lower="0"+lower;argText+=lower}else{argText=(origArg[0]>>>0).toString(16)}}else if(currArg<0){currArg=-currArg;argText=(currAbsArg-1).toString(16);var buffer=[];for(var i=0;i<argText.length;i++){buffer.push((15-parseInt(argText[i],16)).toString(16))}argText=buffer.join("");while(argText.length<argSize*2)argText="f"+argText}else{argText=currAbsArg.toString(16)}if(next==88){prefix=prefix.toUpperCase();argText=argText.toUpperCase()}}else if(next==112){if(currAbsArg===0){argText="(nil)"}else{prefix="0x";argText=currAbsArg.toString(16)}}if(precisionSet){while(argText.length<precision){argText="0"+argText}}if(currArg>=0){if(flagAlwaysSigned){prefix="+"+prefix}else if(flagPadSign){prefix=" "+prefix}}if(argText.charAt(0)=="-"){prefix="-"+prefix;argText=argText.substr(1)}while(prefix.length+argText.length<width){if(flagLeftAlign){argText+=" "}else{if(flagZeroPad){argText="0"+argText}else{prefix=" "+prefix}}}argText=prefix+argText;argText.split("").forEach((function(chr){ret.push(chr.charCodeAt(0))}));break};case"f":case"F":case"e":case"E":case"g":case"G":{var currArg=getNextArg("double");var argText;if(isNaN(currArg)){argText="nan";flagZeroPad=false}else if(!isFinite(currArg)){argText=(currArg<0?"-":"")+"inf";flagZeroPad=false}else{var isGeneral=false;var effectivePrecision=Math.min(precision,20);if(next==103||next==71){isGeneral=true;precision=precision||1;var exponent=parseInt(currArg.toExponential(effectivePrecision).split("e")[1],10);if(precision>exponent&&exponent>=-4){next=(next==103?"f":"F").charCodeAt(0);precision-=exponent+1}else{next=(next==103?"e":"E").charCodeAt(0);precision--}effectivePrecision=Math.min(precision,20)}if(next==101||next==69){argText=currArg.toExponential(effectivePrecision);if(/[eE][-+]\d$/.test(argText)){argText=argText.slice(0,-1)+"0"+argText.slice(-1)}}else if(next==102||next==70){argText=currArg.toFixed(effectivePrecision);if(currArg===0&&__reallyNegative(currArg)){argText="-"+argText}}var parts=argText.split("e");if(isGeneral&&!flagAlternative){while(parts[0].length>1&&parts[0].indexOf(".")!=-1&&(parts[0].slice(-1)=="0"||parts[0].slice(-1)==".")){parts[0]=parts[0].slice(0,-1)}}else{if(flagAlternative&&argText.indexOf(".")==-1)parts[0]+=".";while(precision>effectivePrecision++)parts[0]+="0"}argText=parts[0]+(parts.length>1?"e"+parts[1]:"");if(next==69)argText=argText.toUpperCase();if(currArg>=0){if(flagAlwaysSigned){argText="+"+argText}else if(flagPadSign){argText=" "+argText}}}while(argText.length<width){if(flagLeftAlign){argText+=" "}else{if(flagZeroPad&&(argText[0]=="-"||argText[0]=="+")){argText=argText[0]+"0"+argText.slice(1)}else{argText=(flagZeroPad?"0":" ")+argText}}}if(next<97)argText=argText.toUpperCase();argText.split("").forEach((function(chr){ret.push(chr.charCodeAt(0))}));break};case"s":{var arg=getNextArg("i8*");var argLength=arg?_strlen(arg):"(null)".length;if(precisionSet)argLength=Math.min(argLength,precision);if(!flagLeftAlign){while(argLength<width--){ret.push(32)}}if(arg){for(var i=0;i<argLength;i++){ret.push(HEAPU8[arg++>>0])}}else{ret=ret.concat(intArrayFromString("(null)".substr(0,argLength),true))}if(flagLeftAlign){while(argLength<width--){ret.push(32)}}break};case"c":{if(flagLeftAlign)ret.push(getNextArg("i8"));while(--width>0){ret.push(32)}if(!flagLeftAlign)ret.push(getNextArg("i8"));break};case"n":{var ptr=getNextArg("i32*");HEAP32[ptr>>2]=ret.length;break};case"%":{ret.push(curr);break};default:{for(var i=startTextIndex;i<textIndex+2;i++){ret.push(HEAP8[i>>0])}}}textIndex+=2}else{ret.push(curr);textIndex+=1}}return ret}function _fprintf(stream,format,varargs){var result=__formatString(format,varargs);var stack=Runtime.stackSave();var ret=_fwrite(allocate(result,"i8",ALLOC_STACK),1,result.length,stream);Runtime.stackRestore(stack);return ret}function _emscripten_set_main_loop_timing(mode,value){Browser.mainLoop.timingMode=mode;Browser.mainLoop.timingValue=value;if(!Browser.mainLoop.func){return 1}if(mode==0){Browser.mainLoop.scheduler=function Browser_mainLoop_scheduler(){setTimeout(Browser.mainLoop.runner,value)};Browser.mainLoop.method="timeout"}else if(mode==1){Browser.mainLoop.scheduler=function Browser_mainLoop_scheduler(){Browser.requestAnimationFrame(Browser.mainLoop.runner)};Browser.mainLoop.method="rAF"}return 0}function _emscripten_set_main_loop(func,fps,simulateInfiniteLoop,arg,noSetTiming){Module["noExitRuntime"]=true;assert(!Browser.mainLoop.func,"emscripten_set_main_loop: there can only be one main loop function at once: call emscripten_cancel_main_loop to cancel the previous one before setting a new one with different parameters.");Browser.mainLoop.func=func;Browser.mainLoop.arg=arg;var thisMainLoopId=Browser.mainLoop.currentlyRunningMainloop;Browser.mainLoop.runner=function Browser_mainLoop_runner(){if(ABORT)return;if(Browser.mainLoop.queue.length>0){var start=Date.now();var blocker=Browser.mainLoop.queue.shift();blocker.func(blocker.arg);if(Browser.mainLoop.remainingBlockers){var remaining=Browser.mainLoop.remainingBlockers;var next=remaining%1==0?remaining-1:Math.floor(remaining);if(blocker.counted){Browser.mainLoop.remainingBlockers=next}else{next=next+.5;Browser.mainLoop.remainingBlockers=(8*remaining+next)/9}}console.log('main loop blocker "'+blocker.name+'" took '+(Date.now()-start)+" ms");Browser.mainLoop.updateStatus();setTimeout(Browser.mainLoop.runner,0);return}if(thisMainLoopId<Browser.mainLoop.currentlyRunningMainloop)return;Browser.mainLoop.currentFrameNumber=Browser.mainLoop.currentFrameNumber+1|0;if(Browser.mainLoop.timingMode==1&&Browser.mainLoop.timingValue>1&&Browser.mainLoop.currentFrameNumber%Browser.mainLoop.timingValue!=0){Browser.mainLoop.scheduler();return}if(Browser.mainLoop.method==="timeout"&&Module.ctx){Module.printErr("Looks like you are rendering without using requestAnimationFrame for the main loop. You should use 0 for the frame rate in emscripten_set_main_loop in order to use requestAnimationFrame, as that can greatly improve your frame rates!");Browser.mainLoop.method=""}Browser.mainLoop.runIter((function(){if(typeof arg!=="undefined"){Runtime.dynCall("vi",func,[arg])}else{Runtime.dynCall("v",func)}}));if(thisMainLoopId<Browser.mainLoop.currentlyRunningMainloop)return;if(typeof SDL==="object"&&SDL.audio&&SDL.audio.queueNewAudioData)SDL.audio.queueNewAudioData();Browser.mainLoop.scheduler()};if(!noSetTiming){if(fps&&fps>0)_emscripten_set_main_loop_timing(0,1e3/fps);else _emscripten_set_main_loop_timing(1,1);Browser.mainLoop.scheduler()}if(simulateInfiniteLoop){throw"SimulateInfiniteLoop"}}var Browser={mainLoop:{scheduler:null,method:"",currentlyRunningMainloop:0,func:null,arg:0,timingMode:0,timingValue:0,currentFrameNumber:0,queue:[],pause:(function(){Browser.mainLoop.scheduler=null;Browser.mainLoop.currentlyRunningMainloop++}),resume:(function(){Browser.mainLoop.currentlyRunningMainloop++;var timingMode=Browser.mainLoop.timingMode;var timingValue=Browser.mainLoop.timingValue;var func=Browser.mainLoop.func;Browser.mainLoop.func=null;_emscripten_set_main_loop(func,0,false,Browser.mainLoop.arg,true);_emscripten_set_main_loop_timing(timingMode,timingValue);Browser.mainLoop.scheduler()}),updateStatus:(function(){if(Module["setStatus"]){var message=Module["statusMessage"]||"Please wait...";var remaining=Browser.mainLoop.remainingBlockers;var expected=Browser.mainLoop.expectedBlockers;if(remaining){if(remaining<expected){Module["setStatus"](message+" ("+(expected-remaining)+"/"+expected+")")}else{Module["setStatus"](message)}}else{Module["setStatus"]("")}}}),runIter:(function(func){if(ABORT)return;if(Module["preMainLoop"]){var preRet=Module["preMainLoop"]();if(preRet===false){return}}try{func()}catch(e){if(e instanceof ExitStatus){return}else{if(e&&typeof e==="object"&&e.stack)Module.printErr("exception thrown: "+[e,e.stack]);throw e}}if(Module["postMainLoop"])Module["postMainLoop"]()})},isFullScreen:false,pointerLock:false,moduleContextCreatedCallbacks:[],workers:[],init:(function(){if(!Module["preloadPlugins"])Module["preloadPlugins"]=[];if(Browser.initted)return;Browser.initted=true;try{new Blob;Browser.hasBlobConstructor=true}catch(e){Browser.hasBlobConstructor=false;console.log("warning: no blob constructor, cannot create blobs with mimetypes")}Browser.BlobBuilder=typeof MozBlobBuilder!="undefined"?MozBlobBuilder:typeof WebKitBlobBuilder!="undefined"?WebKitBlobBuilder:!Browser.hasBlobConstructor?console.log("warning: no BlobBuilder"):null;Browser.URLObject=typeof window!="undefined"?window.URL?window.URL:window.webkitURL:undefined;if(!Module.noImageDecoding&&typeof Browser.URLObject==="undefined"){console.log("warning: Browser does not support creating object URLs. Built-in browser image decoding will not be available.");Module.noImageDecoding=true}var imagePlugin={};imagePlugin["canHandle"]=function imagePlugin_canHandle(name){return!Module.noImageDecoding&&/\.(jpg|jpeg|png|bmp)$/i.test(name)};imagePlugin["handle"]=function imagePlugin_handle(byteArray,name,onload,onerror){var b=null;if(Browser.hasBlobConstructor){try{b=new Blob([byteArray],{type:Browser.getMimetype(name)});if(b.size!==byteArray.length){b=new Blob([(new Uint8Array(byteArray)).buffer],{type:Browser.getMimetype(name)})}}catch(e){Runtime.warnOnce("Blob constructor present but fails: "+e+"; falling back to blob builder")}}if(!b){var bb=new Browser.BlobBuilder;bb.append((new Uint8Array(byteArray)).buffer);b=bb.getBlob()}var url=Browser.URLObject.createObjectURL(b);var img=new Image;img.onload=function img_onload(){assert(img.complete,"Image "+name+" could not be decoded");var canvas=document.createElement("canvas");canvas.width=img.width;canvas.height=img.height;var ctx=canvas.getContext("2d");ctx.drawImage(img,0,0);Module["preloadedImages"][name]=canvas;Browser.URLObject.revokeObjectURL(url);if(onload)onload(byteArray)};img.onerror=function img_onerror(event){console.log("Image "+url+" could not be decoded");if(onerror)onerror()};img.src=url};Module["preloadPlugins"].push(imagePlugin);var audioPlugin={};audioPlugin["canHandle"]=function audioPlugin_canHandle(name){return!Module.noAudioDecoding&&name.substr(-4)in{".ogg":1,".wav":1,".mp3":1}};audioPlugin["handle"]=function audioPlugin_handle(byteArray,name,onload,onerror){var done=false;function finish(audio){if(done)return;done=true;Module["preloadedAudios"][name]=audio;if(onload)onload(byteArray)}function fail(){if(done)return;done=true;Module["preloadedAudios"][name]=new Audio;if(onerror)onerror()}if(Browser.hasBlobConstructor){try{var b=new Blob([byteArray],{type:Browser.getMimetype(name)})}catch(e){return fail()}var url=Browser.URLObject.createObjectURL(b);var audio=new Audio;audio.addEventListener("canplaythrough",(function(){finish(audio)}),false);audio.onerror=function audio_onerror(event){if(done)return;console.log("warning: browser could not fully decode audio "+name+", trying slower base64 approach");function encode64(data){var BASE="ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";var PAD="=";var ret="";var leftchar=0;var leftbits=0;for(var i=0;i<data.length;i++){leftchar=leftchar<<8|data[i];leftbits+=8;while(leftbits>=6){var curr=leftchar>>leftbits-6&63;leftbits-=6;ret+=BASE[curr]}}if(leftbits==2){ret+=BASE[(leftchar&3)<<4];ret+=PAD+PAD}else if(leftbits==4){ret+=BASE[(leftchar&15)<<2];ret+=PAD}return ret}audio.src="data:audio/x-"+name.substr(-3)+";base64,"+encode64(byteArray);finish(audio)};audio.src=url;Browser.safeSetTimeout((function(){finish(audio)}),1e4)}else{return fail()}};Module["preloadPlugins"].push(audioPlugin);var canvas=Module["canvas"];function pointerLockChange(){Browser.pointerLock=document["pointerLockElement"]===canvas||document["mozPointerLockElement"]===canvas||document["webkitPointerLockElement"]===canvas||document["msPointerLockElement"]===canvas}if(canvas){canvas.requestPointerLock=canvas["requestPointerLock"]||canvas["mozRequestPointerLock"]||canvas["webkitRequestPointerLock"]||canvas["msRequestPointerLock"]||(function(){});canvas.exitPointerLock=document["exitPointerLock"]||document["mozExitPointerLock"]||document["webkitExitPointerLock"]||document["msExitPointerLock"]||(function(){});canvas.exitPointerLock=canvas.exitPointerLock.bind(document);document.addEventListener("pointerlockchange",pointerLockChange,false);document.addEventListener("mozpointerlockchange",pointerLockChange,false);document.addEventListener("webkitpointerlockchange",pointerLockChange,false);document.addEventListener("mspointerlockchange",pointerLockChange,false);if(Module["elementPointerLock"]){canvas.addEventListener("click",(function(ev){if(!Browser.pointerLock&&canvas.requestPointerLock){canvas.requestPointerLock();ev.preventDefault()}}),false)}}}),createContext:(function(canvas,useWebGL,setInModule,webGLContextAttributes){if(useWebGL&&Module.ctx&&canvas==Module.canvas)return Module.ctx;var ctx;var contextHandle;if(useWebGL){var contextAttributes={antialias:false,alpha:false};if(webGLContextAttributes){for(var attribute in webGLContextAttributes){contextAttributes[attribute]=webGLContextAttributes[attribute]}}contextHandle=GL.createContext(canvas,contextAttributes);if(contextHandle){ctx=GL.getContext(contextHandle).GLctx}canvas.style.backgroundColor="black"}else{ctx=canvas.getContext("2d")}if(!ctx)return null;if(setInModule){if(!useWebGL)assert(typeof GLctx==="undefined","cannot set in module if GLctx is used, but we are a non-GL context that would replace it");Module.ctx=ctx;if(useWebGL)GL.makeContextCurrent(contextHandle);Module.useWebGL=useWebGL;Browser.moduleContextCreatedCallbacks.forEach((function(callback){callback()}));Browser.init()}return ctx}),destroyContext:(function(canvas,useWebGL,setInModule){}),fullScreenHandlersInstalled:false,lockPointer:undefined,resizeCanvas:undefined,requestFullScreen:(function(lockPointer,resizeCanvas,vrDevice){Browser.lockPointer=lockPointer;Browser.resizeCanvas=resizeCanvas;Browser.vrDevice=vrDevice;if(typeof Browser.lockPointer==="undefined")Browser.lockPointer=true;if(typeof Browser.resizeCanvas==="undefined")Browser.resizeCanvas=false;if(typeof Browser.vrDevice==="undefined")Browser.vrDevice=null;var canvas=Module["canvas"];function fullScreenChange(){Browser.isFullScreen=false;var canvasContainer=canvas.parentNode;if((document["webkitFullScreenElement"]||document["webkitFullscreenElement"]||document["mozFullScreenElement"]||document["mozFullscreenElement"]||document["fullScreenElement"]||document["fullscreenElement"]||document["msFullScreenElement"]||document["msFullscreenElement"]||document["webkitCurrentFullScreenElement"])===canvasContainer){canvas.cancelFullScreen=document["cancelFullScreen"]||document["mozCancelFullScreen"]||document["webkitCancelFullScreen"]||document["msExitFullscreen"]||document["exitFullscreen"]||(function(){});canvas.cancelFullScreen=canvas.cancelFullScreen.bind(document);if(Browser.lockPointer)canvas.requestPointerLock();Browser.isFullScreen=true;if(Browser.resizeCanvas)Browser.setFullScreenCanvasSize()}else{canvasContainer.parentNode.insertBefore(canvas,canvasContainer);canvasContainer.parentNode.removeChild(canvasContainer);if(Browser.resizeCanvas)Browser.setWindowedCanvasSize()}if(Module["onFullScreen"])Module["onFullScreen"](Browser.isFullScreen);Browser.updateCanvasDimensions(canvas)}if(!Browser.fullScreenHandlersInstalled){Browser.fullScreenHandlersInstalled=true;document.addEventListener("fullscreenchange",fullScreenChange,false);document.addEventListener("mozfullscreenchange",fullScreenChange,false);document.addEventListener("webkitfullscreenchange",fullScreenChange,false);document.addEventListener("MSFullscreenChange",fullScreenChange,false)}var canvasContainer=document.createElement("div");canvas.parentNode.insertBefore(canvasContainer,canvas);canvasContainer.appendChild(canvas);canvasContainer.requestFullScreen=canvasContainer["requestFullScreen"]||canvasContainer["mozRequestFullScreen"]||canvasContainer["msRequestFullscreen"]||(canvasContainer["webkitRequestFullScreen"]?(function(){canvasContainer["webkitRequestFullScreen"](Element["ALLOW_KEYBOARD_INPUT"])}):null);if(vrDevice){canvasContainer.requestFullScreen({vrDisplay:vrDevice})}else{canvasContainer.requestFullScreen()}}),nextRAF:0,fakeRequestAnimationFrame:(function(func){var now=Date.now();if(Browser.nextRAF===0){Browser.nextRAF=now+1e3/60}else{while(now+2>=Browser.nextRAF){Browser.nextRAF+=1e3/60}}var delay=Math.max(Browser.nextRAF-now,0);setTimeout(func,delay)}),requestAnimationFrame:function requestAnimationFrame(func){if(typeof window==="undefined"){Browser.fakeRequestAnimationFrame(func)}else{if(!window.requestAnimationFrame){window.requestAnimationFrame=window["requestAnimationFrame"]||window["mozRequestAnimationFrame"]||window["webkitRequestAnimationFrame"]||window["msRequestAnimationFrame"]||window["oRequestAnimationFrame"]||Browser.fakeRequestAnimationFrame}window.requestAnimationFrame(func)}},safeCallback:(function(func){return(function(){if(!ABORT)return func.apply(null,arguments)})}),allowAsyncCallbacks:true,queuedAsyncCallbacks:[],pauseAsyncCallbacks:(function(){Browser.allowAsyncCallbacks=false}),resumeAsyncCallbacks:(function(){Browser.allowAsyncCallbacks=true;if(Browser.queuedAsyncCallbacks.length>0){var callbacks=Browser.queuedAsyncCallbacks;Browser.queuedAsyncCallbacks=[];callbacks.forEach((function(func){func()}))}}),safeRequestAnimationFrame:(function(func){return Browser.requestAnimationFrame((function(){if(ABORT)return;if(Browser.allowAsyncCallbacks){func()}else{Browser.queuedAsyncCallbacks.push(func)}}))}),safeSetTimeout:(function(func,timeout){Module["noExitRuntime"]=true;return setTimeout((function(){if(ABORT)return;if(Browser.allowAsyncCallbacks){func()}else{Browser.queuedAsyncCallbacks.push(func)}}),timeout)}),safeSetInterval:(function(func,timeout){Module["noExitRuntime"]=true;return setInterval((function(){if(ABORT)return;if(Browser.allowAsyncCallbacks){func()}}),timeout)}),getMimetype:(function(name){return{"jpg":"image/jpeg","jpeg":"image/jpeg","png":"image/png","bmp":"image/bmp","ogg":"audio/ogg","wav":"audio/wav","mp3":"audio/mpeg"}[name.substr(name.lastIndexOf(".")+1)]}),getUserMedia:(function(func){if(!window.getUserMedia){window.getUserMedia=navigator["getUserMedia"]||navigator["mozGetUserMedia"]}window.getUserMedia(func)}),getMovementX:(function(event){return event["movementX"]||event["mozMovementX"]||event["webkitMovementX"]||0}),getMovementY:(function(event){return event["movementY"]||event["mozMovementY"]||event["webkitMovementY"]||0}),getMouseWheelDelta:(function(event){var delta=0;switch(event.type){case"DOMMouseScroll":delta=event.detail;break;case"mousewheel":delta=event.wheelDelta;break;case"wheel":delta=event["deltaY"];break;default:throw"unrecognized mouse wheel event: "+event.type}return delta}),mouseX:0,mouseY:0,mouseMovementX:0,mouseMovementY:0,touches:{},lastTouches:{},calculateMouseEvent:(function(event){if(Browser.pointerLock){if(event.type!="mousemove"&&"mozMovementX"in event){Browser.mouseMovementX=Browser.mouseMovementY=0}else{Browser.mouseMovementX=Browser.getMovementX(event);Browser.mouseMovementY=Browser.getMovementY(event)}if(typeof SDL!="undefined"){Browser.mouseX=SDL.mouseX+Browser.mouseMovementX;Browser.mouseY=SDL.mouseY+Browser.mouseMovementY}else{Browser.mouseX+=Browser.mouseMovementX;Browser.mouseY+=Browser.mouseMovementY}}else{var rect=Module["canvas"].getBoundingClientRect();var cw=Module["canvas"].width;var ch=Module["canvas"].height;var scrollX=typeof window.scrollX!=="undefined"?window.scrollX:window.pageXOffset;var scrollY=typeof window.scrollY!=="undefined"?window.scrollY:window.pageYOffset;if(event.type==="touchstart"||event.type==="touchend"||event.type==="touchmove"){var touch=event.touch;if(touch===undefined){return}var adjustedX=touch.pageX-(scrollX+rect.left);var adjustedY=touch.pageY-(scrollY+rect.top);adjustedX=adjustedX*(cw/rect.width);adjustedY=adjustedY*(ch/rect.height);var coords={x:adjustedX,y:adjustedY};if(event.type==="touchstart"){Browser.lastTouches[touch.identifier]=coords;Browser.touches[touch.identifier]=coords}else if(event.type==="touchend"||event.type==="touchmove"){var last=Browser.touches[touch.identifier];if(!last)last=coords;Browser.lastTouches[touch.identifier]=last;Browser.touches[touch.identifier]=coords}return}var x=event.pageX-(scrollX+rect.left);var y=event.pageY-(scrollY+rect.top);x=x*(cw/rect.width);y=y*(ch/rect.height);Browser.mouseMovementX=x-Browser.mouseX;Browser.mouseMovementY=y-Browser.mouseY;Browser.mouseX=x;Browser.mouseY=y}}),xhrLoad:(function(url,onload,onerror){var xhr=new XMLHttpRequest;xhr.open("GET",url,true);xhr.responseType="arraybuffer";xhr.onload=function xhr_onload(){if(xhr.status==200||xhr.status==0&&xhr.response){onload(xhr.response)}else{onerror()}};xhr.onerror=onerror;xhr.send(null)}),asyncLoad:(function(url,onload,onerror,noRunDep){Browser.xhrLoad(url,(function(arrayBuffer){assert(arrayBuffer,'Loading data file "'+url+'" failed (no arrayBuffer).');onload(new Uint8Array(arrayBuffer));if(!noRunDep)removeRunDependency("al "+url)}),(function(event){if(onerror){onerror()}else{throw'Loading data file "'+url+'" failed.'}}));if(!noRunDep)addRunDependency("al "+url)}),resizeListeners:[],updateResizeListeners:(function(){var canvas=Module["canvas"];Browser.resizeListeners.forEach((function(listener){listener(canvas.width,canvas.height)}))}),setCanvasSize:(function(width,height,noUpdates){var canvas=Module["canvas"];Browser.updateCanvasDimensions(canvas,width,height);if(!noUpdates)Browser.updateResizeListeners()}),windowedWidth:0,windowedHeight:0,setFullScreenCanvasSize:(function(){if(typeof SDL!="undefined"){var flags=HEAPU32[SDL.screen+Runtime.QUANTUM_SIZE*0>>2];flags=flags|8388608;HEAP32[SDL.screen+Runtime.QUANTUM_SIZE*0>>2]=flags}Browser.updateResizeListeners()}),setWindowedCanvasSize:(function(){if(typeof SDL!="undefined"){var flags=HEAPU32[SDL.screen+Runtime.QUANTUM_SIZE*0>>2];flags=flags&~8388608;HEAP32[SDL.screen+Runtime.QUANTUM_SIZE*0>>2]=flags}Browser.updateResizeListeners()}),updateCanvasDimensions:(function(canvas,wNative,hNative){if(wNative&&hNative){canvas.widthNative=wNative;canvas.heightNative=hNative}else{wNative=canvas.widthNative;hNative=canvas.heightNative}var w=wNative;var h=hNative;if(Module["forcedAspectRatio"]&&Module["forcedAspectRatio"]>0){if(w/h<Module["forcedAspectRatio"]){w=Math.round(h*Module["forcedAspectRatio"])}else{h=Math.round(w/Module["forcedAspectRatio"])}}if((document["webkitFullScreenElement"]||document["webkitFullscreenElement"]||document["mozFullScreenElement"]||document["mozFullscreenElement"]||document["fullScreenElement"]||document["fullscreenElement"]||document["msFullScreenElement"]||document["msFullscreenElement"]||document["webkitCurrentFullScreenElement"])===canvas.parentNode&&typeof screen!="undefined"){var factor=Math.min(screen.width/w,screen.height/h);w=Math.round(w*factor);h=Math.round(h*factor)}if(Browser.resizeCanvas){if(canvas.width!=w)canvas.width=w;if(canvas.height!=h)canvas.height=h;if(typeof canvas.style!="undefined"){canvas.style.removeProperty("width");canvas.style.removeProperty("height")}}else{if(canvas.width!=wNative)canvas.width=wNative;if(canvas.height!=hNative)canvas.height=hNative;if(typeof canvas.style!="undefined"){if(w!=wNative||h!=hNative){canvas.style.setProperty("width",w+"px","important");canvas.style.setProperty("height",h+"px","important")}else{canvas.style.removeProperty("width");canvas.style.removeProperty("height")}}}}),wgetRequests:{},nextWgetRequestHandle:0,getNextWgetRequestHandle:(function(){var handle=Browser.nextWgetRequestHandle;Browser.nextWgetRequestHandle++;return handle})};var EmterpreterAsync={initted:false,state:0,saveStack:"",yieldCallbacks:[],postAsync:null,asyncFinalizers:[],ensureInit:(function(){if(this.initted)return;this.initted=true}),setState:(function(s){this.ensureInit();this.state=s;asm.setAsyncState(s)}),handle:(function(doAsyncOp,yieldDuring){Module["noExitRuntime"]=true;if(EmterpreterAsync.state===0){var stack=new Int32Array(HEAP32.subarray(EMTSTACKTOP>>2,asm.emtStackSave()>>2));var stacktop=asm.stackSave();var resumedCallbacksForYield=false;function resumeCallbacksForYield(){if(resumedCallbacksForYield)return;resumedCallbacksForYield=true;EmterpreterAsync.yieldCallbacks.forEach((function(func){func()}));Browser.resumeAsyncCallbacks()}var callingDoAsyncOp=1;doAsyncOp(function resume(post){if(callingDoAsyncOp){assert(callingDoAsyncOp===1);callingDoAsyncOp++;setTimeout((function(){resume(post)}),0);return}assert(EmterpreterAsync.state===1||EmterpreterAsync.state===3);EmterpreterAsync.setState(3);if(yieldDuring){resumeCallbacksForYield()}HEAP32.set(stack,EMTSTACKTOP>>2);EmterpreterAsync.setState(2);if(Browser.mainLoop.func){Browser.mainLoop.resume()}assert(!EmterpreterAsync.postAsync);EmterpreterAsync.postAsync=post||null;asm.emterpret(stack[0]);if(!yieldDuring&&EmterpreterAsync.state===0){Browser.resumeAsyncCallbacks()}if(EmterpreterAsync.state===0){EmterpreterAsync.asyncFinalizers.forEach((function(func){func()}));EmterpreterAsync.asyncFinalizers.length=0}});callingDoAsyncOp=0;EmterpreterAsync.setState(1);if(Browser.mainLoop.func){Browser.mainLoop.pause()}if(yieldDuring){setTimeout((function(){resumeCallbacksForYield()}),0)}else{Browser.pauseAsyncCallbacks()}}else{assert(EmterpreterAsync.state===2);EmterpreterAsync.setState(0);if(EmterpreterAsync.postAsync){var ret=EmterpreterAsync.postAsync();EmterpreterAsync.postAsync=null;return ret}}})};function _emscripten_sleep(ms){EmterpreterAsync.handle((function(resume){setTimeout((function(){if(ABORT)return;resume()}),ms)}))}function _printf(format,varargs){var stdout=HEAP32[_stdout>>2];return _fprintf(stdout,format,varargs)}function _close(fildes){var stream=FS.getStream(fildes);if(!stream){___setErrNo(ERRNO_CODES.EBADF);return-1}try{FS.close(stream);return 0}catch(e){FS.handleFSError(e);return-1}}var _fabs=Math_abs;function _open(path,oflag,varargs){var mode=HEAP32[varargs>>2];path=Pointer_stringify(path);try{var stream=FS.open(path,oflag,mode);return stream.fd}catch(e){FS.handleFSError(e);return-1}}Module["_strncpy"]=_strncpy;function _usleep(useconds){var msec=useconds/1e3;if((ENVIRONMENT_IS_WEB||ENVIRONMENT_IS_WORKER)&&self["performance"]&&self["performance"]["now"]){var start=self["performance"]["now"]();while(self["performance"]["now"]()-start<msec){}}else{var start=Date.now();while(Date.now()-start<msec){}}return 0}function _fputc(c,stream){var chr=unSign(c&255);HEAP8[_fputc.ret>>0]=chr;var fd=_fileno(stream);var ret=_write(fd,_fputc.ret,1);if(ret==-1){var streamObj=FS.getStreamFromPtr(stream);if(streamObj)streamObj.error=true;return-1}else{return chr}}var _emscripten_asm_const=true;Module["_i64Add"]=_i64Add;function _fputs(s,stream){var fd=_fileno(stream);return _write(fd,s,_strlen(s))}function _puts(s){var stdout=HEAP32[_stdout>>2];var ret=_fputs(s,stdout);if(ret<0){return ret}else{var newlineRet=_fputc(10,stdout);return newlineRet<0?-1:ret+1}}var _sqrt=Math_sqrt;var _sin=Math_sin;function _stat(path,buf,dontResolveLastLink){path=typeof path!=="string"?Pointer_stringify(path):path;try{var stat=dontResolveLastLink?FS.lstat(path):FS.stat(path);HEAP32[buf>>2]=stat.dev;HEAP32[buf+4>>2]=0;HEAP32[buf+8>>2]=stat.ino;HEAP32[buf+12>>2]=stat.mode;HEAP32[buf+16>>2]=stat.nlink;HEAP32[buf+20>>2]=stat.uid;HEAP32[buf+24>>2]=stat.gid;HEAP32[buf+28>>2]=stat.rdev;HEAP32[buf+32>>2]=0;HEAP32[buf+36>>2]=stat.size;HEAP32[buf+40>>2]=4096;HEAP32[buf+44>>2]=stat.blocks;HEAP32[buf+48>>2]=stat.atime.getTime()/1e3|0;HEAP32[buf+52>>2]=0;HEAP32[buf+56>>2]=stat.mtime.getTime()/1e3|0;HEAP32[buf+60>>2]=0;HEAP32[buf+64>>2]=stat.ctime.getTime()/1e3|0;HEAP32[buf+68>>2]=0;HEAP32[buf+72>>2]=stat.ino;return 0}catch(e){if(e.node&&PATH.normalize(path)!==PATH.normalize(FS.getPath(e.node))){e.setErrno(ERRNO_CODES.ENOTDIR)}FS.handleFSError(e);return-1}}Module["_bitshift64Lshr"]=_bitshift64Lshr;function _recv(fd,buf,len,flags){var sock=SOCKFS.getSocket(fd);if(!sock){___setErrNo(ERRNO_CODES.EBADF);return-1}return _read(fd,buf,len)}function _pread(fildes,buf,nbyte,offset){var stream=FS.getStream(fildes);if(!stream){___setErrNo(ERRNO_CODES.EBADF);return-1}try{var slab=HEAP8;return FS.read(stream,slab,buf,nbyte,offset)}catch(e){FS.handleFSError(e);return-1}}function _read(fildes,buf,nbyte){var stream=FS.getStream(fildes);if(!stream){___setErrNo(ERRNO_CODES.EBADF);return-1}try{var slab=HEAP8;return FS.read(stream,slab,buf,nbyte)}catch(e){FS.handleFSError(e);return-1}}var _BDtoIHigh=true;function _getcwd(buf,size){if(size==0){___setErrNo(ERRNO_CODES.EINVAL);return 0}var cwd=FS.cwd();if(size<cwd.length+1){___setErrNo(ERRNO_CODES.ERANGE);return 0}else{writeAsciiToMemory(cwd,buf);return buf}}var _environ=allocate(1,"i32*",ALLOC_STATIC);var ___environ=_environ;function ___buildEnvironment(env){var MAX_ENV_VALUES=64;var TOTAL_ENV_SIZE=1024;var poolPtr;var envPtr;if(!___buildEnvironment.called){___buildEnvironment.called=true;ENV["USER"]="web_user";ENV["PATH"]="/";ENV["PWD"]="/";ENV["HOME"]="/home/web_user";ENV["LANG"]="C";ENV["_"]=Module["thisProgram"];poolPtr=allocate(TOTAL_ENV_SIZE,"i8",ALLOC_STATIC);envPtr=allocate(MAX_ENV_VALUES*4,"i8*",ALLOC_STATIC);HEAP32[envPtr>>2]=poolPtr;HEAP32[_environ>>2]=envPtr}else{envPtr=HEAP32[_environ>>2];poolPtr=HEAP32[envPtr>>2]}var strings=[];var totalSize=0;for(var key in env){if(typeof env[key]==="string"){var line=key+"="+env[key];strings.push(line);totalSize+=line.length}}if(totalSize>TOTAL_ENV_SIZE){throw new Error("Environment size exceeded TOTAL_ENV_SIZE!")}var ptrSize=4;for(var i=0;i<strings.length;i++){var line=strings[i];writeAsciiToMemory(line,poolPtr);HEAP32[envPtr+i*ptrSize>>2]=poolPtr;poolPtr+=line.length+1}HEAP32[envPtr+strings.length*ptrSize>>2]=0}var ENV={};function _getenv(name){if(name===0)return 0;name=Pointer_stringify(name);if(!ENV.hasOwnProperty(name))return 0;if(_getenv.ret)_free(_getenv.ret);_getenv.ret=allocate(intArrayFromString(ENV[name]),"i8",ALLOC_NORMAL);return _getenv.ret}var _emscripten_asm_const_int=true;function _vfprintf(s,f,va_arg){return _fprintf(s,f,HEAP32[va_arg>>2])}function _getuid(){return 0}function _emscripten_memcpy_big(dest,src,num){HEAPU8.set(HEAPU8.subarray(src,src+num),dest);return dest}Module["_memcpy"]=_memcpy;var _cos=Math_cos;function _putchar(c){return _fputc(c,HEAP32[_stdout>>2])}var _llvm_pow_f64=Math_pow;function _sbrk(bytes){var self=_sbrk;if(!self.called){DYNAMICTOP=alignMemoryPage(DYNAMICTOP);self.called=true;assert(Runtime.dynamicAlloc);self.alloc=Runtime.dynamicAlloc;Runtime.dynamicAlloc=(function(){abort("cannot dynamically allocate, sbrk now has control")})}var ret=DYNAMICTOP;if(bytes!=0){var success=self.alloc(bytes);if(!success)return-1>>>0}return ret}var _llvm_pow_f32=Math_pow;function ___errno_location(){return ___errno_state}var _BItoD=true;Module["_strcpy"]=_strcpy;var _exp=Math_exp;function _time(ptr){var ret=Date.now()/1e3|0;if(ptr){HEAP32[ptr>>2]=ret}return ret}function _getpwuid(uid){return 0}FS.staticInit();__ATINIT__.unshift((function(){if(!Module["noFSInit"]&&!FS.init.initialized)FS.init()}));__ATMAIN__.push((function(){FS.ignorePermissions=false}));__ATEXIT__.push((function(){FS.quit()}));Module["FS_createFolder"]=FS.createFolder;Module["FS_createPath"]=FS.createPath;Module["FS_createDataFile"]=FS.createDataFile;Module["FS_createPreloadedFile"]=FS.createPreloadedFile;Module["FS_createLazyFile"]=FS.createLazyFile;Module["FS_createLink"]=FS.createLink;Module["FS_createDevice"]=FS.createDevice;___errno_state=Runtime.staticAlloc(4);HEAP32[___errno_state>>2]=0;__ATINIT__.unshift((function(){TTY.init()}));__ATEXIT__.push((function(){TTY.shutdown()}));if(ENVIRONMENT_IS_NODE){var fs=require("fs");var NODEJS_PATH=require("path");NODEFS.staticInit()}__ATINIT__.push((function(){SOCKFS.root=FS.mount(SOCKFS,{},null)}));Module["requestFullScreen"]=function Module_requestFullScreen(lockPointer,resizeCanvas,vrDevice){Browser.requestFullScreen(lockPointer,resizeCanvas,vrDevice)};Module["requestAnimationFrame"]=function Module_requestAnimationFrame(func){Browser.requestAnimationFrame(func)};Module["setCanvasSize"]=function Module_setCanvasSize(width,height,noUpdates){Browser.setCanvasSize(width,height,noUpdates)};Module["pauseMainLoop"]=function Module_pauseMainLoop(){Browser.mainLoop.pause()};Module["resumeMainLoop"]=function Module_resumeMainLoop(){Browser.mainLoop.resume()};Module["getUserMedia"]=function Module_getUserMedia(){Browser.getUserMedia()};Module["createContext"]=function Module_createContext(canvas,useWebGL,setInModule,webGLContextAttributes){return Browser.createContext(canvas,useWebGL,setInModule,webGLContextAttributes)};_fputc.ret=allocate([0],"i8",ALLOC_STATIC);___buildEnvironment(ENV);STACK_BASE=STACKTOP=Runtime.alignMemory(STATICTOP);staticSealed=true;STACK_MAX=STACK_BASE+TOTAL_STACK;DYNAMIC_BASE=DYNAMICTOP=Runtime.alignMemory(STACK_MAX);assert(DYNAMIC_BASE<TOTAL_MEMORY,"TOTAL_MEMORY not big enough for stack");var cttz_i8=allocate([8,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,5,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,6,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,5,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,7,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,5,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,6,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,5,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0,4,0,1,0,2,0,1,0,3,0,1,0,2,0,1,0],"i8",ALLOC_DYNAMIC);function invoke_iiii(index,a1,a2,a3){try{return Module["dynCall_iiii"](index,a1,a2,a3)}catch(e){if(typeof e!=="number"&&e!=="longjmp")throw e;asm["setThrew"](1,0)}}function invoke_vii(index,a1,a2){try{Module["dynCall_vii"](index,a1,a2)}catch(e){if(typeof e!=="number"&&e!=="longjmp")throw e;asm["setThrew"](1,0)}}function invoke_iii(index,a1,a2){try{return Module["dynCall_iii"](index,a1,a2)}catch(e){if(typeof e!=="number"&&e!=="longjmp")throw e;asm["setThrew"](1,0)}}Module.asmGlobalArg={"Math":Math,"Int8Array":Int8Array,"Int16Array":Int16Array,"Int32Array":Int32Array,"Uint8Array":Uint8Array,"Uint16Array":Uint16Array,"Uint32Array":Uint32Array,"Float32Array":Float32Array,"Float64Array":Float64Array,"NaN":NaN,"Infinity":Infinity};Module.asmLibraryArg={"abort":abort,"assert":assert,"invoke_iiii":invoke_iiii,"invoke_vii":invoke_vii,"invoke_iii":invoke_iii,"_fabs":_fabs,"_sin":_sin,"_exp":_exp,"_getuid":_getuid,"_llvm_pow_f64":_llvm_pow_f64,"_send":_send,"_getcwd":_getcwd,"_lseek":_lseek,"_open":_open,"_vfprintf":_vfprintf,"_emscripten_set_main_loop_timing":_emscripten_set_main_loop_timing,"_usleep":_usleep,"___buildEnvironment":___buildEnvironment,"_fflush":_fflush,"_pwrite":_pwrite,"_strerror_r":_strerror_r,"__reallyNegative":__reallyNegative,"_sbrk":_sbrk,"_llvm_pow_f32":_llvm_pow_f32,"_emscripten_memcpy_big":_emscripten_memcpy_big,"_fileno":_fileno,"_sysconf":_sysconf,"___setErrNo":___setErrNo,"_putchar":_putchar,"_cos":_cos,"_pread":_pread,"_puts":_puts,"_getenv":_getenv,"_write":_write,"_emscripten_set_main_loop":_emscripten_set_main_loop,"___errno_location":___errno_location,"_stat":_stat,"_recv":_recv,"_emscripten_sleep":_emscripten_sleep,"_getpwuid":_getpwuid,"_mkport":_mkport,"_read":_read,"_fputc":_fputc,"_abort":_abort,"_fwrite":_fwrite,"_time":_time,"_fprintf":_fprintf,"_strerror":_strerror,"__formatString":__formatString,"_fputs":_fputs,"_sqrt":_sqrt,"_printf":_printf,"_close":_close,"_emscripten_asm_const_3":_emscripten_asm_const_3,"_emscripten_asm_const_2":_emscripten_asm_const_2,"_emscripten_asm_const_0":_emscripten_asm_const_0,"STACKTOP":STACKTOP,"STACK_MAX":STACK_MAX,"tempDoublePtr":tempDoublePtr,"ABORT":ABORT,"cttz_i8":cttz_i8,"_stderr":_stderr};Module.asmLibraryArg["EMTSTACKTOP"]=EMTSTACKTOP;Module.asmLibraryArg["EMT_STACK_MAX"]=EMT_STACK_MAX;Module.asmLibraryArg["eb"]=eb;// EMSCRIPTEN_START_ASM
-var asm=(function(global,env,buffer) {
-"use asm";var a=new global.Int8Array(buffer);var b=new global.Int16Array(buffer);var c=new global.Int32Array(buffer);var d=new global.Uint8Array(buffer);var e=new global.Uint16Array(buffer);var f=new global.Uint32Array(buffer);var g=new global.Float32Array(buffer);var h=new global.Float64Array(buffer);var i=env.STACKTOP|0;var j=env.STACK_MAX|0;var k=env.tempDoublePtr|0;var l=env.ABORT|0;var m=env.cttz_i8|0;var n=env._stderr|0;var o=0;var p=0;var q=0;var r=0;var s=global.NaN,t=global.Infinity;var u=0,v=0,w=0,x=0,y=0.0,z=0,A=0,B=0,C=0.0;var D=0;var E=0;var F=0;var G=0;var H=0;var I=0;var J=0;var K=0;var L=0;var M=0;var N=global.Math.floor;var O=global.Math.abs;var P=global.Math.sqrt;var Q=global.Math.pow;var R=global.Math.cos;var S=global.Math.sin;var T=global.Math.tan;var U=global.Math.acos;var V=global.Math.asin;var W=global.Math.atan;var X=global.Math.atan2;var Y=global.Math.exp;var Z=global.Math.log;var _=global.Math.ceil;var $=global.Math.imul;var aa=global.Math.min;var ba=global.Math.clz32;var ca=env.abort;var da=env.assert;var ea=env.invoke_iiii;var fa=env.invoke_vii;var ga=env.invoke_iii;var ha=env._fabs;var ia=env._sin;var ja=env._exp;var ka=env._getuid;var la=env._llvm_pow_f64;var ma=env._send;var na=env._getcwd;var oa=env._lseek;var pa=env._open;var qa=env._vfprintf;var ra=env._emscripten_set_main_loop_timing;var sa=env._usleep;var ta=env.___buildEnvironment;var ua=env._fflush;var va=env._pwrite;var wa=env._strerror_r;var xa=env.__reallyNegative;var ya=env._sbrk;var za=env._llvm_pow_f32;var Aa=env._emscripten_memcpy_big;var Ba=env._fileno;var Ca=env._sysconf;var Da=env.___setErrNo;var Ea=env._putchar;var Fa=env._cos;var Ga=env._pread;var Ha=env._puts;var Ia=env._getenv;var Ja=env._write;var Ka=env._emscripten_set_main_loop;var La=env.___errno_location;var Ma=env._stat;var Na=env._recv;var Oa=env._emscripten_sleep;var Pa=env._getpwuid;var Qa=env._mkport;var Ra=env._read;var Sa=env._fputc;var Ta=env._abort;var Ua=env._fwrite;var Va=env._time;var Wa=env._fprintf;var Xa=env._strerror;var Ya=env.__formatString;var Za=env._fputs;var _a=env._sqrt;var $a=env._printf;var ab=env._close;var bb=env._emscripten_asm_const_3;var cb=env._emscripten_asm_const_2;var db=env._emscripten_asm_const_0;var eb=0.0;var fb=0;var gb=env.EMTSTACKTOP|0;var hb=env.EMT_STACK_MAX|0;var ib=env.eb|0;
-// EMSCRIPTEN_START_FUNCS
-function mb(b){b=b|0;var f=0,g=0,h=0,j=0,k=0,l=0.0;c[gb>>2]=b;f=gb+8|0;h=e[b+2>>1]|0;gb=gb+(h+1<<3)|0;if((fb|0)!=2){}else{b=(c[f-4>>2]|0)-8|0}b=b+4|0;while(1){b=b+4|0;g=c[b>>2]|0;h=g>>8&255;j=g>>16&255;k=g>>>24;switch(g&255){case 0:c[f+(h<<3)>>2]=c[f+(j<<3)>>2]|0;break;case 1:c[f+(h<<3)>>2]=g>>16;break;case 2:b=b+4|0;c[f+(h<<3)>>2]=c[b>>2]|0;break;case 3:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)+(c[f+(k<<3)>>2]|0)|0;break;case 4:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)-(c[f+(k<<3)>>2]|0)|0;break;case 7:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]>>>0)/(c[f+(k<<3)>>2]>>>0)>>>0;break;case 9:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]>>>0)%(c[f+(k<<3)>>2]>>>0)>>>0;break;case 15:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)<(c[f+(k<<3)>>2]|0)|0;break;case 19:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)&(c[f+(k<<3)>>2]|0);break;case 25:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)+(g>>24)|0;break;case 32:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)==g>>24|0;break;case 33:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)!=g>>24|0;break;case 34:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)<g>>24|0;break;case 38:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)&g>>24;break;case 41:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)<<k;break;case 43:c[f+(h<<3)>>2]=(c[f+(j<<3)>>2]|0)>>>k;break;case 45:if((c[f+(j<<3)>>2]|0)==(c[f+(k<<3)>>2]|0)){b=b+4|0}else{b=c[b+4>>2]|0;b=b-4|0;continue}break;case 47:if((c[f+(j<<3)>>2]|0)<(c[f+(k<<3)>>2]|0)){b=b+4|0}else{b=c[b+4>>2]|0;b=b-4|0;continue}break;case 48:if(c[f+(j<<3)>>2]>>>0<c[f+(k<<3)>>2]>>>0){b=b+4|0}else{b=c[b+4>>2]|0;b=b-4|0;continue}break;case 49:if((c[f+(j<<3)>>2]|0)<=(c[f+(k<<3)>>2]|0)){b=b+4|0}else{b=c[b+4>>2]|0;b=b-4|0;continue}break;case 54:if((c[f+(j<<3)>>2]|0)<(c[f+(k<<3)>>2]|0)){b=c[b+4>>2]|0;b=b-4|0;continue}else{b=b+4|0}break;case 78:c[f+(h<<3)>>2]=a[c[f+(j<<3)>>2]>>0];break;case 82:c[f+(h<<3)>>2]=c[c[f+(j<<3)>>2]>>2];break;case 83:a[c[f+(h<<3)>>2]>>0]=c[f+(j<<3)>>2]|0;break;case 85:c[c[f+(h<<3)>>2]>>2]=c[f+(j<<3)>>2]|0;break;case 106:c[f+(h<<3)>>2]=c[(c[f+(j<<3)>>2]|0)+(g>>24)>>2];break;case 107:a[(c[f+(h<<3)>>2]|0)+(j<<24>>24)>>0]=c[f+(k<<3)>>2]|0;break;case 109:c[(c[f+(h<<3)>>2]|0)+(j<<24>>24)>>2]=c[f+(k<<3)>>2]|0;break;case 119:b=b+(g>>16<<2)|0;b=b-4|0;continue;break;case 120:if(c[f+(h<<3)>>2]|0){b=b+(g>>16<<2)|0;b=b-4|0;continue}break;case 121:if(!(c[f+(h<<3)>>2]|0)){b=b+(g>>16<<2)|0;b=b-4|0;continue}break;case 130:switch(j|0){case 0:{c[f+(h<<3)>>2]=n;continue}default:}break;case 135:switch(g>>>16|0){case 0:{c[f-4>>2]=b;k=Ha(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 1:{c[f-4>>2]=b;k=pa(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 2:{c[f-4>>2]=b;k=La()|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;continue}case 3:{c[f-4>>2]=b;k=Xa(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 4:{c[f-4>>2]=b;k=Wa(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 5:{c[f-4>>2]=b;k=Ja(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 6:{c[f-4>>2]=b;k=ab(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 7:{c[f-4>>2]=b;k=$a(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 8:{c[f-4>>2]=b;db(c[f+(d[b+4>>0]<<3)>>2]|0);if((fb|0)==1){gb=f-8|0;return};b=b+4|0;continue}case 9:{c[f-4>>2]=b;k=Qe()|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;continue}case 10:{c[f-4>>2]=b;k=Gc(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 11:{c[f-4>>2]=b;k=pb(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 12:{c[f-4>>2]=b;k=Ua(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0,c[f+(d[b+7>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 13:{c[f-4>>2]=b;k=Fc()|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;continue}case 14:{c[f-4>>2]=b;k=md(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 15:{c[f-4>>2]=b;ge();if((fb|0)==1){gb=f-8|0;return};continue}case 16:{c[f-4>>2]=b;k=$b(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 17:{c[f-4>>2]=b;k=Oe()|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;continue}case 18:{c[f-4>>2]=b;k=bc(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 19:{c[f-4>>2]=b;k=wc(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 20:{c[f-4>>2]=b;k=Sa(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 21:{c[f-4>>2]=b;k=db(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 22:{c[f-4>>2]=b;k=Pb(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 23:{c[f-4>>2]=b;Oa(c[f+(d[b+4>>0]<<3)>>2]|0);if((fb|0)==1){gb=f-8|0;return};b=b+4|0;continue}case 24:{c[f-4>>2]=b;k=rb(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 25:{c[f-4>>2]=b;k=bb(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0,c[f+(d[b+7>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 26:{c[f-4>>2]=b;k=lb[c[f+(d[b+4>>0]<<3)>>2]&31](c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 27:{c[f-4>>2]=b;k=Ea(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 28:{c[f-4>>2]=b;k=hc(c[f+(d[b+4>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 29:{c[f-4>>2]=b;k=$c(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 30:{c[f-4>>2]=b;k=oa(c[f+(d[b+4>>0]<<3)>>2]|0,c[f+(d[b+5>>0]<<3)>>2]|0,c[f+(d[b+6>>0]<<3)>>2]|0)|0;if((fb|0)==1){gb=f-8|0;return}else c[f+(h<<3)>>2]=k;b=b+4|0;continue}case 31:{c[f-4>>2]=b;vb(c[f+(d[b+4>>0]<<3)>>2]|0);if((fb|0)==1){gb=f-8|0;return};b=b+4|0;continue}default:}break;case 136:c[f+(h<<3)>>2]=i;break;case 137:i=c[f+(h<<3)>>2]|0;break;case 139:gb=f-8|0;c[gb>>2]=c[f+(h<<3)>>2]|0;c[gb+4>>2]=c[f+(h<<3)+4>>2]|0;return;break;default:}}}function nb(e,f,g,j,l){e=e|0;f=f|0;g=g|0;j=j|0;l=l|0;var m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0,S=0,T=0,U=0,V=0,W=0,X=0,Y=0,Z=0,_=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0,Fa=0,Ga=0,Ha=0,Ia=0,Ja=0,Ka=0,Ma=0,Na=0,Oa=0.0,Pa=0.0,Qa=0,Ra=0,Sa=0,Ta=0,Ua=0.0,Va=0,Wa=0.0,Ya=0.0,Za=0.0,_a=0,$a=0,ab=0,bb=0,cb=0,db=0,eb=0,fb=0,gb=0,hb=0,ib=0,jb=0,kb=0,lb=0,mb=0,nb=0,ob=0,pb=0,qb=0,rb=0,sb=0,tb=0.0,ub=0,vb=0,wb=0,xb=0,yb=0,zb=0,Ab=0,Bb=0,Cb=0,Db=0,Eb=0,Fb=0,Gb=0,Hb=0,Ib=0,Jb=0,Kb=0,Lb=0,Mb=0,Nb=0,Ob=0,Pb=0,Qb=0,Rb=0,Sb=0,Tb=0,Ub=0,Vb=0,Wb=0.0,Yb=0.0,Zb=0.0,_b=0,$b=0,ac=0,bc=0,cc=0,ec=0,fc=0,gc=0,hc=0,ic=0,jc=0,kc=0,lc=0,mc=0,nc=0,oc=0,pc=0,qc=0,rc=0,sc=0,tc=0,uc=0,vc=0,wc=0,xc=0,yc=0,zc=0,Ac=0,Bc=0,Cc=0,Dc=0,Ec=0,Fc=0,Gc=0,Hc=0,Ic=0,Jc=0,Kc=0,Lc=0,Mc=0,Nc=0,Oc=0,Pc=0,Qc=0,Rc=0,Sc=0,Tc=0,Uc=0,Vc=0,Wc=0,Xc=0,Yc=0,Zc=0,_c=0,ad=0,bd=0,cd=0,dd=0,ed=0,fd=0,gd=0,hd=0,id=0,jd=0,kd=0,ld=0,md=0,nd=0,od=0,pd=0,qd=0,rd=0,sd=0,td=0,ud=0,wd=0,xd=0,yd=0,zd=0,Ad=0,Bd=0,Cd=0,Ed=0,Fd=0,Gd=0,Hd=0,Id=0,Jd=0,Kd=0,Md=0,Nd=0,Qd=0,Rd=0,Sd=0;m=0;m=0;n=i;i=i+864|0;o=n+16|0;p=n+8|0;q=n+560|0;r=q;s=n+840|0;t=n+584|0;u=n+520|0;v=n;w=n+852|0;x=(e|0)!=0;y=u+40|0;z=y;A=u+39|0;u=v+4|0;B=v;C=s+12|0;E=s+11|0;s=C;F=s-r|0;G=-2-r|0;H=s+2|0;I=o+288|0;J=q+9|0;K=J;L=q+8|0;M=0;N=0;O=0;P=f;f=0;Q=0;a:while(1){do if((O|0)>-1)if((f|0)>(2147483647-O|0)){c[(La()|0)>>2]=75;R=-1;break}else{R=f+O|0;break}else R=O;while(0);S=a[P>>0]|0;if(!(S<<24>>24)){T=R;U=Q;m=344;break}else{V=S;W=P}while(1){if(!(V<<24>>24)){X=W;Y=W;break}else if(V<<24>>24==37){Z=W;_=W;m=9;break}S=W+1|0;V=a[S>>0]|0;W=S}b:do if((m|0)==9)while(1){m=0;if((a[Z+1>>0]|0)!=37){X=Z;Y=_;break b}S=_+1|0;aa=Z+2|0;if((a[aa>>0]|0)==37){Z=aa;_=S;m=9}else{X=aa;Y=S;break}}while(0);S=Y-P|0;if(x)dc(P,S,e)|0;if((Y|0)!=(P|0)){O=R;P=X;f=S;continue}aa=X+1|0;ba=a[aa>>0]|0;ca=(ba<<24>>24)+-48|0;if(ca>>>0<10){da=(a[X+2>>0]|0)==36;ea=da?X+3|0:aa;fa=a[ea>>0]|0;ga=da?ca:-1;ha=da?1:Q;ia=ea}else{fa=ba;ga=-1;ha=Q;ia=aa}aa=fa<<24>>24;c:do if((aa&-32|0)==32){ba=aa;ea=fa;da=0;ca=ia;while(1){if(!(1<<ba+-32&75913)){ja=ea;ka=da;la=ca;break c}ma=1<<(ea<<24>>24)+-32|da;na=ca+1|0;oa=a[na>>0]|0;ba=oa<<24>>24;if((ba&-32|0)!=32){ja=oa;ka=ma;la=na;break}else{ea=oa;da=ma;ca=na}}}else{ja=fa;ka=0;la=ia}while(0);do if(ja<<24>>24==42){aa=la+1|0;ca=(a[aa>>0]|0)+-48|0;if(ca>>>0<10)if((a[la+2>>0]|0)==36){c[l+(ca<<2)>>2]=10;pa=1;qa=la+3|0;ra=c[j+((a[aa>>0]|0)+-48<<3)>>2]|0}else m=23;else m=23;if((m|0)==23){m=0;if(ha){sa=-1;m=363;break a}if(!x){ta=ka;ua=aa;va=0;wa=0;break}ca=(c[g>>2]|0)+(4-1)&~(4-1);da=c[ca>>2]|0;c[g>>2]=ca+4;pa=0;qa=aa;ra=da}if((ra|0)<0){ta=ka|8192;ua=qa;va=pa;wa=0-ra|0}else{ta=ka;ua=qa;va=pa;wa=ra}}else{da=(ja<<24>>24)+-48|0;if(da>>>0<10){aa=la;ca=0;ea=da;while(1){da=(ca*10|0)+ea|0;ba=aa+1|0;ea=(a[ba>>0]|0)+-48|0;if(ea>>>0>=10){xa=da;ya=ba;break}else{aa=ba;ca=da}}if((xa|0)<0){sa=-1;m=363;break a}else{ta=ka;ua=ya;va=ha;wa=xa}}else{ta=ka;ua=la;va=ha;wa=0}}while(0);d:do if((a[ua>>0]|0)==46){ca=ua+1|0;aa=a[ca>>0]|0;if(aa<<24>>24!=42){ea=(aa<<24>>24)+-48|0;if(ea>>>0<10){za=ca;Aa=0;Ba=ea}else{Ca=ca;Da=0;break}while(1){ca=(Aa*10|0)+Ba|0;ea=za+1|0;Ba=(a[ea>>0]|0)+-48|0;if(Ba>>>0>=10){Ca=ea;Da=ca;break d}else{za=ea;Aa=ca}}}ca=ua+2|0;ea=(a[ca>>0]|0)+-48|0;if(ea>>>0<10)if((a[ua+3>>0]|0)==36){c[l+(ea<<2)>>2]=10;Ca=ua+4|0;Da=c[j+((a[ca>>0]|0)+-48<<3)>>2]|0;break}if(va){sa=-1;m=363;break a}if(x){ea=(c[g>>2]|0)+(4-1)&~(4-1);aa=c[ea>>2]|0;c[g>>2]=ea+4;Ca=ca;Da=aa}else{Ca=ca;Da=0}}else{Ca=ua;Da=-1}while(0);ca=Ca;aa=0;while(1){ea=(a[ca>>0]|0)+-65|0;if(ea>>>0>57){sa=-1;m=363;break a}da=ca+1|0;ba=a[39864+(aa*58|0)+ea>>0]|0;ea=ba&255;if((ea+-1|0)>>>0<8){ca=da;aa=ea}else{Ea=da;Fa=ba;Ga=ea;Ha=ca;Ia=aa;break}}if(!(Fa<<24>>24)){sa=-1;m=363;break}aa=(ga|0)>-1;e:do if(Fa<<24>>24==19)if(aa){sa=-1;m=363;break a}else{Ja=M;Ka=N;m=62}else{if(aa){c[l+(ga<<2)>>2]=Ga;ca=j+(ga<<3)|0;Ja=c[ca+4>>2]|0;Ka=c[ca>>2]|0;m=62;break}if(!x){sa=0;m=363;break a}if((Fa&255)>20){Ma=N;Na=M}else do switch(Ga|0){case 18:{ca=(c[g>>2]|0)+(8-1)&~(8-1);Oa=+h[ca>>3];c[g>>2]=ca+8;h[k>>3]=Oa;Ma=c[k>>2]|0;Na=c[k+4>>2]|0;break e;break}case 16:{ca=(c[g>>2]|0)+(4-1)&~(4-1);ea=c[ca>>2]|0;c[g>>2]=ca+4;Ma=ea&255;Na=0;break e;break}case 17:{ea=(c[g>>2]|0)+(8-1)&~(8-1);Oa=+h[ea>>3];c[g>>2]=ea+8;h[k>>3]=Oa;Ma=c[k>>2]|0;Na=c[k+4>>2]|0;break e;break}case 11:{ea=(c[g>>2]|0)+(4-1)&~(4-1);ca=c[ea>>2]|0;c[g>>2]=ea+4;Ma=ca;Na=0;break e;break}case 12:{ca=(c[g>>2]|0)+(8-1)&~(8-1);ea=ca;ba=c[ea>>2]|0;da=c[ea+4>>2]|0;c[g>>2]=ca+8;Ma=ba;Na=da;break e;break}case 9:{da=(c[g>>2]|0)+(4-1)&~(4-1);ba=c[da>>2]|0;c[g>>2]=da+4;Ma=ba;Na=M;break e;break}case 10:{ba=(c[g>>2]|0)+(4-1)&~(4-1);da=c[ba>>2]|0;c[g>>2]=ba+4;Ma=da;Na=((da|0)<0)<<31>>31;break e;break}case 13:{da=(c[g>>2]|0)+(4-1)&~(4-1);ba=c[da>>2]|0;c[g>>2]=da+4;Ma=ba<<16>>16;Na=(((ba&65535)<<16>>16|0)<0)<<31>>31;break e;break}case 14:{ba=(c[g>>2]|0)+(4-1)&~(4-1);da=c[ba>>2]|0;c[g>>2]=ba+4;Ma=da&65535;Na=0;break e;break}case 15:{da=(c[g>>2]|0)+(4-1)&~(4-1);ba=c[da>>2]|0;c[g>>2]=da+4;Ma=ba<<24>>24;Na=(((ba&255)<<24>>24|0)<0)<<31>>31;break e;break}default:{Ma=N;Na=M;break e}}while(0);}while(0);if((m|0)==62){m=0;if(x){Ma=Ka;Na=Ja}else{M=Ja;N=Ka;O=R;P=Ea;f=S;Q=va;continue}}aa=a[Ha>>0]|0;ba=(Ia|0)!=0&(aa&15|0)==3?aa&-33:aa;aa=ta&-65537;da=(ta&8192|0)==0?ta:aa;f:do switch(ba|0){case 65:case 71:case 70:case 69:case 97:case 103:case 102:case 101:{c[k>>2]=Ma;c[k+4>>2]=Na;Oa=+h[k>>3];c[p>>2]=0;if((Na|0)<0){Pa=-Oa;Qa=1;Ra=40368}else if(!(da&2048)){ca=da&1;Pa=Oa;Qa=ca;Ra=(ca|0)==0?40369:40374}else{Pa=Oa;Qa=1;Ra=40371}h[k>>3]=Pa;ca=c[k+4>>2]&2146435072;do if(ca>>>0<2146435072|(ca|0)==2146435072&0<0){Oa=+ve(Pa,p)*2.0;ea=Oa!=0.0;if(ea)c[p>>2]=(c[p>>2]|0)+-1;na=ba|32;if((na|0)==97){ma=ba&32;oa=(ma|0)==0?Ra:Ra+9|0;Sa=Qa|2;Ta=12-Da|0;do if(Da>>>0>11|(Ta|0)==0)Ua=Oa;else{Va=Ta;Wa=8.0;while(1){Va=Va+-1|0;Ya=Wa*16.0;if(!Va){Za=Ya;break}else Wa=Ya}if((a[oa>>0]|0)==45){Ua=-(Za+(-Oa-Za));break}else{Ua=Oa+Za-Za;break}}while(0);Ta=c[p>>2]|0;Va=(Ta|0)<0?0-Ta|0:Ta;if((Va|0)<0){Ta=C;_a=Va;$a=((Va|0)<0)<<31>>31;while(1){ab=vd(_a|0,$a|0,10,0)|0;bb=Ta+-1|0;a[bb>>0]=ab|48;ab=_d(_a|0,$a|0,10,0)|0;if($a>>>0>9|($a|0)==9&_a>>>0>4294967295){Ta=bb;_a=ab;$a=D}else{cb=bb;db=ab;break}}eb=cb;fb=db}else{eb=C;fb=Va}if(!fb)gb=eb;else{$a=eb;_a=fb;while(1){Ta=$a+-1|0;a[Ta>>0]=(_a>>>0)%10|0|48;if(_a>>>0<10){gb=Ta;break}else{$a=Ta;_a=(_a>>>0)/10|0}}}if((gb|0)==(C|0)){a[E>>0]=48;hb=E}else hb=gb;a[hb+-1>>0]=(c[p>>2]>>31&2)+43;_a=hb+-2|0;a[_a>>0]=ba+15;if(!(da&8))if((Da|0)<1){Wa=Ua;$a=q;while(1){Va=~~Wa;Ta=$a+1|0;a[$a>>0]=d[40328+Va>>0]|ma;Wa=(Wa-+(Va|0))*16.0;if((Ta-r|0)!=1|Wa==0.0)ib=Ta;else{a[Ta>>0]=46;ib=$a+2|0}if(!(Wa!=0.0)){jb=ib;break}else $a=ib}}else{Wa=Ua;$a=q;while(1){Ta=~~Wa;Va=$a+1|0;a[$a>>0]=d[40328+Ta>>0]|ma;Wa=(Wa-+(Ta|0))*16.0;if((Va-r|0)==1){a[Va>>0]=46;kb=$a+2|0}else kb=Va;if(!(Wa!=0.0)){jb=kb;break}else $a=kb}}else{Wa=Ua;$a=q;while(1){Va=~~Wa;Ta=$a+1|0;a[$a>>0]=d[40328+Va>>0]|ma;Wa=(Wa-+(Va|0))*16.0;if((Ta-r|0)==1){a[Ta>>0]=46;lb=$a+2|0}else lb=Ta;if(!(Wa!=0.0)){jb=lb;break}else $a=lb}}$a=jb;ma=(Da|0)!=0&(G+$a|0)<(Da|0)?H+Da-_a|0:F-_a+$a|0;Ta=ma+Sa|0;Va=da&73728;ab=(wa|0)>(Ta|0);if((Va|0)==0&ab){bb=wa-Ta|0;$c(t|0,32,(bb>>>0>256?256:bb)|0)|0;if(bb>>>0>255){mb=bb;do{dc(t,256,e)|0;mb=mb+-256|0}while(mb>>>0>255);nb=bb&255}else nb=bb;dc(t,nb,e)|0}dc(oa,Sa,e)|0;if((Va|0)==65536&ab){mb=wa-Ta|0;$c(t|0,48,(mb>>>0>256?256:mb)|0)|0;if(mb>>>0>255){ob=mb;do{dc(t,256,e)|0;ob=ob+-256|0}while(ob>>>0>255);pb=mb&255}else pb=mb;dc(t,pb,e)|0}ob=$a-r|0;dc(q,ob,e)|0;Sa=s-_a|0;oa=ma-Sa-ob|0;if((oa|0)>0){$c(t|0,48,(oa>>>0>256?256:oa)|0)|0;if(oa>>>0>255){ob=oa;do{dc(t,256,e)|0;ob=ob+-256|0}while(ob>>>0>255);qb=oa&255}else qb=oa;dc(t,qb,e)|0}dc(_a,Sa,e)|0;if((Va|0)==8192&ab){ob=wa-Ta|0;$c(t|0,32,(ob>>>0>256?256:ob)|0)|0;if(ob>>>0>255){ma=ob;do{dc(t,256,e)|0;ma=ma+-256|0}while(ma>>>0>255);rb=ob&255}else rb=ob;dc(t,rb,e)|0}sb=ab?wa:Ta;break}ma=(Da|0)<0?6:Da;if(ea){Va=(c[p>>2]|0)+-28|0;c[p>>2]=Va;tb=Oa*268435456.0;ub=Va}else{tb=Oa;ub=c[p>>2]|0}Va=(ub|0)<0?o:I;Sa=Va;Wa=tb;_a=Va;while(1){oa=~~Wa>>>0;c[_a>>2]=oa;$a=_a+4|0;Wa=(Wa-+(oa>>>0))*1.0e9;if(!(Wa!=0.0)){vb=$a;break}else _a=$a}_a=c[p>>2]|0;if((_a|0)>0){ea=_a;Ta=Va;ab=vb;while(1){ob=(ea|0)>29?29:ea;$a=ab+-4|0;do if($a>>>0<Ta>>>0)wb=Ta;else{oa=0;mb=$a;while(1){bb=Ld(c[mb>>2]|0,0,ob|0)|0;xb=Pd(bb|0,D|0,oa|0,0)|0;bb=D;yb=vd(xb|0,bb|0,1e9,0)|0;c[mb>>2]=yb;yb=_d(xb|0,bb|0,1e9,0)|0;mb=mb+-4|0;if(mb>>>0<Ta>>>0){zb=yb;break}else oa=yb}if(!zb){wb=Ta;break}oa=Ta+-4|0;c[oa>>2]=zb;wb=oa}while(0);$a=ab;while(1){if($a>>>0<=wb>>>0){Ab=$a;break}oa=$a+-4|0;if(!(c[oa>>2]|0))$a=oa;else{Ab=$a;break}}$a=(c[p>>2]|0)-ob|0;c[p>>2]=$a;if(($a|0)>0){ea=$a;Ta=wb;ab=Ab}else{Bb=$a;Cb=wb;Db=Ab;break}}}else{Bb=_a;Cb=Va;Db=vb}g:do if((Bb|0)<0){ab=((ma+25|0)/9|0)+1|0;if((na|0)!=102){Ta=Bb;ea=Cb;$a=Db;while(1){oa=0-Ta|0;mb=(oa|0)>9?9:oa;do if(ea>>>0<$a>>>0){oa=(1<<mb)+-1|0;yb=1e9>>>mb;bb=0;xb=ea;while(1){Eb=c[xb>>2]|0;c[xb>>2]=(Eb>>>mb)+bb;Fb=$(Eb&oa,yb)|0;xb=xb+4|0;if(xb>>>0>=$a>>>0){Gb=Fb;break}else bb=Fb}bb=(c[ea>>2]|0)==0?ea+4|0:ea;if(!Gb){Hb=bb;Ib=$a;break}c[$a>>2]=Gb;Hb=bb;Ib=$a+4|0}else{Hb=(c[ea>>2]|0)==0?ea+4|0:ea;Ib=$a}while(0);bb=(Ib-Hb>>2|0)>(ab|0)?Hb+(ab<<2)|0:Ib;Ta=(c[p>>2]|0)+mb|0;c[p>>2]=Ta;if((Ta|0)>=0){Jb=Hb;Kb=bb;break g}else{ea=Hb;$a=bb}}}$a=Va+(ab<<2)|0;ea=Bb;Ta=Cb;ob=Db;while(1){bb=0-ea|0;xb=(bb|0)>9?9:bb;do if(Ta>>>0<ob>>>0){bb=(1<<xb)+-1|0;yb=1e9>>>xb;oa=0;Fb=Ta;while(1){Eb=c[Fb>>2]|0;c[Fb>>2]=(Eb>>>xb)+oa;Lb=$(Eb&bb,yb)|0;Fb=Fb+4|0;if(Fb>>>0>=ob>>>0){Mb=Lb;break}else oa=Lb}oa=(c[Ta>>2]|0)==0?Ta+4|0:Ta;if(!Mb){Nb=oa;Ob=ob;break}c[ob>>2]=Mb;Nb=oa;Ob=ob+4|0}else{Nb=(c[Ta>>2]|0)==0?Ta+4|0:Ta;Ob=ob}while(0);mb=(Ob-Sa>>2|0)>(ab|0)?$a:Ob;ea=(c[p>>2]|0)+xb|0;c[p>>2]=ea;if((ea|0)>=0){Jb=Nb;Kb=mb;break}else{Ta=Nb;ob=mb}}}else{Jb=Cb;Kb=Db}while(0);do if(Jb>>>0<Kb>>>0){_a=(Sa-Jb>>2)*9|0;ob=c[Jb>>2]|0;if(ob>>>0<10){Pb=_a;break}else{Qb=_a;Rb=10}while(1){Rb=Rb*10|0;_a=Qb+1|0;if(ob>>>0<Rb>>>0){Pb=_a;break}else Qb=_a}}else Pb=0;while(0);ob=(na|0)==103;_a=(ma|0)!=0;Ta=ma-((na|0)!=102?Pb:0)+((_a&ob)<<31>>31)|0;if((Ta|0)<(((Kb-Sa>>2)*9|0)+-9|0)){ea=Ta+9216|0;Ta=(ea|0)/9|0;$a=Va+(Ta+-1023<<2)|0;ab=((ea|0)%9|0)+1|0;if((ab|0)<9){ea=10;mb=ab;while(1){ab=ea*10|0;mb=mb+1|0;if((mb|0)==9){Sb=ab;break}else ea=ab}}else Sb=10;ea=c[$a>>2]|0;mb=(ea>>>0)%(Sb>>>0)|0;if(!mb)if((Va+(Ta+-1022<<2)|0)==(Kb|0)){Tb=Jb;Ub=$a;Vb=Pb}else m=221;else m=221;do if((m|0)==221){m=0;Wa=(((ea>>>0)/(Sb>>>0)|0)&1|0)==0?9007199254740992.0:9007199254740994.0;na=(Sb|0)/2|0;do if(mb>>>0<na>>>0)Wb=.5;else{if((mb|0)==(na|0))if((Va+(Ta+-1022<<2)|0)==(Kb|0)){Wb=1.0;break}Wb=1.5}while(0);do if(!Qa){Yb=Wa;Zb=Wb}else{if((a[Ra>>0]|0)!=45){Yb=Wa;Zb=Wb;break}Yb=-Wa;Zb=-Wb}while(0);na=ea-mb|0;c[$a>>2]=na;if(!(Yb+Zb!=Yb)){Tb=Jb;Ub=$a;Vb=Pb;break}ab=na+Sb|0;c[$a>>2]=ab;if(ab>>>0>999999999){ab=Jb;na=$a;while(1){oa=na+-4|0;c[na>>2]=0;if(oa>>>0<ab>>>0){Fb=ab+-4|0;c[Fb>>2]=0;_b=Fb}else _b=ab;Fb=(c[oa>>2]|0)+1|0;c[oa>>2]=Fb;if(Fb>>>0>999999999){ab=_b;na=oa}else{$b=_b;ac=oa;break}}}else{$b=Jb;ac=$a}na=(Sa-$b>>2)*9|0;ab=c[$b>>2]|0;if(ab>>>0<10){Tb=$b;Ub=ac;Vb=na;break}else{bc=na;cc=10}while(1){cc=cc*10|0;na=bc+1|0;if(ab>>>0<cc>>>0){Tb=$b;Ub=ac;Vb=na;break}else bc=na}}while(0);$a=Ub+4|0;ec=Tb;fc=Vb;gc=Kb>>>0>$a>>>0?$a:Kb}else{ec=Jb;fc=Pb;gc=Kb}$a=0-fc|0;mb=gc;while(1){if(mb>>>0<=ec>>>0){hc=0;ic=mb;break}ea=mb+-4|0;if(!(c[ea>>2]|0))mb=ea;else{hc=1;ic=mb;break}}do if(ob){mb=(_a&1^1)+ma|0;if((mb|0)>(fc|0)&(fc|0)>-5){jc=ba+-1|0;kc=mb+-1-fc|0}else{jc=ba+-2|0;kc=mb+-1|0}mb=da&8;if(mb){lc=jc;mc=kc;nc=mb;break}do if(hc){mb=c[ic+-4>>2]|0;if(!mb){oc=9;break}if(!((mb>>>0)%10|0)){pc=10;qc=0}else{oc=0;break}while(1){pc=pc*10|0;ea=qc+1|0;if((mb>>>0)%(pc>>>0)|0){oc=ea;break}else qc=ea}}else oc=9;while(0);mb=((ic-Sa>>2)*9|0)+-9|0;if((jc|32|0)==102){xb=mb-oc|0;ea=(xb|0)<0?0:xb;lc=jc;mc=(kc|0)<(ea|0)?kc:ea;nc=0;break}else{ea=mb+fc-oc|0;mb=(ea|0)<0?0:ea;lc=jc;mc=(kc|0)<(mb|0)?kc:mb;nc=0;break}}else{lc=ba;mc=ma;nc=da&8}while(0);ma=mc|nc;Sa=(ma|0)!=0&1;_a=(lc|32|0)==102;if(_a){rc=(fc|0)>0?fc:0;sc=0}else{ob=(fc|0)<0?$a:fc;if((ob|0)<0){mb=C;ea=ob;xb=((ob|0)<0)<<31>>31;while(1){Ta=vd(ea|0,xb|0,10,0)|0;ab=mb+-1|0;a[ab>>0]=Ta|48;Ta=_d(ea|0,xb|0,10,0)|0;if(xb>>>0>9|(xb|0)==9&ea>>>0>4294967295){mb=ab;ea=Ta;xb=D}else{tc=ab;uc=Ta;break}}vc=tc;wc=uc}else{vc=C;wc=ob}if(!wc)xc=vc;else{xb=vc;ea=wc;while(1){mb=xb+-1|0;a[mb>>0]=(ea>>>0)%10|0|48;if(ea>>>0<10){xc=mb;break}else{xb=mb;ea=(ea>>>0)/10|0}}}if((s-xc|0)<2){ea=xc;while(1){xb=ea+-1|0;a[xb>>0]=48;if((s-xb|0)<2)ea=xb;else{yc=xb;break}}}else yc=xc;a[yc+-1>>0]=(fc>>31&2)+43;ea=yc+-2|0;a[ea>>0]=lc;rc=s-ea|0;sc=ea}ea=Qa+1+mc+Sa+rc|0;xb=da&73728;ob=(wa|0)>(ea|0);if((xb|0)==0&ob){mb=wa-ea|0;$c(t|0,32,(mb>>>0>256?256:mb)|0)|0;if(mb>>>0>255){$a=mb;do{dc(t,256,e)|0;$a=$a+-256|0}while($a>>>0>255);zc=mb&255}else zc=mb;dc(t,zc,e)|0}dc(Ra,Qa,e)|0;if((xb|0)==65536&ob){$a=wa-ea|0;$c(t|0,48,($a>>>0>256?256:$a)|0)|0;if($a>>>0>255){Sa=$a;do{dc(t,256,e)|0;Sa=Sa+-256|0}while(Sa>>>0>255);Ac=$a&255}else Ac=$a;dc(t,Ac,e)|0}if(_a){Sa=ec>>>0>Va>>>0?Va:ec;mb=Sa;while(1){Ta=c[mb>>2]|0;if(!Ta)Bc=J;else{ab=J;na=Ta;while(1){Ta=ab+-1|0;a[Ta>>0]=(na>>>0)%10|0|48;if(na>>>0<10){Bc=Ta;break}else{ab=Ta;na=(na>>>0)/10|0}}}do if((mb|0)==(Sa|0)){if((Bc|0)!=(J|0)){Cc=Bc;break}a[L>>0]=48;Cc=L}else{if(Bc>>>0>q>>>0)Dc=Bc;else{Cc=Bc;break}while(1){na=Dc+-1|0;a[na>>0]=48;if(na>>>0>q>>>0)Dc=na;else{Cc=na;break}}}while(0);dc(Cc,K-Cc|0,e)|0;na=mb+4|0;if(na>>>0>Va>>>0){Ec=na;break}else mb=na}if(ma)dc(40424,1,e)|0;if((mc|0)>0&Ec>>>0<ic>>>0){mb=mc;Va=Ec;while(1){Sa=c[Va>>2]|0;if(!Sa){Fc=J;m=289}else{_a=J;$a=Sa;while(1){Sa=_a+-1|0;a[Sa>>0]=($a>>>0)%10|0|48;if($a>>>0<10){Gc=Sa;break}else{_a=Sa;$a=($a>>>0)/10|0}}if(Gc>>>0>q>>>0){Fc=Gc;m=289}else Hc=Gc}if((m|0)==289)while(1){m=0;$a=Fc+-1|0;a[$a>>0]=48;if($a>>>0>q>>>0){Fc=$a;m=289}else{Hc=$a;break}}$a=(mb|0)>9;dc(Hc,$a?9:mb,e)|0;Va=Va+4|0;_a=mb+-9|0;if(!($a&Va>>>0<ic>>>0)){Ic=_a;break}else mb=_a}}else Ic=mc;if((Ic|0)>0){$c(t|0,48,(Ic>>>0>256?256:Ic)|0)|0;if(Ic>>>0>255){mb=Ic;do{dc(t,256,e)|0;mb=mb+-256|0}while(mb>>>0>255);Jc=Ic&255}else Jc=Ic;dc(t,Jc,e)|0}}else{mb=hc?ic:ec+4|0;do if((mc|0)>-1){Va=(nc|0)==0;ma=mc;_a=ec;while(1){$a=c[_a>>2]|0;if(!$a)m=303;else{Sa=J;na=$a;while(1){$a=Sa+-1|0;a[$a>>0]=(na>>>0)%10|0|48;if(na>>>0<10){Kc=Sa;Lc=$a;break}else{Sa=$a;na=(na>>>0)/10|0}}if((Lc|0)==(J|0))m=303;else{Mc=Kc;Nc=Lc}}if((m|0)==303){m=0;a[L>>0]=48;Mc=J;Nc=L}do if((_a|0)==(ec|0)){dc(Nc,1,e)|0;if(Va&(ma|0)<1){Oc=Mc;break}dc(40424,1,e)|0;Oc=Mc}else{if(Nc>>>0>q>>>0)Pc=Nc;else{Oc=Nc;break}while(1){na=Pc+-1|0;a[na>>0]=48;if(na>>>0>q>>>0)Pc=na;else{Oc=na;break}}}while(0);na=K-Oc|0;dc(Oc,(ma|0)>(na|0)?na:ma,e)|0;Sa=ma-na|0;_a=_a+4|0;if(!(_a>>>0<mb>>>0&(Sa|0)>-1)){Qc=Sa;break}else ma=Sa}if((Qc|0)<=0)break;$c(t|0,48,(Qc>>>0>256?256:Qc)|0)|0;if(Qc>>>0>255){ma=Qc;do{dc(t,256,e)|0;ma=ma+-256|0}while(ma>>>0>255);Rc=Qc&255}else Rc=Qc;dc(t,Rc,e)|0}while(0);dc(sc,s-sc|0,e)|0}if((xb|0)==8192&ob){mb=wa-ea|0;$c(t|0,32,(mb>>>0>256?256:mb)|0)|0;if(mb>>>0>255){ma=mb;do{dc(t,256,e)|0;ma=ma+-256|0}while(ma>>>0>255);Sc=mb&255}else Sc=mb;dc(t,Sc,e)|0}sb=ob?wa:ea}else{ma=(ba&32|0)!=0;xb=Pa!=Pa|0.0!=0.0;_a=xb?0:Qa;Va=xb?(ma?40408:40416):ma?40392:40400;ma=_a+3|0;xb=(wa|0)>(ma|0);if((da&8192|0)==0&xb){Sa=wa-ma|0;$c(t|0,32,(Sa>>>0>256?256:Sa)|0)|0;if(Sa>>>0>255){na=Sa;do{dc(t,256,e)|0;na=na+-256|0}while(na>>>0>255);Tc=Sa&255}else Tc=Sa;dc(t,Tc,e)|0}dc(Ra,_a,e)|0;dc(Va,3,e)|0;if((da&73728|0)==8192&xb){na=wa-ma|0;$c(t|0,32,(na>>>0>256?256:na)|0)|0;if(na>>>0>255){ea=na;do{dc(t,256,e)|0;ea=ea+-256|0}while(ea>>>0>255);Uc=na&255}else Uc=na;dc(t,Uc,e)|0}sb=xb?wa:ma}while(0);M=Na;N=Ma;O=R;P=Ea;f=sb;Q=va;continue a;break}case 67:{c[v>>2]=Ma;c[u>>2]=0;Vc=v;Wc=B;Xc=-1;m=97;break}case 83:{ca=Ma;if(!Da){Yc=Ma;Zc=ca;_c=0;m=102}else{Vc=ca;Wc=Ma;Xc=Da;m=97}break}case 109:{ad=Xa(c[(La()|0)>>2]|0)|0;m=94;break}case 115:{ad=(Ma|0)!=0?Ma:40360;m=94;break}case 99:{a[A>>0]=Ma;bd=Na;cd=Ma;dd=A;ed=aa;fd=1;gd=0;hd=40344;id=y;break}case 111:{ca=(Ma|0)==0&(Na|0)==0;if(ca)jd=y;else{ea=y;Va=Ma;_a=Na;while(1){Sa=ea+-1|0;a[Sa>>0]=Va&7|48;Va=Od(Va|0,_a|0,3)|0;_a=D;if((Va|0)==0&(_a|0)==0){jd=Sa;break}else ea=Sa}}ea=(da&8|0)==0|ca;kd=Ma;ld=Na;md=jd;nd=da;od=Da;pd=ea&1^1;qd=ea?40344:40349;m=89;break}case 105:case 100:{if((Na|0)<0){ea=Dd(0,0,Ma|0,Na|0)|0;rd=D;sd=ea;td=1;ud=40344;m=84;break f}if(!(da&2048)){ea=da&1;rd=Na;sd=Ma;td=ea;ud=(ea|0)==0?40344:40346;m=84}else{rd=Na;sd=Ma;td=1;ud=40345;m=84}break}case 117:{rd=Na;sd=Ma;td=0;ud=40344;m=84;break}case 112:{wd=da|8;xd=Da>>>0>8?Da:8;yd=120;m=73;break}case 88:case 120:{wd=da;xd=Da;yd=ba;m=73;break}case 110:{switch(Ia|0){case 2:{ea=Ma;c[ea>>2]=R;c[ea+4>>2]=((R|0)<0)<<31>>31;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}case 3:{b[Ma>>1]=R;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}case 4:{a[Ma>>0]=R;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}case 6:{c[Ma>>2]=R;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}case 7:{ea=Ma;c[ea>>2]=R;c[ea+4>>2]=((R|0)<0)<<31>>31;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}case 0:{c[Ma>>2]=R;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}case 1:{c[Ma>>2]=R;M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a;break}default:{M=Na;N=Ma;O=R;P=Ea;f=S;Q=va;continue a}}break}default:{bd=Na;cd=Ma;dd=P;ed=da;fd=Da;gd=0;hd=40344;id=y}}while(0);if((m|0)==73){m=0;S=yd&32;if((Ma|0)==0&(Na|0)==0){kd=Ma;ld=Na;md=y;nd=wd;od=xd;pd=0;qd=40344;m=89}else{ba=y;ea=Ma;_a=Na;while(1){Va=ba+-1|0;a[Va>>0]=d[40328+(ea&15)>>0]|S;ea=Od(ea|0,_a|0,4)|0;_a=D;if((ea|0)==0&(_a|0)==0){zd=Va;break}else ba=Va}if(!(wd&8)){kd=Ma;ld=Na;md=zd;nd=wd;od=xd;pd=0;qd=40344;m=89}else{kd=Ma;ld=Na;md=zd;nd=wd;od=xd;pd=2;qd=40344+(yd>>4)|0;m=89}}}else if((m|0)==84){m=0;if(rd>>>0>0|(rd|0)==0&sd>>>0>4294967295){ba=y;_a=sd;ea=rd;while(1){S=vd(_a|0,ea|0,10,0)|0;Va=ba+-1|0;a[Va>>0]=S|48;S=_d(_a|0,ea|0,10,0)|0;if(ea>>>0>9|(ea|0)==9&_a>>>0>4294967295){ba=Va;_a=S;ea=D}else{Ad=Va;Bd=S;break}}Cd=Ad;Ed=Bd}else{Cd=y;Ed=sd}if(!Ed){kd=sd;ld=rd;md=Cd;nd=da;od=Da;pd=td;qd=ud;m=89}else{ea=Cd;_a=Ed;while(1){ba=ea+-1|0;a[ba>>0]=(_a>>>0)%10|0|48;if(_a>>>0<10){kd=sd;ld=rd;md=ba;nd=da;od=Da;pd=td;qd=ud;m=89;break}else{ea=ba;_a=(_a>>>0)/10|0}}}}else if((m|0)==94){m=0;_a=Xb(ad,0,Da)|0;ea=(_a|0)==0;bd=Na;cd=Ma;dd=ad;ed=aa;fd=ea?Da:_a-ad|0;gd=0;hd=40344;id=ea?ad+Da|0:_a}else if((m|0)==97){m=0;_a=0;ea=0;ba=Vc;while(1){S=c[ba>>2]|0;if(!S){Fd=_a;Gd=ea;break}Va=$d(w,S)|0;if((Va|0)<0|Va>>>0>(Xc-_a|0)>>>0){Fd=_a;Gd=Va;break}S=Va+_a|0;if(Xc>>>0>S>>>0){_a=S;ea=Va;ba=ba+4|0}else{Fd=S;Gd=Va;break}}if((Gd|0)<0){sa=-1;m=363;break}else{Yc=Wc;Zc=Vc;_c=Fd;m=102}}if((m|0)==89){m=0;ba=(od|0)>-1?nd&-65537:nd;ea=(kd|0)!=0|(ld|0)!=0;if(ea|(od|0)!=0){_a=(ea&1^1)+(z-md)|0;bd=ld;cd=kd;dd=md;ed=ba;fd=(od|0)>(_a|0)?od:_a;gd=pd;hd=qd;id=y}else{bd=ld;cd=kd;dd=y;ed=ba;fd=0;gd=pd;hd=qd;id=y}}else if((m|0)==102){m=0;ba=da&73728;_a=(wa|0)>(_c|0);if((ba|0)==0&_a){ea=wa-_c|0;$c(t|0,32,(ea>>>0>256?256:ea)|0)|0;if(ea>>>0>255){aa=ea;do{dc(t,256,e)|0;aa=aa+-256|0}while(aa>>>0>255);Hd=ea&255}else Hd=ea;dc(t,Hd,e)|0}h:do if(_c){aa=0;da=Zc;while(1){Va=c[da>>2]|0;if(!Va)break h;S=$d(w,Va)|0;aa=S+aa|0;if((aa|0)>(_c|0))break h;dc(w,S,e)|0;if(aa>>>0>=_c>>>0)break;else da=da+4|0}}while(0);if((ba|0)==8192&_a){ea=wa-_c|0;$c(t|0,32,(ea>>>0>256?256:ea)|0)|0;if(ea>>>0>255){da=ea;do{dc(t,256,e)|0;da=da+-256|0}while(da>>>0>255);Id=ea&255}else Id=ea;dc(t,Id,e)|0}M=Na;N=Yc;O=R;P=Ea;f=_a?wa:_c;Q=va;continue}da=id-dd|0;ba=(fd|0)<(da|0)?da:fd;aa=gd+ba|0;ca=(wa|0)<(aa|0)?aa:wa;S=ed&73728;Va=(ca|0)>(aa|0);if((S|0)==0&Va){Sa=ca-aa|0;$c(t|0,32,(Sa>>>0>256?256:Sa)|0)|0;if(Sa>>>0>255){ob=Sa;do{dc(t,256,e)|0;ob=ob+-256|0}while(ob>>>0>255);Jd=Sa&255}else Jd=Sa;dc(t,Jd,e)|0}dc(hd,gd,e)|0;if((S|0)==65536&Va){ob=ca-aa|0;$c(t|0,48,(ob>>>0>256?256:ob)|0)|0;if(ob>>>0>255){_a=ob;do{dc(t,256,e)|0;_a=_a+-256|0}while(_a>>>0>255);Kd=ob&255}else Kd=ob;dc(t,Kd,e)|0}if((ba|0)>(da|0)){_a=ba-da|0;$c(t|0,48,(_a>>>0>256?256:_a)|0)|0;if(_a>>>0>255){Sa=_a;do{dc(t,256,e)|0;Sa=Sa+-256|0}while(Sa>>>0>255);Md=_a&255}else Md=_a;dc(t,Md,e)|0}dc(dd,da,e)|0;if((S|0)==8192&Va){Sa=ca-aa|0;$c(t|0,32,(Sa>>>0>256?256:Sa)|0)|0;if(Sa>>>0>255){ba=Sa;do{dc(t,256,e)|0;ba=ba+-256|0}while(ba>>>0>255);Nd=Sa&255}else Nd=Sa;dc(t,Nd,e)|0}M=bd;N=cd;O=R;P=Ea;f=ca;Q=va}if((m|0)==344){if(e){sa=T;i=n;return sa|0}if(!U){sa=0;i=n;return sa|0}else Qd=1;while(1){U=c[l+(Qd<<2)>>2]|0;if(!U){Rd=Qd;break}T=j+(Qd<<3)|0;i:do if(U>>>0<=20)do switch(U|0){case 18:{e=(c[g>>2]|0)+(8-1)&~(8-1);Pa=+h[e>>3];c[g>>2]=e+8;h[T>>3]=Pa;break i;break}case 13:{e=(c[g>>2]|0)+(4-1)&~(4-1);va=c[e>>2]|0;c[g>>2]=e+4;e=(va&65535)<<16>>16;va=T;c[va>>2]=e;c[va+4>>2]=((e|0)<0)<<31>>31;break i;break}case 14:{e=(c[g>>2]|0)+(4-1)&~(4-1);va=c[e>>2]|0;c[g>>2]=e+4;e=T;c[e>>2]=va&65535;c[e+4>>2]=0;break i;break}case 15:{e=(c[g>>2]|0)+(4-1)&~(4-1);va=c[e>>2]|0;c[g>>2]=e+4;e=(va&255)<<24>>24;va=T;c[va>>2]=e;c[va+4>>2]=((e|0)<0)<<31>>31;break i;break}case 16:{e=(c[g>>2]|0)+(4-1)&~(4-1);va=c[e>>2]|0;c[g>>2]=e+4;e=T;c[e>>2]=va&255;c[e+4>>2]=0;break i;break}case 17:{e=(c[g>>2]|0)+(8-1)&~(8-1);Pa=+h[e>>3];c[g>>2]=e+8;h[T>>3]=Pa;break i;break}case 9:{e=(c[g>>2]|0)+(4-1)&~(4-1);va=c[e>>2]|0;c[g>>2]=e+4;c[T>>2]=va;break i;break}case 10:{va=(c[g>>2]|0)+(4-1)&~(4-1);e=c[va>>2]|0;c[g>>2]=va+4;va=T;c[va>>2]=e;c[va+4>>2]=((e|0)<0)<<31>>31;break i;break}case 11:{e=(c[g>>2]|0)+(4-1)&~(4-1);va=c[e>>2]|0;c[g>>2]=e+4;e=T;c[e>>2]=va;c[e+4>>2]=0;break i;break}case 12:{e=(c[g>>2]|0)+(8-1)&~(8-1);va=e;Q=c[va>>2]|0;f=c[va+4>>2]|0;c[g>>2]=e+8;e=T;c[e>>2]=Q;c[e+4>>2]=f;break i;break}default:break i}while(0);while(0);Qd=Qd+1|0;if((Qd|0)>=10){sa=1;m=363;break}}if((m|0)==363){i=n;return sa|0}if((Rd|0)<10)Sd=Rd;else{sa=1;i=n;return sa|0}while(1){if(c[l+(Sd<<2)>>2]|0){sa=-1;m=363;break}Sd=Sd+1|0;if((Sd|0)>=10){sa=1;m=363;break}}if((m|0)==363){i=n;return sa|0}}else if((m|0)==363){i=n;return sa|0}return 0}function ob(b,e,f){b=b|0;e=e|0;f=f|0;var g=0,h=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0,S=0,T=0,U=0,V=0,W=0,X=0,Y=0,Z=0,_=0,$=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0,Fa=0,Ga=0,Ha=0,Ia=0,Ja=0,Ka=0,La=0,Ma=0,Na=0,Oa=0,Pa=0,Qa=0,Ra=0,Sa=0,Ta=0,Ua=0,Va=0,Wa=0,Xa=0,Ya=0,Za=0,_a=0,$a=0,ab=0,bb=0,cb=0,db=0,eb=0,fb=0,gb=0,hb=0,ib=0,jb=0,kb=0,lb=0,mb=0,nb=0,ob=0,qb=0,rb=0,sb=0,tb=0,ub=0,wb=0,xb=0,yb=0,zb=0,Ab=0,Bb=0,Cb=0,Db=0,Eb=0,Fb=0,Gb=0,Hb=0,Ib=0,Jb=0,Kb=0,Lb=0,Mb=0,Nb=0,Ob=0,Pb=0,Qb=0,Rb=0,Sb=0,Tb=0,Ub=0,Vb=0,Wb=0,Xb=0,Yb=0;g=0;g=0;h=i;i=i+16|0;j=h+8|0;k=h;l=a[e>>0]|0;m=l<<24>>24<0;n=m?e+1|0:e;e=(l&255)>>>7&255;o=(m?l:f)&255;f=o&15;l=f&255;switch(o&240|0){case 160:{o=a[n>>0]|0;m=a[n+1>>0]|0;p=b+16|0;q=c[p>>2]|0;r=b+20|0;s=c[r>>2]|0;if((q+1|0)>>>0<s>>>0){t=c[b+8>>2]|0;u=q}else{q=s+8192|0;c[r>>2]=q;r=b+8|0;s=Vc(c[r>>2]|0,q*20|0)|0;c[r>>2]=s;t=s;u=c[p>>2]|0}s=t+(u*20|0)|0;c[s>>2]=13;a[s+4>>0]=l;c[s+8>>2]=(o&255)<<8|m&255;m=c[p>>2]|0;c[t+(m*20|0)+12>>2]=0;c[p>>2]=m+1;v=e|2;i=h;return v|0}case 176:{m=a[n+1>>0]|0;p=d[n>>0]|0;do switch(p|0){case 11:{w=31;break}case 38:{w=32;break}case 64:{w=33;break}case 96:{w=34;break}case 97:{w=35;break}case 98:{w=36;break}case 99:{w=37;break}case 100:{w=38;break}case 101:{w=39;break}case 120:{w=40;break}case 121:{w=41;break}case 123:{w=42;break}case 6:{w=26;break}case 0:{a[b+52+(f<<5)>>0]=m;w=27;break}case 7:{a[b+52+(f<<5)+9>>0]=m;w=28;break}case 8:{w=29;break}case 10:{w=30;break}default:w=14}while(0);t=b+16|0;o=c[t>>2]|0;s=b+20|0;u=c[s>>2]|0;if((o+1|0)>>>0<u>>>0){x=c[b+8>>2]|0;y=o}else{o=u+8192|0;c[s>>2]=o;s=b+8|0;u=Vc(c[s>>2]|0,o*20|0)|0;c[s>>2]=u;x=u;y=c[t>>2]|0}u=x+(y*20|0)|0;c[u>>2]=w;a[u+4>>0]=l;if((w|0)==14)z=p<<8|m&255;else z=m&255;c[x+(y*20|0)+8>>2]=z;z=c[t>>2]|0;c[x+(z*20|0)+12>>2]=0;c[t>>2]=z+1;v=e|2;i=h;return v|0}case 128:{A=a[n+1>>0]|0;break}case 208:{z=a[n>>0]|0;t=b+16|0;x=c[t>>2]|0;y=b+20|0;m=c[y>>2]|0;if((x+1|0)>>>0<m>>>0){B=c[b+8>>2]|0;C=x}else{x=m+8192|0;c[y>>2]=x;y=b+8|0;m=Vc(c[y>>2]|0,x*20|0)|0;c[y>>2]=m;B=m;C=c[t>>2]|0}m=B+(C*20|0)|0;c[m>>2]=16;a[m+4>>0]=l;c[m+8>>2]=z&255;z=c[t>>2]|0;c[B+(z*20|0)+12>>2]=0;c[t>>2]=z+1;v=e+1|0;i=h;return v|0}case 224:{z=d[n+1>>0]<<7|d[n>>0]&127;t=b+16|0;B=c[t>>2]|0;m=b+20|0;C=c[m>>2]|0;if((B+1|0)>>>0<C>>>0){D=c[b+8>>2]|0;E=B}else{B=C+8192|0;c[m>>2]=B;m=b+8|0;C=Vc(c[m>>2]|0,B*20|0)|0;c[m>>2]=C;D=C;E=c[t>>2]|0}C=D+(E*20|0)|0;c[C>>2]=17;a[C+4>>0]=l;c[C+8>>2]=z;z=c[t>>2]|0;c[D+(z*20|0)+12>>2]=0;c[t>>2]=z+1;v=e|2;i=h;return v|0}case 240:{if((f|0)==15){do switch(a[n>>0]|0){case 32:{if((a[n+1>>0]|0)==1){z=d[n+2>>0]|0;t=b+16|0;D=c[t>>2]|0;C=b+20|0;E=c[C>>2]|0;if((D+1|0)>>>0<E>>>0){F=c[b+8>>2]|0;G=D}else{D=E+8192|0;c[C>>2]=D;C=b+8|0;E=Vc(c[C>>2]|0,D*20|0)|0;c[C>>2]=E;F=E;G=c[t>>2]|0}E=F+(G*20|0)|0;c[E>>2]=19;a[E+4>>0]=0;c[E+8>>2]=z;z=c[t>>2]|0;c[F+(z*20|0)+12>>2]=0;c[t>>2]=z+1;v=e+3|0;i=h;return v|0}else g=175;break}case 4:{z=n+1|0;t=e+1|0;E=a[z>>0]|0;if(E<<24>>24<0){C=z;z=E;D=t;m=0;while(1){B=z&127|m<<7;y=C+1|0;x=D+1|0;p=a[y>>0]|0;if(p<<24>>24<0){C=y;z=p;D=x;m=B}else{H=C;I=B;J=x;K=p;break}}L=K;M=H;N=J;O=I<<7}else{L=E;M=n;N=t;O=0}C=L&127|O;m=N+1|0;D=pb(C+1|0)|0;Wc(D|0,M+2|0,C|0)|0;a[D+C>>0]=0;z=he(D,10)|0;if(z){p=z;do{a[p>>0]=32;p=he(D,10)|0}while((p|0)!=0);}p=he(D,13)|0;if(p){t=p;do{a[t>>0]=32;t=he(D,13)|0}while((t|0)!=0);}t=b+16|0;p=c[t>>2]|0;E=b+20|0;z=c[E>>2]|0;if((p+1|0)>>>0<z>>>0){x=b+8|0;P=x;Q=c[x>>2]|0;R=p}else{p=z+8192|0;c[E>>2]=p;E=b+8|0;z=Vc(c[E>>2]|0,p*20|0)|0;c[E>>2]=z;P=E;Q=z;R=c[t>>2]|0}z=Q+(R*20|0)|0;c[z>>2]=9;a[z+4>>0]=0;c[z+8>>2]=D;c[(c[P>>2]|0)+(R*20|0)+12>>2]=0;c[t>>2]=R+1;v=m+C|0;i=h;return v|0}case 5:{t=n+1|0;z=e+1|0;E=a[t>>0]|0;if(E<<24>>24<0){p=t;t=E;x=z;B=0;while(1){y=t&127|B<<7;w=p+1|0;u=x+1|0;s=a[w>>0]|0;if(s<<24>>24<0){p=w;t=s;x=u;B=y}else{S=p;T=y;U=u;V=s;break}}W=V;X=S;Y=U;Z=T<<7}else{W=E;X=n;Y=z;Z=0}p=W&127|Z;B=Y+1|0;x=pb(p+1|0)|0;Wc(x|0,X+2|0,p|0)|0;a[x+p>>0]=0;t=he(x,10)|0;if(t){C=t;do{a[C>>0]=32;C=he(x,10)|0}while((C|0)!=0);}C=he(x,13)|0;if(C){z=C;do{a[z>>0]=32;z=he(x,13)|0}while((z|0)!=0);}z=b+16|0;C=c[z>>2]|0;E=b+20|0;t=c[E>>2]|0;if((C+1|0)>>>0<t>>>0){m=b+8|0;_=m;$=c[m>>2]|0;aa=C}else{C=t+8192|0;c[E>>2]=C;E=b+8|0;t=Vc(c[E>>2]|0,C*20|0)|0;c[E>>2]=t;_=E;$=t;aa=c[z>>2]|0}t=$+(aa*20|0)|0;c[t>>2]=10;a[t+4>>0]=0;c[t+8>>2]=x;c[(c[_>>2]|0)+(aa*20|0)+12>>2]=0;c[z>>2]=aa+1;v=B+p|0;i=h;return v|0}case 6:{z=n+1|0;t=e+1|0;E=a[z>>0]|0;if(E<<24>>24<0){C=z;z=E;m=t;D=0;while(1){s=z&127|D<<7;u=C+1|0;y=m+1|0;w=a[u>>0]|0;if(w<<24>>24<0){C=u;z=w;m=y;D=s}else{ba=C;ca=s;da=y;ea=w;break}}fa=ea;ga=ba;ha=da;ia=ca<<7}else{fa=E;ga=n;ha=t;ia=0}C=fa&127|ia;D=ha+1|0;m=pb(C+1|0)|0;Wc(m|0,ga+2|0,C|0)|0;a[m+C>>0]=0;z=he(m,10)|0;if(z){p=z;do{a[p>>0]=32;p=he(m,10)|0}while((p|0)!=0);}p=he(m,13)|0;if(p){t=p;do{a[t>>0]=32;t=he(m,13)|0}while((t|0)!=0);}t=b+16|0;p=c[t>>2]|0;E=b+20|0;z=c[E>>2]|0;if((p+1|0)>>>0<z>>>0){B=b+8|0;ja=B;ka=c[B>>2]|0;la=p}else{p=z+8192|0;c[E>>2]=p;E=b+8|0;z=Vc(c[E>>2]|0,p*20|0)|0;c[E>>2]=z;ja=E;ka=z;la=c[t>>2]|0}z=ka+(la*20|0)|0;c[z>>2]=11;a[z+4>>0]=0;c[z+8>>2]=m;c[(c[ja>>2]|0)+(la*20|0)+12>>2]=0;c[t>>2]=la+1;v=D+C|0;i=h;return v|0}case 7:{t=n+1|0;z=e+1|0;E=a[t>>0]|0;if(E<<24>>24<0){p=t;t=E;B=z;x=0;while(1){w=t&127|x<<7;y=p+1|0;s=B+1|0;u=a[y>>0]|0;if(u<<24>>24<0){p=y;t=u;B=s;x=w}else{ma=p;na=w;oa=s;pa=u;break}}qa=pa;ra=ma;sa=oa;ta=na<<7}else{qa=E;ra=n;sa=z;ta=0}p=qa&127|ta;x=sa+1|0;B=pb(p+1|0)|0;Wc(B|0,ra+2|0,p|0)|0;a[B+p>>0]=0;t=he(B,10)|0;if(t){C=t;do{a[C>>0]=32;C=he(B,10)|0}while((C|0)!=0);}C=he(B,13)|0;if(C){z=C;do{a[z>>0]=32;z=he(B,13)|0}while((z|0)!=0);}z=b+16|0;C=c[z>>2]|0;E=b+20|0;t=c[E>>2]|0;if((C+1|0)>>>0<t>>>0){D=b+8|0;ua=D;va=c[D>>2]|0;wa=C}else{C=t+8192|0;c[E>>2]=C;E=b+8|0;t=Vc(c[E>>2]|0,C*20|0)|0;c[E>>2]=t;ua=E;va=t;wa=c[z>>2]|0}t=va+(wa*20|0)|0;c[t>>2]=12;a[t+4>>0]=0;c[t+8>>2]=B;c[(c[ua>>2]|0)+(wa*20|0)+12>>2]=0;c[z>>2]=wa+1;v=x+p|0;i=h;return v|0}case 3:{z=n+1|0;t=e+1|0;E=a[z>>0]|0;if(E<<24>>24<0){C=z;z=E;D=t;m=0;while(1){u=z&127|m<<7;s=C+1|0;w=D+1|0;y=a[s>>0]|0;if(y<<24>>24<0){C=s;z=y;D=w;m=u}else{xa=C;ya=u;za=w;Aa=y;break}}Ba=Aa;Ca=xa;Da=za;Ea=ya<<7}else{Ba=E;Ca=n;Da=t;Ea=0}C=Ba&127|Ea;m=Da+1|0;D=pb(C+1|0)|0;Wc(D|0,Ca+2|0,C|0)|0;a[D+C>>0]=0;z=he(D,10)|0;if(z){p=z;do{a[p>>0]=32;p=he(D,10)|0}while((p|0)!=0);}p=he(D,13)|0;if(p){t=p;do{a[t>>0]=32;t=he(D,13)|0}while((t|0)!=0);}t=b+16|0;p=c[t>>2]|0;E=b+20|0;z=c[E>>2]|0;if((p+1|0)>>>0<z>>>0){x=b+8|0;Fa=x;Ga=c[x>>2]|0;Ha=p}else{p=z+8192|0;c[E>>2]=p;E=b+8|0;z=Vc(c[E>>2]|0,p*20|0)|0;c[E>>2]=z;Fa=E;Ga=z;Ha=c[t>>2]|0}z=Ga+(Ha*20|0)|0;c[z>>2]=8;a[z+4>>0]=0;c[z+8>>2]=D;c[(c[Fa>>2]|0)+(Ha*20|0)+12>>2]=0;c[t>>2]=Ha+1;v=m+C|0;i=h;return v|0}case 2:{t=n+1|0;z=e+1|0;E=a[t>>0]|0;if(E<<24>>24<0){p=t;t=E;x=z;B=0;while(1){y=t&127|B<<7;w=p+1|0;u=x+1|0;s=a[w>>0]|0;if(s<<24>>24<0){p=w;t=s;x=u;B=y}else{Ia=p;Ja=y;Ka=u;La=s;break}}Ma=La;Na=Ia;Oa=Ka;Pa=Ja<<7}else{Ma=E;Na=n;Oa=z;Pa=0}p=Ma&127|Pa;B=Na+2|0;x=Oa+1|0;t=b+24|0;C=c[t>>2]|0;if(!C){m=p+1|0;D=pb(m)|0;c[t>>2]=D;Wc(D|0,B|0,p|0)|0;a[D+p>>0]=0;Qa=m}else{m=Vc(C,p+2+(ce(C|0)|0)|0)|0;c[t>>2]=m;Wc(m+((ce(m|0)|0)+1)|0,B|0,p|0)|0;t=p+1|0;a[m+(t+(ce(m|0)|0))>>0]=0;a[m+(ce(m|0)|0)>>0]=10;Qa=t}t=pb(Qa)|0;Wc(t|0,B|0,p|0)|0;a[t+p>>0]=0;B=he(t,10)|0;if(B){m=B;do{a[m>>0]=32;m=he(t,10)|0}while((m|0)!=0);}m=he(t,13)|0;if(m){z=m;do{a[z>>0]=32;z=he(t,13)|0}while((z|0)!=0);}z=b+16|0;m=c[z>>2]|0;E=b+20|0;B=c[E>>2]|0;if((m+1|0)>>>0<B>>>0){C=b+8|0;Ra=C;Sa=c[C>>2]|0;Ta=m}else{m=B+8192|0;c[E>>2]=m;E=b+8|0;B=Vc(c[E>>2]|0,m*20|0)|0;c[E>>2]=B;Ra=E;Sa=B;Ta=c[z>>2]|0}B=Sa+(Ta*20|0)|0;c[B>>2]=7;a[B+4>>0]=0;c[B+8>>2]=t;c[(c[Ra>>2]|0)+(Ta*20|0)+12>>2]=0;c[z>>2]=Ta+1;v=x+p|0;i=h;return v|0}case 0:{if((a[n+1>>0]|0)==2){z=d[n+2>>0]<<8|d[n+3>>0];B=b+16|0;E=c[B>>2]|0;m=b+20|0;C=c[m>>2]|0;if((E+1|0)>>>0<C>>>0){Ua=c[b+8>>2]|0;Va=E}else{E=C+8192|0;c[m>>2]=E;m=b+8|0;C=Vc(c[m>>2]|0,E*20|0)|0;c[m>>2]=C;Ua=C;Va=c[B>>2]|0}C=Ua+(Va*20|0)|0;c[C>>2]=18;a[C+4>>0]=0;c[C+8>>2]=z;z=c[B>>2]|0;c[Ua+(z*20|0)+12>>2]=0;c[B>>2]=z+1;v=e|4;i=h;return v|0}else g=175;break}case 1:{z=n+1|0;B=e+1|0;C=a[z>>0]|0;if(C<<24>>24<0){m=z;z=C;E=B;D=0;while(1){s=z&127|D<<7;u=m+1|0;y=E+1|0;w=a[u>>0]|0;if(w<<24>>24<0){m=u;z=w;E=y;D=s}else{Wa=m;Xa=s;Ya=y;Za=w;break}}_a=Za;$a=Wa;ab=Ya;bb=Xa<<7}else{_a=C;$a=n;ab=B;bb=0}m=_a&127|bb;D=ab+1|0;E=pb(m+1|0)|0;Wc(E|0,$a+2|0,m|0)|0;a[E+m>>0]=0;z=he(E,10)|0;if(z){p=z;do{a[p>>0]=32;p=he(E,10)|0}while((p|0)!=0);}p=he(E,13)|0;if(p){B=p;do{a[B>>0]=32;B=he(E,13)|0}while((B|0)!=0);}B=b+16|0;p=c[B>>2]|0;C=b+20|0;z=c[C>>2]|0;if((p+1|0)>>>0<z>>>0){x=b+8|0;cb=x;db=c[x>>2]|0;eb=p}else{p=z+8192|0;c[C>>2]=p;C=b+8|0;z=Vc(c[C>>2]|0,p*20|0)|0;c[C>>2]=z;cb=C;db=z;eb=c[B>>2]|0}z=db+(eb*20|0)|0;c[z>>2]=6;a[z+4>>0]=0;c[z+8>>2]=E;c[(c[cb>>2]|0)+(eb*20|0)+12>>2]=0;c[B>>2]=eb+1;v=D+m|0;i=h;return v|0}case 33:{if((a[n+1>>0]|0)==1){B=d[n+2>>0]|0;z=b+16|0;C=c[z>>2]|0;p=b+20|0;x=c[p>>2]|0;if((C+1|0)>>>0<x>>>0){fb=c[b+8>>2]|0;gb=C}else{C=x+8192|0;c[p>>2]=C;p=b+8|0;x=Vc(c[p>>2]|0,C*20|0)|0;c[p>>2]=x;fb=x;gb=c[z>>2]|0}x=fb+(gb*20|0)|0;c[x>>2]=20;a[x+4>>0]=0;c[x+8>>2]=B;B=c[z>>2]|0;c[fb+(B*20|0)+12>>2]=0;c[z>>2]=B+1;v=e+3|0;i=h;return v|0}else g=175;break}case 47:{if(!(a[n+1>>0]|0)){B=b+16|0;z=c[B>>2]|0;x=b+20|0;p=c[x>>2]|0;if((z+1|0)>>>0<p>>>0){hb=c[b+8>>2]|0;ib=z}else{z=p+8192|0;c[x>>2]=z;x=b+8|0;p=Vc(c[x>>2]|0,z*20|0)|0;c[x>>2]=p;hb=p;ib=c[B>>2]|0}p=hb+(ib*20|0)|0;c[p>>2]=4;a[p+4>>0]=0;c[p+8>>2]=0;p=c[B>>2]|0;c[hb+(p*20|0)+12>>2]=0;c[B>>2]=p+1;v=e|2;i=h;return v|0}else g=175;break}case 81:{if((a[n+1>>0]|0)==3){p=d[n+3>>0]<<8|d[n+2>>0]<<16|d[n+4>>0];B=b+16|0;x=c[B>>2]|0;z=b+20|0;C=c[z>>2]|0;if((x+1|0)>>>0<C>>>0){jb=c[b+8>>2]|0;kb=x}else{x=C+8192|0;c[z>>2]=x;z=b+8|0;C=Vc(c[z>>2]|0,x*20|0)|0;c[z>>2]=C;jb=C;kb=c[B>>2]|0}C=jb+(kb*20|0)|0;c[C>>2]=5;a[C+4>>0]=0;c[C+8>>2]=p;p=c[B>>2]|0;c[jb+(p*20|0)+12>>2]=0;c[B>>2]=p+1;v=e+5|0;i=h;return v|0}else g=175;break}case 84:{if((a[n+1>>0]|0)==5){p=d[n+4>>0]<<16|d[n+3>>0]<<24|d[n+5>>0]<<8|d[n+6>>0];B=b+16|0;C=c[B>>2]|0;z=b+20|0;x=c[z>>2]|0;if((C+1|0)>>>0<x>>>0){t=c[b+8>>2]|0;lb=t;mb=C;nb=t}else{t=x+8192|0;c[z>>2]=t;x=b+8|0;C=Vc(c[x>>2]|0,t*20|0)|0;c[x>>2]=C;lb=C;mb=c[B>>2]|0;nb=C}C=lb+(mb*20|0)|0;c[C>>2]=21;a[C+4>>0]=0;c[C+8>>2]=p;p=c[B>>2]|0;c[lb+(p*20|0)+12>>2]=0;c[B>>2]=p+1;a[nb+(((c[z>>2]|0)+-1|0)*20|0)+4>>0]=a[n+2>>0]|0;v=e+7|0;i=h;return v|0}else g=175;break}case 88:{if((a[n+1>>0]|0)==4){z=d[n+3>>0]<<16|d[n+2>>0]<<24|d[n+4>>0]<<8|d[n+5>>0];p=b+16|0;B=c[p>>2]|0;C=b+20|0;x=c[C>>2]|0;if((B+1|0)>>>0<x>>>0){ob=c[b+8>>2]|0;qb=B}else{B=x+8192|0;c[C>>2]=B;C=b+8|0;x=Vc(c[C>>2]|0,B*20|0)|0;c[C>>2]=x;ob=x;qb=c[p>>2]|0}x=ob+(qb*20|0)|0;c[x>>2]=22;a[x+4>>0]=0;c[x+8>>2]=z;z=c[p>>2]|0;c[ob+(z*20|0)+12>>2]=0;c[p>>2]=z+1;v=e|6;i=h;return v|0}else g=175;break}case 89:{z=n+1|0;p=a[z>>0]|0;if(p<<24>>24==2){x=d[n+2>>0]<<8|d[n+3>>0];C=b+16|0;B=c[C>>2]|0;t=b+20|0;w=c[t>>2]|0;if((B+1|0)>>>0<w>>>0){rb=c[b+8>>2]|0;sb=B}else{B=w+8192|0;c[t>>2]=B;t=b+8|0;w=Vc(c[t>>2]|0,B*20|0)|0;c[t>>2]=w;rb=w;sb=c[C>>2]|0}w=rb+(sb*20|0)|0;c[w>>2]=23;a[w+4>>0]=0;c[w+8>>2]=x;x=c[C>>2]|0;c[rb+(x*20|0)+12>>2]=0;c[C>>2]=x+1;v=e|4;i=h;return v|0}else{tb=z;ub=p}break}default:g=175}while(0);if((g|0)==175){g=n+1|0;tb=g;ub=a[g>>0]|0}g=e+1|0;if(ub<<24>>24<0){rb=tb;tb=ub;sb=g;ob=0;while(1){qb=tb&127|ob<<7;rb=rb+1|0;nb=sb+1|0;lb=a[rb>>0]|0;if(lb<<24>>24>=0){wb=qb;xb=nb;yb=lb;break}else{tb=lb;sb=nb;ob=qb}}zb=yb;Ab=xb;Bb=wb<<7}else{zb=ub;Ab=g;Bb=0}v=Ab+1+(zb&127|Bb)|0;i=h;return v|0}else if((f|0)==7|(f|0)==0){Bb=a[n>>0]|0;if(Bb<<24>>24<0){zb=n;Ab=Bb;g=e;ub=0;while(1){wb=Ab&127|ub<<7;xb=zb+1|0;yb=g+1|0;ob=a[xb>>0]|0;if(ob<<24>>24<0){zb=xb;Ab=ob;g=yb;ub=wb}else{Cb=xb;Db=ob;Eb=yb;Fb=wb;break}}}else{Cb=n;Db=Bb;Eb=e;Fb=0}Bb=Db&127|Fb<<7;Fb=Eb+1|0;Eb=Vc(0,Bb)|0;Wc(Eb|0,Cb+1|0,Bb|0)|0;do if((a[Eb+(Bb+-1)>>0]|0)==-9){c[j>>2]=306319425;if(!(Yc(j,Eb,4)|0)){Gb=0;Hb=4}else{Cb=k;c[Cb>>2]=4984899;c[Cb+4>>2]=-150962688;if(!(Yc(37576,Eb,5)|0)){Cb=b+16|0;Db=c[Cb>>2]|0;ub=b+20|0;g=c[ub>>2]|0;if((Db+1|0)>>>0<g>>>0){Ib=c[b+8>>2]|0;Jb=Db}else{Db=g+8192|0;c[ub>>2]=Db;ub=b+8|0;g=Vc(c[ub>>2]|0,Db*20|0)|0;c[ub>>2]=g;Ib=g;Jb=c[Cb>>2]|0}g=Ib+(Jb*20|0)|0;c[g>>2]=25;a[g+4>>0]=0;c[g+8>>2]=0;g=c[Cb>>2]|0;c[Ib+(g*20|0)+12>>2]=0;c[Cb>>2]=g+1;break}if(Yc(k,Eb,8)|0)break;g=b+16|0;Cb=c[g>>2]|0;ub=b+20|0;Db=c[ub>>2]|0;if((Cb+1|0)>>>0<Db>>>0){Kb=c[b+8>>2]|0;Lb=Cb}else{Cb=Db+8192|0;c[ub>>2]=Cb;ub=b+8|0;Db=Vc(c[ub>>2]|0,Cb*20|0)|0;c[ub>>2]=Db;Kb=Db;Lb=c[g>>2]|0}Db=Kb+(Lb*20|0)|0;c[Db>>2]=25;a[Db+4>>0]=0;c[Db+8>>2]=0;Db=c[g>>2]|0;c[Kb+(Db*20|0)+12>>2]=0;c[g>>2]=Db+1;break}while(1){Db=d[Eb+Hb>>0]|0;g=Db+Gb&255;ub=g>>>0>127?g+-128|0:Db+(Gb&255)|0;Db=Hb+1|0;if((a[Eb+(Hb+2)>>0]|0)==-9){Mb=ub;Nb=Db;break}else{Gb=ub;Hb=Db}}if((a[Eb+Nb>>0]|0)==(128-Mb&255)<<24>>24)if((a[Eb+4>>0]|0)==64){m=a[Eb+5>>0]|0;D=m&255;if((D&240|0)==16)if((a[Eb+6>>0]|0)==21){E=D&15;if(!E)Ob=9;else if(E>>>0<10)Ob=E+255&255;else Ob=E&255;E=a[Eb+7>>0]|0;D=b+16|0;Db=c[D>>2]|0;ub=b+20|0;g=c[ub>>2]|0;if((Db+1|0)>>>0<g>>>0){Pb=c[b+8>>2]|0;Qb=Db}else{Db=g+8192|0;c[ub>>2]=Db;ub=b+8|0;g=Vc(c[ub>>2]|0,Db*20|0)|0;c[ub>>2]=g;Pb=g;Qb=c[D>>2]|0}g=Pb+(Qb*20|0)|0;c[g>>2]=24;a[g+4>>0]=Ob;c[g+8>>2]=E&255;g=c[D>>2]|0;c[Pb+(g*20|0)+12>>2]=0;c[D>>2]=g+1;a[b+52+((Ob&255)<<5)+31>>0]=E<<24>>24!=0&1;break}if(!(m<<24>>24))if((a[Eb+6>>0]|0)==127)if(!(a[Eb+7>>0]|0)){m=b+16|0;E=c[m>>2]|0;g=b+20|0;D=c[g>>2]|0;if((E+1|0)>>>0<D>>>0){Rb=c[b+8>>2]|0;Sb=E}else{E=D+8192|0;c[g>>2]=E;g=b+8|0;D=Vc(c[g>>2]|0,E*20|0)|0;c[g>>2]=D;Rb=D;Sb=c[m>>2]|0}D=Rb+(Sb*20|0)|0;c[D>>2]=25;a[D+4>>0]=0;c[D+8>>2]=0;D=c[m>>2]|0;c[Rb+(D*20|0)+12>>2]=0;c[m>>2]=D+1}}}while(0);vb(Eb);v=Fb+Bb|0;i=h;return v|0}else{_b(37584,37608,2367,7,37640,0);v=0;i=h;return v|0}break}case 192:{Bb=a[n>>0]|0;Fb=b+16|0;Eb=c[Fb>>2]|0;Rb=b+20|0;Sb=c[Rb>>2]|0;if((Eb+1|0)>>>0<Sb>>>0){Tb=c[b+8>>2]|0;Ub=Eb}else{Eb=Sb+8192|0;c[Rb>>2]=Eb;Rb=b+8|0;Sb=Vc(c[Rb>>2]|0,Eb*20|0)|0;c[Rb>>2]=Sb;Tb=Sb;Ub=c[Fb>>2]|0}Sb=Tb+(Ub*20|0)|0;c[Sb>>2]=15;a[Sb+4>>0]=l;Ub=Bb&255;c[Sb+8>>2]=Ub;Sb=c[Fb>>2]|0;c[Tb+(Sb*20|0)+12>>2]=0;c[Fb>>2]=Sb+1;Sb=b+52+(f<<5)|0;if(!(a[b+52+(f<<5)+31>>0]|0)){oc(b,(d[Sb>>0]<<8|Ub)&65535);c[b+52+(f<<5)+4>>2]=uc(b,(d[Sb>>0]<<8|Ub)&65535)|0}else a[Sb>>0]=Bb;v=e+1|0;i=h;return v|0}case 144:{Bb=a[n+1>>0]|0;if(!(Bb<<24>>24))A=0;else{Sb=a[n>>0]|0;Ub=b+16|0;Fb=c[Ub>>2]|0;Tb=b+20|0;Rb=c[Tb>>2]|0;if((Fb+1|0)>>>0<Rb>>>0){Vb=c[b+8>>2]|0;Wb=Fb}else{Fb=Rb+8192|0;c[Tb>>2]=Fb;Tb=b+8|0;Rb=Vc(c[Tb>>2]|0,Fb*20|0)|0;c[Tb>>2]=Rb;Vb=Rb;Wb=c[Ub>>2]|0}Rb=Vb+(Wb*20|0)|0;c[Rb>>2]=1;a[Rb+4>>0]=l;Wb=Sb&255;c[Rb+8>>2]=Wb<<8|Bb&255;Bb=c[Ub>>2]|0;c[Vb+(Bb*20|0)+12>>2]=0;c[Ub>>2]=Bb+1;if(a[b+52+(f<<5)+31>>0]|0)oc(b,(Wb|d[b+52+(f<<5)>>0]<<8|128)&65535);v=e|2;i=h;return v|0}break}default:{v=0;i=h;return v|0}}f=a[n>>0]|0;n=b+16|0;Wb=c[n>>2]|0;Bb=b+20|0;Ub=c[Bb>>2]|0;if((Wb+1|0)>>>0<Ub>>>0){Xb=c[b+8>>2]|0;Yb=Wb}else{Wb=Ub+8192|0;c[Bb>>2]=Wb;Bb=b+8|0;b=Vc(c[Bb>>2]|0,Wb*20|0)|0;c[Bb>>2]=b;Xb=b;Yb=c[n>>2]|0}b=Xb+(Yb*20|0)|0;c[b>>2]=2;a[b+4>>0]=l;c[b+8>>2]=(f&255)<<8|A&255;A=c[n>>2]|0;c[Xb+(A*20|0)+12>>2]=0;c[n>>2]=A+1;v=e|2;i=h;return v|0}function pb(a){a=a|0;var b=0,d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0,S=0,T=0,U=0,V=0,W=0,X=0,Y=0,Z=0,_=0,$=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,za=0,Aa=0,Ba=0,Da=0,Ea=0,Fa=0,Ga=0,Ha=0,Ia=0,Ja=0,Ka=0,Ma=0,Na=0,Oa=0,Pa=0,Qa=0,Ra=0,Sa=0,Ua=0,Wa=0,Xa=0;b=0;b=0;do if(a>>>0<245){d=a>>>0<11?16:a+11&-8;e=d>>>3;f=c[10108]|0;g=f>>>e;if(g&3){h=(g&1^1)+e|0;i=h<<1;j=40472+(i<<2)|0;k=40472+(i+2<<2)|0;i=c[k>>2]|0;l=i+8|0;m=c[l>>2]|0;do if((j|0)==(m|0))c[10108]=f&~(1<<h);else{if(m>>>0<(c[10112]|0)>>>0)Ta();n=m+12|0;if((c[n>>2]|0)==(i|0)){c[n>>2]=j;c[k>>2]=m;break}else Ta();}while(0);m=h<<3;c[i+4>>2]=m|3;k=i+(m|4)|0;c[k>>2]=c[k>>2]|1;o=l;return o|0}k=c[10110]|0;if(d>>>0>k>>>0){if(g){m=2<<e;j=g<<e&(m|0-m);m=(j&0-j)+-1|0;j=m>>>12&16;n=m>>>j;m=n>>>5&8;p=n>>>m;n=p>>>2&4;q=p>>>n;p=q>>>1&2;r=q>>>p;q=r>>>1&1;s=(m|j|n|p|q)+(r>>>q)|0;q=s<<1;r=40472+(q<<2)|0;p=40472+(q+2<<2)|0;q=c[p>>2]|0;n=q+8|0;j=c[n>>2]|0;do if((r|0)==(j|0)){c[10108]=f&~(1<<s);t=k}else{if(j>>>0<(c[10112]|0)>>>0)Ta();m=j+12|0;if((c[m>>2]|0)==(q|0)){c[m>>2]=r;c[p>>2]=j;t=c[10110]|0;break}else Ta();}while(0);j=s<<3;p=j-d|0;c[q+4>>2]=d|3;r=q+d|0;c[q+(d|4)>>2]=p|1;c[q+j>>2]=p;if(t){j=c[10113]|0;k=t>>>3;f=k<<1;e=40472+(f<<2)|0;g=c[10108]|0;l=1<<k;if(!(g&l)){c[10108]=g|l;u=40472+(f+2<<2)|0;v=e}else{l=40472+(f+2<<2)|0;f=c[l>>2]|0;if(f>>>0<(c[10112]|0)>>>0)Ta();else{u=l;v=f}}c[u>>2]=j;c[v+12>>2]=j;c[j+8>>2]=v;c[j+12>>2]=e}c[10110]=p;c[10113]=r;o=n;return o|0}r=c[10109]|0;if(!r)w=d;else{p=(r&0-r)+-1|0;r=p>>>12&16;e=p>>>r;p=e>>>5&8;j=e>>>p;e=j>>>2&4;f=j>>>e;j=f>>>1&2;l=f>>>j;f=l>>>1&1;g=c[40736+((p|r|e|j|f)+(l>>>f)<<2)>>2]|0;f=(c[g+4>>2]&-8)-d|0;l=g;j=g;while(1){g=c[l+16>>2]|0;if(!g){e=c[l+20>>2]|0;if(!e){x=f;y=j;break}else z=e}else z=g;g=(c[z+4>>2]&-8)-d|0;e=g>>>0<f>>>0;f=e?g:f;l=z;j=e?z:j}j=c[10112]|0;if(y>>>0<j>>>0)Ta();l=y+d|0;if(y>>>0>=l>>>0)Ta();f=c[y+24>>2]|0;n=c[y+12>>2]|0;do if((n|0)==(y|0)){q=y+20|0;s=c[q>>2]|0;if(!s){e=y+16|0;g=c[e>>2]|0;if(!g){A=0;break}else{B=g;C=e}}else{B=s;C=q}while(1){q=B+20|0;s=c[q>>2]|0;if(s){B=s;C=q;continue}q=B+16|0;s=c[q>>2]|0;if(!s){D=B;E=C;break}else{B=s;C=q}}if(E>>>0<j>>>0)Ta();else{c[E>>2]=0;A=D;break}}else{q=c[y+8>>2]|0;if(q>>>0<j>>>0)Ta();s=q+12|0;if((c[s>>2]|0)!=(y|0))Ta();e=n+8|0;if((c[e>>2]|0)==(y|0)){c[s>>2]=n;c[e>>2]=q;A=n;break}else Ta();}while(0);do if(f){n=c[y+28>>2]|0;j=40736+(n<<2)|0;if((y|0)==(c[j>>2]|0)){c[j>>2]=A;if(!A){c[10109]=c[10109]&~(1<<n);break}}else{if(f>>>0<(c[10112]|0)>>>0)Ta();n=f+16|0;if((c[n>>2]|0)==(y|0))c[n>>2]=A;else c[f+20>>2]=A;if(!A)break}n=c[10112]|0;if(A>>>0<n>>>0)Ta();c[A+24>>2]=f;j=c[y+16>>2]|0;do if(j)if(j>>>0<n>>>0)Ta();else{c[A+16>>2]=j;c[j+24>>2]=A;break}while(0);j=c[y+20>>2]|0;if(j)if(j>>>0<(c[10112]|0)>>>0)Ta();else{c[A+20>>2]=j;c[j+24>>2]=A;break}}while(0);if(x>>>0<16){f=x+d|0;c[y+4>>2]=f|3;j=y+(f+4)|0;c[j>>2]=c[j>>2]|1}else{c[y+4>>2]=d|3;c[y+(d|4)>>2]=x|1;c[y+(x+d)>>2]=x;j=c[10110]|0;if(j){f=c[10113]|0;n=j>>>3;j=n<<1;q=40472+(j<<2)|0;e=c[10108]|0;s=1<<n;if(!(e&s)){c[10108]=e|s;F=40472+(j+2<<2)|0;G=q}else{s=40472+(j+2<<2)|0;j=c[s>>2]|0;if(j>>>0<(c[10112]|0)>>>0)Ta();else{F=s;G=j}}c[F>>2]=f;c[G+12>>2]=f;c[f+8>>2]=G;c[f+12>>2]=q}c[10110]=x;c[10113]=l}o=y+8|0;return o|0}}else w=d}else if(a>>>0>4294967231)w=-1;else{q=a+11|0;f=q&-8;j=c[10109]|0;if(!j)w=f;else{s=0-f|0;e=q>>>8;if(!e)H=0;else if(f>>>0>16777215)H=31;else{q=(e+1048320|0)>>>16&8;n=e<<q;e=(n+520192|0)>>>16&4;g=n<<e;n=(g+245760|0)>>>16&2;r=14-(e|q|n)+(g<<n>>>15)|0;H=f>>>(r+7|0)&1|r<<1}r=c[40736+(H<<2)>>2]|0;a:do if(!r){I=s;J=0;K=0;b=86}else{n=s;g=0;q=f<<((H|0)==31?0:25-(H>>>1)|0);e=r;p=0;while(1){k=c[e+4>>2]&-8;i=k-f|0;if(i>>>0<n>>>0)if((k|0)==(f|0)){L=i;M=e;N=e;b=90;break a}else{O=i;P=e}else{O=n;P=p}i=c[e+20>>2]|0;e=c[e+16+(q>>>31<<2)>>2]|0;k=(i|0)==0|(i|0)==(e|0)?g:i;if(!e){I=O;J=k;K=P;b=86;break}else{n=O;g=k;q=q<<1;p=P}}}while(0);if((b|0)==86){if((J|0)==0&(K|0)==0){r=2<<H;s=j&(r|0-r);if(!s){w=f;break}r=(s&0-s)+-1|0;s=r>>>12&16;d=r>>>s;r=d>>>5&8;l=d>>>r;d=l>>>2&4;p=l>>>d;l=p>>>1&2;q=p>>>l;p=q>>>1&1;Q=c[40736+((r|s|d|l|p)+(q>>>p)<<2)>>2]|0;R=0}else{Q=J;R=K}if(!Q){S=I;T=R}else{L=I;M=Q;N=R;b=90}}if((b|0)==90)while(1){b=0;p=(c[M+4>>2]&-8)-f|0;q=p>>>0<L>>>0;l=q?p:L;p=q?M:N;q=c[M+16>>2]|0;if(q){L=l;M=q;N=p;b=90;continue}M=c[M+20>>2]|0;if(!M){S=l;T=p;break}else{L=l;N=p;b=90}}if(!T)w=f;else if(S>>>0<((c[10110]|0)-f|0)>>>0){j=c[10112]|0;if(T>>>0<j>>>0)Ta();p=T+f|0;if(T>>>0>=p>>>0)Ta();l=c[T+24>>2]|0;q=c[T+12>>2]|0;do if((q|0)==(T|0)){d=T+20|0;s=c[d>>2]|0;if(!s){r=T+16|0;g=c[r>>2]|0;if(!g){U=0;break}else{V=g;W=r}}else{V=s;W=d}while(1){d=V+20|0;s=c[d>>2]|0;if(s){V=s;W=d;continue}d=V+16|0;s=c[d>>2]|0;if(!s){X=V;Y=W;break}else{V=s;W=d}}if(Y>>>0<j>>>0)Ta();else{c[Y>>2]=0;U=X;break}}else{d=c[T+8>>2]|0;if(d>>>0<j>>>0)Ta();s=d+12|0;if((c[s>>2]|0)!=(T|0))Ta();r=q+8|0;if((c[r>>2]|0)==(T|0)){c[s>>2]=q;c[r>>2]=d;U=q;break}else Ta();}while(0);do if(l){q=c[T+28>>2]|0;j=40736+(q<<2)|0;if((T|0)==(c[j>>2]|0)){c[j>>2]=U;if(!U){c[10109]=c[10109]&~(1<<q);break}}else{if(l>>>0<(c[10112]|0)>>>0)Ta();q=l+16|0;if((c[q>>2]|0)==(T|0))c[q>>2]=U;else c[l+20>>2]=U;if(!U)break}q=c[10112]|0;if(U>>>0<q>>>0)Ta();c[U+24>>2]=l;j=c[T+16>>2]|0;do if(j)if(j>>>0<q>>>0)Ta();else{c[U+16>>2]=j;c[j+24>>2]=U;break}while(0);j=c[T+20>>2]|0;if(j)if(j>>>0<(c[10112]|0)>>>0)Ta();else{c[U+20>>2]=j;c[j+24>>2]=U;break}}while(0);b:do if(S>>>0<16){l=S+f|0;c[T+4>>2]=l|3;j=T+(l+4)|0;c[j>>2]=c[j>>2]|1}else{c[T+4>>2]=f|3;c[T+(f|4)>>2]=S|1;c[T+(S+f)>>2]=S;j=S>>>3;if(S>>>0<256){l=j<<1;q=40472+(l<<2)|0;d=c[10108]|0;r=1<<j;if(!(d&r)){c[10108]=d|r;Z=40472+(l+2<<2)|0;_=q}else{r=40472+(l+2<<2)|0;l=c[r>>2]|0;if(l>>>0<(c[10112]|0)>>>0)Ta();else{Z=r;_=l}}c[Z>>2]=p;c[_+12>>2]=p;c[T+(f+8)>>2]=_;c[T+(f+12)>>2]=q;break}q=S>>>8;if(!q)$=0;else if(S>>>0>16777215)$=31;else{l=(q+1048320|0)>>>16&8;r=q<<l;q=(r+520192|0)>>>16&4;d=r<<q;r=(d+245760|0)>>>16&2;j=14-(q|l|r)+(d<<r>>>15)|0;$=S>>>(j+7|0)&1|j<<1}j=40736+($<<2)|0;c[T+(f+28)>>2]=$;c[T+(f+20)>>2]=0;c[T+(f+16)>>2]=0;r=c[10109]|0;d=1<<$;if(!(r&d)){c[10109]=r|d;c[j>>2]=p;c[T+(f+24)>>2]=j;c[T+(f+12)>>2]=p;c[T+(f+8)>>2]=p;break}d=c[j>>2]|0;c:do if((c[d+4>>2]&-8|0)==(S|0))aa=d;else{j=S<<(($|0)==31?0:25-($>>>1)|0);r=d;while(1){l=r+16+(j>>>31<<2)|0;q=c[l>>2]|0;if(!q){ba=l;ca=r;break}if((c[q+4>>2]&-8|0)==(S|0)){aa=q;break c}else{j=j<<1;r=q}}if(ba>>>0<(c[10112]|0)>>>0)Ta();else{c[ba>>2]=p;c[T+(f+24)>>2]=ca;c[T+(f+12)>>2]=p;c[T+(f+8)>>2]=p;break b}}while(0);d=aa+8|0;r=c[d>>2]|0;j=c[10112]|0;if(r>>>0>=j>>>0&aa>>>0>=j>>>0){c[r+12>>2]=p;c[d>>2]=p;c[T+(f+8)>>2]=r;c[T+(f+12)>>2]=aa;c[T+(f+24)>>2]=0;break}else Ta();}while(0);o=T+8|0;return o|0}else w=f}}while(0);T=c[10110]|0;if(T>>>0>=w>>>0){aa=T-w|0;ca=c[10113]|0;if(aa>>>0>15){c[10113]=ca+w;c[10110]=aa;c[ca+(w+4)>>2]=aa|1;c[ca+T>>2]=aa;c[ca+4>>2]=w|3}else{c[10110]=0;c[10113]=0;c[ca+4>>2]=T|3;aa=ca+(T+4)|0;c[aa>>2]=c[aa>>2]|1}o=ca+8|0;return o|0}ca=c[10111]|0;if(ca>>>0>w>>>0){aa=ca-w|0;c[10111]=aa;ca=c[10114]|0;c[10114]=ca+w;c[ca+(w+4)>>2]=aa|1;c[ca+4>>2]=w|3;o=ca+8|0;return o|0}do if(!(c[10226]|0)){ca=Ca(30)|0;if(!(ca+-1&ca)){c[10228]=ca;c[10227]=ca;c[10229]=-1;c[10230]=-1;c[10231]=0;c[10219]=0;c[10226]=(Va(0)|0)&-16^1431655768;break}else Ta();}while(0);ca=w+48|0;aa=c[10228]|0;T=w+47|0;ba=aa+T|0;S=0-aa|0;aa=ba&S;if(aa>>>0<=w>>>0){o=0;return o|0}$=c[10218]|0;if($){_=c[10216]|0;Z=_+aa|0;if(Z>>>0<=_>>>0|Z>>>0>$>>>0){o=0;return o|0}}d:do if(!(c[10219]&4)){$=c[10114]|0;e:do if(!$)b=174;else{Z=40880;while(1){_=c[Z>>2]|0;if(_>>>0<=$>>>0){U=Z+4|0;if((_+(c[U>>2]|0)|0)>>>0>$>>>0){da=Z;ea=U;break}}Z=c[Z+8>>2]|0;if(!Z){b=174;break e}}Z=ba-(c[10111]|0)&S;if(Z>>>0<2147483647){U=ya(Z|0)|0;_=(U|0)==((c[da>>2]|0)+(c[ea>>2]|0)|0);X=_?Z:0;if(_)if((U|0)==(-1|0))fa=X;else{ga=U;ha=X;b=194;break d}else{ia=U;ja=Z;ka=X;b=184}}else fa=0}while(0);do if((b|0)==174){$=ya(0)|0;if(($|0)==(-1|0))fa=0;else{f=$;X=c[10227]|0;Z=X+-1|0;if(!(Z&f))la=aa;else la=aa-f+(Z+f&0-X)|0;X=c[10216]|0;f=X+la|0;if(la>>>0>w>>>0&la>>>0<2147483647){Z=c[10218]|0;if(Z)if(f>>>0<=X>>>0|f>>>0>Z>>>0){fa=0;break}Z=ya(la|0)|0;f=(Z|0)==($|0);X=f?la:0;if(f){ga=$;ha=X;b=194;break d}else{ia=Z;ja=la;ka=X;b=184}}else fa=0}}while(0);f:do if((b|0)==184){X=0-ja|0;do if(ca>>>0>ja>>>0&(ja>>>0<2147483647&(ia|0)!=(-1|0))){Z=c[10228]|0;$=T-ja+Z&0-Z;if($>>>0<2147483647)if((ya($|0)|0)==(-1|0)){ya(X|0)|0;fa=ka;break f}else{ma=$+ja|0;break}else ma=ja}else ma=ja;while(0);if((ia|0)==(-1|0))fa=ka;else{ga=ia;ha=ma;b=194;break d}}while(0);c[10219]=c[10219]|4;na=fa;b=191}else{na=0;b=191}while(0);if((b|0)==191)if(aa>>>0<2147483647){fa=ya(aa|0)|0;aa=ya(0)|0;if(fa>>>0<aa>>>0&((fa|0)!=(-1|0)&(aa|0)!=(-1|0))){ma=aa-fa|0;aa=ma>>>0>(w+40|0)>>>0;if(aa){ga=fa;ha=aa?ma:na;b=194}}}if((b|0)==194){na=(c[10216]|0)+ha|0;c[10216]=na;if(na>>>0>(c[10217]|0)>>>0)c[10217]=na;na=c[10114]|0;g:do if(!na){ma=c[10112]|0;if((ma|0)==0|ga>>>0<ma>>>0)c[10112]=ga;c[10220]=ga;c[10221]=ha;c[10223]=0;c[10117]=c[10226];c[10116]=-1;ma=0;do{aa=ma<<1;fa=40472+(aa<<2)|0;c[40472+(aa+3<<2)>>2]=fa;c[40472+(aa+2<<2)>>2]=fa;ma=ma+1|0}while((ma|0)!=32);ma=ga+8|0;fa=(ma&7|0)==0?0:0-ma&7;ma=ha+-40-fa|0;c[10114]=ga+fa;c[10111]=ma;c[ga+(fa+4)>>2]=ma|1;c[ga+(ha+-36)>>2]=40;c[10115]=c[10230]}else{ma=40880;do{fa=c[ma>>2]|0;aa=ma+4|0;ia=c[aa>>2]|0;if((ga|0)==(fa+ia|0)){oa=fa;pa=aa;qa=ia;ra=ma;b=204;break}ma=c[ma+8>>2]|0}while((ma|0)!=0);if((b|0)==204)if(!(c[ra+12>>2]&8))if(na>>>0<ga>>>0&na>>>0>=oa>>>0){c[pa>>2]=qa+ha;ma=(c[10111]|0)+ha|0;ia=na+8|0;aa=(ia&7|0)==0?0:0-ia&7;ia=ma-aa|0;c[10114]=na+aa;c[10111]=ia;c[na+(aa+4)>>2]=ia|1;c[na+(ma+4)>>2]=40;c[10115]=c[10230];break}ma=c[10112]|0;if(ga>>>0<ma>>>0){c[10112]=ga;sa=ga}else sa=ma;ma=ga+ha|0;ia=40880;while(1){if((c[ia>>2]|0)==(ma|0)){ta=ia;ua=ia;b=212;break}ia=c[ia+8>>2]|0;if(!ia){va=40880;break}}if((b|0)==212)if(!(c[ua+12>>2]&8)){c[ta>>2]=ga;ia=ua+4|0;c[ia>>2]=(c[ia>>2]|0)+ha;ia=ga+8|0;ma=(ia&7|0)==0?0:0-ia&7;ia=ga+(ha+8)|0;aa=(ia&7|0)==0?0:0-ia&7;ia=ga+(aa+ha)|0;fa=ma+w|0;ka=ga+fa|0;ja=ia-(ga+ma)-w|0;c[ga+(ma+4)>>2]=w|3;h:do if((ia|0)==(na|0)){T=(c[10111]|0)+ja|0;c[10111]=T;c[10114]=ka;c[ga+(fa+4)>>2]=T|1}else{if((ia|0)==(c[10113]|0)){T=(c[10110]|0)+ja|0;c[10110]=T;c[10113]=ka;c[ga+(fa+4)>>2]=T|1;c[ga+(T+fa)>>2]=T;break}T=ha+4|0;ca=c[ga+(T+aa)>>2]|0;if((ca&3|0)==1){la=ca&-8;ea=ca>>>3;i:do if(ca>>>0<256){da=c[ga+((aa|8)+ha)>>2]|0;S=c[ga+(ha+12+aa)>>2]|0;ba=40472+(ea<<1<<2)|0;do if((da|0)!=(ba|0)){if(da>>>0<sa>>>0)Ta();if((c[da+12>>2]|0)==(ia|0))break;Ta();}while(0);if((S|0)==(da|0)){c[10108]=c[10108]&~(1<<ea);break}do if((S|0)==(ba|0))wa=S+8|0;else{if(S>>>0<sa>>>0)Ta();X=S+8|0;if((c[X>>2]|0)==(ia|0)){wa=X;break}Ta();}while(0);c[da+12>>2]=S;c[wa>>2]=da}else{ba=c[ga+((aa|24)+ha)>>2]|0;X=c[ga+(ha+12+aa)>>2]|0;do if((X|0)==(ia|0)){$=aa|16;Z=ga+(T+$)|0;f=c[Z>>2]|0;if(!f){U=ga+($+ha)|0;$=c[U>>2]|0;if(!$){xa=0;break}else{za=$;Aa=U}}else{za=f;Aa=Z}while(1){Z=za+20|0;f=c[Z>>2]|0;if(f){za=f;Aa=Z;continue}Z=za+16|0;f=c[Z>>2]|0;if(!f){Ba=za;Da=Aa;break}else{za=f;Aa=Z}}if(Da>>>0<sa>>>0)Ta();else{c[Da>>2]=0;xa=Ba;break}}else{Z=c[ga+((aa|8)+ha)>>2]|0;if(Z>>>0<sa>>>0)Ta();f=Z+12|0;if((c[f>>2]|0)!=(ia|0))Ta();U=X+8|0;if((c[U>>2]|0)==(ia|0)){c[f>>2]=X;c[U>>2]=Z;xa=X;break}else Ta();}while(0);if(!ba)break;X=c[ga+(ha+28+aa)>>2]|0;da=40736+(X<<2)|0;do if((ia|0)==(c[da>>2]|0)){c[da>>2]=xa;if(xa)break;c[10109]=c[10109]&~(1<<X);break i}else{if(ba>>>0<(c[10112]|0)>>>0)Ta();S=ba+16|0;if((c[S>>2]|0)==(ia|0))c[S>>2]=xa;else c[ba+20>>2]=xa;if(!xa)break i}while(0);X=c[10112]|0;if(xa>>>0<X>>>0)Ta();c[xa+24>>2]=ba;da=aa|16;S=c[ga+(da+ha)>>2]|0;do if(S)if(S>>>0<X>>>0)Ta();else{c[xa+16>>2]=S;c[S+24>>2]=xa;break}while(0);S=c[ga+(T+da)>>2]|0;if(!S)break;if(S>>>0<(c[10112]|0)>>>0)Ta();else{c[xa+20>>2]=S;c[S+24>>2]=xa;break}}while(0);Ea=ga+((la|aa)+ha)|0;Fa=la+ja|0}else{Ea=ia;Fa=ja}T=Ea+4|0;c[T>>2]=c[T>>2]&-2;c[ga+(fa+4)>>2]=Fa|1;c[ga+(Fa+fa)>>2]=Fa;T=Fa>>>3;if(Fa>>>0<256){ea=T<<1;ca=40472+(ea<<2)|0;S=c[10108]|0;X=1<<T;do if(!(S&X)){c[10108]=S|X;Ga=40472+(ea+2<<2)|0;Ha=ca}else{T=40472+(ea+2<<2)|0;ba=c[T>>2]|0;if(ba>>>0>=(c[10112]|0)>>>0){Ga=T;Ha=ba;break}Ta();}while(0);c[Ga>>2]=ka;c[Ha+12>>2]=ka;c[ga+(fa+8)>>2]=Ha;c[ga+(fa+12)>>2]=ca;break}ea=Fa>>>8;do if(!ea)Ia=0;else{if(Fa>>>0>16777215){Ia=31;break}X=(ea+1048320|0)>>>16&8;S=ea<<X;la=(S+520192|0)>>>16&4;ba=S<<la;S=(ba+245760|0)>>>16&2;T=14-(la|X|S)+(ba<<S>>>15)|0;Ia=Fa>>>(T+7|0)&1|T<<1}while(0);ea=40736+(Ia<<2)|0;c[ga+(fa+28)>>2]=Ia;c[ga+(fa+20)>>2]=0;c[ga+(fa+16)>>2]=0;ca=c[10109]|0;T=1<<Ia;if(!(ca&T)){c[10109]=ca|T;c[ea>>2]=ka;c[ga+(fa+24)>>2]=ea;c[ga+(fa+12)>>2]=ka;c[ga+(fa+8)>>2]=ka;break}T=c[ea>>2]|0;j:do if((c[T+4>>2]&-8|0)==(Fa|0))Ja=T;else{ea=Fa<<((Ia|0)==31?0:25-(Ia>>>1)|0);ca=T;while(1){S=ca+16+(ea>>>31<<2)|0;ba=c[S>>2]|0;if(!ba){Ka=S;Ma=ca;break}if((c[ba+4>>2]&-8|0)==(Fa|0)){Ja=ba;break j}else{ea=ea<<1;ca=ba}}if(Ka>>>0<(c[10112]|0)>>>0)Ta();else{c[Ka>>2]=ka;c[ga+(fa+24)>>2]=Ma;c[ga+(fa+12)>>2]=ka;c[ga+(fa+8)>>2]=ka;break h}}while(0);T=Ja+8|0;ca=c[T>>2]|0;ea=c[10112]|0;if(ca>>>0>=ea>>>0&Ja>>>0>=ea>>>0){c[ca+12>>2]=ka;c[T>>2]=ka;c[ga+(fa+8)>>2]=ca;c[ga+(fa+12)>>2]=Ja;c[ga+(fa+24)>>2]=0;break}else Ta();}while(0);o=ga+(ma|8)|0;return o|0}else va=40880;while(1){fa=c[va>>2]|0;if(fa>>>0<=na>>>0){ka=c[va+4>>2]|0;ja=fa+ka|0;if(ja>>>0>na>>>0){Na=fa;Oa=ka;Pa=ja;break}}va=c[va+8>>2]|0}ma=Na+(Oa+-39)|0;ja=Na+(Oa+-47+((ma&7|0)==0?0:0-ma&7))|0;ma=na+16|0;ka=ja>>>0<ma>>>0?na:ja;ja=ka+8|0;fa=ga+8|0;ia=(fa&7|0)==0?0:0-fa&7;fa=ha+-40-ia|0;c[10114]=ga+ia;c[10111]=fa;c[ga+(ia+4)>>2]=fa|1;c[ga+(ha+-36)>>2]=40;c[10115]=c[10230];fa=ka+4|0;c[fa>>2]=27;c[ja>>2]=c[10220];c[ja+4>>2]=c[10221];c[ja+8>>2]=c[10222];c[ja+12>>2]=c[10223];c[10220]=ga;c[10221]=ha;c[10223]=0;c[10222]=ja;ja=ka+28|0;c[ja>>2]=7;if((ka+32|0)>>>0<Pa>>>0){ia=ja;do{ja=ia;ia=ia+4|0;c[ia>>2]=7}while((ja+8|0)>>>0<Pa>>>0);}if((ka|0)!=(na|0)){ia=ka-na|0;c[fa>>2]=c[fa>>2]&-2;c[na+4>>2]=ia|1;c[ka>>2]=ia;ja=ia>>>3;if(ia>>>0<256){aa=ja<<1;ca=40472+(aa<<2)|0;T=c[10108]|0;ea=1<<ja;if(!(T&ea)){c[10108]=T|ea;Qa=40472+(aa+2<<2)|0;Ra=ca}else{ea=40472+(aa+2<<2)|0;aa=c[ea>>2]|0;if(aa>>>0<(c[10112]|0)>>>0)Ta();else{Qa=ea;Ra=aa}}c[Qa>>2]=na;c[Ra+12>>2]=na;c[na+8>>2]=Ra;c[na+12>>2]=ca;break}ca=ia>>>8;if(!ca)Sa=0;else if(ia>>>0>16777215)Sa=31;else{aa=(ca+1048320|0)>>>16&8;ea=ca<<aa;ca=(ea+520192|0)>>>16&4;T=ea<<ca;ea=(T+245760|0)>>>16&2;ja=14-(ca|aa|ea)+(T<<ea>>>15)|0;Sa=ia>>>(ja+7|0)&1|ja<<1}ja=40736+(Sa<<2)|0;c[na+28>>2]=Sa;c[na+20>>2]=0;c[ma>>2]=0;ea=c[10109]|0;T=1<<Sa;if(!(ea&T)){c[10109]=ea|T;c[ja>>2]=na;c[na+24>>2]=ja;c[na+12>>2]=na;c[na+8>>2]=na;break}T=c[ja>>2]|0;k:do if((c[T+4>>2]&-8|0)==(ia|0))Ua=T;else{ja=ia<<((Sa|0)==31?0:25-(Sa>>>1)|0);ea=T;while(1){aa=ea+16+(ja>>>31<<2)|0;ca=c[aa>>2]|0;if(!ca){Wa=aa;Xa=ea;break}if((c[ca+4>>2]&-8|0)==(ia|0)){Ua=ca;break k}else{ja=ja<<1;ea=ca}}if(Wa>>>0<(c[10112]|0)>>>0)Ta();else{c[Wa>>2]=na;c[na+24>>2]=Xa;c[na+12>>2]=na;c[na+8>>2]=na;break g}}while(0);ia=Ua+8|0;T=c[ia>>2]|0;ma=c[10112]|0;if(T>>>0>=ma>>>0&Ua>>>0>=ma>>>0){c[T+12>>2]=na;c[ia>>2]=na;c[na+8>>2]=T;c[na+12>>2]=Ua;c[na+24>>2]=0;break}else Ta();}}while(0);na=c[10111]|0;if(na>>>0>w>>>0){Ua=na-w|0;c[10111]=Ua;na=c[10114]|0;c[10114]=na+w;c[na+(w+4)>>2]=Ua|1;c[na+4>>2]=w|3;o=na+8|0;return o|0}}c[(La()|0)>>2]=12;o=0;return o|0}function qb(b,e,f){b=b|0;e=e|0;f=f|0;var g=0,h=0,j=0,k=0,l=0,m=0.0,n=0,o=0,p=0,q=0,r=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,P=0,Q=0,R=0,S=0,T=0,U=0,V=0.0,W=0,X=0.0,Y=0,Z=0,_=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0.0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0.0,qa=0,ra=0.0,sa=0,ta=0.0,ua=0,va=0.0,wa=0.0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0,Fa=0,Ga=0.0,Ha=0,Ia=0,Ja=0,Ka=0,Ma=0.0,Na=0,Oa=0,Pa=0,Qa=0.0,Ra=0.0,Sa=0,Ta=0,Ua=0,Va=0,Wa=0,Xa=0,Ya=0,Za=0,_a=0,$a=0,ab=0,bb=0,cb=0,db=0,eb=0,fb=0,gb=0,hb=0,ib=0,jb=0,kb=0,lb=0,mb=0,nb=0,ob=0,pb=0,qb=0,rb=0,sb=0,tb=0,ub=0,vb=0,wb=0,xb=0,yb=0,zb=0,Ab=0,Bb=0,Cb=0,Db=0,Eb=0,Fb=0,Gb=0,Hb=0,Ib=0,Jb=0,Kb=0,Mb=0,Nb=0,Ob=0,Pb=0,Qb=0,Rb=0,Sb=0,Tb=0,Ub=0,Vb=0,Wb=0,Xb=0,Yb=0,Zb=0,_b=0,$b=0,ac=0,bc=0.0,cc=0,dc=0,fc=0,gc=0,hc=0,ic=0,jc=0,kc=0,lc=0,mc=0,nc=0,oc=0,pc=0,qc=0,rc=0,sc=0,tc=0,uc=0,vc=0,wc=0,xc=0,yc=0,zc=0,Ac=0,Bc=0,Dc=0,Ec=0,Fc=0,Gc=0,Hc=0,Ic=0,Jc=0,Kc=0,Lc=0,Mc=0,Nc=0,Oc=0,Pc=0,Qc=0,Rc=0,Sc=0,Tc=0,Uc=0,Vc=0,Wc=0,Xc=0,Yc=0,Zc=0,_c=0,$c=0,ad=0,bd=0,cd=0,dd=0,ed=0,fd=0,gd=0,hd=0,id=0.0,jd=0.0,kd=0.0,ld=0.0,md=0.0,nd=0.0,od=0.0,pd=0,qd=0,sd=0.0,td=0,ud=0.0,wd=0;g=0;g=0;h=i;i=i+512|0;j=h;if((e|0)==1){k=53;l=-1074}else if(!e){k=24;l=-149}else if((e|0)==2){k=53;l=-1074}else{m=0.0;i=h;return +m}e=b+4|0;n=b+100|0;do{o=c[e>>2]|0;if(o>>>0<(c[n>>2]|0)>>>0){c[e>>2]=o+1;p=d[o>>0]|0}else p=ec(b)|0}while((me(p)|0)!=0);q=p;do if((q|0)==43|(q|0)==45){p=1-(((q|0)==45&1)<<1)|0;o=c[e>>2]|0;if(o>>>0<(c[n>>2]|0)>>>0){c[e>>2]=o+1;r=d[o>>0]|0;u=p;break}else{r=ec(b)|0;u=p;break}}else{r=q;u=1}while(0);q=r;r=0;while(1){if((q|32|0)!=(a[39704+r>>0]|0)){v=q;w=r;break}do if(r>>>0<7){p=c[e>>2]|0;if(p>>>0<(c[n>>2]|0)>>>0){c[e>>2]=p+1;x=d[p>>0]|0;break}else{x=ec(b)|0;break}}else x=q;while(0);p=r+1|0;if(p>>>0<8){q=x;r=p}else{v=x;w=p;break}}do if((w|0)==3)g=23;else if((w|0)!=8){x=(f|0)!=0;if(x&w>>>0>3)if((w|0)==8)break;else{g=23;break}do if(!w){if((v|32|0)==110){r=c[e>>2]|0;if(r>>>0<(c[n>>2]|0)>>>0){c[e>>2]=r+1;y=d[r>>0]|0}else y=ec(b)|0;if((y|32|0)!=97)break;r=c[e>>2]|0;if(r>>>0<(c[n>>2]|0)>>>0){c[e>>2]=r+1;z=d[r>>0]|0}else z=ec(b)|0;if((z|32|0)!=110)break;r=c[e>>2]|0;if(r>>>0<(c[n>>2]|0)>>>0){c[e>>2]=r+1;A=d[r>>0]|0}else A=ec(b)|0;if((A|0)==40)B=1;else{if(!(c[n>>2]|0)){m=s;i=h;return +m}c[e>>2]=(c[e>>2]|0)+-1;m=s;i=h;return +m}while(1){r=c[e>>2]|0;if(r>>>0<(c[n>>2]|0)>>>0){c[e>>2]=r+1;C=d[r>>0]|0}else C=ec(b)|0;if(!((C+-48|0)>>>0<10|(C+-65|0)>>>0<26))if(!((C|0)==95|(C+-97|0)>>>0<26)){E=C;F=B;break}B=B+1|0}if((E|0)==41){m=s;i=h;return +m}r=(c[n>>2]|0)==0;if(!r)c[e>>2]=(c[e>>2]|0)+-1;if(!x){c[(La()|0)>>2]=22;rd(b,0);m=0.0;i=h;return +m}if((F|0)==0|r){m=s;i=h;return +m}r=F;q=c[e>>2]|0;while(1){r=r+-1|0;p=q+-1|0;if(!r){G=p;break}else q=p}c[e>>2]=G;m=s;i=h;return +m}do if((v|0)==48){q=c[e>>2]|0;if(q>>>0<(c[n>>2]|0)>>>0){c[e>>2]=q+1;H=d[q>>0]|0}else H=ec(b)|0;if((H|32|0)!=120){if(!(c[n>>2]|0)){I=48;break}c[e>>2]=(c[e>>2]|0)+-1;I=48;break}q=c[e>>2]|0;if(q>>>0<(c[n>>2]|0)>>>0){c[e>>2]=q+1;J=d[q>>0]|0;K=0}else{J=ec(b)|0;K=0}while(1){if((J|0)==46){L=K;g=71;break}else if((J|0)!=48){M=0;N=0;P=0;Q=0;R=J;S=K;T=0;U=0;V=1.0;W=0;X=0.0;break}q=c[e>>2]|0;if(q>>>0<(c[n>>2]|0)>>>0){c[e>>2]=q+1;J=d[q>>0]|0;K=1;continue}else{J=ec(b)|0;K=1;continue}}if((g|0)==71){q=c[e>>2]|0;if(q>>>0<(c[n>>2]|0)>>>0){c[e>>2]=q+1;Y=d[q>>0]|0}else Y=ec(b)|0;if((Y|0)==48){q=0;r=0;while(1){p=c[e>>2]|0;if(p>>>0<(c[n>>2]|0)>>>0){c[e>>2]=p+1;Z=d[p>>0]|0}else Z=ec(b)|0;p=Pd(q|0,r|0,-1,-1)|0;o=D;if((Z|0)==48){q=p;r=o}else{M=0;N=0;P=p;Q=o;R=Z;S=1;T=1;U=0;V=1.0;W=0;X=0.0;break}}}else{M=0;N=0;P=0;Q=0;R=Y;S=L;T=1;U=0;V=1.0;W=0;X=0.0}}while(1){r=R+-48|0;q=R|32;if(r>>>0<10)g=83;else{o=(R|0)==46;if(!(o|(q+-97|0)>>>0<6)){_=N;aa=P;ba=M;ca=Q;da=R;ea=S;fa=T;ga=W;ha=X;break}if(o)if(!T){ia=N;ja=M;ka=N;la=M;ma=S;na=1;oa=U;pa=V;qa=W;ra=X}else{_=N;aa=P;ba=M;ca=Q;da=46;ea=S;fa=T;ga=W;ha=X;break}else g=83}if((g|0)==83){g=0;o=(R|0)>57?q+-87|0:r;do if((M|0)<0|(M|0)==0&N>>>0<8){sa=U;ta=V;ua=o+(W<<4)|0;va=X}else{if((M|0)<0|(M|0)==0&N>>>0<14){wa=V*.0625;sa=U;ta=wa;ua=W;va=X+wa*+(o|0);break}if((U|0)!=0|(o|0)==0){sa=U;ta=V;ua=W;va=X}else{sa=1;ta=V;ua=W;va=X+V*.5}}while(0);o=Pd(N|0,M|0,1,0)|0;ia=P;ja=Q;ka=o;la=D;ma=1;na=T;oa=sa;pa=ta;qa=ua;ra=va}o=c[e>>2]|0;if(o>>>0<(c[n>>2]|0)>>>0){c[e>>2]=o+1;M=la;N=ka;P=ia;Q=ja;R=d[o>>0]|0;S=ma;T=na;U=oa;V=pa;W=qa;X=ra;continue}else{M=la;N=ka;P=ia;Q=ja;R=ec(b)|0;S=ma;T=na;U=oa;V=pa;W=qa;X=ra;continue}}if(!ea){o=(c[n>>2]|0)==0;if(!o)c[e>>2]=(c[e>>2]|0)+-1;if(!f)rd(b,0);else if(!o){o=c[e>>2]|0;c[e>>2]=o+-1;if(fa)c[e>>2]=o+-2}m=+(u|0)*0.0;i=h;return +m}o=(fa|0)==0;r=o?_:aa;q=o?ba:ca;if((ba|0)<0|(ba|0)==0&_>>>0<8){o=_;p=ba;xa=ga;while(1){ya=xa<<4;o=Pd(o|0,p|0,1,0)|0;p=D;if(!((p|0)<0|(p|0)==0&o>>>0<8)){za=ya;break}else xa=ya}}else za=ga;do if((da|32|0)==112){xa=Lb(b,f)|0;o=D;if((xa|0)==0&(o|0)==-2147483648)if(!f){rd(b,0);m=0.0;i=h;return +m}else{if(!(c[n>>2]|0)){Aa=0;Ba=0;break}c[e>>2]=(c[e>>2]|0)+-1;Aa=0;Ba=0;break}else{Aa=xa;Ba=o}}else if(!(c[n>>2]|0)){Aa=0;Ba=0}else{c[e>>2]=(c[e>>2]|0)+-1;Aa=0;Ba=0}while(0);o=Ld(r|0,q|0,2)|0;xa=Pd(o|0,D|0,-32,-1)|0;o=Pd(xa|0,D|0,Aa|0,Ba|0)|0;xa=D;if(!za){m=+(u|0)*0.0;i=h;return +m}if((xa|0)>0|(xa|0)==0&o>>>0>(0-l|0)>>>0){c[(La()|0)>>2]=34;m=+(u|0)*1797693134862315708145274.0e284*1797693134862315708145274.0e284;i=h;return +m}p=l+-106|0;ya=((p|0)<0)<<31>>31;if((xa|0)<(ya|0)|(xa|0)==(ya|0)&o>>>0<p>>>0){c[(La()|0)>>2]=34;m=+(u|0)*2.2250738585072014e-308*2.2250738585072014e-308;i=h;return +m}if((za|0)>-1){p=o;ya=xa;Ca=za;wa=ha;while(1){Da=!(wa>=.5);Ea=Da&1|Ca<<1;Fa=Ea^1;Ga=wa+(Da?wa:wa+-1.0);Da=Pd(p|0,ya|0,-1,-1)|0;Ha=D;if((Ea|0)>-1){p=Da;ya=Ha;Ca=Fa;wa=Ga}else{Ia=Da;Ja=Ha;Ka=Fa;Ma=Ga;break}}}else{Ia=o;Ja=xa;Ka=za;Ma=ha}Ca=Dd(32,0,l|0,((l|0)<0)<<31>>31|0)|0;ya=Pd(Ia|0,Ja|0,Ca|0,D|0)|0;Ca=D;if(0>(Ca|0)|0==(Ca|0)&k>>>0>ya>>>0)if((ya|0)<0){Na=0;g=124}else{Oa=ya;g=122}else{Oa=k;g=122}do if((g|0)==122){if((Oa|0)<53){Na=Oa;g=124;break}Pa=Oa;Qa=+(u|0);Ra=0.0}while(0);if((g|0)==124){wa=+(u|0);Pa=Na;Qa=wa;Ra=+pe(+Cc(1.0,84-Na|0),wa);}xa=(Ka&1|0)==0&(Ma!=0.0&(Pa|0)<32);wa=Qa*(xa?0.0:Ma)+(Ra+Qa*+(((xa&1)+Ka|0)>>>0))-Ra;if(!(wa!=0.0))c[(La()|0)>>2]=34;m=+se(wa,Ia);i=h;return +m}else I=v;while(0);xa=l+k|0;o=0-xa|0;ya=I;Ca=0;while(1){if((ya|0)==46){Sa=Ca;g=135;break}else if((ya|0)!=48){Ta=ya;Ua=0;Va=0;Wa=Ca;Xa=0;break}p=c[e>>2]|0;if(p>>>0<(c[n>>2]|0)>>>0){c[e>>2]=p+1;ya=d[p>>0]|0;Ca=1;continue}else{ya=ec(b)|0;Ca=1;continue}}if((g|0)==135){Ca=c[e>>2]|0;if(Ca>>>0<(c[n>>2]|0)>>>0){c[e>>2]=Ca+1;Ya=d[Ca>>0]|0}else Ya=ec(b)|0;if((Ya|0)==48){Ca=0;ya=0;while(1){p=Pd(Ca|0,ya|0,-1,-1)|0;q=D;r=c[e>>2]|0;if(r>>>0<(c[n>>2]|0)>>>0){c[e>>2]=r+1;Za=d[r>>0]|0}else Za=ec(b)|0;if((Za|0)==48){Ca=p;ya=q}else{Ta=Za;Ua=p;Va=q;Wa=1;Xa=1;break}}}else{Ta=Ya;Ua=0;Va=0;Wa=Sa;Xa=1}}c[j>>2]=0;ya=Ta+-48|0;Ca=(Ta|0)==46;a:do if(Ca|ya>>>0<10){q=j+496|0;p=Ta;r=0;Fa=0;Ha=Ca;Da=ya;Ea=Ua;_a=Va;$a=Wa;ab=Xa;bb=0;cb=0;db=0;b:while(1){do if(Ha)if(!ab){eb=r;fb=Fa;gb=r;hb=Fa;ib=$a;jb=1;kb=bb;lb=cb;mb=db}else{nb=Ea;ob=_a;pb=r;qb=Fa;rb=$a;sb=bb;tb=cb;ub=db;break b}else{vb=Pd(r|0,Fa|0,1,0)|0;wb=D;xb=(p|0)!=48;if((cb|0)>=125){if(!xb){eb=Ea;fb=_a;gb=vb;hb=wb;ib=$a;jb=ab;kb=bb;lb=cb;mb=db;break}c[q>>2]=c[q>>2]|1;eb=Ea;fb=_a;gb=vb;hb=wb;ib=$a;jb=ab;kb=bb;lb=cb;mb=db;break}yb=j+(cb<<2)|0;if(!bb)zb=Da;else zb=p+-48+((c[yb>>2]|0)*10|0)|0;c[yb>>2]=zb;yb=bb+1|0;Ab=(yb|0)==9;eb=Ea;fb=_a;gb=vb;hb=wb;ib=1;jb=ab;kb=Ab?0:yb;lb=(Ab&1)+cb|0;mb=xb?vb:db}while(0);vb=c[e>>2]|0;if(vb>>>0<(c[n>>2]|0)>>>0){c[e>>2]=vb+1;Bb=d[vb>>0]|0}else Bb=ec(b)|0;Da=Bb+-48|0;Ha=(Bb|0)==46;if(!(Ha|Da>>>0<10)){Cb=Bb;Db=gb;Eb=eb;Fb=hb;Gb=fb;Hb=ib;Ib=jb;Jb=kb;Kb=lb;Mb=mb;g=158;break a}else{p=Bb;r=gb;Fa=hb;Ea=eb;_a=fb;$a=ib;ab=jb;bb=kb;cb=lb;db=mb}}Nb=pb;Ob=qb;Pb=nb;Qb=ob;Rb=(rb|0)!=0;Sb=sb;Tb=tb;Ub=ub;g=166}else{Cb=Ta;Db=0;Eb=Ua;Fb=0;Gb=Va;Hb=Wa;Ib=Xa;Jb=0;Kb=0;Mb=0;g=158}while(0);do if((g|0)==158){ya=(Ib|0)==0;Ca=ya?Db:Eb;db=ya?Fb:Gb;ya=(Hb|0)!=0;if(!((Cb|32|0)==101&ya))if((Cb|0)>-1){Nb=Db;Ob=Fb;Pb=Ca;Qb=db;Rb=ya;Sb=Jb;Tb=Kb;Ub=Mb;g=166;break}else{Vb=Db;Wb=Fb;Xb=ya;Yb=Ca;Zb=db;_b=Jb;$b=Kb;ac=Mb;g=168;break}ya=Lb(b,f)|0;cb=D;if((ya|0)==0&(cb|0)==-2147483648){if(!f){rd(b,0);bc=0.0;break}if(!(c[n>>2]|0)){cc=0;dc=0}else{c[e>>2]=(c[e>>2]|0)+-1;cc=0;dc=0}}else{cc=ya;dc=cb}cb=Pd(cc|0,dc|0,Ca|0,db|0)|0;fc=cb;gc=Db;hc=D;ic=Fb;jc=Jb;kc=Kb;lc=Mb;g=170}while(0);if((g|0)==166)if(!(c[n>>2]|0)){Vb=Nb;Wb=Ob;Xb=Rb;Yb=Pb;Zb=Qb;_b=Sb;$b=Tb;ac=Ub;g=168}else{c[e>>2]=(c[e>>2]|0)+-1;if(Rb){fc=Pb;gc=Nb;hc=Qb;ic=Ob;jc=Sb;kc=Tb;lc=Ub;g=170}else g=169}if((g|0)==168)if(Xb){fc=Yb;gc=Vb;hc=Zb;ic=Wb;jc=_b;kc=$b;lc=ac;g=170}else g=169;do if((g|0)==169){c[(La()|0)>>2]=22;rd(b,0);bc=0.0}else if((g|0)==170){cb=c[j>>2]|0;if(!cb){bc=+(u|0)*0.0;break}if(((ic|0)<0|(ic|0)==0&gc>>>0<10)&((fc|0)==(gc|0)&(hc|0)==(ic|0)))if(k>>>0>30|(cb>>>k|0)==0){bc=+(u|0)*+(cb>>>0);break}cb=(l|0)/-2|0;db=((cb|0)<0)<<31>>31;if((hc|0)>(db|0)|(hc|0)==(db|0)&fc>>>0>cb>>>0){c[(La()|0)>>2]=34;bc=+(u|0)*1797693134862315708145274.0e284*1797693134862315708145274.0e284;break}cb=l+-106|0;db=((cb|0)<0)<<31>>31;if((hc|0)<(db|0)|(hc|0)==(db|0)&fc>>>0<cb>>>0){c[(La()|0)>>2]=34;bc=+(u|0)*2.2250738585072014e-308*2.2250738585072014e-308;break}if(!jc)mc=kc;else{if((jc|0)<9){cb=j+(kc<<2)|0;db=c[cb>>2]|0;Ca=jc;while(1){ya=db*10|0;Ca=Ca+1|0;if((Ca|0)==9){nc=ya;break}else db=ya}c[cb>>2]=nc}mc=kc+1|0}if((lc|0)<9)if((lc|0)<=(fc|0)&(fc|0)<18){if((fc|0)==9){bc=+(u|0)*+((c[j>>2]|0)>>>0);break}if((fc|0)<9){bc=+(u|0)*+((c[j>>2]|0)>>>0)/+(c[39720+(8-fc<<2)>>2]|0);break}db=k+27+($(fc,-3)|0)|0;Ca=c[j>>2]|0;if((db|0)>30|(Ca>>>db|0)==0){bc=+(u|0)*+(Ca>>>0)*+(c[39720+(fc+-10<<2)>>2]|0);break}}Ca=(fc|0)%9|0;if(!Ca){oc=0;pc=0;qc=fc;rc=mc}else{db=(fc|0)>-1?Ca:Ca+9|0;Ca=c[39720+(8-db<<2)>>2]|0;if(!mc){sc=0;tc=fc;uc=0}else{ya=1e9/(Ca|0)|0;bb=0;ab=0;$a=0;_a=fc;while(1){Ea=j+($a<<2)|0;Fa=c[Ea>>2]|0;r=((Fa>>>0)/(Ca>>>0)|0)+ab|0;c[Ea>>2]=r;Ea=$((Fa>>>0)%(Ca>>>0)|0,ya)|0;Fa=($a|0)==(bb|0)&(r|0)==0;$a=$a+1|0;r=Fa?_a+-9|0:_a;p=Fa?$a&127:bb;if(($a|0)==(mc|0)){vc=Ea;wc=p;xc=r;break}else{bb=p;ab=Ea;_a=r}}if(!vc){sc=wc;tc=xc;uc=mc}else{c[j+(mc<<2)>>2]=vc;sc=wc;tc=xc;uc=mc+1|0}}oc=sc;pc=0;qc=9-db+tc|0;rc=uc}c:while(1){_a=j+(oc<<2)|0;if((qc|0)<18){ab=pc;bb=rc;while(1){$a=0;ya=bb+127|0;Ca=bb;while(1){cb=ya&127;r=j+(cb<<2)|0;Ea=Ld(c[r>>2]|0,0,29)|0;p=Pd(Ea|0,D|0,$a|0,0)|0;Ea=D;if(Ea>>>0>0|(Ea|0)==0&p>>>0>1e9){Fa=_d(p|0,Ea|0,1e9,0)|0;Da=vd(p|0,Ea|0,1e9,0)|0;yc=Da;zc=Fa}else{yc=p;zc=0}c[r>>2]=yc;r=(cb|0)==(oc|0);p=(cb|0)!=(Ca+127&127|0)|r?Ca:(yc|0)==0?cb:Ca;if(r){Ac=zc;Bc=p;break}else{$a=zc;ya=cb+-1|0;Ca=p}}Ca=ab+-29|0;if(!Ac){ab=Ca;bb=Bc}else{Dc=Ca;Ec=Ac;Fc=Bc;break}}}else{if((qc|0)==18){Gc=pc;Hc=rc}else{Ic=oc;Jc=pc;Kc=qc;Lc=rc;break}while(1){if((c[_a>>2]|0)>>>0>=9007199){Ic=oc;Jc=Gc;Kc=18;Lc=Hc;break c}bb=0;ab=Hc+127|0;Ca=Hc;while(1){ya=ab&127;$a=j+(ya<<2)|0;p=Ld(c[$a>>2]|0,0,29)|0;cb=Pd(p|0,D|0,bb|0,0)|0;p=D;if(p>>>0>0|(p|0)==0&cb>>>0>1e9){r=_d(cb|0,p|0,1e9,0)|0;Fa=vd(cb|0,p|0,1e9,0)|0;Mc=Fa;Nc=r}else{Mc=cb;Nc=0}c[$a>>2]=Mc;$a=(ya|0)==(oc|0);cb=(ya|0)!=(Ca+127&127|0)|$a?Ca:(Mc|0)==0?ya:Ca;if($a){Oc=Nc;Pc=cb;break}else{bb=Nc;ab=ya+-1|0;Ca=cb}}Ca=Gc+-29|0;if(!Oc){Gc=Ca;Hc=Pc}else{Dc=Ca;Ec=Oc;Fc=Pc;break}}}_a=oc+127&127;if((_a|0)==(Fc|0)){Ca=Fc+127&127;ab=j+((Fc+126&127)<<2)|0;c[ab>>2]=c[ab>>2]|c[j+(Ca<<2)>>2];Qc=Ca}else Qc=Fc;c[j+(_a<<2)>>2]=Ec;oc=_a;pc=Dc;qc=qc+9|0;rc=Qc}d:while(1){Rc=Lc+1&127;db=j+((Lc+127&127)<<2)|0;_a=Ic;Ca=Jc;ab=Kc;while(1){bb=(ab|0)==18;cb=(ab|0)>27?9:1;ya=bb^1;Sc=_a;Tc=Ca;while(1){Uc=Sc&127;Vc=(Uc|0)==(Lc|0);do if(Vc)g=220;else{$a=c[j+(Uc<<2)>>2]|0;if($a>>>0<9007199){g=220;break}if($a>>>0>9007199)break;$a=Sc+1&127;if(($a|0)==(Lc|0)){g=220;break}r=c[j+($a<<2)>>2]|0;if(r>>>0<254740991){g=220;break}if(!(r>>>0>254740991|ya)){Wc=Uc;Xc=Sc;Yc=Tc;Zc=Lc;break d}}while(0);if((g|0)==220){g=0;if(bb){g=221;break d}}r=Tc+cb|0;if((Sc|0)==(Lc|0)){Sc=Lc;Tc=r}else{_c=r;$c=Sc;break}}bb=(1<<cb)+-1|0;ya=1e9>>>cb;r=$c;$a=0;Fa=$c;p=ab;while(1){Da=j+(Fa<<2)|0;Ea=c[Da>>2]|0;Ha=(Ea>>>cb)+$a|0;c[Da>>2]=Ha;Da=$(Ea&bb,ya)|0;Ea=(Fa|0)==(r|0)&(Ha|0)==0;Fa=Fa+1&127;Ha=Ea?p+-9|0:p;q=Ea?Fa:r;if((Fa|0)==(Lc|0)){ad=Da;bd=q;cd=Ha;break}else{r=q;$a=Da;p=Ha}}if(!ad){_a=bd;Ca=_c;ab=cd;continue}if((Rc|0)!=(bd|0)){dd=_c;ed=ad;fd=bd;gd=cd;break}c[db>>2]=c[db>>2]|1;_a=bd;Ca=_c;ab=cd}c[j+(Lc<<2)>>2]=ed;Ic=fd;Jc=dd;Kc=gd;Lc=Rc}if((g|0)==221)if(Vc){c[j+(Rc+-1<<2)>>2]=0;Wc=Lc;Xc=Sc;Yc=Tc;Zc=Rc}else{Wc=Uc;Xc=Sc;Yc=Tc;Zc=Lc}wa=+((c[j+(Wc<<2)>>2]|0)>>>0);ab=Xc+1&127;if((ab|0)==(Zc|0)){Ca=Xc+2&127;c[j+(Ca+-1<<2)>>2]=0;hd=Ca}else hd=Zc;Ga=+(u|0);id=Ga*(wa*1.0e9+ +((c[j+(ab<<2)>>2]|0)>>>0));ab=Yc+53|0;Ca=ab-l|0;_a=(Ca|0)<(k|0);db=_a&1;p=_a?((Ca|0)<0?0:Ca):k;if((p|0)<53){wa=+pe(+Cc(1.0,105-p|0),id);jd=+Ge(id,+Cc(1.0,53-p|0));kd=wa;ld=jd;md=wa+(id-jd);}else{kd=0.0;ld=0.0;md=id}$a=Xc+2&127;do if(($a|0)==(hd|0))nd=ld;else{r=c[j+($a<<2)>>2]|0;do if(r>>>0<5e8){if(!r)if((Xc+3&127|0)==(hd|0)){od=ld;break}od=Ga*.25+ld}else{if(r>>>0>5e8){od=Ga*.75+ld;break}if((Xc+3&127|0)==(hd|0)){od=Ga*.5+ld;break}else{od=Ga*.75+ld;break}}while(0);if((53-p|0)<=1){nd=od;break}if(+Ge(od,1.0)!=0.0){nd=od;break}nd=od+1.0}while(0);Ga=md+nd-kd;do if((ab&2147483647|0)>(-2-xa|0)){if(!(+O(+Ga)>=9007199254740992.0)){pd=db;qd=Yc;sd=Ga}else{pd=_a&(p|0)==(Ca|0)?0:db;qd=Yc+1|0;sd=Ga*.5}if((qd+50|0)<=(o|0))if(!(nd!=0.0&(pd|0)!=0)){td=qd;ud=sd;break}c[(La()|0)>>2]=34;td=qd;ud=sd}else{td=Yc;ud=Ga}while(0);bc=+se(ud,td);}while(0);m=bc;i=h;return +m}while(0);if(c[n>>2]|0)c[e>>2]=(c[e>>2]|0)+-1;c[(La()|0)>>2]=22;rd(b,0);m=0.0;i=h;return +m}while(0);if((g|0)==23){g=(c[n>>2]|0)==0;if(!g)c[e>>2]=(c[e>>2]|0)+-1;if(!(w>>>0<4|(f|0)==0|g)){g=c[e>>2]|0;f=w;while(1){w=g+-1|0;f=f+-1|0;if(f>>>0<=3){wd=w;break}else g=w}c[e>>2]=wd}}m=+(u|0)*t;i=h;return +m}function rb(e,f,g){e=e|0;f=f|0;g=g|0;var j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,R=0,T=0,U=0,V=0,W=0,X=0,Y=0,Z=0,_=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0,Fa=0,Ga=0,Ha=0,Ia=0,Ja=0,Ka=0,La=0,Ma=0,Na=0,Oa=0,Pa=0,Qa=0,Ra=0,Sa=0,Ta=0,Ua=0,Va=0,Wa=0,Xa=0,Ya=0,Za=0,_a=0,$a=0,ab=0.0,bb=0.0,cb=0.0,db=0.0,eb=0,fb=0,gb=0.0,hb=0.0,ib=0.0,jb=0,lb=0,mb=0,nb=0,ob=0,qb=0,rb=0,sb=0,tb=0,ub=0,vb=0,wb=0,xb=0,yb=0,zb=0.0,Ab=0.0,Bb=0.0,Cb=0,Eb=0,Fb=0,Gb=0,Hb=0,Ib=0,Jb=0,Kb=0,Lb=0,Mb=0,Nb=0,Ob=0,Pb=0,Qb=0,Rb=0,Sb=0,Tb=0,Ub=0,Vb=0,Wb=0,Xb=0,Zb=0,$b=0,bc=0,cc=0,dc=0,ec=0,fc=0,gc=0,hc=0;j=0;j=0;k=i;i=i+288|0;l=k;if((c[208]|0)!=1){_b(1176,784,1909,8,0,0);m=-1;i=k;return m|0}if(!e){_b(1176,784,1913,9,1056,0);m=-1;i=k;return m|0}if(!f){_b(1176,784,1917,9,1200,0);m=-1;i=k;return m|0}if(!g){m=0;i=k;return m|0}if(g&3){_b(1176,784,1924,9,1224,0);m=-1;i=k;return m|0}n=e+36|0;if(!(b[n>>1]&2)){o=e+12|0;p=c[o>>2]|0;Xd(e);$c(f|0,0,g|0)|0;q=g>>>1;r=e+229960|0;s=c[r>>2]|0;if(q>>>0>s>>>0){t=q>>>0>s<<1>>>0?q:s+8192|0;c[r>>2]=t;r=e+229956|0;s=Vc(c[r>>2]|0,t<<2)|0;c[r>>2]=s;u=s}else u=c[e+229956>>2]|0;$c(u|0,0,q<<2|0)|0;q=e+28|0;s=e+4|0;r=e+564|0;t=e+32|0;v=g;w=c[s>>2]|0;x=0;y=p;p=u;a:while(1){b:do if(!w){z=y;while(1){A=c[z>>2]|0;if(!A){B=z;break}kb[A&63](e,z+4|0);if(!(b[n>>1]&8))j=125;else if(!(c[z+20>>2]|0)){A=c[r>>2]|0;if(A){C=A;do{a[C+53>>0]=1;C=c[C+40>>2]|0}while((C|0)!=0);}Yb(e);D=c[s>>2]|0;E=c[o>>2]|0}else j=125;if((j|0)==125){j=0;C=c[z+12>>2]|0;c[s>>2]=C;A=z+20|0;c[o>>2]=A;D=C;E=A}if(!D)z=E;else{F=D;G=E;break b}}z=c[q>>2]|0;A=c[t>>2]|0;if(A>>>0<=z>>>0){H=x;break a}C=A-z|0;z=v>>>2;if(C>>>0>z>>>0){c[s>>2]=z;F=z;G=B;break}else{c[s>>2]=C;F=C;G=B;break}}else{F=w;G=y}while(0);C=v>>>2;if(F>>>0>C>>>0){I=C;j=132}else if(!F){J=v;K=0;L=x;M=p}else{I=F;j=132}if((j|0)==132){j=0;C=I;z=p;while(1){A=c[r>>2]|0;if(!A){N=0;O=0}else{P=0;R=A;A=0;c:while(1){T=R+12|0;U=c[R+8>>2]|0;V=c[U+96>>2]|0;W=R+28|0;X=R+32|0;Y=a[X>>0]|0;Z=R+20|0;_=R+24|0;aa=U+4|0;ba=U+12|0;ca=c[T>>2]|0;da=c[W>>2]|0;ea=c[R+44>>2]|0;fa=c[R+48>>2]|0;ga=c[R+16>>2]|0;d:do if(!(Y&4)){ha=c[U>>2]|0;ia=Y&255;ja=(ia&32|0)==0;ka=(ia&128|0)==0;ia=U+84|0;la=U+56|0;ma=ca;na=da;oa=P;pa=A;while(1){qa=ma>>>10;ra=b[V+(qa<<1)>>1]|0;sa=($((($((b[V+(qa+1<<1)>>1]|0)-ra|0,ma&1023)|0)/1024|0)+ra|0,na>>12)|0)/1024|0;ra=(($(sa,ea)|0)/1024|0)+oa|0;qa=(($(sa,fa)|0)/1024|0)+pa|0;sa=ma+ga|0;c[T>>2]=sa;if(sa>>>0>=ha>>>0){ta=qa;ua=ra;j=167;break d}va=c[Z>>2]|0;if(!va){wa=ra;xa=qa;j=150;break d}ya=va+na|0;c[W>>2]=ya;za=a[_>>0]|0;Aa=za&255;Ba=c[U+64+(Aa<<2)>>2]|0;if((va|0)<0){if((ya|0)>(Ba|0)){Ca=ra;Da=qa;j=153;break d}}else if((ya|0)<(Ba|0)){Ea=ra;Fa=qa;j=155;break d}c[W>>2]=Ba;if(!Aa){Ga=ra;Ha=qa;Ia=Ba;Ja=za;j=157;break d}else if((Aa|0)==5){Ka=ra;La=qa;Ma=Ba;j=163;break d}else if((Aa|0)==6){ta=qa;ua=ra;j=167;break d}else if((Aa|0)!=2){Na=za;Oa=Ba;Pa=qa;Qa=ra;j=180;break d}if(!ja){Ra=ra;Sa=qa;j=160;break d}if(ka){Na=za;Oa=Ba;Pa=qa;Qa=ra;j=180;break d}a[_>>0]=5;za=c[la>>2]|0;c[Z>>2]=(Ba|0)>(c[ia>>2]|0)?0-za|0:za;ma=sa;na=Ba;oa=ra;pa=qa}}else{pa=Y&255;oa=(pa&32|0)==0;na=(pa&128|0)==0;pa=U+84|0;ma=U+56|0;ia=c[U+8>>2]|0;la=ca;ka=da;ja=P;ha=A;while(1){qa=la>>>10;ra=b[V+(qa<<1)>>1]|0;Ba=($((($((b[V+(qa+1<<1)>>1]|0)-ra|0,la&1023)|0)/1024|0)+ra|0,ka>>12)|0)/1024|0;ra=(($(Ba,ea)|0)/1024|0)+ja|0;qa=(($(Ba,fa)|0)/1024|0)+ha|0;Ba=la+ga|0;c[T>>2]=Ba;if(Ba>>>0>ia>>>0){sa=c[aa>>2]|0;za=(((Ba-sa|0)>>>0)%((c[ba>>2]|0)>>>0)|0)+sa|0;c[T>>2]=za;Ta=za}else Ta=Ba;Ba=c[Z>>2]|0;if(!Ba){wa=ra;xa=qa;j=150;break d}za=Ba+ka|0;c[W>>2]=za;sa=a[_>>0]|0;Aa=sa&255;ya=c[U+64+(Aa<<2)>>2]|0;if((Ba|0)<0){if((za|0)>(ya|0)){Ca=ra;Da=qa;j=153;break d}}else if((za|0)<(ya|0)){Ea=ra;Fa=qa;j=155;break d}c[W>>2]=ya;if(!Aa){Ga=ra;Ha=qa;Ia=ya;Ja=sa;j=157;break d}else if((Aa|0)==5){Ka=ra;La=qa;Ma=ya;j=163;break d}else if((Aa|0)==6){ta=qa;ua=ra;j=167;break d}else if((Aa|0)!=2){Na=sa;Oa=ya;Pa=qa;Qa=ra;j=180;break d}if(!oa){Ra=ra;Sa=qa;j=160;break d}if(na){Na=sa;Oa=ya;Pa=qa;Qa=ra;j=180;break d}a[_>>0]=5;sa=c[ma>>2]|0;c[Z>>2]=(ya|0)>(c[pa>>2]|0)?0-sa|0:sa;la=Ta;ka=ya;ja=ra;ha=qa}}while(0);if((j|0)==150){j=0;Ua=wa;Va=xa;Wa=c[R+40>>2]|0}else if((j|0)==153){j=0;Ua=Ca;Va=Da;Wa=c[R+40>>2]|0}else if((j|0)==155){j=0;Ua=Ea;Va=Fa;Wa=c[R+40>>2]|0}else if((j|0)==157){j=0;if(!(Y&64)){c[Z>>2]=0;Ua=Ga;Va=Ha;Wa=c[R+40>>2]|0}else{Na=Ja;Oa=Ia;Pa=Ha;Qa=Ga;j=180}}else if((j|0)==160){j=0;c[Z>>2]=0;Ua=Ra;Va=Sa;Wa=c[R+40>>2]|0}else if((j|0)==163){j=0;if(!Ma){ta=La;ua=Ka;j=167}else{W=Y&255;if(W&4)a[X>>0]=W^4;c[Z>>2]=0;Ua=Ka;Va=La;Wa=c[R+40>>2]|0}}e:do if((j|0)==167){j=0;W=c[R+36>>2]|0;a[R+34>>0]=0;T=c[r>>2]|0;ba=(T|0)==(R|0);aa=W;if(!W){do if(ba)Xa=c[R+40>>2]|0;else{ga=T;while(1){fa=ga+40|0;ea=c[fa>>2]|0;if((ea|0)!=(R|0)&(ea|0)!=0)ga=ea;else{Ya=fa;Za=ga;break}}ga=R+40|0;fa=c[ga>>2]|0;if(!Za){Xa=fa;break}c[Ya>>2]=fa;Ua=ua;Va=ta;Wa=c[ga>>2]|0;break e}while(0);c[r>>2]=Xa;Ua=ua;Va=ta;Wa=Xa;break}else{do if(ba)j=172;else{ga=T;while(1){fa=ga+40|0;ea=c[fa>>2]|0;if((ea|0)==(R|0)){_a=fa;$a=ga;break}else ga=ea}if(!$a){j=172;break}c[_a>>2]=aa}while(0);if((j|0)==172){j=0;c[r>>2]=aa}c[W+40>>2]=c[R+40>>2];a[W+34>>0]=1;P=ua;R=W;A=ta;continue c}}else if((j|0)==180){j=0;T=Na+1<<24>>24;a[_>>0]=T;do if((a[R+52>>0]|0)==1)ac(R);else{ba=T&255;ga=c[U+36+(ba<<2)>>2]|0;if((Oa|0)<(c[U+64+(ba<<2)>>2]|0)){c[Z>>2]=ga;break}else{c[Z>>2]=0-ga;break}}while(0);Ua=Qa;Va=Pa;Wa=c[R+40>>2]|0}while(0);if(!Wa){N=Ua;O=Va;break}else{P=Ua;R=Wa;A=Va}}}c[z>>2]=N;c[z+4>>2]=O;C=C+-1|0;if(!C)break;else z=z+8|0}z=I<<2;c[q>>2]=(c[q>>2]|0)+I;C=(c[s>>2]|0)-I|0;c[s>>2]=C;J=v-z|0;K=C;L=z+x|0;M=p+(I<<1<<2)|0}if(!J){H=L;break}else{v=J;w=K;x=L;y=G;p=M}}if(b[n>>1]&4)Db(c[e+229964>>2]|0,u,H>>>1);if(H){M=f;p=0;G=u;while(1){u=c[G>>2]|0;y=c[G+4>>2]|0;a[M>>0]=u;a[M+1>>0]=u>>>8&127|u>>>24&128;a[M+2>>0]=y;a[M+3>>0]=y>>>8&127|y>>>24&128;p=p+4|0;if(p>>>0>=H>>>0)break;else{M=M+4|0;G=G+8|0}}}ae(e);m=H;i=k;return m|0}if(!(c[314]|0)){Xd(960);if(!(c[314]|0)){h[158]=1.0;H=0;do{G=1264+(H*464|0)|0;M=G|0;h[M>>3]=1.0;p=G+(H<<3)|0;h[p>>3]=1.0;if((H|0)>1){G=H+-1|0;y=1264+(G*464|0)|0;ab=+(H|0);bb=+h[y>>3]/ab;h[M>>3]=bb;h[p>>3]=bb;bb=+h[y>>3];y=1;do{cb=bb;bb=+h[1264+(G*464|0)+(y<<3)>>3];h[1264+(H*464|0)+(y<<3)>>3]=(cb+bb)/ab;y=y+1|0}while((y|0)!=(H|0));db=ab}else db=+(H|0);h[l+(H<<3)>>3]=db/12.566370614359172;H=H+1|0}while((H|0)!=35);eb=0;fb=1;while(1){H=0;y=~~+Q(-1.0,+(+(eb|0)));while(1){G=1264+(eb*464|0)+(H<<3)|0;h[G>>3]=+(y|0)*+h[G>>3];H=H+1|0;if((H|0)==(fb|0))break;else y=0-y|0}eb=eb+1|0;if((eb|0)==35)break;else fb=fb+1|0}fb=pb(286720)|0;eb=0;db=0.0;while(1){ab=(db+17.0)/12.566370614359172;y=fb+(eb*35<<3)|0;H=0;while(1){G=l+(H<<3)|0;bb=1.0;p=0;while(1){if((p|0)==(H|0))gb=bb;else{cb=+h[l+(p<<3)>>3];hb=+S(+(ab-cb));gb=bb*(hb/+S(+(+h[G>>3]-cb)));}p=p+1|0;if((p|0)==35){ib=gb;break}else bb=gb}h[y>>3]=ib;H=H+1|0;if((H|0)==35)break;else y=y+8|0}eb=eb+1|0;if((eb|0)==1024)break;else db=db+.0009765625}c[314]=fb;ae(960);}else ae(960);}fb=e+12|0;eb=c[fb>>2]|0;Xd(e);$c(f|0,0,g|0)|0;l=g>>>1;y=e+229960|0;H=c[y>>2]|0;if(l>>>0>H>>>0){p=l>>>0>H<<1>>>0?l:H+8192|0;c[y>>2]=p;y=e+229956|0;H=Vc(c[y>>2]|0,p<<2)|0;c[y>>2]=H;jb=H}else jb=c[e+229956>>2]|0;$c(jb|0,0,l<<2|0)|0;l=e+28|0;H=e+4|0;y=e+564|0;p=e+32|0;G=g;g=c[H>>2]|0;M=0;u=eb;eb=jb;f:while(1){g:do if(!g){L=u;while(1){x=c[L>>2]|0;if(!x){lb=L;break}kb[x&63](e,L+4|0);if(!(b[n>>1]&8))j=45;else if(!(c[L+20>>2]|0)){x=c[y>>2]|0;if(x){K=x;do{a[K+53>>0]=1;K=c[K+40>>2]|0}while((K|0)!=0);}Yb(e);mb=c[H>>2]|0;nb=c[fb>>2]|0}else j=45;if((j|0)==45){j=0;K=c[L+12>>2]|0;c[H>>2]=K;x=L+20|0;c[fb>>2]=x;mb=K;nb=x}if(!mb)L=nb;else{ob=mb;qb=nb;break g}}L=c[l>>2]|0;x=c[p>>2]|0;if(x>>>0<=L>>>0){rb=M;break f}K=x-L|0;L=G>>>2;if(K>>>0>L>>>0){c[H>>2]=L;ob=L;qb=lb;break}else{c[H>>2]=K;ob=K;qb=lb;break}}else{ob=g;qb=u}while(0);K=G>>>2;if(ob>>>0>K>>>0){sb=K;j=52}else if(!ob){tb=G;ub=0;vb=M;wb=eb}else{sb=ob;j=52}if((j|0)==52){j=0;K=sb;L=eb;while(1){x=c[y>>2]|0;if(!x){xb=0;yb=0}else{w=0;J=x;x=0;h:while(1){v=J+12|0;I=c[J+8>>2]|0;s=I+96|0;q=J+28|0;O=J+44|0;N=J+48|0;Va=J+16|0;Wa=I+8|0;Ua=J+32|0;Pa=I+4|0;Qa=I+12|0;Oa=J+20|0;Na=J+24|0;ta=c[314]|0;ua=c[I>>2]|0;r=ua>>>10;_a=(r<<1)+-3|0;$a=I+84|0;Xa=I+56|0;Ya=c[v>>2]|0;Za=w;La=x;i:while(1){Ka=Ya>>>10;Ma=(r-Ka<<1)+-3|0;Sa=(Ma|0)<1?1:Ma;Ma=Ka<<1;Ra=Ma|1;Ga=(Sa|0)>(Ra|0)?Ra:Sa;Sa=Ya&1023;if((Ga|0)<34){Ra=Ga>>1;db=+(Sa>>>0)*.0009765625+ +(Ra|0);Ha=c[s>>2]|0;Ia=Ka-Ra|0;Ra=_a-Ma|0;Ja=(Ra|0)>1?~Ra:-2;Ra=-2-Ma|0;Ma=Ga;Ga=0-((Ja|0)>(Ra|0)?Ja:Ra)|0;ib=0.0;while(1){if((Ma|0)<0)zb=ib;else{Ra=0;gb=ib;while(1){ab=gb+ +(b[Ha+(Ra+Ia<<1)>>1]|0)*+h[1264+(Ma*464|0)+(Ra<<3)>>3];Ra=Ra+1|0;if((Ra|0)==(Ga|0)){zb=ab;break}else gb=ab}}Ma=Ma+-1|0;gb=(db-+(Ma|0))*zb;if(!Ma){Ab=gb;break}else{Ga=Ga+-1|0;ib=gb}}Bb=Ab+ +(b[Ha+(Ia<<1)>>1]|0);}else{Ga=Sa*35|0;Ma=ta+(Ga+34<<3)|0;Ra=ta+(Ga<<3)|0;Ga=(c[s>>2]|0)+(Ka+-17<<1)|0;ib=0.0;while(1){db=ib+ +(b[Ga>>1]|0)*+h[Ra>>3];Ra=Ra+8|0;if(Ra>>>0>Ma>>>0){Bb=db;break}else{Ga=Ga+2|0;ib=db}}}Ga=c[q>>2]|0;Ma=~~(Bb*+(Ga>>12|0)*.0009765625);Ra=(($(Ma,c[O>>2]|0)|0)/1024|0)+Za|0;Ka=(($(Ma,c[N>>2]|0)|0)/1024|0)+La|0;Ma=(c[Va>>2]|0)+Ya|0;c[v>>2]=Ma;do if(Ma>>>0>(c[Wa>>2]|0)>>>0)if(!(a[Ua>>0]&4))if(Ma>>>0<ua>>>0){Cb=Ma;break}else{Eb=Ka;Fb=Ra;j=86;break i}else{Sa=c[Pa>>2]|0;Ia=(((Ma-Sa|0)>>>0)%((c[Qa>>2]|0)>>>0)|0)+Sa|0;c[v>>2]=Ia;Cb=Ia;break}else Cb=Ma;while(0);Ma=c[Oa>>2]|0;if(!Ma){Gb=Ra;Hb=Ka;j=69;break}Ia=Ma+Ga|0;c[q>>2]=Ia;Sa=a[Na>>0]|0;Ha=Sa&255;Ja=c[I+64+(Ha<<2)>>2]|0;if((Ma|0)<0){if((Ia|0)>(Ja|0)){Ib=Ra;Jb=Ka;j=72;break}}else if((Ia|0)<(Ja|0)){Kb=Ra;Lb=Ka;j=74;break}c[q>>2]=Ja;if(!Ha){Mb=Ra;Nb=Ka;Ob=Sa;Pb=Ja;j=76;break}else if((Ha|0)==5){Qb=Ra;Rb=Ka;Sb=Ja;j=82;break}else if((Ha|0)==6){Eb=Ka;Fb=Ra;j=86;break}else if((Ha|0)!=2){Tb=Sa;Ub=Ja;Vb=Ka;Wb=Ra;j=99;break}Ha=d[Ua>>0]|0;if(Ha&32){Xb=Ra;Zb=Ka;j=79;break}if(!(Ha&128)){Tb=Sa;Ub=Ja;Vb=Ka;Wb=Ra;j=99;break}a[Na>>0]=5;Sa=c[Xa>>2]|0;c[Oa>>2]=(Ja|0)>(c[$a>>2]|0)?0-Sa|0:Sa;Ya=Cb;Za=Ra;La=Ka}if((j|0)==69){j=0;$b=Gb;bc=Hb;cc=c[J+40>>2]|0}else if((j|0)==72){j=0;$b=Ib;bc=Jb;cc=c[J+40>>2]|0}else if((j|0)==74){j=0;$b=Kb;bc=Lb;cc=c[J+40>>2]|0}else if((j|0)==76){j=0;if(!(a[Ua>>0]&64)){c[Oa>>2]=0;$b=Mb;bc=Nb;cc=c[J+40>>2]|0}else{Tb=Ob;Ub=Pb;Vb=Nb;Wb=Mb;j=99}}else if((j|0)==79){j=0;c[Oa>>2]=0;$b=Xb;bc=Zb;cc=c[J+40>>2]|0}else if((j|0)==82){j=0;if(!Sb){Eb=Rb;Fb=Qb;j=86}else{La=d[Ua>>0]|0;if(La&4)a[Ua>>0]=La^4;c[Oa>>2]=0;$b=Qb;bc=Rb;cc=c[J+40>>2]|0}}j:do if((j|0)==86){j=0;La=c[J+36>>2]|0;a[J+34>>0]=0;Za=c[y>>2]|0;Ya=(Za|0)==(J|0);$a=La;if(!La){do if(Ya)dc=c[J+40>>2]|0;else{Xa=Za;while(1){q=Xa+40|0;v=c[q>>2]|0;if((v|0)!=(J|0)&(v|0)!=0)Xa=v;else{ec=q;fc=Xa;break}}Xa=J+40|0;q=c[Xa>>2]|0;if(!fc){dc=q;break}c[ec>>2]=q;$b=Fb;bc=Eb;cc=c[Xa>>2]|0;break j}while(0);c[y>>2]=dc;$b=Fb;bc=Eb;cc=dc;break}else{do if(Ya)j=91;else{Ka=Za;while(1){Ra=Ka+40|0;Ga=c[Ra>>2]|0;if((Ga|0)==(J|0)){gc=Ra;hc=Ka;break}else Ka=Ga}if(!hc){j=91;break}c[gc>>2]=$a}while(0);if((j|0)==91){j=0;c[y>>2]=$a}c[La+40>>2]=c[J+40>>2];a[La+34>>0]=1;w=Fb;J=La;x=Eb;continue h}}else if((j|0)==99){j=0;Za=Tb+1<<24>>24;a[Na>>0]=Za;do if((a[J+52>>0]|0)==1)ac(J);else{Ya=Za&255;Ka=c[I+36+(Ya<<2)>>2]|0;if((Ub|0)<(c[I+64+(Ya<<2)>>2]|0)){c[Oa>>2]=Ka;break}else{c[Oa>>2]=0-Ka;break}}while(0);$b=Wb;bc=Vb;cc=c[J+40>>2]|0}while(0);if(!cc){xb=$b;yb=bc;break}else{w=$b;J=cc;x=bc}}}c[L>>2]=xb;c[L+4>>2]=yb;K=K+-1|0;if(!K)break;else L=L+8|0}L=sb<<2;c[l>>2]=(c[l>>2]|0)+sb;K=(c[H>>2]|0)-sb|0;c[H>>2]=K;tb=G-L|0;ub=K;vb=L+M|0;wb=eb+(sb<<1<<2)|0}if(!tb){rb=vb;break}else{G=tb;g=ub;M=vb;u=qb;eb=wb}}if(b[n>>1]&4)Db(c[e+229964>>2]|0,jb,rb>>>1);if(rb){n=f;f=0;wb=jb;while(1){jb=c[wb>>2]|0;eb=c[wb+4>>2]|0;a[n>>0]=jb;a[n+1>>0]=jb>>>8&127|jb>>>24&128;a[n+2>>0]=eb;a[n+3>>0]=eb>>>8&127|eb>>>24&128;f=f+4|0;if(f>>>0>=rb>>>0)break;else{n=n+4|0;wb=wb+8|0}}}ae(e);m=rb;i=k;return m|0}function sb(f){f=f|0;var h=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0,S=0,T=0,U=0,V=0,W=0,X=0,Y=0,Z=0,_=0,$=0,aa=0,ba=0,ca=0,da=0.0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0,Fa=0,Ga=0,Ha=0,Ia=0;h=0;h=0;j=i;i=i+16|0;k=j;c[k>>2]=0;l=Jb(f,k)|0;if(!l){zc();m=-1;i=j;return m|0}n=he(f,47)|0;do if(!n)o=0;else{p=n-f|0;q=pb(p+2|0)|0;if(q){r=p+1|0;zd(q|0,f|0,r|0)|0;a[q+r>>0]=0;o=q;break}_b(28344,784,354,1,28360,c[(La()|0)>>2]|0);_b(28344,784,356,3,f,0);zc();vb(l);m=-1;i=j;return m|0}while(0);a[l+(c[k>>2]|0)>>0]=10;n=o;o=0;q=0;r=0;a:while(1){p=l+o|0;s=a[p>>0]|0;if(s<<24>>24==10|s<<24>>24==13){a[p>>0]=0;if((o|0)==(q|0)){t=n;u=r}else{p=ce(l+q|0)|0;do if(!p){v=0;w=n;x=r}else{s=0;y=0;z=0;A=0;B=0;while(1){C=l+(s+q)|0;D=a[C>>0]|0;if(D<<24>>24==9|D<<24>>24==32)if(!B){E=y;F=z;G=A;H=0}else{a[C>>0]=0;E=y;F=z;G=A;H=0}else if(D<<24>>24==35){I=y;J=z;K=A;break}else if(!B){if((y|0)<(A|0)){L=z;M=A}else{D=A+8|0;N=Vc(z,D<<2)|0;if(!N){h=18;break}else{L=N;M=D}}c[L+(y<<2)>>2]=C;E=y+1|0;F=L;G=M;H=1}else{E=y;F=z;G=A;H=B}s=s+1|0;if((s|0)==(p|0)){I=E;J=F;K=G;break}else{y=E;z=F;A=G;B=H}}if((h|0)==18){h=0;_b(28376,784,308,1,28360,c[(La()|0)>>2]|0);v=0;w=n;x=r;break}if(!I)O=J;else{if((I|0)<(K|0))P=J;else P=Vc(J,(I<<2)+4|0)|0;c[P+(I<<2)>>2]=0;O=P}if(!O){v=0;w=n;x=r}else{B=c[O>>2]|0;if(!(rc(B,28400)|0)){vb(n);A=c[O+4>>2]|0;if(!A){Q=O;h=28;break a}z=pb((ce(A|0)|0)+5|0)|0;if(!z){R=O;h=30;break a}Qd(z|0,A|0)|0;A=ce(z|0)|0;if((a[z+(A+-1)>>0]|0)==47){v=O;w=z;x=r;break}a[z+(A+1)>>0]=0;a[z+(ce(z|0)|0)>>0]=47;v=O;w=z;x=r;break}if(!(rc(B,28440)|0)){z=O+4|0;A=c[z>>2]|0;if(!A){S=O;h=35;break a}if((n|0)!=0&(a[A>>0]|0)!=47){y=ce(n|0)|0;s=pb(y+1+(ce(A|0)|0)|0)|0;if(!s){T=O;U=n;h=38;break a}Qd(s|0,n|0)|0;y=s+(ce(n|0)|0)|0;Qd(y|0,c[z>>2]|0)|0;V=s}else{s=pb((ce(A|0)|0)+5|0)|0;if(!s){W=O;h=42;break a}Qd(s|0,A|0)|0;V=s}s=(sb(V)|0)==-1;vb(V);if(s){X=O;Y=n;h=44;break a}else{v=O;w=n;x=r;break}}if(!(rc(B,28480)|0)){s=c[O+4>>2]|0;if(!s){Z=O;_=n;h=48;break a}if(((a[s>>0]|0)+-48|0)>>>0>=10){Z=O;_=n;h=48;break a}v=O;w=n;x=(lc(s)|0)<<8&65535;break}if(!(rc(B,28520)|0)){s=c[O+4>>2]|0;if(!s){$=O;aa=n;h=53;break a}if(((a[s>>0]|0)+-48|0)>>>0>=10){$=O;aa=n;h=53;break a}v=O;w=n;x=((lc(s)|0)<<8|128)&65535;break}if(!(rc(B,28560)|0)){s=c[O+4>>2]|0;if(!s){ba=O;ca=n;h=58;break a}if(((a[s>>0]|0)+-48|0)>>>0>=10){ba=O;ca=n;h=58;break a}da=+Je(s);g[176]=da;if(da<1.0){_b(28344,784,476,9,28632,0);g[176]=1.0;v=O;w=n;x=r;break}if(!(da>100.0)){v=O;w=n;x=r;break}_b(28344,784,479,9,28696,0);g[176]=100.0;v=O;w=n;x=r;break}if(!(rc(B,28768)|0)){s=c[O+4>>2]|0;if(!s){ea=O;fa=n;h=66;break a}if(((a[s>>0]|0)+-48|0)>>>0>=10){ea=O;fa=n;h=66;break a}da=+Je(s);g[178]=da;if(da<1.0){_b(28344,784,495,9,28840,0);g[178]=1.0;v=O;w=n;x=r;break}if(!(da>100.0)){v=O;w=n;x=r;break}_b(28344,784,498,9,28904,0);g[178]=100.0;v=O;w=n;x=r;break}if(!(rc(B,28976)|0)){s=c[O+4>>2]|0;if(!s){ga=O;ha=n;h=74;break a}if(((a[s>>0]|0)+-48|0)>>>0>=10){ga=O;ha=n;h=74;break a}da=+Je(s);g[180]=da;if(!(da>+g[176]|da<0.0)){v=O;w=n;x=r;break}_b(28344,784,514,9,29048,0);g[180]=+g[176]*.5;v=O;w=n;x=r;break}if(!(rc(B,29096)|0)){s=c[O+4>>2]|0;if(!s){ia=O;ja=n;h=80;break a}if(((a[s>>0]|0)+-48|0)>>>0>=10){ia=O;ja=n;h=80;break a}da=+Je(s);g[182]=da;if(!(da>+g[176]|da<0.0)){v=O;w=n;x=r;break}_b(28344,784,531,9,29168,0);g[182]=+g[178]*.75;v=O;w=n;x=r;break}if(!(rc(B,29216)|0)){c[184]=1;v=O;w=n;x=r;break}if(!(rc(B,29280)|0)){c[186]=1;v=O;w=n;x=r;break}if(!(rc(B,29296)|0)){c[186]=1;c[188]=1;v=O;w=n;x=r;break}if(((a[B>>0]|0)+-48|0)>>>0>=10){v=O;w=n;x=r;break}s=(lc(B)|0)&127;B=s|r&65408;A=B&65535;z=37680+(s<<2)|0;s=c[z>>2]|0;do if(!s){y=pb(100)|0;c[z>>2]=y;if(!y){ka=O;la=n;h=92;break a}b[y>>1]=A;c[y+4>>2]=0;b[y+8>>1]=1024;a[y+84>>0]=0;c[y+96>>2]=0;c[y+92>>2]=0;a[y+2>>0]=0;c[y+88>>2]=0;ma=y}else{if((e[s>>1]|0)==(B|0)){y=s+4|0;vb(c[y>>2]|0);c[y>>2]=0;b[s+8>>1]=1024;a[s+84>>0]=0;ma=s;break}y=s+96|0;C=c[y>>2]|0;if(!C){D=pb(100)|0;c[y>>2]=D;if(!D){na=O;oa=n;h=104;break a}b[D>>1]=A;c[D+4>>2]=0;b[D+8>>1]=1024;a[D+84>>0]=0;c[D+96>>2]=0;c[D+92>>2]=0;a[D+2>>0]=0;c[D+88>>2]=0;ma=D;break}else pa=C;while(1){if((e[pa>>1]|0)==(B|0)){qa=pa;h=102;break}C=c[pa+96>>2]|0;if(!C){ra=pa;break}else pa=C}if((h|0)==102){h=0;C=qa+4|0;vb(c[C>>2]|0);c[C>>2]=0;b[qa+8>>1]=1024;a[qa+84>>0]=0;ma=qa;break}C=pb(100)|0;c[ra+96>>2]=C;if(!C){sa=O;ta=n;h=100;break a}b[C>>1]=A;c[C+4>>2]=0;b[C+8>>1]=1024;a[C+84>>0]=0;c[C+96>>2]=0;c[C+92>>2]=0;a[C+2>>0]=0;c[C+88>>2]=0;ma=C}while(0);B=O+4|0;s=c[B>>2]|0;if(!s){ua=O;va=n;h=107;break a}if((n|0)!=0&(a[s>>0]|0)!=47){z=ce(n|0)|0;C=pb(z+5+(ce(s|0)|0)|0)|0;z=ma+4|0;c[z>>2]=C;if(!C){wa=O;xa=n;h=110;break a}Qd(C|0,n|0)|0;Id(c[z>>2]|0,c[B>>2]|0)|0;ya=c[z>>2]|0}else{z=pb((ce(s|0)|0)+5|0)|0;if(!z){za=O;Aa=n;Ba=ma;h=114;break a}Qd(z|0,s|0)|0;c[ma+4>>2]=z;ya=z}z=ce(ya|0)|0;if(gc(ya+(z+-4)|0,29352,4)|0){s=ya+z|0;a[s>>0]=a[29352]|0;a[s+1>>0]=a[29353]|0;a[s+2>>0]=a[29354]|0;a[s+3>>0]=a[29355]|0;a[s+4>>0]=a[29356]|0}a[ma+20>>0]=0;a[ma+32>>0]=0;a[ma+44>>0]=0;a[ma+56>>0]=0;a[ma+68>>0]=0;a[ma+80>>0]=0;s=ma+10|0;a[s>>0]=0;z=ma+11|0;a[z>>0]=0;B=c[O>>2]|0;if(!B){v=O;w=n;x=A;break}C=ma+8|0;D=ma+84|0;y=B;B=0;while(1){b:do if(!(gc(y,29360,4)|0)){N=y+4|0;if(((a[N>>0]|0)+-48|0)>>>0<10){b[C>>1]=((lc(N)|0)<<10|0)/100|0;break}else{_b(28344,784,676,9,29368,0);break}}else{if(!(gc(y,29400,5)|0)){N=y+5|0;if(((a[N>>0]|0)+-48|0)>>>0<10){a[D>>0]=lc(N)|0;break}else{_b(28344,784,682,9,29368,0);break}}if(!(gc(y,29408,8)|0)){N=y+8|0;do if(((a[N>>0]|0)+-48|0)>>>0<10){Ca=y+10|0;if(((a[Ca>>0]|0)+-48|0)>>>0>=10)break;if((a[y+9>>0]|0)!=61)break;Da=lc(N)|0;if(Da>>>0>5){_b(28344,784,694,9,29368,0);break b}da=+Je(Ca);g[ma+12+(Da*12|0)>>2]=da;if(da>45.0e3|da<1.4700000286102295){_b(28344,784,699,9,29424,0);Ca=ma+12+(Da*12|0)+8|0;a[Ca>>0]=d[Ca>>0]&254;break b}else{Ca=ma+12+(Da*12|0)+8|0;a[Ca>>0]=d[Ca>>0]|1;break b}}while(0);_b(28344,784,690,9,29368,0);break}if(gc(y,29456,9)|0){if(!(rc(y,29472)|0)){a[s>>0]=d[s>>0]|4;break}if(!(rc(y,29488)|0)){a[s>>0]=d[s>>0]|64;break}if(!(rc(y,29504)|0)){a[z>>0]=d[z>>0]|32;break}if(rc(y,29520)|0)break;a[z>>0]=d[z>>0]|128;break}N=y+9|0;do if(((a[N>>0]|0)+-48|0)>>>0<10){Ca=y+11|0;if(((a[Ca>>0]|0)+-48|0)>>>0>=10)break;if((a[y+10>>0]|0)!=61)break;Da=lc(N)|0;if(Da>>>0>5){_b(28344,784,714,9,29368,0);break b}da=+Je(Ca);g[ma+12+(Da*12|0)+4>>2]=da;if(da>1.0|da<0.0){_b(28344,784,719,9,29424,0);Ca=ma+12+(Da*12|0)+8|0;a[Ca>>0]=d[Ca>>0]&253;break b}else{Ca=ma+12+(Da*12|0)+8|0;a[Ca>>0]=d[Ca>>0]|2;break b}}while(0);_b(28344,784,710,9,29368,0);}while(0);B=B+1|0;y=c[O+(B<<2)>>2]|0;if(!y){v=O;w=n;x=A;break}}}}while(0);vb(v);t=w;u=x}p=o+1|0;Ea=p;Fa=t;Ga=p;Ha=u}else{Ea=o+1|0;Fa=n;Ga=q;Ha=r}if(Ea>>>0>(c[k>>2]|0)>>>0){Ia=Fa;h=159;break}else{n=Fa;o=Ea;q=Ga;r=Ha}}switch(h|0){case 28:{_b(28344,784,384,9,28408,0);_b(28344,784,385,3,f,0);zc();vb(Q);vb(l);m=-1;i=j;return m|0}case 30:{_b(28344,784,391,1,28360,c[(La()|0)>>2]|0);_b(28344,784,392,3,f,0);zc();vb(R);vb(l);m=-1;i=j;return m|0}case 35:{_b(28344,784,405,9,28448,0);_b(28344,784,406,3,f,0);zc();vb(S);vb(l);m=-1;i=j;return m|0}case 38:{_b(28344,784,414,1,28360,c[(La()|0)>>2]|0);_b(28344,784,415,3,f,0);zc();vb(U);vb(T);vb(l);m=-1;i=j;return m|0}case 42:{_b(28344,784,426,1,28360,c[(La()|0)>>2]|0);_b(28344,784,427,3,f,0);zc();vb(W);vb(l);m=-1;i=j;return m|0}case 44:{vb(X);vb(l);vb(Y);m=-1;i=j;return m|0}case 48:{_b(28344,784,444,9,28488,0);_b(28344,784,445,3,f,0);zc();vb(_);vb(Z);vb(l);m=-1;i=j;return m|0}case 53:{_b(28344,784,455,9,28528,0);_b(28344,784,456,3,f,0);zc();vb(aa);vb($);vb(l);m=-1;i=j;return m|0}case 58:{_b(28344,784,466,9,28584,0);_b(28344,784,467,3,f,0);zc();vb(ca);vb(ba);vb(l);m=-1;i=j;return m|0}case 66:{_b(28344,784,484,9,28792,0);_b(28344,784,485,3,f,0);zc();vb(fa);vb(ea);vb(l);m=-1;i=j;return m|0}case 74:{_b(28344,784,503,9,29e3,0);_b(28344,784,504,3,f,0);zc();vb(ha);vb(ga);vb(l);m=-1;i=j;return m|0}case 80:{_b(28344,784,520,9,29120,0);_b(28344,784,521,3,f,0);zc();vb(ja);vb(ia);vb(l);m=-1;i=j;return m|0}case 92:{_b(28344,784,547,1,0,c[(La()|0)>>2]|0);_b(28344,784,548,3,f,0);zc();vb(la);vb(ka);vb(l);m=-1;i=j;return m|0}case 100:{_b(28344,784,580,1,0,0);_b(28344,784,581,3,f,0);zc();vb(ta);vb(sa);vb(l);m=-1;i=j;return m|0}case 104:{_b(28344,784,608,1,0,c[(La()|0)>>2]|0);_b(28344,784,609,3,f,0);zc();vb(oa);vb(na);vb(l);m=-1;i=j;return m|0}case 107:{_b(28344,784,629,9,29320,0);_b(28344,784,630,3,f,0);zc();vb(va);vb(ua);vb(l);m=-1;i=j;return m|0}case 110:{_b(28344,784,639,1,0,0);_b(28344,784,640,3,f,0);zc();vb(xa);vb(wa);vb(l);m=-1;i=j;return m|0}case 114:{c[Ba+4>>2]=0;_b(28344,784,651,1,0,0);_b(28344,784,652,3,f,0);zc();vb(Aa);vb(za);vb(l);m=-1;i=j;return m|0}case 159:{vb(l);vb(Ia);m=0;i=j;return m|0}}return 0}function tb(b,f){b=b|0;f=f|0;var h=0,i=0,j=0,k=0,l=0,m=0,n=0.0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0.0,P=0.0,Q=0.0,R=0.0,S=0,T=0,U=0.0,V=0,W=0.0,X=0.0,Y=0,Z=0.0,_=0,$=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0.0,ja=0,ka=0.0,la=0,ma=0,na=0.0,oa=0.0,pa=0,qa=0.0,ra=0.0,sa=0.0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0.0,za=0.0;h=0;h=0;i=(Yc(b,38448,4)|0)==0;j=i?f+-20|0:f;f=i?b+20|0:b;if(Yc(f,38456,4)|0){_b(38464,38488,79,11,0,0);k=0;return k|0}if((j+-4|0)>>>0<10){_b(38464,38488,87,7,38512,0);k=0;return k|0}if((d[f+5>>0]<<16|d[f+4>>0]<<24|d[f+6>>0]<<8|d[f+7>>0]|0)!=6){_b(38464,38488,101,7,0,0);k=0;return k|0}b=d[f+8>>0]<<8|d[f+9>>0];if(b>>>0>2){_b(38464,38488,113,6,0,0);k=0;return k|0}i=d[f+10>>0]<<8|d[f+11>>0];if(!i){_b(38464,38488,126,7,38528,0);k=0;return k|0}if((b|0)==0&i>>>0>1){_b(38464,38488,136,6,38544,0);k=0;return k|0}l=d[f+12>>0]<<8;m=l|d[f+13>>0];if(l&32768){_b(38464,38488,148,6,0,0);k=0;return k|0}l=j+-14|0;j=f+14|0;n=+Zd(m,5e5);f=Tc()|0;Nc(f,m)|0;o=i<<2;p=pb(o)|0;q=pb(o)|0;o=pb(i)|0;r=pb(i)|0;a:do if((b|0)==1){s=l;t=j;u=0;v=-1;while(1){if(s>>>0<8){h=26;break a}if(Yc(t,38600,4)|0){h=28;break a}w=t+8|0;x=d[t+5>>0]<<16|d[t+4>>0]<<24|d[t+6>>0]<<8|d[t+7>>0];y=s+-8|0;if(y>>>0<x>>>0){h=30;break a}if((a[t+(x+5)>>0]|0)!=-1){h=34;break a}if((a[t+(x+6)>>0]|0)!=47){h=34;break a}if(a[t+(x+7)>>0]|0){h=34;break a}z=p+(u<<2)|0;c[z>>2]=w;t=t+(x+8)|0;a[o+u>>0]=0;a[r+u>>0]=0;A=q+(u<<2)|0;c[A>>2]=0;B=w;w=0;while(1){C=a[B>>0]|0;D=w<<7|C&127;E=B+1|0;if(C<<24>>24<0){B=E;w=D}else{F=D;G=E;break}}c[z>>2]=G;c[A>>2]=F;w=F>>>0<v>>>0?F:v;u=u+1|0;if(u>>>0>=i>>>0){H=w;h=38;break}else{s=y-x|0;v=w}}}else{v=l;s=j;u=0;t=-1;while(1){if(v>>>0<8){h=26;break a}if(Yc(s,38600,4)|0){h=28;break a}w=s+8|0;B=d[s+5>>0]<<16|d[s+4>>0]<<24|d[s+6>>0]<<8|d[s+7>>0];E=v+-8|0;if(E>>>0<B>>>0){h=30;break a}if((a[s+(B+5)>>0]|0)!=-1){h=34;break a}if((a[s+(B+6)>>0]|0)!=47){h=34;break a}if(a[s+(B+7)>>0]|0){h=34;break a}D=p+(u<<2)|0;c[D>>2]=w;s=s+(B+8)|0;a[o+u>>0]=0;a[r+u>>0]=0;C=q+(u<<2)|0;c[C>>2]=0;I=w;w=0;while(1){J=a[I>>0]|0;K=w<<7|J&127;L=I+1|0;if(J<<24>>24<0){I=L;w=K}else{M=K;N=L;break}}c[D>>2]=N;c[C>>2]=M;w=(u|0)==0?M:t;u=u+1|0;if(u>>>0>=i>>>0){H=w;h=38;break}else{v=E-B|0;t=w}}}while(0);b:do if((h|0)==26)_b(38464,38488,166,7,38512,0);else if((h|0)==28)_b(38464,38488,170,7,38608,0);else if((h|0)==30)_b(38464,38488,182,7,38512,0);else if((h|0)==34)_b(38464,38488,188,7,38632,0);else if((h|0)==38){O=n*+(H>>>0)+0.0;M=~~O>>>0;N=f+16|0;j=f+8|0;l=(c[j>>2]|0)+(((c[N>>2]|0)+-1|0)*20|0)+12|0;c[l>>2]=(c[l>>2]|0)+M;l=f+32|0;c[l>>2]=(c[l>>2]|0)+M;c:do if((b|0)==1){F=0;P=O-+(M>>>0);Q=n;G=H;d:while(1){t=F;v=0;R=Q;u=0;while(1){s=o+v|0;do if(!(a[s>>0]|0)){w=q+(v<<2)|0;I=c[w>>2]|0;if(!I)S=0;else{x=I-G|0;c[w>>2]=x;if((I|0)==(G|0))S=x;else{T=t;U=R;V=(u+-1|0)>>>0>=x>>>0?x:u;break}}x=p+(v<<2)|0;I=r+v|0;y=S;A=c[x>>2]|0;W=R;e:while(1){z=ob(f,A,a[I>>0]|0)|0;if(!z)break d;L=a[A>>0]|0;do if(L<<24>>24<0){if((L&255)<240){a[I>>0]=L;X=W;break}if(L<<24>>24==-9|L<<24>>24==-16){a[I>>0]=0;X=W;break}else if(L<<24>>24!=-1){X=W;break}if((a[A+1>>0]|0)==47)if(!(a[A+2>>0]|0)){Y=A;Z=W;h=55;break e}if((a[A+1>>0]|0)!=81){X=W;break}if((a[A+2>>0]|0)!=3){X=W;break}K=d[A+4>>0]<<8|d[A+3>>0]<<16|d[A+5>>0];X=+Zd(m,(K|0)!=0?K:5e5);}else X=W;while(0);L=A+z|0;c[x>>2]=L;K=a[L>>0]|0;if(K<<24>>24<0){J=y;_=K;$=L;while(1){aa=_&127|J<<7;ba=$+1|0;_=a[ba>>0]|0;if(_<<24>>24>=0){ca=aa;da=ba;break}else{J=aa;$=ba}}c[w>>2]=ca;c[x>>2]=da;ea=ca;fa=a[da>>0]|0;ga=da}else{ea=y;fa=K;ga=L}$=fa&127|ea<<7;c[w>>2]=$;A=ga+1|0;c[x>>2]=A;if($){ha=$;ia=X;h=63;break}else{y=0;W=X}}if((h|0)==55){h=0;a[s>>0]=1;c[x>>2]=Y+3;T=t+1|0;U=Z;V=u;break}else if((h|0)==63){h=0;T=t;U=ia;V=(u+-1|0)>>>0>=ha>>>0?ha:u;break}}else{T=t;U=R;V=u}while(0);v=v+1|0;if(v>>>0>=i>>>0){ja=T;ka=U;la=V;break}else{t=T;R=U;u=V}}u=c[l>>2]|0;R=P+ka*+(la>>>0);t=~~R>>>0;v=(c[j>>2]|0)+(((c[N>>2]|0)+-1|0)*20|0)+12|0;c[v>>2]=(c[v>>2]|0)+t;c[l>>2]=u+t;if((ja|0)==(i|0))break c;else{F=ja;P=R-+(t>>>0);Q=ka;G=la}}_b(38464,38488,249,7,38744,0);break b}else if((b|0)==2){a[f+23e4>>0]=1;ma=0;na=0.0;oa=n;h=67}else{ma=0;na=0.0;oa=n;h=67}while(0);f:do if((h|0)==67){g:while(1){h=0;M=r+ma|0;a[M>>0]=0;G=p+(ma<<2)|0;F=o+ma|0;B=q+(ma<<2)|0;E=c[G>>2]|0;C=0;O=na;Q=oa;h:while(1){D=ob(f,E,C)|0;if(!D)break g;t=a[E>>0]|0;do if(t<<24>>24<0){if((t&255)<240){a[M>>0]=t;pa=t;qa=Q;break}if(t<<24>>24==-9|t<<24>>24==-16){a[M>>0]=0;pa=0;qa=Q;break}else if(t<<24>>24!=-1){pa=C;qa=Q;break}if((a[E+1>>0]|0)==47)if(!(a[E+2>>0]|0)){ra=O;sa=Q;h=77;break h}if((a[E+1>>0]|0)==81)if((a[E+2>>0]|0)==3){u=d[E+4>>0]<<8|d[E+3>>0]<<16|d[E+5>>0];pa=C;qa=+Zd(m,(u|0)!=0?u:5e5);}else{pa=C;qa=Q}else{pa=C;qa=Q}}else{pa=C;qa=Q}while(0);t=E+D|0;c[G>>2]=t;c[B>>2]=0;u=a[t>>0]|0;if(u<<24>>24<0){v=0;s=u;y=t;while(1){A=s&127|v<<7;w=y+1|0;s=a[w>>0]|0;if(s<<24>>24>=0){ta=A;ua=w;break}else{v=A;y=w}}c[B>>2]=ta;c[G>>2]=ua;va=ta;wa=a[ua>>0]|0;xa=ua}else{va=0;wa=u;xa=t}y=wa&127|va<<7;c[B>>2]=y;E=xa+1|0;c[G>>2]=E;P=O+qa*+(y>>>0);y=~~P>>>0;R=P-+(y>>>0);v=(c[j>>2]|0)+(((c[N>>2]|0)+-1|0)*20|0)+12|0;c[v>>2]=y+(c[v>>2]|0);c[l>>2]=(c[l>>2]|0)+y;if(a[F>>0]|0){ya=R;za=qa;break}else{C=pa;O=R;Q=qa}}if((h|0)==77){h=0;a[F>>0]=1;ya=ra;za=sa}ma=ma+1|0;if(ma>>>0>=i>>>0)break f;else{na=ya;oa=za;h=67}}_b(38464,38488,311,7,38744,0);break b}while(0);l=Bb(e[380]|0,+g[176],+g[178],+g[180],+g[182])|0;c[f+229964>>2]=l;if(!l){_b(38464,38488,362,1,38760,0);break}else{c[f+28>>2]=0;c[f+12>>2]=c[j>>2];c[f+4>>2]=0;c[f+564>>2]=0;Yb(f);break}}while(0);vb(o);vb(q);vb(r);vb(p);if(c[f+229964>>2]|0){k=f;return k|0}Mb(f);k=0;return k|0}function ub(f,h){f=f|0;h=h|0;var i=0,j=0,k=0,l=0,m=0,n=0,o=0.0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,Q=0.0,R=0.0,S=0,T=0,U=0,V=0,W=0,X=0,Y=0,Z=0,_=0,$=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0,ka=0,la=0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0.0;i=0;i=0;if(Yc(f,38648,18)|0){_b(38672,38688,81,14,0,0);j=0;return j|0}k=a[f+212>>0]|0;l=a[f+228>>0]|0;m=l&255;n=Tc()|0;Nc(n,60)|0;o=+(6e7/((k&255)>>>0)|0|0);k=~~((b[348]&8192)==0?o:o+.5)>>>0;o=+Zd(60,k);Oc(n,k)|0;k=m<<2;p=pb(k)|0;q=pb(k)|0;r=pb(k)|0;k=pb(m<<10)|0;s=pb(m<<7)|0;t=f+370|0;a:do if(((m*17|0)+370|0)>>>0>h>>>0)_b(38672,38688,117,14,38712,0);else{u=a[t>>0]|0;c[p>>2]=u&255;v=l<<24>>24==0;b:do if(v)w=-1;else{x=t;y=u;z=0;A=-1;while(1){B=y&255;C=p+(z<<2)|0;c[C>>2]=B;D=d[x+1>>0]<<8|B;c[C>>2]=D;B=D|d[x+2>>0]<<16;c[C>>2]=B;D=x+4|0;E=B|d[x+3>>0]<<24;c[C>>2]=E;if((E+94|0)>>>0>h>>>0){i=7;break}if(Yc(f+E|0,38728,13)|0){i=9;break}B=(d[f+(E+88)>>0]<<8|d[f+(E+87)>>0]|d[f+(E+89)>>0]<<16|d[f+(E+90)>>0]<<24)+E|0;E=f+B|0;c[C>>2]=B;F=r+(z<<2)|0;c[F>>2]=0;G=a[E>>0]|0;if(G<<24>>24<0){H=0;I=G;J=B;K=E;while(1){E=I&127|H<<7;c[F>>2]=E;K=K+1|0;L=J+1|0;c[C>>2]=L;M=a[K>>0]|0;if(M<<24>>24>=0){N=E;O=M;P=L;break}else{H=E;I=M;J=L}}}else{N=0;O=G;P=B}J=O&127|N<<7;c[F>>2]=J;c[C>>2]=P+1;I=J>>>0<A>>>0;c[q+(z<<2)>>2]=0;a[s+z>>0]=0;H=z<<7;K=0;do{L=K+H|0;M=k+(L<<3)|0;c[M>>2]=0;a[M+4>>0]=0;K=K+1|0}while((K|0)!=128);K=I?J:A;H=z+1|0;if(H>>>0>=m>>>0){w=K;break b}x=D;y=a[D>>0]|0;z=H;A=K}if((i|0)==7){_b(38672,38688,130,14,38712,0);break a}else if((i|0)==9){_b(38672,38688,137,14,0,0);break a}}while(0);Q=o*+(w>>>0)+0.0;u=~~Q>>>0;A=n+16|0;z=n+8|0;y=(c[z>>2]|0)+(((c[A>>2]|0)+-1|0)*20|0)+12|0;c[y>>2]=(c[y>>2]|0)+u;y=n+32|0;c[y>>2]=(c[y>>2]|0)+u;c:do if(!v){x=0;R=Q-+(u>>>0);K=w;d:while(1){H=x;C=0;F=0;while(1){B=q+(C<<2)|0;do if(!(c[B>>2]|0)){G=C<<7;M=0;L=F;while(1){E=M+G|0;S=k+(E<<3)|0;T=c[S>>2]|0;do if(!T)U=L;else{V=T-K|0;c[S>>2]=V;if((T|0)==(K|0)){Jc(n,a[k+(E<<3)+4>>0]|0,M&255,0)|0;U=L;break}else{U=(L+-1|0)>>>0>=V>>>0?V:L;break}}while(0);M=M+1|0;if((M|0)==128){W=U;break}else L=U}L=r+(C<<2)|0;M=c[L>>2]|0;if(M){E=M-K|0;c[L>>2]=E;if((M|0)!=(K|0)){X=H;Y=(W+-1|0)>>>0>=E>>>0?E:W;break}}E=p+(C<<2)|0;M=s+C|0;T=c[E>>2]|0;S=W;e:while(1){V=f+T|0;c[L>>2]=0;do if((a[V>>0]|0)==-2){Z=a[f+(T+1)>>0]|0;if(Z<<24>>24==16){_=(d[f+(T+4)>>0]|0)+5+T|0;c[E>>2]=_;$=f+_|0;aa=_}else if(Z<<24>>24==21){Z=T+4|0;c[E>>2]=Z;$=f+Z|0;aa=Z}else{$=V;aa=T}Z=aa+4|0;c[E>>2]=Z;ba=$+4|0;ca=Z;da=S}else{Z=a[M>>0]|0;_=ob(n,V,Z)|0;if(!_)break d;ea=a[V>>0]|0;if(ea<<24>>24==-1)if((a[f+(T+1)>>0]|0)==47)if(!(a[f+(T+2)>>0]|0)){fa=S;break e}else{ga=Z;i=47}else{ga=Z;i=47}else if(ea<<24>>24==-9|ea<<24>>24==-16)a[M>>0]=0;else if((ea&255)<240&ea<<24>>24<0){a[M>>0]=ea;ga=ea;i=47}else{ga=Z;i=47}if((i|0)==47){i=0;if((ga&-16)<<24>>24==-112){if(ea<<24>>24<0)ha=a[f+(T+1)>>0]|0;else ha=ea;ea=(ha&255)+G|0;Z=ga&15;ia=k+(ea<<3)|0;a[ia+4>>0]=Z;ea=_+T|0;ja=f+ea|0;c[E>>2]=ea;ka=ia|0;c[ka>>2]=0;ia=a[ja>>0]|0;if(ia<<24>>24<0){la=ja;ma=0;na=ia;oa=ea;while(1){pa=na&127|ma<<7;c[ka>>2]=pa;qa=la+1|0;ra=oa+1|0;c[E>>2]=ra;sa=a[qa>>0]|0;if(sa<<24>>24<0){la=qa;ma=pa;na=sa;oa=ra}else{ta=qa;ua=pa;va=sa;wa=ra;break}}}else{ta=ja;ua=0;va=ia;wa=ea}oa=va&127|ua<<7;c[ka>>2]=oa;na=ta+1|0;ma=wa+1|0;c[E>>2]=ma;if(!oa){Jc(n,Z,-128,0)|0;ba=na;ca=ma;da=S;break}else{ba=na;ca=ma;da=(S+-1|0)>>>0>=oa>>>0?oa:S;break}}}oa=_+T|0;c[E>>2]=oa;ba=f+oa|0;ca=oa;da=S}while(0);V=a[ba>>0]|0;if(V<<24>>24<0){oa=ba;ma=0;na=V;la=ca;while(1){ra=na&127|ma<<7;c[L>>2]=ra;oa=oa+1|0;sa=la+1|0;c[E>>2]=sa;pa=a[oa>>0]|0;if(pa<<24>>24>=0){xa=ra;ya=pa;za=sa;break}else{ma=ra;na=pa;la=sa}}}else{xa=0;ya=V;za=ca}la=ya&127|xa<<7;c[L>>2]=la;T=za+1|0;c[E>>2]=T;if(la){Aa=la;Ba=da;i=59;break}else S=da}if((i|0)==59){i=0;X=H;Y=(Ba+-1|0)>>>0>=Aa>>>0?Aa:Ba;break}c[B>>2]=1;S=0;do{T=S+G|0;E=k+(T<<3)|0;if(c[E>>2]|0){Jc(n,a[k+(T<<3)+4>>0]|0,S&255,0)|0;c[E>>2]=0}S=S+1|0}while((S|0)!=128);X=H+1<<24>>24;Y=fa}else{X=H;Y=F}while(0);C=C+1|0;if(C>>>0>=m>>>0){Ca=X;Da=Y;break}else{H=X;F=Y}}F=c[y>>2]|0;Ea=R+o*+(Da>>>0);H=~~Ea>>>0;C=(c[z>>2]|0)+(((c[A>>2]|0)+-1|0)*20|0)+12|0;c[C>>2]=(c[C>>2]|0)+H;c[y>>2]=F+H;if((Ca&255)<(l&255)){x=Ca;R=Ea-+(H>>>0);K=Da}else break c}_b(38672,38688,234,7,38744,0);break a}while(0);y=Bb(e[380]|0,+g[176],+g[178],+g[180],+g[182])|0;c[n+229964>>2]=y;if(!y){_b(38672,38688,334,1,38760,0);break}else{c[n+28>>2]=0;c[n+12>>2]=c[z>>2];c[n+4>>2]=0;c[n+564>>2]=0;Yb(n);break}}while(0);vb(p);vb(q);vb(r);vb(k);vb(s);if(c[n+229964>>2]|0){j=n;return j|0}Mb(n);j=0;return j|0}function vb(a){a=a|0;var b=0,d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0;if(!a)return;b=a+-8|0;d=c[10112]|0;if(b>>>0<d>>>0)Ta();e=c[a+-4>>2]|0;f=e&3;if((f|0)==1)Ta();g=e&-8;h=a+(g+-8)|0;do if(!(e&1)){i=c[b>>2]|0;if(!f)return;j=-8-i|0;k=a+j|0;l=i+g|0;if(k>>>0<d>>>0)Ta();if((k|0)==(c[10113]|0)){m=a+(g+-4)|0;n=c[m>>2]|0;if((n&3|0)!=3){o=k;p=l;break}c[10110]=l;c[m>>2]=n&-2;c[a+(j+4)>>2]=l|1;c[h>>2]=l;return}n=i>>>3;if(i>>>0<256){i=c[a+(j+8)>>2]|0;m=c[a+(j+12)>>2]|0;q=40472+(n<<1<<2)|0;if((i|0)!=(q|0)){if(i>>>0<d>>>0)Ta();if((c[i+12>>2]|0)!=(k|0))Ta();}if((m|0)==(i|0)){c[10108]=c[10108]&~(1<<n);o=k;p=l;break}if((m|0)==(q|0))r=m+8|0;else{if(m>>>0<d>>>0)Ta();q=m+8|0;if((c[q>>2]|0)==(k|0))r=q;else Ta();}c[i+12>>2]=m;c[r>>2]=i;o=k;p=l;break}i=c[a+(j+24)>>2]|0;m=c[a+(j+12)>>2]|0;do if((m|0)==(k|0)){q=a+(j+20)|0;n=c[q>>2]|0;if(!n){s=a+(j+16)|0;t=c[s>>2]|0;if(!t){u=0;break}else{v=t;w=s}}else{v=n;w=q}while(1){q=v+20|0;n=c[q>>2]|0;if(n){v=n;w=q;continue}q=v+16|0;n=c[q>>2]|0;if(!n){x=v;y=w;break}else{v=n;w=q}}if(y>>>0<d>>>0)Ta();else{c[y>>2]=0;u=x;break}}else{q=c[a+(j+8)>>2]|0;if(q>>>0<d>>>0)Ta();n=q+12|0;if((c[n>>2]|0)!=(k|0))Ta();s=m+8|0;if((c[s>>2]|0)==(k|0)){c[n>>2]=m;c[s>>2]=q;u=m;break}else Ta();}while(0);if(!i){o=k;p=l}else{m=c[a+(j+28)>>2]|0;q=40736+(m<<2)|0;if((k|0)==(c[q>>2]|0)){c[q>>2]=u;if(!u){c[10109]=c[10109]&~(1<<m);o=k;p=l;break}}else{if(i>>>0<(c[10112]|0)>>>0)Ta();m=i+16|0;if((c[m>>2]|0)==(k|0))c[m>>2]=u;else c[i+20>>2]=u;if(!u){o=k;p=l;break}}m=c[10112]|0;if(u>>>0<m>>>0)Ta();c[u+24>>2]=i;q=c[a+(j+16)>>2]|0;do if(q)if(q>>>0<m>>>0)Ta();else{c[u+16>>2]=q;c[q+24>>2]=u;break}while(0);q=c[a+(j+20)>>2]|0;if(!q){o=k;p=l}else if(q>>>0<(c[10112]|0)>>>0)Ta();else{c[u+20>>2]=q;c[q+24>>2]=u;o=k;p=l;break}}}else{o=b;p=g}while(0);if(o>>>0>=h>>>0)Ta();b=a+(g+-4)|0;u=c[b>>2]|0;if(!(u&1))Ta();if(!(u&2)){if((h|0)==(c[10114]|0)){d=(c[10111]|0)+p|0;c[10111]=d;c[10114]=o;c[o+4>>2]=d|1;if((o|0)!=(c[10113]|0))return;c[10113]=0;c[10110]=0;return}if((h|0)==(c[10113]|0)){d=(c[10110]|0)+p|0;c[10110]=d;c[10113]=o;c[o+4>>2]=d|1;c[o+d>>2]=d;return}d=(u&-8)+p|0;x=u>>>3;do if(u>>>0<256){y=c[a+g>>2]|0;w=c[a+(g|4)>>2]|0;v=40472+(x<<1<<2)|0;if((y|0)!=(v|0)){if(y>>>0<(c[10112]|0)>>>0)Ta();if((c[y+12>>2]|0)!=(h|0))Ta();}if((w|0)==(y|0)){c[10108]=c[10108]&~(1<<x);break}if((w|0)==(v|0))z=w+8|0;else{if(w>>>0<(c[10112]|0)>>>0)Ta();v=w+8|0;if((c[v>>2]|0)==(h|0))z=v;else Ta();}c[y+12>>2]=w;c[z>>2]=y}else{y=c[a+(g+16)>>2]|0;w=c[a+(g|4)>>2]|0;do if((w|0)==(h|0)){v=a+(g+12)|0;r=c[v>>2]|0;if(!r){f=a+(g+8)|0;e=c[f>>2]|0;if(!e){A=0;break}else{B=e;C=f}}else{B=r;C=v}while(1){v=B+20|0;r=c[v>>2]|0;if(r){B=r;C=v;continue}v=B+16|0;r=c[v>>2]|0;if(!r){D=B;E=C;break}else{B=r;C=v}}if(E>>>0<(c[10112]|0)>>>0)Ta();else{c[E>>2]=0;A=D;break}}else{v=c[a+g>>2]|0;if(v>>>0<(c[10112]|0)>>>0)Ta();r=v+12|0;if((c[r>>2]|0)!=(h|0))Ta();f=w+8|0;if((c[f>>2]|0)==(h|0)){c[r>>2]=w;c[f>>2]=v;A=w;break}else Ta();}while(0);if(y){w=c[a+(g+20)>>2]|0;l=40736+(w<<2)|0;if((h|0)==(c[l>>2]|0)){c[l>>2]=A;if(!A){c[10109]=c[10109]&~(1<<w);break}}else{if(y>>>0<(c[10112]|0)>>>0)Ta();w=y+16|0;if((c[w>>2]|0)==(h|0))c[w>>2]=A;else c[y+20>>2]=A;if(!A)break}w=c[10112]|0;if(A>>>0<w>>>0)Ta();c[A+24>>2]=y;l=c[a+(g+8)>>2]|0;do if(l)if(l>>>0<w>>>0)Ta();else{c[A+16>>2]=l;c[l+24>>2]=A;break}while(0);l=c[a+(g+12)>>2]|0;if(l)if(l>>>0<(c[10112]|0)>>>0)Ta();else{c[A+20>>2]=l;c[l+24>>2]=A;break}}}while(0);c[o+4>>2]=d|1;c[o+d>>2]=d;if((o|0)==(c[10113]|0)){c[10110]=d;return}else F=d}else{c[b>>2]=u&-2;c[o+4>>2]=p|1;c[o+p>>2]=p;F=p}p=F>>>3;if(F>>>0<256){u=p<<1;b=40472+(u<<2)|0;d=c[10108]|0;A=1<<p;if(!(d&A)){c[10108]=d|A;G=40472+(u+2<<2)|0;H=b}else{A=40472+(u+2<<2)|0;u=c[A>>2]|0;if(u>>>0<(c[10112]|0)>>>0)Ta();else{G=A;H=u}}c[G>>2]=o;c[H+12>>2]=o;c[o+8>>2]=H;c[o+12>>2]=b;return}b=F>>>8;if(!b)I=0;else if(F>>>0>16777215)I=31;else{H=(b+1048320|0)>>>16&8;G=b<<H;b=(G+520192|0)>>>16&4;u=G<<b;G=(u+245760|0)>>>16&2;A=14-(b|H|G)+(u<<G>>>15)|0;I=F>>>(A+7|0)&1|A<<1}A=40736+(I<<2)|0;c[o+28>>2]=I;c[o+20>>2]=0;c[o+16>>2]=0;G=c[10109]|0;u=1<<I;a:do if(!(G&u)){c[10109]=G|u;c[A>>2]=o;c[o+24>>2]=A;c[o+12>>2]=o;c[o+8>>2]=o}else{H=c[A>>2]|0;b:do if((c[H+4>>2]&-8|0)==(F|0))J=H;else{b=F<<((I|0)==31?0:25-(I>>>1)|0);d=H;while(1){p=d+16+(b>>>31<<2)|0;g=c[p>>2]|0;if(!g){K=p;L=d;break}if((c[g+4>>2]&-8|0)==(F|0)){J=g;break b}else{b=b<<1;d=g}}if(K>>>0<(c[10112]|0)>>>0)Ta();else{c[K>>2]=o;c[o+24>>2]=L;c[o+12>>2]=o;c[o+8>>2]=o;break a}}while(0);H=J+8|0;d=c[H>>2]|0;b=c[10112]|0;if(d>>>0>=b>>>0&J>>>0>=b>>>0){c[d+12>>2]=o;c[H>>2]=o;c[o+8>>2]=d;c[o+12>>2]=J;c[o+24>>2]=0;break}else Ta();}while(0);o=(c[10116]|0)+-1|0;c[10116]=o;if(!o)M=40888;else return;while(1){o=c[M>>2]|0;if(!o)break;else M=o+8|0}c[10116]=-1;return}function wb(a,b){a=a|0;b=b|0;var d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0;d=a+b|0;e=c[a+4>>2]|0;do if(!(e&1)){f=c[a>>2]|0;if(!(e&3))return;g=a+(0-f)|0;h=f+b|0;i=c[10112]|0;if(g>>>0<i>>>0)Ta();if((g|0)==(c[10113]|0)){j=a+(b+4)|0;k=c[j>>2]|0;if((k&3|0)!=3){l=g;m=h;break}c[10110]=h;c[j>>2]=k&-2;c[a+(4-f)>>2]=h|1;c[d>>2]=h;return}k=f>>>3;if(f>>>0<256){j=c[a+(8-f)>>2]|0;n=c[a+(12-f)>>2]|0;o=40472+(k<<1<<2)|0;if((j|0)!=(o|0)){if(j>>>0<i>>>0)Ta();if((c[j+12>>2]|0)!=(g|0))Ta();}if((n|0)==(j|0)){c[10108]=c[10108]&~(1<<k);l=g;m=h;break}if((n|0)==(o|0))p=n+8|0;else{if(n>>>0<i>>>0)Ta();o=n+8|0;if((c[o>>2]|0)==(g|0))p=o;else Ta();}c[j+12>>2]=n;c[p>>2]=j;l=g;m=h;break}j=c[a+(24-f)>>2]|0;n=c[a+(12-f)>>2]|0;do if((n|0)==(g|0)){o=16-f|0;k=a+(o+4)|0;q=c[k>>2]|0;if(!q){r=a+o|0;o=c[r>>2]|0;if(!o){s=0;break}else{t=o;u=r}}else{t=q;u=k}while(1){k=t+20|0;q=c[k>>2]|0;if(q){t=q;u=k;continue}k=t+16|0;q=c[k>>2]|0;if(!q){v=t;w=u;break}else{t=q;u=k}}if(w>>>0<i>>>0)Ta();else{c[w>>2]=0;s=v;break}}else{k=c[a+(8-f)>>2]|0;if(k>>>0<i>>>0)Ta();q=k+12|0;if((c[q>>2]|0)!=(g|0))Ta();r=n+8|0;if((c[r>>2]|0)==(g|0)){c[q>>2]=n;c[r>>2]=k;s=n;break}else Ta();}while(0);if(!j){l=g;m=h}else{n=c[a+(28-f)>>2]|0;i=40736+(n<<2)|0;if((g|0)==(c[i>>2]|0)){c[i>>2]=s;if(!s){c[10109]=c[10109]&~(1<<n);l=g;m=h;break}}else{if(j>>>0<(c[10112]|0)>>>0)Ta();n=j+16|0;if((c[n>>2]|0)==(g|0))c[n>>2]=s;else c[j+20>>2]=s;if(!s){l=g;m=h;break}}n=c[10112]|0;if(s>>>0<n>>>0)Ta();c[s+24>>2]=j;i=16-f|0;k=c[a+i>>2]|0;do if(k)if(k>>>0<n>>>0)Ta();else{c[s+16>>2]=k;c[k+24>>2]=s;break}while(0);k=c[a+(i+4)>>2]|0;if(!k){l=g;m=h}else if(k>>>0<(c[10112]|0)>>>0)Ta();else{c[s+20>>2]=k;c[k+24>>2]=s;l=g;m=h;break}}}else{l=a;m=b}while(0);s=c[10112]|0;if(d>>>0<s>>>0)Ta();v=a+(b+4)|0;w=c[v>>2]|0;if(!(w&2)){if((d|0)==(c[10114]|0)){u=(c[10111]|0)+m|0;c[10111]=u;c[10114]=l;c[l+4>>2]=u|1;if((l|0)!=(c[10113]|0))return;c[10113]=0;c[10110]=0;return}if((d|0)==(c[10113]|0)){u=(c[10110]|0)+m|0;c[10110]=u;c[10113]=l;c[l+4>>2]=u|1;c[l+u>>2]=u;return}u=(w&-8)+m|0;t=w>>>3;do if(w>>>0<256){p=c[a+(b+8)>>2]|0;e=c[a+(b+12)>>2]|0;k=40472+(t<<1<<2)|0;if((p|0)!=(k|0)){if(p>>>0<s>>>0)Ta();if((c[p+12>>2]|0)!=(d|0))Ta();}if((e|0)==(p|0)){c[10108]=c[10108]&~(1<<t);break}if((e|0)==(k|0))x=e+8|0;else{if(e>>>0<s>>>0)Ta();k=e+8|0;if((c[k>>2]|0)==(d|0))x=k;else Ta();}c[p+12>>2]=e;c[x>>2]=p}else{p=c[a+(b+24)>>2]|0;e=c[a+(b+12)>>2]|0;do if((e|0)==(d|0)){k=a+(b+20)|0;n=c[k>>2]|0;if(!n){f=a+(b+16)|0;j=c[f>>2]|0;if(!j){y=0;break}else{z=j;A=f}}else{z=n;A=k}while(1){k=z+20|0;n=c[k>>2]|0;if(n){z=n;A=k;continue}k=z+16|0;n=c[k>>2]|0;if(!n){B=z;C=A;break}else{z=n;A=k}}if(C>>>0<s>>>0)Ta();else{c[C>>2]=0;y=B;break}}else{k=c[a+(b+8)>>2]|0;if(k>>>0<s>>>0)Ta();n=k+12|0;if((c[n>>2]|0)!=(d|0))Ta();f=e+8|0;if((c[f>>2]|0)==(d|0)){c[n>>2]=e;c[f>>2]=k;y=e;break}else Ta();}while(0);if(p){e=c[a+(b+28)>>2]|0;h=40736+(e<<2)|0;if((d|0)==(c[h>>2]|0)){c[h>>2]=y;if(!y){c[10109]=c[10109]&~(1<<e);break}}else{if(p>>>0<(c[10112]|0)>>>0)Ta();e=p+16|0;if((c[e>>2]|0)==(d|0))c[e>>2]=y;else c[p+20>>2]=y;if(!y)break}e=c[10112]|0;if(y>>>0<e>>>0)Ta();c[y+24>>2]=p;h=c[a+(b+16)>>2]|0;do if(h)if(h>>>0<e>>>0)Ta();else{c[y+16>>2]=h;c[h+24>>2]=y;break}while(0);h=c[a+(b+20)>>2]|0;if(h)if(h>>>0<(c[10112]|0)>>>0)Ta();else{c[y+20>>2]=h;c[h+24>>2]=y;break}}}while(0);c[l+4>>2]=u|1;c[l+u>>2]=u;if((l|0)==(c[10113]|0)){c[10110]=u;return}else D=u}else{c[v>>2]=w&-2;c[l+4>>2]=m|1;c[l+m>>2]=m;D=m}m=D>>>3;if(D>>>0<256){w=m<<1;v=40472+(w<<2)|0;u=c[10108]|0;y=1<<m;if(!(u&y)){c[10108]=u|y;E=40472+(w+2<<2)|0;F=v}else{y=40472+(w+2<<2)|0;w=c[y>>2]|0;if(w>>>0<(c[10112]|0)>>>0)Ta();else{E=y;F=w}}c[E>>2]=l;c[F+12>>2]=l;c[l+8>>2]=F;c[l+12>>2]=v;return}v=D>>>8;if(!v)G=0;else if(D>>>0>16777215)G=31;else{F=(v+1048320|0)>>>16&8;E=v<<F;v=(E+520192|0)>>>16&4;w=E<<v;E=(w+245760|0)>>>16&2;y=14-(v|F|E)+(w<<E>>>15)|0;G=D>>>(y+7|0)&1|y<<1}y=40736+(G<<2)|0;c[l+28>>2]=G;c[l+20>>2]=0;c[l+16>>2]=0;E=c[10109]|0;w=1<<G;if(!(E&w)){c[10109]=E|w;c[y>>2]=l;c[l+24>>2]=y;c[l+12>>2]=l;c[l+8>>2]=l;return}w=c[y>>2]|0;a:do if((c[w+4>>2]&-8|0)==(D|0))H=w;else{y=D<<((G|0)==31?0:25-(G>>>1)|0);E=w;while(1){F=E+16+(y>>>31<<2)|0;v=c[F>>2]|0;if(!v){I=F;J=E;break}if((c[v+4>>2]&-8|0)==(D|0)){H=v;break a}else{y=y<<1;E=v}}if(I>>>0<(c[10112]|0)>>>0)Ta();c[I>>2]=l;c[l+24>>2]=J;c[l+12>>2]=l;c[l+8>>2]=l;return}while(0);J=H+8|0;I=c[J>>2]|0;D=c[10112]|0;if(!(I>>>0>=D>>>0&H>>>0>=D>>>0))Ta();c[I+12>>2]=l;c[J>>2]=l;c[l+8>>2]=I;c[l+12>>2]=H;c[l+24>>2]=0;return}function xb(f,h){f=f|0;h=h|0;var j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0.0,t=0,u=0,v=0,w=0,x=0,y=0.0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0.0,P=0;j=0;j=0;k=i;i=i+32|0;l=k+4|0;m=k;n=k+8|0;c[l>>2]=441668941;c[m>>2]=0;o=n;p=o+16|0;do{a[o>>0]=0;o=o+1|0}while((o|0)<(p|0));if(h>>>0<17){_b(38296,38312,75,16,38336,0);q=0;i=k;return q|0}if(Yc(f,l,4)|0){_b(38296,38312,80,16,0,0);q=0;i=k;return q|0}l=(d[f+7>>0]|0)<<8|(d[f+6>>0]|0);o=(d[f+13>>0]|0)<<8|(d[f+12>>0]|0);if((((d[f+5>>0]|0)<<8|(d[f+4>>0]|0))+16+(o<<1)|0)>>>0>h>>>0){_b(38296,38312,104,16,38336,0);q=0;i=k;return q|0}else r=0;while(1)if((r&65535)>>>0<o>>>0)r=r+1<<16>>16;else break;r=Hd(32)|0;s=+(6e7/((r<<16>>16==0?140:r&65535)>>>0)|0|0);r=~~((b[348]&8192)==0?s:s+.5)>>>0;s=+Zd(60,r);o=Tc()|0;Nc(o,60)|0;Oc(o,r)|0;r=m+1|0;p=m+2|0;t=m+3|0;u=o+16|0;v=o+8|0;w=o+32|0;x=l;l=0;y=0.0;a:while(1){z=x;A=l;while(1){B=f+z|0;C=a[B>>0]|0;D=C&255;E=D&15;if((E|0)==15){F=(D&240|9)&255;a[B>>0]=F;G=F}else if((E|0)==9){E=(D|15)&255;a[B>>0]=E;G=E}else G=C;C=G&255;b:do switch(C>>>4&7|0){case 0:{a[m>>0]=C&15|128;a[r>>0]=a[f+(z+1)>>0]|0;a[p>>0]=0;a[t>>0]=0;H=2;j=36;break}case 1:{E=a[f+(z+1)>>0]|0;D=C&15;a[m>>0]=D|144;if(E<<24>>24<0){a[r>>0]=E&127;F=a[f+(z+2)>>0]|0;a[p>>0]=F;a[t>>0]=0;a[n+D>>0]=F;H=3;j=36;break b}else{a[r>>0]=E;a[p>>0]=a[n+D>>0]|0;a[t>>0]=0;H=2;j=36;break b}break}case 2:{a[m>>0]=C&15|224;D=a[f+(z+1)>>0]|0;a[r>>0]=(D&255)<<6&64;a[p>>0]=(D&255)>>>1;a[t>>0]=0;H=2;j=36;break}case 3:{switch(d[f+(z+1)>>0]|0|0){case 10:{a[m>>0]=C&15|176;a[r>>0]=120;a[p>>0]=0;a[t>>0]=0;H=2;j=36;break b;break}case 11:{a[m>>0]=C&15|176;a[r>>0]=123;a[p>>0]=0;a[t>>0]=0;H=2;j=36;break b;break}case 12:{a[m>>0]=C&15|176;a[r>>0]=126;a[p>>0]=0;a[t>>0]=0;H=2;j=36;break b;break}case 13:{a[m>>0]=C&15|176;a[r>>0]=127;a[p>>0]=0;a[t>>0]=0;H=2;j=36;break b;break}case 14:{a[m>>0]=C&15|176;a[r>>0]=121;a[p>>0]=0;a[t>>0]=0;H=2;j=36;break b;break}default:{I=G;J=2;break b}}break}case 4:{do switch(d[f+(z+1)>>0]|0|0){case 4:{a[m>>0]=C&15|176;a[r>>0]=10;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 5:{a[m>>0]=C&15|176;a[r>>0]=11;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 7:{a[m>>0]=C&15|176;a[r>>0]=93;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 8:{a[m>>0]=C&15|176;a[r>>0]=64;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 9:{a[m>>0]=C&15|176;a[r>>0]=67;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 6:{a[m>>0]=C&15|176;a[r>>0]=91;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 0:{a[m>>0]=C&15|192;a[r>>0]=a[f+(z+2)>>0]|0;a[p>>0]=0;a[t>>0]=0;H=3;j=36;break b;break}case 1:{a[m>>0]=C&15|176;a[r>>0]=0;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 2:{a[m>>0]=C&15|176;a[r>>0]=1;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}case 3:{a[m>>0]=C&15|176;a[r>>0]=7;a[p>>0]=a[f+(z+2)>>0]|0;a[t>>0]=0;H=3;j=36;break b;break}default:{I=G;J=3;break b}}while(0);break}case 7:case 5:{I=G;J=1;break}case 6:{j=43;break a;break}default:{H=A;j=36}}while(0);if((j|0)==36){j=0;if(!(ob(o,m,0)|0)){j=38;break a}I=a[B>>0]|0;J=H}C=(J&255)+z|0;if(I<<24>>24<0){K=C;L=J;break}else{z=C;A=J}}A=K;z=0;while(1){C=A+1|0;D=d[f+A>>0]|0;E=D&127|z<<7;if(!(D&128)){M=C;N=E;break}else{A=C;z=E}}O=y+s*+(N>>>0);z=~~O>>>0;c[(c[v>>2]|0)+(((c[u>>2]|0)+-1|0)*20|0)+12>>2]=z;c[w>>2]=(c[w>>2]|0)+z;if(M>>>0<h>>>0){x=M;l=L;y=O-+(z>>>0);}else{j=43;break}}do if((j|0)==38){_b(38296,38312,319,7,38744,0);P=o+229964|0}else if((j|0)==43){L=Bb(e[380]|0,+g[176],+g[178],+g[180],+g[182])|0;l=o+229964|0;c[l>>2]=L;if(!L){_b(38296,38312,348,1,38760,0);P=l;break}else{Pc(o)|0;c[o+28>>2]=0;c[o+12>>2]=c[v>>2];c[o+4>>2]=0;c[o+564>>2]=0;Yb(o);P=l;break}}while(0);if(c[P>>2]|0){q=o;i=k;return q|0}Mb(o);q=0;i=k;return q|0}function yb(b,f){b=b|0;f=f|0;var h=0,i=0,j=0,k=0,l=0.0,m=0,n=0,o=0,p=0,q=0,r=0,s=0.0,t=0.0,u=0,v=0,w=0,x=0.0,y=0,z=0,A=0,B=0,C=0,D=0.0,E=0.0,F=0,G=0,H=0,I=0,J=0.0,K=0.0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0.0,S=0,T=0.0,U=0,V=0.0,W=0,X=0,Y=0,Z=0,_=0,$=0,aa=0.0,ba=0.0,ca=0,da=0,ea=0,fa=0,ga=0.0,ha=0.0,ia=0,ja=0,ka=0,la=0.0,ma=0,na=0,oa=0,pa=0,qa=0,ra=0,sa=0,ta=0,ua=0,va=0,wa=0,xa=0,ya=0,za=0,Aa=0,Ba=0,Ca=0,Da=0,Ea=0,Fa=0.0,Ga=0.0,Ha=0;f=0;f=0;if(Yc(b,38192,4)|0){_b(38200,38216,68,17,0,0);h=0;return h|0}i=d[b+5>>0]<<16|d[b+4>>0]<<24|d[b+6>>0]<<8|d[b+7>>0];if(Yc(b+8|0,38240,8)|0){_b(38200,38216,83,17,0,0);h=0;return h|0}j=a[b+20>>0]|0;k=j&255;if(!(j<<24>>24)){_b(38200,38216,99,17,0,0);h=0;return h|0}if(Yc(b+(i+8)|0,38256,4)|0){_b(38200,38216,114,17,0,0);h=0;return h|0}if(Yc(b+(i+16)|0,38264,4)|0){_b(38200,38216,129,17,0,0);h=0;return h|0}j=Tc()|0;Nc(j,60)|0;Oc(j,5e5)|0;l=+Zd(60,5e5);m=pb(8192)|0;$c(m|0,0,8192)|0;n=j+16|0;o=j+8|0;p=j+32|0;q=b+(i+20)|0;i=0;b=0;r=0;s=0.0;t=l;a:while(1){if(Yc(q,38192,4)|0){f=13;break}if(Yc(q+8|0,38264,4)|0){f=15;break}u=q+12|0;v=b;w=r;l=s;x=t;y=(d[q+6>>0]<<8|d[q+7>>0]|d[q+5>>0]<<16|d[q+4>>0]<<24)+-4|0;while(1){do if(!(Yc(u,38272,4)|0)){z=(d[u+5>>0]<<16|d[u+4>>0]<<24|d[u+6>>0]<<8|d[u+7>>0])+8|0;A=u+z|0;B=v;C=w;D=l;E=x;F=y-z|0}else{if(!(Yc(u,38280,4)|0)){z=(d[u+5>>0]<<16|d[u+4>>0]<<24|d[u+6>>0]<<8|d[u+7>>0])+8|0;A=u+z|0;B=v;C=w;D=l;E=x;F=y-z|0;break}if(Yc(u,38288,4)|0){f=50;break a}z=v+1|0;G=u+8|0;H=d[u+5>>0]<<16|d[u+4>>0]<<24|d[u+6>>0]<<8|d[u+7>>0];I=w;J=l;K=x;L=y+-8|0;M=0;while(1){N=a[G>>0]|0;b:do if(N<<24>>24>-1){O=H+-1|0;P=N&127;Q=I;R=J;while(1){S=(Q+-1|0)>>>0>=P>>>0?P:Q;T=R+K*+(S>>>0);U=~~T>>>0;V=+(U>>>0);W=(c[o>>2]|0)+(((c[n>>2]|0)+-1|0)*20|0)+12|0;c[W>>2]=U+(c[W>>2]|0);c[p>>2]=U+(c[p>>2]|0);U=0;W=0;while(1){X=m+(U<<2)|0;Y=c[X>>2]|0;do if(!Y)Z=W;else{_=Y-S|0;c[X>>2]=_;if((Y|0)==(S|0)){Jc(j,U>>>7&255,U&127,0)|0;Z=W;break}else{Z=(W+-1|0)>>>0>=_>>>0?_:W;break}}while(0);U=U+1|0;if((U|0)==2048){$=Z;break}else W=Z}aa=T-V;if((P|0)==(S|0)){ba=aa;ca=$;break}else{P=P-S|0;Q=$;R=aa}}da=G+1|0;ea=O;fa=ca;ga=ba;ha=K;ia=L+-1|0;ja=M}else{if(M<<24>>24!=0&N<<24>>24==-1)if((a[G+1>>0]|0)==81)if((a[G+2>>0]|0)==3){ka=6;la=K}else f=35;else f=35;else f=35;c:do if((f|0)==35){f=0;Q=ob(j,G,0)|0;if(!Q){f=36;break a}P=a[G>>0]|0;W=P&255;if((W&240|0)==144){U=a[G+1>>0]|0;Y=G+Q|0;X=H-Q|0;_=L-Q|0;ma=a[Y>>0]|0;if(ma<<24>>24<0){na=Y;oa=ma;pa=X;qa=_;ra=0;while(1){sa=na+1|0;ta=oa&127|ra<<7;ua=pa+-1|0;va=qa+-1|0;wa=a[sa>>0]|0;if(wa<<24>>24<0){na=sa;oa=wa;pa=ua;qa=va;ra=ta}else{xa=sa;ya=wa;za=ua;Aa=va;Ba=ta;break}}}else{xa=Y;ya=ma;za=X;Aa=_;Ba=0}ra=xa+1|0;qa=ya&127|Ba<<7;pa=za+-1|0;oa=Aa+-1|0;c[m+((U&255)+(W<<7&1920)<<2)>>2]=qa;if(!qa){da=ra;ea=pa;fa=I;ga=J;ha=K;ia=oa;ja=M;break b}da=ra;ea=pa;fa=(I+-1|0)>>>0>=qa>>>0?qa:I;ga=J;ha=K;ia=oa;ja=M;break b}do if(P<<24>>24==-1){if((a[G+1>>0]|0)!=81)break;if((a[G+2>>0]|0)!=3)break;oa=d[G+4>>0]<<8|d[G+3>>0]<<16|d[G+5>>0];ka=Q;la=+Zd(60,(oa|0)!=0?oa:5e5);break c}while(0);da=G+Q|0;ea=H-Q|0;fa=I;ga=J;ha=K;ia=L-Q|0;ja=M;break b}while(0);da=G+ka|0;ea=H-ka|0;fa=I;ga=J;ha=la;ia=L-ka|0;ja=1}while(0);if(!ea){A=da;B=z;C=fa;D=ga;E=ha;F=ia;break}else{G=da;H=ea;I=fa;J=ga;K=ha;L=ia;M=ja}}}while(0);if(!F){Ca=A;Da=B;Ea=C;Fa=D;Ga=E;break}else{u=A;v=B;w=C;l=D;x=E;y=F}}y=i+1|0;if(y>>>0<k>>>0){q=Ca;i=y;b=Da;r=Ea;s=Fa;t=Ga}else{Ha=Da;f=53;break}}do if((f|0)==13)_b(38200,38216,146,17,0,0);else if((f|0)==15)_b(38200,38216,159,17,0,0);else if((f|0)==36)_b(38200,38216,274,7,38744,0);else if((f|0)==50)_b(38200,38216,336,17,0,0);else if((f|0)==53){Da=Bb(e[380]|0,+g[176],+g[178],+g[180],+g[182])|0;c[j+229964>>2]=Da;if(!Da){_b(38200,38216,345,1,38760,0);break}c[j+28>>2]=0;c[j+12>>2]=c[j+8>>2];c[j+4>>2]=0;c[j+564>>2]=0;if(Ha>>>0>1)a[j+23e4>>0]=1;Yb(j);}while(0);if(m)vb(m);if(c[j+229964>>2]|0){h=j;return h|0}Mb(j);h=0;return h|0}function zb(f,j){f=f|0;j=j|0;var k=0,l=0,m=0,o=0,p=0,q=0,r=0,s=0,t=0.0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0,S=0,T=0,U=0,V=0.0,W=0.0,X=0,Y=0,Z=0,_=0,$=0,aa=0,ba=0,ca=0,da=0,ea=0,fa=0,ga=0,ha=0,ia=0,ja=0.0;k=0;k=0;l=i;i=i+16|0;m=l;if(Yc(f,38352,8)|0){_b(38368,38384,78,13,0,0);o=0;i=l;return o|0}p=(Yc(f+8|0,38408,6)|0)==0;q=(p?-14:-8)+j|0;j=p?14:8;r=p?18:24;s=0;do{if(a[f+(s+j)>>0]|0){k=6;break}s=s+1|0}while(s>>>0<r>>>0);if((k|0)==6){_b(38368,38384,98,13,0,0);o=0;i=l;return o|0}s=j+r|1;j=d[f+(s+16)>>0]<<8|d[f+(s+15)>>0]|d[f+(s+17)>>0]<<16|d[f+(s+18)>>0]<<24;t=+((6e7/((d[f+(s+24)>>0]<<8|d[f+(s+23)>>0]|d[f+(s+25)>>0]<<16|d[f+(s+26)>>0]<<24)>>>0)|0)>>>0);u=~~((b[348]&8192)==0?t:t+.5)>>>0;t=+Zd(60,u);v=Tc()|0;Nc(v,60)|0;Oc(v,u)|0;u=j<<2;w=pb(u)|0;x=pb(u)|0;u=pb(j)|0;y=(j|0)==0;a:do if(y){z=-1;k=14}else{A=q-r+(p?-872:-744)|0;B=f+(s+(p?871:743))|0;C=0;D=-1;while(1){E=w+(C<<2)|0;c[E>>2]=B;F=d[B+5>>0]<<8|d[B+4>>0]|d[B+6>>0]<<16|d[B+7>>0]<<24;if(A>>>0<F>>>0)break;A=A-F|0;G=B+12|0;H=x+(C<<2)|0;c[H>>2]=0;I=a[G>>0]|0;if(I<<24>>24>-1){J=G;G=I;K=0;L=12;M=0;while(1){J=J+1|0;N=(G&127)<<M|K;c[H>>2]=N;O=M+7|0;P=L+1|0;Q=a[J>>0]|0;if(Q<<24>>24<=-1){R=Q;S=N;T=P;U=O;break}else{G=Q;K=N;L=P;M=O}}}else{R=I;S=0;T=12;U=0}M=(R&127)<<U|S;c[H>>2]=M;L=M>>>0<D>>>0?M:D;c[E>>2]=B+(T+1);a[u+C>>0]=0;C=C+1|0;if(C>>>0>=j>>>0){z=L;k=14;break a}else{B=B+F|0;D=L}}_b(38368,38384,206,13,38712,0);}while(0);b:do if((k|0)==14){V=t*+(z>>>0)+0.0;T=~~V>>>0;S=v+16|0;U=v+8|0;R=(c[U>>2]|0)+(((c[S>>2]|0)+-1|0)*20|0)+12|0;c[R>>2]=(c[R>>2]|0)+T;R=v+32|0;c[R>>2]=(c[R>>2]|0)+T;c:do if(!y){p=c[n>>2]|0;s=0;W=V-+(T>>>0);f=z;d:while(1){r=s;q=0;D=0;while(1){B=u+q|0;do if(!(a[B>>0]|0)){C=x+(q<<2)|0;A=c[C>>2]|0;if(A){L=A-f|0;c[C>>2]=L;if((A|0)!=(f|0)){X=r;Y=(D+-1|0)>>>0>=L>>>0?L:D;break}}L=w+(q<<2)|0;A=c[L>>2]|0;while(1){if((a[A>>0]&-16)<<24>>24==-80)if((a[A+1>>0]&-2)<<24>>24==110)if((a[A+2>>0]|0)<0)Z=A+3|0;else k=26;else k=26;else k=26;if((k|0)==26){k=0;M=ob(v,A,0)|0;if(!M)break d;if((a[A>>0]|0)==-1){if((a[A+1>>0]|0)==47)if(!(a[A+2>>0]|0)){_=A;k=31;break}if((a[A+1>>0]|0)==81)if((a[A+2>>0]|0)==3){K=d[A+4>>0]<<8|d[A+3>>0]<<16|d[A+5>>0];h[m>>3]=(K|0)==0?5.0e5:+(K|0);Wa(p|0,38416,m|0)|0}}Z=A+M|0}c[L>>2]=Z;c[C>>2]=0;M=a[Z>>0]|0;if(M<<24>>24>-1){K=M;G=0;J=Z;O=0;while(1){P=((K&127)<<O)+G|0;N=O+7|0;Q=J+1|0;K=a[Q>>0]|0;if(K<<24>>24<=-1){$=P;aa=N;ba=Q;break}else{G=P;J=Q;O=N}}c[C>>2]=$;c[L>>2]=ba;ca=a[ba>>0]|0;da=$;ea=ba;fa=aa}else{ca=M;da=0;ea=Z;fa=0}O=((ca&127)<<fa)+da|0;c[C>>2]=O;A=ea+1|0;c[L>>2]=A;if(O){ga=O;k=40;break}}if((k|0)==31){k=0;a[B>>0]=1;c[L>>2]=_+3;X=r+1|0;Y=D;break}else if((k|0)==40){k=0;X=r;Y=(D+-1|0)>>>0>=ga>>>0?ga:D;break}}else{X=r;Y=D}while(0);q=q+1|0;if(q>>>0>=j>>>0){ha=X;ia=Y;break}else{r=X;D=Y}}D=c[R>>2]|0;ja=W+t*+(ia>>>0);r=~~ja>>>0;q=(c[U>>2]|0)+(((c[S>>2]|0)+-1|0)*20|0)+12|0;c[q>>2]=(c[q>>2]|0)+r;c[R>>2]=D+r;if(ha>>>0<j>>>0){s=ha;W=ja-+(r>>>0);f=ia}else break c}_b(38368,38384,280,7,38744,0);break b}while(0);R=Bb(e[380]|0,+g[176],+g[178],+g[180],+g[182])|0;c[v+229964>>2]=R;if(!R){_b(38368,38384,334,1,38760,0);break}else{c[v+28>>2]=0;c[v+12>>2]=c[U>>2];c[v+4>>2]=0;c[v+564>>2]=0;Yb(v);break}}while(0);vb(w);vb(x);vb(u);if(c[v+229964>>2]|0){o=v;i=l;return o|0}Mb(v);o=0;i=l;return o|0}function Ab(f,j){f=f|0;j=j|0;var k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0.0,D=0,E=0,F=0.0,G=0,H=0,I=0.0,J=0,K=0,L=0,M=0,N=0,O=0,P=0.0,Q=0,R=0.0;j=0;j=0;k=i;i=i+32|0;l=k;m=k+24|0;n=Jb(f,m)|0;if(!n){o=0;i=k;return o|0}if((c[m>>2]|0)>>>0<239){_b(29920,29944,736,7,38512,0);_b(29920,29944,737,3,f,0);vb(n);o=0;i=k;return o|0}if(Yc(n,29968,22)|0)if(Yc(n,29992,22)|0){_b(29920,29944,743,6,30016,0);_b(29920,29944,745,3,f,0);vb(n);o=0;i=k;return o|0}if((d[n+82>>0]|0)>1){_b(29920,29944,750,6,30016,0);_b(29920,29944,752,3,f,0);vb(n);o=0;i=k;return o|0}if((d[n+151>>0]|0)>1){_b(29920,29944,757,6,30016,0);_b(29920,29944,759,3,f,0);vb(n);o=0;i=k;return o|0}m=a[n+198>>0]|0;a:do if(!(m<<24>>24))p=0;else{q=0;r=239;s=0;t=m;while(1){u=s;s=pb(108)|0;if(!q)v=s;else{c[u+100>>2]=s;v=q}if(!s){j=15;break}c[s+100>>2]=0;u=s+16|0;a[u>>0]=a[n+(r+7)>>0]|0;c[s>>2]=(d[n+(r+10)>>0]|0)<<16|(d[n+(r+11)>>0]|0)<<24|(d[n+(r+9)>>0]|0)<<8|(d[n+(r+8)>>0]|0);w=s+4|0;c[w>>2]=(d[n+(r+14)>>0]|0)<<16|(d[n+(r+15)>>0]|0)<<24|(d[n+(r+13)>>0]|0)<<8|(d[n+(r+12)>>0]|0);x=s+8|0;c[x>>2]=(d[n+(r+18)>>0]|0)<<16|(d[n+(r+19)>>0]|0)<<24|(d[n+(r+17)>>0]|0)<<8|(d[n+(r+16)>>0]|0);y=(d[n+(r+21)>>0]|0)<<8|(d[n+(r+20)>>0]|0);z=s+18|0;b[z>>1]=y;c[s+20>>2]=(d[n+(r+24)>>0]|0)<<16|(d[n+(r+25)>>0]|0)<<24|(d[n+(r+23)>>0]|0)<<8|(d[n+(r+22)>>0]|0);c[s+24>>2]=(d[n+(r+28)>>0]|0)<<16|(d[n+(r+29)>>0]|0)<<24|(d[n+(r+27)>>0]|0)<<8|(d[n+(r+26)>>0]|0);A=(d[n+(r+32)>>0]|0)<<16|(d[n+(r+33)>>0]|0)<<24|(d[n+(r+31)>>0]|0)<<8|(d[n+(r+30)>>0]|0);c[s+28>>2]=A;c[s+92>>2]=((A<<9>>>0)/(y>>>0)|0)<<1;y=s+32|0;a[y>>0]=a[n+(r+55)>>0]|0;A=c[w>>2]|0;B=c[x>>2]|0;if(A>>>0>B>>>0){c[x>>2]=A;c[w>>2]=B;B=d[u>>0]|0;a[u>>0]=B<<4|B>>>4}B=n+(r+40)|0;A=a[B>>0]|0;C=+g[30040+((A&255)<<2)>>2];D=n+(r+41)|0;E=a[D>>0]|0;F=+g[30040+((E&255)<<2)>>2];G=n+(r+42)|0;H=a[G>>0]|0;I=+g[30040+((H&255)<<2)>>2];J=F<I;do if(C<F){if(J){a[B>>0]=H;a[G>>0]=A;break}if(F==I){a[B>>0]=H;a[D>>0]=H;a[G>>0]=A;break}a[B>>0]=E;if(C<I){a[D>>0]=H;a[G>>0]=A;break}else{a[D>>0]=A;break}}else if(J)if(C<I){a[B>>0]=H;a[G>>0]=E;a[D>>0]=A;break}else{a[D>>0]=H;a[G>>0]=E;break}while(0);E=s+64|0;G=s+36|0;H=r+37|0;D=r+43|0;A=0;do{if(!(a[y>>0]&64)){c[E+(A<<2)>>2]=4194303;B=b[380]|0;c[G+(A<<2)>>2]=~~(4194303.0/(+(B&65535)*1.4560000272467732e-03));K=B}else{B=a[n+(H+A)>>0]|0;c[E+(A<<2)>>2]=(d[n+(D+A)>>0]|0)*16448;J=b[380]|0;L=~~(4194303.0/(+(J&65535)*+g[30040+((B&255)<<2)>>2]));B=G+(A<<2)|0;c[B>>2]=L;if(!L){c[l>>2]=29920;c[l+4>>2]=A;c[l+8>>2]=f;h[l+16>>3]=1.4560000272467732e-03;ud(31064,l);L=b[380]|0;c[B>>2]=~~(4194303.0/(+(L&65535)*1.4560000272467732e-03));K=L}else K=J}A=A+1|0}while((A|0)!=6);M=K;c[s+88>>2]=0;A=s+60|0;c[A>>2]=~~(4194303.0/(+(M&65535)*1.4560000272467732e-03));G=r+96|0;D=c[s>>2]|0;E=d[y>>0]|0;if((lb[c[31144+((E>>>1&12|E&3)<<2)>>2]&31](n+G|0,s)|0)==-1){j=37;break}E=d[y>>0]|0;if(!(E&64)){H=c[s>>2]|0;J=$(e[380]|0,H)|0;c[s+104>>2]=(J>>>0)/((e[z>>1]|0)>>>0)|0;N=H}else{if(!(E&128)){if(!(E&32)){E=c[s+80>>2]|0;O=E;P=(4194301.0-+(E|0))/+(c[s+52>>2]|0);}else{E=c[s+76>>2]|0;H=c[s+80>>2]|0;O=H;P=(4194301.0-+(E|0))/+(c[s+48>>2]|0)+ +(E-H|0)/+(c[s+52>>2]|0);}H=c[s+84>>2]|0;Q=H;R=P+ +(O-H|0)/+(c[s+56>>2]|0);}else{H=c[s+84>>2]|0;Q=H;R=(4194301.0-+(H|0))/+(c[s+56>>2]|0);}c[s+104>>2]=~~(R+ +(Q|0)/+(c[A>>2]|0))>>>0;N=c[s>>2]|0}A=d[u>>0]|0;H=A<<6&960|c[w>>2]<<10;c[w>>2]=H;E=A<<2&960|c[x>>2]<<10;c[x>>2]=E;c[s+12>>2]=E-H;c[s>>2]=N<<10;t=t+-1<<24>>24;if(!(t<<24>>24)){p=v;break a}else{q=v;r=D+G|0}}if((j|0)==15){_b(29920,29944,779,1,0,0);_b(29920,29944,780,3,f,0);vb(n);o=0;i=k;return o|0}else if((j|0)==37){vb(n);o=0;i=k;return o|0}}while(0);vb(n);o=p;i=k;return o|0}function Bb(a,b,d,e,f){a=a|0;b=+b;d=+d;e=+e;f=+f;var g=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0.0,s=0.0,t=0.0,u=0.0,v=0.0,w=0.0,x=0.0,y=0.0,z=0,A=0.0,B=0.0,C=0.0,D=0.0,E=0,F=0,G=0.0,H=0.0,I=0.0,J=0,K=0.0,L=0.0,M=0,N=0.0,O=0.0,T=0.0,U=0.0,V=0.0,W=0,X=0.0,Y=0.0;g=i;i=i+416|0;j=g+368|0;k=g+320|0;l=g+256|0;m=g+192|0;n=g+128|0;o=g;p=j;q=p+40|0;do{c[p>>2]=0;p=p+4|0}while((p|0)<(q|0));h[j>>3]=125.0;h[j+8>>3]=250.0;h[j+16>>3]=500.0;h[j+24>>3]=1.0e3;h[j+32>>3]=2.0e3;h[j+40>>3]=4.0e3;p=k;q=p+40|0;do{c[p>>2]=0;p=p+4|0}while((p|0)<(q|0));h[k>>3]=-.00044;h[k+8>>3]=-.00131;h[k+16>>3]=-.002728;h[k+24>>3]=-.004665;h[k+32>>3]=-.009887;h[k+40>>3]=-.029665;p=l;q=p+64|0;do{c[p>>2]=0;p=p+4|0}while((p|0)<(q|0));p=m;q=p+64|0;do{c[p>>2]=0;p=p+4|0}while((p|0)<(q|0));p=n;q=p+64|0;do{c[p>>2]=0;p=p+4|0}while((p|0)<(q|0));p=pb(2624)|0;r=b;b=r*.25;s=b*3.0;t=d;d=t/10.0;u=r/3.0;h[o>>3]=u;q=o+8|0;v=t/3.0;c[q>>2]=0;c[q+4>>2]=0;c[q+8>>2]=0;c[q+12>>2]=0;h[o+24>>3]=v;h[o+32>>3]=0.0;w=v*2.0;h[o+40>>3]=w;h[o+48>>3]=u;h[o+56>>3]=t;x=u*2.0;h[o+64>>3]=x;h[o+72>>3]=t;h[o+80>>3]=r;h[o+88>>3]=w;h[o+96>>3]=r;h[o+104>>3]=v;h[o+112>>3]=x;h[o+120>>3]=0.0;x=e;e=b-x;w=f;f=d-w;t=f*f;f=+P(+(e*e+t));e=s-x;y=+P(+(e*e+t));if(!p){z=0;i=g;return z|0}t=+(a|0);q=p+1536|0;e=u;A=0.0;B=u;u=0.0;C=f>0.0?f:0.0;D=y>0.0?y:0.0;E=0;F=0;while(1){G=x-e;H=w-A;I=+P(+(G*G+H*H));J=n+(F<<3)|0;h[J>>3]=I;H=b-B;G=d-u;K=s-B;L=G*G;G=+P(+(H*H+L));H=+P(+(K*K+L));M=m+(E<<3)|0;h[M>>3]=H;L=+h[n+(E<<3)>>3];K=L+G-f;h[l+(E<<3)>>3]=K;if(E>>>0<4){G=K>C?K:C;N=L+H-y;h[M>>3]=N;if(N>G){O=N;T=D}else{O=G;T=D}}else{G=K>D?K:D;K=L+H-y;h[M>>3]=K;if(K>G){O=C;T=K}else{O=C;T=G}}G=I*2.0;h[J>>3]=G;if((F|0)<4)if(G>O){U=G;V=T}else{U=O;V=T}else if(G>T){U=O;V=G}else{U=O;V=T}J=0;do{I=+h[j+(J<<3)>>3]*6.283185307179586/t;K=+S(+I);H=+R(+I);L=K*+Uc(I*.6931471805599453/K);K=+Q(10.0,+((+h[29536+(F*48|0)+(J<<3)>>3]+ +h[k+(J<<3)>>3]*G)/40.0));I=L*K;N=L/K;K=N+1.0;M=q+(F*120|0)+(J*20|0)|0;c[M>>2]=~~((I+1.0)/K*1024.0);W=~~(H*-2.0/K*1024.0);c[M+4>>2]=W;c[M+8>>2]=~~((1.0-I)/K*1024.0);c[M+12>>2]=W;c[M+16>>2]=~~((1.0-N)/K*1024.0);J=J+1|0}while((J|0)!=6);J=F+1|0;if((J|0)==8){X=U;Y=V;break}M=o+(J<<4)|0;e=+h[M>>3];A=+h[M+8>>3];B=r;u=v;C=U;D=V;E=6;F=J}V=+(a|0);a=~~(V*(X/340.29));c[p+2504>>2]=a;c[p+2496>>2]=pb((a<<2)+4|0)|0;c[p+2512>>2]=0;a=~~(V*(Y/340.29));c[p+2508>>2]=a;c[p+2500>>2]=pb((a<<2)+4|0)|0;c[p+2516>>2]=0;a=p+2520|0;F=p+2552|0;E=p+2584|0;o=p+2600|0;q=0;do{c[a+(q<<2)>>2]=~~(V*(+h[l+(q<<3)>>3]/340.29));k=q+4|0;c[a+(k<<2)>>2]=~~(V*(+h[l+(k<<3)>>3]/340.29));c[F+(q<<2)>>2]=~~(V*(+h[m+(q<<3)>>3]/340.29));c[F+(k<<2)>>2]=~~(V*(+h[m+(k<<3)>>3]/340.29));c[E+(q<<2)>>2]=~~(V*(+h[n+(q<<3)>>3]/340.29));c[o+(q<<2)>>2]=~~(V*(+h[n+(k<<3)>>3]/340.29));q=q+1|0}while((q|0)!=4);c[p+2616>>2]=4;Wb(p);z=p;i=g;return z|0}function Cb(a,b,d){a=a|0;b=b|0;d=d|0;if((fb|0)!=2){c[gb+8>>2]=a;c[gb+16>>2]=b;c[gb+24>>2]=d;if((fb|0)==1)fb=3}mb(ib+0|0);return c[gb>>2]|0}function Db(a,b,d){a=a|0;b=b|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,D=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0,L=0,M=0,N=0;if((d|0)<=0)return;e=a+2496|0;f=a+2504|0;g=a+2500|0;h=a+2508|0;i=a+2512|0;j=a+2516|0;k=a+2584|0;l=a+2600|0;m=a+2588|0;n=a+2604|0;o=a+2592|0;p=a+2608|0;q=a+2596|0;r=a+2612|0;s=0;do{t=b+(s<<2)|0;u=(c[t>>2]|0)/64|0;v=b+((s|1)<<2)|0;w=(c[v>>2]|0)/64|0;x=0;do{y=a+2520+(x<<2)|0;z=(c[e>>2]|0)+(c[y>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+u;c[y>>2]=((c[y>>2]|0)+1|0)%(c[f>>2]|0)|0;y=a+2552+(x<<2)|0;z=(c[e>>2]|0)+(c[y>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+w;c[y>>2]=((c[y>>2]|0)+1|0)%(c[f>>2]|0)|0;y=x+4|0;z=a+2520+(y<<2)|0;A=(c[g>>2]|0)+(c[z>>2]<<2)|0;c[A>>2]=(c[A>>2]|0)+u;c[z>>2]=((c[z>>2]|0)+1|0)%(c[h>>2]|0)|0;z=a+2552+(y<<2)|0;y=(c[g>>2]|0)+(c[z>>2]<<2)|0;c[y>>2]=(c[y>>2]|0)+w;c[z>>2]=((c[z>>2]|0)+1|0)%(c[h>>2]|0)|0;x=x+1|0}while((x|0)!=4);x=(c[e>>2]|0)+(c[i>>2]<<2)|0;w=c[x>>2]|0;c[x>>2]=0;c[i>>2]=((c[i>>2]|0)+1|0)%(c[f>>2]|0)|0;x=(c[g>>2]|0)+(c[j>>2]<<2)|0;u=c[x>>2]|0;c[x>>2]=0;c[j>>2]=((c[j>>2]|0)+1|0)%(c[h>>2]|0)|0;x=0;do{z=0;do{y=a+1536+(x*120|0)+(z*20|0)|0;A=y|0;B=$(c[A>>2]|0,w)|0;C=a+(x*48|0)+(z<<3)|0;D=C|0;E=c[D>>2]|0;F=y+4|0;G=($(c[F>>2]|0,E)|0)+B|0;B=C+4|0;C=y+8|0;H=G+($(c[C>>2]|0,c[B>>2]|0)|0)|0;G=a+384+(x*48|0)+(z<<3)|0;I=G|0;J=c[I>>2]|0;K=y+12|0;L=H-($(c[K>>2]|0,J)|0)|0;H=G+4|0;G=y+16|0;y=L-($(c[G>>2]|0,c[H>>2]|0)|0)|0;c[B>>2]=E;c[D>>2]=w;c[H>>2]=J;c[I>>2]=(y|0)/1024|0;c[t>>2]=(c[t>>2]|0)+((y|0)/8192|0);y=$(c[A>>2]|0,u)|0;A=a+768+(x*48|0)+(z<<3)|0;I=A|0;J=c[I>>2]|0;H=($(c[F>>2]|0,J)|0)+y|0;y=A+4|0;A=H+($(c[C>>2]|0,c[y>>2]|0)|0)|0;C=a+1152+(x*48|0)+(z<<3)|0;H=C|0;F=c[H>>2]|0;D=A-($(c[K>>2]|0,F)|0)|0;K=C+4|0;C=D-($(c[G>>2]|0,c[K>>2]|0)|0)|0;c[y>>2]=J;c[I>>2]=u;c[K>>2]=F;c[H>>2]=(C|0)/1024|0;H=(c[v>>2]|0)+((C|0)/8192|0)|0;c[v>>2]=H;z=z+1|0}while((z|0)!=6);M=H;x=x+1|0}while((x|0)!=8);N=M;x=(N|0)/64|0;v=(c[t>>2]|0)/64|0;u=c[e>>2]|0;w=u+(c[k>>2]<<2)|0;c[w>>2]=(c[w>>2]|0)+x;c[k>>2]=((c[k>>2]|0)+1|0)%(c[f>>2]|0)|0;w=c[g>>2]|0;z=w+(c[l>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+v;c[l>>2]=((c[l>>2]|0)+1|0)%(c[h>>2]|0)|0;z=u+(c[m>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+x;c[m>>2]=((c[m>>2]|0)+1|0)%(c[f>>2]|0)|0;z=w+(c[n>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+v;c[n>>2]=((c[n>>2]|0)+1|0)%(c[h>>2]|0)|0;z=u+(c[o>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+x;c[o>>2]=((c[o>>2]|0)+1|0)%(c[f>>2]|0)|0;z=w+(c[p>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+v;c[p>>2]=((c[p>>2]|0)+1|0)%(c[h>>2]|0)|0;z=u+(c[q>>2]<<2)|0;c[z>>2]=(c[z>>2]|0)+x;c[q>>2]=((c[q>>2]|0)+1|0)%(c[f>>2]|0)|0;x=w+(c[r>>2]<<2)|0;c[x>>2]=(c[x>>2]|0)+v;c[r>>2]=((c[r>>2]|0)+1|0)%(c[h>>2]|0)|0;s=s+2|0}while((s|0)<(d|0));return}function Eb(a,b){a=a|0;b=b|0;var d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0;d=a+4|0;e=c[d>>2]|0;f=e&-8;g=a+f|0;h=c[10112]|0;i=e&3;if(!((i|0)!=1&a>>>0>=h>>>0&a>>>0<g>>>0))Ta();j=a+(f|4)|0;k=c[j>>2]|0;if(!(k&1))Ta();if(!i){if(b>>>0<256){l=0;return l|0}if(f>>>0>=(b+4|0)>>>0)if((f-b|0)>>>0<=c[10228]<<1>>>0){l=a;return l|0}l=0;return l|0}if(f>>>0>=b>>>0){i=f-b|0;if(i>>>0<=15){l=a;return l|0}c[d>>2]=e&1|b|2;c[a+(b+4)>>2]=i|3;c[j>>2]=c[j>>2]|1;wb(a+b|0,i);l=a;return l|0}if((g|0)==(c[10114]|0)){i=(c[10111]|0)+f|0;if(i>>>0<=b>>>0){l=0;return l|0}j=i-b|0;c[d>>2]=e&1|b|2;c[a+(b+4)>>2]=j|1;c[10114]=a+b;c[10111]=j;l=a;return l|0}if((g|0)==(c[10113]|0)){j=(c[10110]|0)+f|0;if(j>>>0<b>>>0){l=0;return l|0}i=j-b|0;if(i>>>0>15){c[d>>2]=e&1|b|2;c[a+(b+4)>>2]=i|1;c[a+j>>2]=i;m=a+(j+4)|0;c[m>>2]=c[m>>2]&-2;n=a+b|0;o=i}else{c[d>>2]=e&1|j|2;i=a+(j+4)|0;c[i>>2]=c[i>>2]|1;n=0;o=0}c[10110]=o;c[10113]=n;l=a;return l|0}if(k&2){l=0;return l|0}n=(k&-8)+f|0;if(n>>>0<b>>>0){l=0;return l|0}o=n-b|0;i=k>>>3;do if(k>>>0<256){j=c[a+(f+8)>>2]|0;m=c[a+(f+12)>>2]|0;p=40472+(i<<1<<2)|0;if((j|0)!=(p|0)){if(j>>>0<h>>>0)Ta();if((c[j+12>>2]|0)!=(g|0))Ta();}if((m|0)==(j|0)){c[10108]=c[10108]&~(1<<i);break}if((m|0)==(p|0))q=m+8|0;else{if(m>>>0<h>>>0)Ta();p=m+8|0;if((c[p>>2]|0)==(g|0))q=p;else Ta();}c[j+12>>2]=m;c[q>>2]=j}else{j=c[a+(f+24)>>2]|0;m=c[a+(f+12)>>2]|0;do if((m|0)==(g|0)){p=a+(f+20)|0;r=c[p>>2]|0;if(!r){s=a+(f+16)|0;t=c[s>>2]|0;if(!t){u=0;break}else{v=t;w=s}}else{v=r;w=p}while(1){p=v+20|0;r=c[p>>2]|0;if(r){v=r;w=p;continue}p=v+16|0;r=c[p>>2]|0;if(!r){x=v;y=w;break}else{v=r;w=p}}if(y>>>0<h>>>0)Ta();else{c[y>>2]=0;u=x;break}}else{p=c[a+(f+8)>>2]|0;if(p>>>0<h>>>0)Ta();r=p+12|0;if((c[r>>2]|0)!=(g|0))Ta();s=m+8|0;if((c[s>>2]|0)==(g|0)){c[r>>2]=m;c[s>>2]=p;u=m;break}else Ta();}while(0);if(j){m=c[a+(f+28)>>2]|0;p=40736+(m<<2)|0;if((g|0)==(c[p>>2]|0)){c[p>>2]=u;if(!u){c[10109]=c[10109]&~(1<<m);break}}else{if(j>>>0<(c[10112]|0)>>>0)Ta();m=j+16|0;if((c[m>>2]|0)==(g|0))c[m>>2]=u;else c[j+20>>2]=u;if(!u)break}m=c[10112]|0;if(u>>>0<m>>>0)Ta();c[u+24>>2]=j;p=c[a+(f+16)>>2]|0;do if(p)if(p>>>0<m>>>0)Ta();else{c[u+16>>2]=p;c[p+24>>2]=u;break}while(0);p=c[a+(f+20)>>2]|0;if(p)if(p>>>0<(c[10112]|0)>>>0)Ta();else{c[u+20>>2]=p;c[p+24>>2]=u;break}}}while(0);if(o>>>0<16){c[d>>2]=n|e&1|2;u=a+(n|4)|0;c[u>>2]=c[u>>2]|1;l=a;return l|0}else{c[d>>2]=e&1|b|2;c[a+(b+4)>>2]=o|3;e=a+(n|4)|0;c[e>>2]=c[e>>2]|1;wb(a+b|0,o);l=a;return l|0}return 0}function Fb(a,b){a=+a;b=+b;var d=0,e=0,f=0,g=0,i=0,j=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,E=0,F=0,G=0,H=0,I=0,J=0,K=0.0,L=0,M=0,N=0,O=0,P=0,Q=0,R=0,S=0.0;h[k>>3]=a;d=c[k>>2]|0;e=c[k+4>>2]|0;h[k>>3]=b;f=c[k>>2]|0;g=c[k+4>>2]|0;i=Od(d|0,e|0,52)|0;j=i&2047;i=Od(f|0,g|0,52)|0;l=i&2047;i=e&-2147483648;m=Ld(f|0,g|0,1)|0;n=D;if(!((m|0)==0&(n|0)==0)){o=g&2147483647;if(!(o>>>0>2146435072|(o|0)==2146435072&f>>>0>0|(j|0)==2047)){o=Ld(d|0,e|0,1)|0;p=D;if(!(p>>>0>n>>>0|(p|0)==(n|0)&o>>>0>m>>>0))return +((o|0)==(m|0)&(p|0)==(n|0)?a*0.0:a);if(!j){n=Ld(d|0,e|0,12)|0;p=D;if((p|0)>-1|(p|0)==-1&n>>>0>4294967295){m=n;n=p;p=0;while(1){o=p+-1|0;m=Ld(m|0,n|0,1)|0;n=D;if(!((n|0)>-1|(n|0)==-1&m>>>0>4294967295)){q=o;break}else p=o}}else q=0;p=Ld(d|0,e|0,1-q|0)|0;r=p;s=D;t=q}else{r=d;s=e&1048575|1048576;t=j}if(!l){j=Ld(f|0,g|0,12)|0;e=D;if((e|0)>-1|(e|0)==-1&j>>>0>4294967295){d=j;j=e;e=0;while(1){q=e+-1|0;d=Ld(d|0,j|0,1)|0;j=D;if(!((j|0)>-1|(j|0)==-1&d>>>0>4294967295)){u=q;break}else e=q}}else u=0;e=Ld(f|0,g|0,1-u|0)|0;v=e;w=D;x=u}else{v=f;w=g&1048575|1048576;x=l}l=Dd(r|0,s|0,v|0,w|0)|0;g=D;f=(g|0)>-1|(g|0)==-1&l>>>0>4294967295;a:do if((t|0)>(x|0)){u=f;e=l;d=g;j=r;q=s;p=t;while(1){if(u)if((j|0)==(v|0)&(q|0)==(w|0))break;else{y=e;z=d}else{y=j;z=q}m=Ld(y|0,z|0,1)|0;n=D;o=p+-1|0;A=Dd(m|0,n|0,v|0,w|0)|0;B=D;C=(B|0)>-1|(B|0)==-1&A>>>0>4294967295;if((o|0)>(x|0)){u=C;e=A;d=B;j=m;q=n;p=o}else{E=C;F=m;G=n;H=A;I=B;J=o;break a}}K=a*0.0;return +K}else{E=f;F=r;G=s;H=l;I=g;J=t}while(0);if(E)if((F|0)==(v|0)&(G|0)==(w|0)){K=a*0.0;return +K}else{L=I;M=H}else{L=G;M=F}if(L>>>0<1048576|(L|0)==1048576&M>>>0<0){F=M;G=L;H=J;while(1){I=Ld(F|0,G|0,1)|0;w=D;v=H+-1|0;if(w>>>0<1048576|(w|0)==1048576&I>>>0<0){F=I;G=w;H=v}else{N=I;O=w;P=v;break}}}else{N=M;O=L;P=J}if((P|0)>0){J=Pd(N|0,O|0,0,-1048576)|0;L=D;M=Ld(P|0,0,52)|0;Q=L|D;R=J|M}else{M=Od(N|0,O|0,1-P|0)|0;Q=D;R=M}c[k>>2]=R;c[k+4>>2]=Q|i;K=+h[k>>3];return +K}}S=a*b;K=S/S;return +K}function Gb(f){f=f|0;var h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0.0,A=0.0,B=0;a[f+2>>0]=1;h=Ab(c[f+4>>2]|0,c[184]|0)|0;if(!h){i=-1;return i|0}do if(c[186]|0){j=0;k=0;l=h;while(1){m=c[l>>2]|0;if(m>>>0>1023){n=c[l+96>>2]|0;o=m>>>10;m=0;p=0;q=0;while(1){r=b[n+(m<<1)>>1]|0;s=r<<16>>16|0;t=(s|0)>p<<16>>16?r:p;u=(s|0)<q<<16>>16?r:q;m=m+1|0;if(m>>>0>=o>>>0){v=t;w=u;break}else{p=t;q=u}}}else{v=0;w=0}q=v<<16>>16>j<<16>>16?v:j;p=w<<16>>16<k<<16>>16?w:k;l=c[l+100>>2]|0;if(!l){x=q;y=p;break}else{j=q;k=p}}k=x<<16>>16;j=0-(y<<16>>16)|0;l=(k|0)>=(j|0);if(!(c[188]|0))if(l){b[f+8>>1]=33553408/(k|0)|0;break}else{b[f+8>>1]=33554432/(j|0)|0;break}else{p=f+8|0;q=b[p>>1]|0;if(l){b[p>>1]=($(33553408/(k|0)|0,q)|0)>>>10;break}else{b[p>>1]=($(33554432/(j|0)|0,q)|0)>>>10;break}}}while(0);c[f+92>>2]=h;y=b[f>>1]|0;if(y&128){x=a[f+10>>0]|0;if(!(x&4)){w=h;do{v=w+32|0;a[v>>0]=d[v>>0]&251;w=c[w+100>>2]|0}while((w|0)!=0);}if(!(x&64)){x=h;do{w=x+32|0;a[w>>0]=d[w>>0]&191;x=c[x+100>>2]|0}while((x|0)!=0);}}if(y<<16>>16==47){y=h;do{if(!(a[y+32>>0]&4)){x=c[y+72>>2]|0;c[y+76>>2]=x;w=c[y+44>>2]|0;c[y+48>>2]=w;c[y+80>>2]=x;c[y+52>>2]=w;c[y+84>>2]=x;c[y+56>>2]=w}y=c[y+100>>2]|0}while((y|0)!=0);}y=a[f+11>>0]|0;w=(a[f+10>>0]&64)==0;z=+(e[380]|0);x=~~(4194303.0/(z*1.4560000272467732e-03));A=z;v=y<<24>>24<0;if(!(y&32)){y=h;do{if(v){q=y+32|0;j=d[q>>0]|0;if(j&128)a[q>>0]=j^128}j=y+32|0;if(!w)a[j>>0]=d[j>>0]|64;q=(a[j>>0]&64)==0;j=0;do{if(q){c[y+64+(j<<2)>>2]=4194303;c[y+36+(j<<2)>>2]=x}else{p=a[f+12+(j*12|0)+8>>0]|0;if(p&2)c[y+64+(j<<2)>>2]=~~(+g[f+12+(j*12|0)+4>>2]*255.0)*16448;if(p&1)c[y+36+(j<<2)>>2]=~~(4194303.0/(A*(+g[f+12+(j*12|0)>>2]/1.0e3)));}j=j+1|0}while((j|0)!=6);y=c[y+100>>2]|0}while((y|0)!=0);i=0;return i|0}else B=h;do{h=B+32|0;y=d[h>>0]|0;if(y&32)a[h>>0]=y^32;if(v){y=B+32|0;h=d[y>>0]|0;if(h&128)a[y>>0]=h^128}h=B+32|0;if(!w)a[h>>0]=d[h>>0]|64;y=(a[h>>0]&64)==0;h=0;do{if(y){c[B+64+(h<<2)>>2]=4194303;c[B+36+(h<<2)>>2]=x}else{j=a[f+12+(h*12|0)+8>>0]|0;if(j&2)c[B+64+(h<<2)>>2]=~~(+g[f+12+(h*12|0)+4>>2]*255.0)*16448;if(j&1)c[B+36+(h<<2)>>2]=~~(4194303.0/(A*(+g[f+12+(h*12|0)>>2]/1.0e3)));}h=h+1|0}while((h|0)!=6);B=c[B+100>>2]|0}while((B|0)!=0);i=0;return i|0}function Hb(a,b,d,e,f){a=a|0;b=b|0;d=d|0;e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0,C=0,E=0,F=0,G=0,H=0;g=a;h=b;i=h;j=d;k=e;l=k;if(!i){m=(f|0)!=0;if(!l){if(m){c[f>>2]=(g>>>0)%(j>>>0);c[f+4>>2]=0}n=0;o=(g>>>0)/(j>>>0)>>>0;return (D=n,o)|0}else{if(!m){n=0;o=0;return (D=n,o)|0}c[f>>2]=a|0;c[f+4>>2]=b&0;n=0;o=0;return (D=n,o)|0}}m=(l|0)==0;do if(!j){if(m){if(f){c[f>>2]=(i>>>0)%(j>>>0);c[f+4>>2]=0}n=0;o=(i>>>0)/(j>>>0)>>>0;return (D=n,o)|0}if(!g){if(f){c[f>>2]=0;c[f+4>>2]=(i>>>0)%(l>>>0);}n=0;o=(i>>>0)/(l>>>0)>>>0;return (D=n,o)|0}p=l-1|0;if(!(p&l)){if(f){c[f>>2]=a|0;c[f+4>>2]=p&i|b&0}n=0;o=i>>>((qd(l|0)|0)>>>0);return (D=n,o)|0}p=(ba(l|0)|0)-(ba(i|0)|0)|0;if(p>>>0<=30){q=p+1|0;r=31-p|0;s=q;t=i<<r|g>>>(q>>>0);u=i>>>(q>>>0);v=0;w=g<<r;break}if(!f){n=0;o=0;return (D=n,o)|0}c[f>>2]=a|0;c[f+4>>2]=h|b&0;n=0;o=0;return (D=n,o)|0}else{if(!m){r=(ba(l|0)|0)-(ba(i|0)|0)|0;if(r>>>0<=31){q=r+1|0;p=31-r|0;x=r-31>>31;s=q;t=g>>>(q>>>0)&x|i<<p;u=i>>>(q>>>0)&x;v=0;w=g<<p;break}if(!f){n=0;o=0;return (D=n,o)|0}c[f>>2]=a|0;c[f+4>>2]=h|b&0;n=0;o=0;return (D=n,o)|0}p=j-1|0;if(p&j){x=(ba(j|0)|0)+33-(ba(i|0)|0)|0;q=64-x|0;r=32-x|0;y=r>>31;z=x-32|0;A=z>>31;s=x;t=r-1>>31&i>>>(z>>>0)|(i<<r|g>>>(x>>>0))&A;u=A&i>>>(x>>>0);v=g<<q&y;w=(i<<q|g>>>(z>>>0))&y|g<<r&x-33>>31;break}if(f){c[f>>2]=p&g;c[f+4>>2]=0}if((j|0)==1){n=h|b&0;o=a|0|0;return (D=n,o)|0}else{p=qd(j|0)|0;n=i>>>(p>>>0)|0;o=i<<32-p|g>>>(p>>>0)|0;return (D=n,o)|0}}while(0);if(!s){B=w;C=v;E=u;F=t;G=0;H=0}else{g=d|0|0;d=k|e&0;e=Pd(g|0,d|0,-1,-1)|0;k=D;i=w;w=v;v=u;u=t;t=s;s=0;do{j=i;i=w>>>31|i<<1;w=s|w<<1;a=u<<1|j>>>31|0;j=u>>>31|v<<1|0;Dd(e,k,a,j)|0;b=D;h=((b|0)<0?-1:0)<<1|0;l=b>>31|h;s=l&1;u=Dd(a,j,l&g,(((b|0)<0?-1:0)>>31|h)&d)|0;v=D;t=t-1|0}while((t|0)!=0);B=i;C=w;E=v;F=u;G=0;H=s}s=C;C=0;if(f){c[f>>2]=F;c[f+4>>2]=E}n=(s|0)>>>31|(B|C)<<1|(C<<1|s>>>31)&0|G;o=(s<<1|0>>>31)&-2|H;return (D=n,o)|0}function Ib(f,g){f=f|0;g=g|0;var h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0;h=a[g>>0]|0;i=c[g+4>>2]|0;g=i>>>8;j=i&255;k=h&255;if(!(i&255)){i=f+568+(k*7168|0)+(g*56|0)|0;if(!(a[f+568+(k*7168|0)+(g*56|0)+34>>0]|0))if(!(a[f+115256+(k*7168|0)+(g*56|0)+34>>0]|0))return;else{l=1;m=f+115256+(k*7168|0)+(g*56|0)|0}else{l=0;m=i}i=a[f+568+(l*114688|0)+(k*7168|0)+(g*56|0)+32>>0]|0;if((i&4)==0?(a[f+52+(k<<5)+31>>0]|0)!=0:0)return;if(i&64)if(!(a[f+568+(l*114688|0)+(k*7168|0)+(g*56|0)+24>>0]|0)){a[f+568+(l*114688|0)+(k*7168|0)+(g*56|0)+52>>0]=1;return}ac(m);return}do if(!(a[f+52+(k<<5)+31>>0]|0)){m=c[f+52+(k<<5)+4>>2]|0;if(!m)return;else{l=g&255;n=(c[31752+(((l>>>0)%12|0)*100<<2)>>2]|0)>>>(10-((l>>>0)/12|0)|0);o=m;break}}else{m=g&255;l=uc(f,(m|d[f+52+(k<<5)>>0]<<8|128)&65535)|0;if(!l)return;i=a[l+84>>0]|0;if(!(i<<24>>24)){n=(c[31752+(((m>>>0)%12|0)*100<<2)>>2]|0)>>>(10-((m>>>0)/12|0)|0);o=l;break}else{n=(c[31752+((((i&255)%12|0)&255)*100<<2)>>2]|0)>>>(10-(((i&255)/12|0)&255)|0);o=l;break}}while(0);l=tc(o,(n>>>0)/100|0)|0;if(!l)return;n=g&255;i=f+568+(k*7168|0)+(n*56|0)|0;m=i|0;p=i+34|0;do if(!(a[p>>0]|0))if(!(a[f+115256+(k*7168|0)+(n*56|0)+34>>0]|0)){i=f+564|0;q=c[i>>2]|0;if(!q)c[i>>2]=m;else{i=q;do{q=i+40|0;i=c[q>>2]|0}while((i|0)!=0);r=q;c[r>>2]=m}a[p>>0]=1;c[f+568+(k*7168|0)+(n*56|0)+40>>2]=0;s=m;break}else{if(a[f+568+(k*7168|0)+(n*56|0)+32>>0]&64)if((d[f+568+(k*7168|0)+(n*56|0)+24>>0]|0)<3)if(!(a[f+568+(k*7168|0)+(n*56|0)+33>>0]&2))return;i=f+115256+(k*7168|0)+(n*56|0)|0;c[i+36>>2]=m;a[i+24>>0]=6;c[i+20>>2]=0-(c[(c[i+8>>2]|0)+60>>2]|0);s=m;break}else{i=f+568+(k*7168|0)+(n*56|0)+24|0;if(a[f+568+(k*7168|0)+(n*56|0)+32>>0]&64)if((d[i>>0]|0)<3)if(!(a[f+568+(k*7168|0)+(n*56|0)+33>>0]&2))return;q=f+115256+(k*7168|0)+(n*56|0)|0;t=f+568+(k*7168|0)+(n*56|0)|0;c[t+36>>2]=q;a[i>>0]=6;c[t+20>>2]=0-(c[(c[t+8>>2]|0)+60>>2]|0);s=q}while(0);b[s>>1]=n|k<<8;c[s+4>>2]=o;c[s+8>>2]=l;c[s+12>>2]=0;n=a[o+84>>0]|0;o=f+52+(k<<5)|0;k=((n<<24>>24==0?g&127:n&255)*100|0)+(c[o+24>>2]|0)|0;n=(k|0)<0?0:(k|0)>12700?12700:k;c[s+16>>2]=((((c[31752+(((n|0)%1200|0)<<2)>>2]|0)>>>(10-((n|0)/1200|0)|0)>>>0)/(((e[380]|0)*100|0)>>>10>>>0)|0)<<10>>>0)/((c[l+92>>2]|0)>>>0)|0;a[s+2>>0]=j;a[s+24>>0]=0;c[s+20>>2]=c[l+36>>2];c[s+28>>2]=0;a[s+32>>0]=a[l+32>>0]|0;a[s+33>>0]=a[o+8>>0]|0;c[s+36>>2]=0;a[s+52>>0]=0;a[s+53>>0]=0;ic(f,h,s);return}function Jb(b,d){b=b|0;d=d|0;var e=0,f=0,g=0,h=0,j=0,k=0,l=0,m=0,n=0,o=0;e=0;e=0;f=i;i=i+1104|0;g=f;h=f+4|0;j=f+80|0;do if(!(Ic(b,640,2)|0)){k=Pa(ka()|0)|0;if(!k)l=Ia(648)|0;else l=c[k+20>>2]|0;if(!l)e=16;else{k=ce(b|0)|0;m=pb(k+1+(ce(l|0)|0)|0)|0;if(m){Qd(m|0,l|0)|0;Id(m|0,b+1|0)|0;n=m;break}m=La()|0;_b(656,672,88,1,0,c[m>>2]|0);_b(656,672,89,3,b,c[m>>2]|0);o=0;i=f;return o|0}}else if((a[b>>0]|0)==47)e=16;else{if(na(j|0,1024)|0){m=ce(b|0)|0;k=pb(m+2+(ce(j|0)|0)|0)|0;if(k){Qd(k|0,j|0)|0;if((a[j+((ce(j|0)|0)+-1)>>0]|0)==47){Id(k|0,b|0)|0;n=k;break}else{m=k+(ce(k|0)|0)|0;a[m>>0]=47;a[m+1>>0]=0;Id(k|0,b|0)|0;n=k;break}}}k=La()|0;_b(656,672,100,1,0,c[k>>2]|0);_b(656,672,101,3,b,c[k>>2]|0);o=0;i=f;return o|0}while(0);do if((e|0)==16){j=pb((ce(b|0)|0)+1|0)|0;if(j){Qd(j|0,b|0)|0;n=j;break}j=La()|0;_b(656,672,114,1,0,c[j>>2]|0);_b(656,672,115,3,b,c[j>>2]|0);o=0;i=f;return o|0}while(0);if(Ma(n|0,h|0)|0){_b(656,672,130,2,b,c[(La()|0)>>2]|0);vb(n);o=0;i=f;return o|0}e=c[h+36>>2]|0;c[d>>2]=e;if(e>>>0>536870911){_b(656,672,139,12,b,0);vb(n);o=0;i=f;return o|0}h=pb(e+1|0)|0;if(!h){e=La()|0;_b(656,672,147,1,0,c[e>>2]|0);_b(656,672,148,3,b,c[e>>2]|0);vb(n);o=0;i=f;return o|0}e=pa(n|0,0,g|0)|0;if((e|0)==-1){_b(656,672,154,4,b,c[(La()|0)>>2]|0);vb(n);vb(h);o=0;i=f;return o|0}g=Ra(e|0,h|0,c[d>>2]|0)|0;if((g|0)==(c[d>>2]|0)){a[h+g>>0]=0;ab(e|0)|0;vb(n);o=h;i=f;return o|0}else{_b(656,672,160,5,b,c[(La()|0)>>2]|0);vb(n);vb(h);ab(e|0)|0;o=0;i=f;return o|0}return 0}function Kb(a){a=+a;var b=0,d=0,e=0,f=0,j=0,l=0,m=0,n=0,o=0.0,p=0.0,q=0,r=0.0,s=0.0,t=0.0,u=0,v=0.0,w=0.0;b=0;b=0;d=i;i=i+16|0;e=d;h[k>>3]=a;f=c[k>>2]|0;j=c[k+4>>2]|0;l=j&2147483647;m=Od(f|0,j|0,63)|0;do if(l>>>0>1078159481){n=j&2147483647;if(n>>>0>2146435072|(n|0)==2146435072&f>>>0>0){o=a;i=d;return +o}if(m){o=-1.0;i=d;return +o}if(a>709.782712893384){o=a*8988465674311579538646525.0e283;i=d;return +o}else b=11}else{if(l>>>0>1071001154){if(l>>>0>=1072734898){b=11;break}if(!m){p=a+-.6931471803691238;q=1;r=1.9082149292705877e-10;b=12;break}else{p=a+.6931471803691238;q=-1;r=-1.9082149292705877e-10;b=12;break}}if(l>>>0<1016070144){if(l>>>0>=1048576){o=a;i=d;return +o}g[e>>2]=a;o=a;i=d;return +o}else{s=a;t=0.0;u=0}}while(0);if((b|0)==11){e=~~(a*1.4426950408889634+((m|0)!=0?-.5:.5));v=+(e|0);p=a-v*.6931471803691238;q=e;r=v*1.9082149292705877e-10;b=12}if((b|0)==12){v=p-r;s=v;t=p-v-r;u=q}r=s*.5;v=s*r;p=v*(v*(v*(v*(4.008217827329362e-06-v*2.0109921818362437e-07)+-7.93650757867488e-05)+1.5873015872548146e-03)+-.03333333333333313)+1.0;a=3.0-r*p;r=v*((p-a)/(6.0-s*a));if(!u){o=s-(s*r-v);i=d;return +o}a=s*(r-t)-t-v;if((u|0)==-1){o=(s-a)*.5+-.5;i=d;return +o}else if((u|0)==1)if(s<-.25){o=(a-(s+.5))*-2.0;i=d;return +o}else{o=(s-a)*2.0+1.0;i=d;return +o}else{q=Ld(u+1023|0,0,52)|0;b=D;c[k>>2]=q;c[k+4>>2]=b;v=+h[k>>3];if(u>>>0>56){t=s-a+1.0;o=((u|0)==1024?t*2.0*8988465674311579538646525.0e283:v*t)+-1.0;i=d;return +o}b=Ld(1023-u|0,0,52)|0;q=D;if((u|0)<20){c[k>>2]=b;c[k+4>>2]=q;w=1.0-+h[k>>3]+(s-a);}else{c[k>>2]=b;c[k+4>>2]=q;w=s-(+h[k>>3]+a)+1.0}o=v*w;i=d;return +o}return +(0.0);}function Lb(a,b){a=a|0;b=b|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0;e=a+4|0;f=c[e>>2]|0;g=a+100|0;if(f>>>0<(c[g>>2]|0)>>>0){c[e>>2]=f+1;h=d[f>>0]|0}else h=ec(a)|0;if((h|0)==43|(h|0)==45){f=(h|0)==45&1;i=c[e>>2]|0;if(i>>>0<(c[g>>2]|0)>>>0){c[e>>2]=i+1;j=d[i>>0]|0}else j=ec(a)|0;if((b|0)!=0&(j+-48|0)>>>0>9)if(!(c[g>>2]|0)){k=j;l=f}else{c[e>>2]=(c[e>>2]|0)+-1;k=j;l=f}else{k=j;l=f}}else{k=h;l=0}if((k+-48|0)>>>0>9){if(!(c[g>>2]|0)){m=-2147483648;n=0;D=m;return n|0}c[e>>2]=(c[e>>2]|0)+-1;m=-2147483648;n=0;D=m;return n|0}else{o=k;p=0}while(1){k=o+-48+(p*10|0)|0;h=c[e>>2]|0;if(h>>>0<(c[g>>2]|0)>>>0){c[e>>2]=h+1;q=d[h>>0]|0}else q=ec(a)|0;if((q+-48|0)>>>0<10&(k|0)<214748364){o=q;p=k}else{r=k;s=q;break}}q=((r|0)<0)<<31>>31;if((s+-48|0)>>>0<10){p=r;o=q;k=s;while(1){h=Bd(p|0,o|0,10,0)|0;f=D;j=Pd(k|0,((k|0)<0)<<31>>31|0,-48,-1)|0;b=Pd(j|0,D|0,h|0,f|0)|0;f=D;h=c[e>>2]|0;if(h>>>0<(c[g>>2]|0)>>>0){c[e>>2]=h+1;t=d[h>>0]|0}else t=ec(a)|0;if((t+-48|0)>>>0<10&((f|0)<21474836|(f|0)==21474836&b>>>0<2061584302)){p=b;o=f;k=t}else{u=b;v=f;w=t;break}}}else{u=r;v=q;w=s}if((w+-48|0)>>>0<10)do{w=c[e>>2]|0;if(w>>>0<(c[g>>2]|0)>>>0){c[e>>2]=w+1;x=d[w>>0]|0}else x=ec(a)|0}while((x+-48|0)>>>0<10);if(c[g>>2]|0)c[e>>2]=(c[e>>2]|0)+-1;e=(l|0)!=0;l=Dd(0,0,u|0,v|0)|0;m=e?D:v;n=e?l:u;D=m;return n|0}function Mb(b){b=b|0;var d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0;d=b+229948|0;if(c[d>>2]|0){Xd(37672);e=c[d>>2]|0;f=b+229944|0;if(e){g=c[f>>2]|0;h=e;e=0;while(1){i=c[g+(e<<2)>>2]|0;j=i+88|0;k=(c[j>>2]|0)+-1|0;c[j>>2]=k;if(!k){k=c[i+92>>2]|0;if(!k){l=i;m=h;n=g}else{i=k;do{k=c[i+100>>2]|0;vb(c[i+96>>2]|0);vb(c[(c[(c[f>>2]|0)+(e<<2)>>2]|0)+92>>2]|0);j=c[f>>2]|0;o=j+(e<<2)|0;c[(c[o>>2]|0)+92>>2]=k;k=c[o>>2]|0;i=c[k+92>>2]|0}while((i|0)!=0);p=j;q=k;l=q;m=c[d>>2]|0;n=p}a[l+2>>0]=0;r=m;s=n}else{r=h;s=g}e=e+1|0;if(e>>>0>=r>>>0)break;else{g=s;h=r}}}ae(37672);vb(c[f>>2]|0);}f=b+16|0;if(!(c[f>>2]|0)){t=b+8|0;u=c[t>>2]|0;vb(u);v=b+229964|0;w=c[v>>2]|0;Vd(w);x=b+229956|0;y=c[x>>2]|0;vb(y);vb(b);return}r=b+8|0;h=0;do{s=c[r>>2]|0;g=c[s+(h*20|0)>>2]|0;do if((g|0)==6)vb(c[s+(h*20|0)+8>>2]|0);else{if((g|0)==7){vb(c[s+(h*20|0)+8>>2]|0);break}if((g|0)==8){vb(c[s+(h*20|0)+8>>2]|0);break}if((g|0)==9){vb(c[s+(h*20|0)+8>>2]|0);break}if((g|0)==10){vb(c[s+(h*20|0)+8>>2]|0);break}if((g|0)==11){vb(c[s+(h*20|0)+8>>2]|0);break}if((g|0)==12)vb(c[s+(h*20|0)+8>>2]|0);}while(0);h=h+1|0}while(h>>>0<(c[f>>2]|0)>>>0);t=b+8|0;u=c[t>>2]|0;vb(u);v=b+229964|0;w=c[v>>2]|0;Vd(w);x=b+229956|0;y=c[x>>2]|0;vb(y);vb(b);return}function Nb(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j|0;l=k<<1;m=c[f>>2]|0;n=e+j|0;j=(l+m|0)>>>1;o=jd(j+2|0,2)|0;c[f+96>>2]=o;if(!o){_b(31352,29944,608,1,31224,c[(La()|0)>>2]|0);p=-1;return p|0}q=e+2|0;r=(n>>>0>q>>>0?n:q)+~e&-2;q=r+2|0;s=o+q|0;t=o+r|0;u=e;v=o;while(1){b[v>>1]=((d[u+1>>0]|0)<<8|(d[u>>0]|0))^32768;u=u+2|0;if(u>>>0>=n>>>0)break;else v=v+2|0}v=(((d[e+(r+3)>>0]|0)<<8|(d[e+q>>0]|0))^32768)&65535;b[s>>1]=v;s=k&2147483647;b[t+(s+1<<1)>>1]=v;v=e+h|0;q=e+(r+6)|0;n=((v>>>0>q>>>0?v:q)+(-5-(e+r))|0)>>>1;q=n+3|0;u=n+(k&2147483647)|0;k=u+3|0;w=n<<1;n=w+6|0;x=w+4|0;w=e+(r+4)|0;y=o+(r+4)|0;o=t+(s<<1)|0;z=t+(s+2<<1)|0;while(1){s=(((d[w+1>>0]|0)<<8|(d[w>>0]|0))^32768)&65535;w=w+2|0;b[y>>1]=s;b[o>>1]=s;b[z>>1]=b[y>>1]|0;if(w>>>0>=v>>>0)break;else{y=y+2|0;o=o+-2|0;z=z+2|0}}z=r+x|0;x=z+4|0;o=(((d[e+(z+3)>>0]|0)<<8|(d[e+(r+n)>>0]|0))^32768)&65535;b[t+(q<<1)>>1]=o;b[t+(k<<1)>>1]=o;o=e+m|0;if((x|0)!=(m|0)){m=e+x|0;x=t+(u+4<<1)|0;while(1){b[x>>1]=((d[m+1>>0]|0)<<8|(d[m>>0]|0))^32768;m=m+2|0;if(m>>>0>=o>>>0)break;else x=x+2|0}}x=f+32|0;a[x>>0]=(d[x>>0]|0)^8;c[i>>2]=h>>>1;c[g>>2]=(h+l|0)>>>1;c[f>>2]=j;p=0;return p|0}function Ob(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j|0;l=k<<1;m=c[f>>2]|0;n=e+j|0;j=(l+m|0)>>>1;o=jd(j+2|0,2)|0;c[f+96>>2]=o;if(!o){_b(31384,29944,439,1,31224,c[(La()|0)>>2]|0);p=-1;return p|0}q=e+2|0;r=(n>>>0>q>>>0?n:q)+~e&-2;q=r+2|0;s=o+q|0;t=o+r|0;u=e;v=o;while(1){b[v>>1]=(d[u+1>>0]|0)<<8|(d[u>>0]|0);u=u+2|0;if(u>>>0>=n>>>0)break;else v=v+2|0}v=((d[e+(r+3)>>0]|0)<<8|(d[e+q>>0]|0))&65535;b[s>>1]=v;s=k&2147483647;b[t+(s+1<<1)>>1]=v;v=e+h|0;q=e+(r+6)|0;n=((v>>>0>q>>>0?v:q)+(-5-(e+r))|0)>>>1;q=n+3|0;u=n+(k&2147483647)|0;k=u+3|0;w=n<<1;n=w+6|0;x=w+4|0;w=e+(r+4)|0;y=o+(r+4)|0;o=t+(s<<1)|0;z=t+(s+2<<1)|0;while(1){s=((d[w+1>>0]|0)<<8|(d[w>>0]|0))&65535;w=w+2|0;b[y>>1]=s;b[o>>1]=s;b[z>>1]=b[y>>1]|0;if(w>>>0>=v>>>0)break;else{y=y+2|0;o=o+-2|0;z=z+2|0}}z=r+x|0;x=z+4|0;o=((d[e+(z+3)>>0]|0)<<8|(d[e+(r+n)>>0]|0))&65535;b[t+(q<<1)>>1]=o;b[t+(k<<1)>>1]=o;o=e+m|0;if((x|0)!=(m|0)){m=e+x|0;x=t+(u+4<<1)|0;while(1){b[x>>1]=(d[m+1>>0]|0)<<8|(d[m>>0]|0);m=m+2|0;if(m>>>0>=o>>>0)break;else x=x+2|0}}x=f+32|0;a[x>>0]=(d[x>>0]|0)^8;c[i>>2]=h>>>1;c[g>>2]=(h+l|0)>>>1;c[f>>2]=j;p=0;return p|0}function Pb(b,d){b=b|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0;e=0;e=0;if(!(c[208]|0)){_b(1120,784,1716,8,0,0);f=-1;return f|0}if(!b){_b(1120,784,1720,9,1056,0);f=-1;return f|0}if(!d){_b(1120,784,1724,9,1144,0);f=-1;return f|0}Xd(b);g=b+12|0;h=c[g>>2]|0;i=c[d>>2]|0;j=c[b+32>>2]|0;if(i>>>0>j>>>0){c[d>>2]=j;k=j}else k=i;i=b+28|0;j=c[i>>2]|0;if((k|0)==(j|0)){ae(b);f=0;return f|0}if(k>>>0<j>>>0){l=c[b+8>>2]|0;Yb(b);c[i>>2]=0;m=b+4|0;c[m>>2]=0;n=m;o=c[d>>2]|0;p=0;q=l;e=14}else{l=b+4|0;m=c[l>>2]|0;r=k-j|0;if(m>>>0>r>>>0){c[l>>2]=m-r;c[i>>2]=k}else{n=l;o=k;p=j;q=h;e=14}}if((e|0)==14){a:do if(o>>>0>p>>>0){e=q;while(1){kb[c[e>>2]&63](b,e+4|0);h=c[e+12>>2]|0;j=c[d>>2]|0;k=c[i>>2]|0;if(h>>>0>(j-k|0)>>>0){s=h;t=j;u=e;break}l=k+h|0;c[i>>2]=l;c[n>>2]=0;h=e+20|0;if(l>>>0<j>>>0)e=h;else{v=h;break a}}c[i>>2]=t;c[n>>2]=s;v=u+20|0}else v=q;while(0);c[g>>2]=v}v=b+564|0;g=c[v>>2]|0;if(g){q=g;do{a[q+34>>0]=0;g=q+36|0;if(c[g>>2]|0)c[g>>2]=0;q=c[q+40>>2]|0}while((q|0)!=0);}c[v>>2]=0;Wb(c[b+229964>>2]|0);ae(b);f=0;return f|0}function Qb(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j|0;l=k<<1;m=c[f>>2]|0;n=l+m|0;o=e+h|0;p=jd((n>>>1)+2|0,2)|0;c[f+96>>2]=p;if(!p){_b(31208,29944,693,1,31224,c[(La()|0)>>2]|0);q=-1;return q|0}r=e+(m+-1)|0;m=p;while(1){p=r+-2|0;s=m+2|0;b[m>>1]=((d[r>>0]|0)<<8|(d[r+-1>>0]|0))^32768;if(p>>>0<o>>>0){r=p;m=s}else{t=p;u=s;v=r;w=m;break}}m=(((d[t>>0]|0)<<8|(d[v+-3>>0]|0))^32768)&65535;b[u>>1]=m;u=k&2147483647;b[w+(u+1<<1)>>1]=m;m=e+j|0;j=v+-4|0;v=w+4|0;k=w+(u<<1)|0;t=w+(u+2<<1)|0;while(1){u=j+-2|0;w=(((d[j>>0]|0)<<8|(d[j+-1>>0]|0))^32768)&65535;b[v>>1]=w;b[k>>1]=w;w=t+2|0;b[t>>1]=b[v>>1]|0;r=v+2|0;if(u>>>0<m>>>0){j=u;v=r;k=k+-2|0;t=w}else{x=u;y=w;z=r;A=j;B=t;break}}t=(((d[x>>0]|0)<<8|(d[A+-3>>0]|0))^32768)&65535;b[z>>1]=t;b[y>>1]=t;t=e+-1|0;e=A+-4|0;A=B+4|0;while(1){b[A>>1]=((d[e>>0]|0)<<8|(d[e+-1>>0]|0))^32768;e=e+-2|0;if(e>>>0>=t>>>0)break;else A=A+2|0}c[i>>2]=h;c[g>>2]=h+l;c[f>>2]=n;n=f+32|0;a[n>>0]=(d[n>>0]|0)^26;q=0;return q|0}function Rb(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0,B=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j|0;l=k<<1;m=c[f>>2]|0;n=l+m|0;o=e+h|0;p=jd((n>>>1)+2|0,2)|0;c[f+96>>2]=p;if(!p){_b(31256,29944,524,1,31224,c[(La()|0)>>2]|0);q=-1;return q|0}r=e+(m+-1)|0;m=p;while(1){p=r+-2|0;s=m+2|0;b[m>>1]=(d[r>>0]|0)<<8|(d[r+-1>>0]|0);if(p>>>0<o>>>0){r=p;m=s}else{t=p;u=s;v=r;w=m;break}}m=((d[t>>0]|0)<<8|(d[v+-3>>0]|0))&65535;b[u>>1]=m;u=k&2147483647;b[w+(u+1<<1)>>1]=m;m=e+j|0;j=v+-4|0;v=w+4|0;k=w+(u<<1)|0;t=w+(u+2<<1)|0;while(1){u=j+-2|0;w=((d[j>>0]|0)<<8|(d[j+-1>>0]|0))&65535;b[v>>1]=w;b[k>>1]=w;w=t+2|0;b[t>>1]=b[v>>1]|0;r=v+2|0;if(u>>>0<m>>>0){j=u;v=r;k=k+-2|0;t=w}else{x=u;y=w;z=r;A=j;B=t;break}}t=((d[x>>0]|0)<<8|(d[A+-3>>0]|0))&65535;b[z>>1]=t;b[y>>1]=t;t=e+-1|0;e=A+-4|0;A=B+4|0;while(1){b[A>>1]=(d[e>>0]|0)<<8|(d[e+-1>>0]|0);e=e+-2|0;if(e>>>0>=t>>>0)break;else A=A+2|0}c[i>>2]=h;c[g>>2]=h+l;c[f>>2]=n;n=f+32|0;a[n>>0]=(d[n>>0]|0)^24;q=0;return q|0}function Sb(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j<<1;l=c[f>>2]|0;m=k+l|0;n=e+h|0;o=jd(m+2|0,2)|0;c[f+96>>2]=o;if(!o){_b(31240,29944,355,1,31224,c[(La()|0)>>2]|0);p=-1;return p|0}q=l<<1;r=h<<1;s=o+(q+-2-r)|0;t=q+-4-r|0;q=o+t|0;u=h+1|0;v=e+(l+-1)|0;l=o;while(1){b[l>>1]=(d[v>>0]|0)<<8^32768;v=v+-1|0;if((v|0)==(n|0))break;else l=l+2|0}l=((d[n>>0]|0)<<8^32768)&65535;b[s>>1]=l;s=k|1;b[q+(s<<1)>>1]=l;l=e+j|0;n=l;v=e+(u-n)|0;w=j<<1;j=e+(u+(r-n-w))|0;x=e+(u+(r+-1-n-w))|0;w=e+(h+-1)|0;n=o+(t+4)|0;t=q+(s+-1<<1)|0;s=q+(k+2<<1)|0;while(1){o=w+-1|0;r=((d[w>>0]|0)<<8^32768)&65535;b[n>>1]=r;b[t>>1]=r;b[s>>1]=b[n>>1]|0;if((o|0)==(l|0)){y=w;break}else{w=o;n=n+2|0;t=t+-2|0;s=s+2|0}}s=((d[l>>0]|0)<<8^32768)&65535;b[q+(v<<1)>>1]=s;b[q+(j<<1)>>1]=s;s=y+-2|0;y=q+(x+2<<1)|0;while(1){b[y>>1]=(d[s>>0]|0)<<8^32768;if((s|0)==(e|0))break;else{s=s+-1|0;y=y+2|0}}c[i>>2]=h;c[g>>2]=h+k;c[f>>2]=m;m=f+32|0;a[m>>0]=(d[m>>0]|0)^26;p=0;return p|0}function Tb(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j<<1;l=c[f>>2]|0;m=k+l|0;n=e+j|0;o=jd(m+2|0,2)|0;c[f+96>>2]=o;if(!o){_b(31368,29944,279,1,31224,c[(La()|0)>>2]|0);p=-1;return p|0}q=j<<1;r=o+q|0;s=o+(q+-2)|0;t=j+-1|0;u=e;v=o;while(1){b[v>>1]=(d[u>>0]|0)<<8^32768;u=u+1|0;if((u|0)==(n|0))break;else v=v+2|0}v=e+t|0;t=((d[n>>0]|0)<<8^32768)&65535;b[r>>1]=t;r=k|1;b[s+(r<<1)>>1]=t;t=e+h|0;n=e+(h-v)|0;u=h*3|0;w=e+(u-v-q)|0;x=e+(u+-1-v-q)|0;v=e+(j+1)|0;j=o+(q+2)|0;q=s+(r+-1<<1)|0;r=s+(k+2<<1)|0;while(1){o=v+1|0;u=((d[v>>0]|0)<<8^32768)&65535;b[j>>1]=u;b[q>>1]=u;b[r>>1]=b[j>>1]|0;if((o|0)==(t|0)){y=v;break}else{v=o;j=j+2|0;q=q+-2|0;r=r+2|0}}r=y+2|0;y=((d[t>>0]|0)<<8^32768)&65535;b[s+(n<<1)>>1]=y;b[s+(w<<1)>>1]=y;y=e+l|0;if((r|0)!=(y|0)){l=r;r=s+(x+2<<1)|0;while(1){b[r>>1]=(d[l>>0]|0)<<8^32768;l=l+1|0;if((l|0)==(y|0))break;else r=r+2|0}}c[i>>2]=h;c[g>>2]=h+k;c[f>>2]=m;m=f+32|0;a[m>>0]=(d[m>>0]|0)^10;p=0;return p|0}function Ub(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j<<1;l=c[f>>2]|0;m=k+l|0;n=e+j|0;o=jd(m+2|0,2)|0;c[f+96>>2]=o;if(!o){_b(31400,29944,130,1,31224,c[(La()|0)>>2]|0);p=-1;return p|0}q=j<<1;r=o+q|0;s=o+(q+-2)|0;t=j+-1|0;u=e;v=o;while(1){b[v>>1]=(d[u>>0]|0)<<8;u=u+1|0;if((u|0)==(n|0))break;else v=v+2|0}v=e+t|0;t=(d[n>>0]|0)<<8&65535;b[r>>1]=t;r=k|1;b[s+(r<<1)>>1]=t;t=e+h|0;n=e+(h-v)|0;u=h*3|0;w=e+(u-v-q)|0;x=e+(u+-1-v-q)|0;v=e+(j+1)|0;j=o+(q+2)|0;q=s+(r+-1<<1)|0;r=s+(k+2<<1)|0;while(1){o=v+1|0;u=(d[v>>0]|0)<<8&65535;b[j>>1]=u;b[q>>1]=u;b[r>>1]=b[j>>1]|0;if((o|0)==(t|0)){y=v;break}else{v=o;j=j+2|0;q=q+-2|0;r=r+2|0}}r=y+2|0;y=(d[t>>0]|0)<<8&65535;b[s+(n<<1)>>1]=y;b[s+(w<<1)>>1]=y;y=e+l|0;if((r|0)!=(y|0)){l=r;r=s+(x+2<<1)|0;while(1){b[r>>1]=(d[l>>0]|0)<<8;l=l+1|0;if((l|0)==(y|0))break;else r=r+2|0}}c[i>>2]=h;c[g>>2]=h+k;c[f>>2]=m;m=f+32|0;a[m>>0]=(d[m>>0]|0)^8;p=0;return p|0}function Vb(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0;g=f+8|0;h=c[g>>2]|0;i=f+4|0;j=c[i>>2]|0;k=h-j<<1;l=c[f>>2]|0;m=k+l|0;n=e+h|0;o=jd(m+2|0,2)|0;c[f+96>>2]=o;if(!o){_b(31272,29944,207,1,31224,c[(La()|0)>>2]|0);p=-1;return p|0}q=l<<1;r=h<<1;s=o+(q+-2-r)|0;t=q+-4-r|0;q=o+t|0;u=h+1|0;v=e+(l+-1)|0;l=o;while(1){b[l>>1]=(d[v>>0]|0)<<8;v=v+-1|0;if((v|0)==(n|0))break;else l=l+2|0}l=(d[n>>0]|0)<<8&65535;b[s>>1]=l;s=k|1;b[q+(s<<1)>>1]=l;l=e+j|0;n=l;v=e+(u-n)|0;w=j<<1;j=e+(u+(r-n-w))|0;x=e+(u+(r+-1-n-w))|0;w=e+(h+-1)|0;n=o+(t+4)|0;t=q+(s+-1<<1)|0;s=q+(k+2<<1)|0;while(1){o=w+-1|0;r=(d[w>>0]|0)<<8&65535;b[n>>1]=r;b[t>>1]=r;b[s>>1]=b[n>>1]|0;if((o|0)==(l|0)){y=w;break}else{w=o;n=n+2|0;t=t+-2|0;s=s+2|0}}s=(d[l>>0]|0)<<8&65535;b[q+(v<<1)>>1]=s;b[q+(j<<1)>>1]=s;s=y+-2|0;y=q+(x<<1)|0;while(1){y=y+4|0;b[y>>1]=(d[s>>0]|0)<<8;if((s|0)==(e|0))break;else s=s+-1|0}c[i>>2]=h;c[g>>2]=h+k;c[f>>2]=m;m=f+32|0;a[m>>0]=(d[m>>0]|0)^24;p=0;return p|0}function Wb(a){a=a|0;var b=0,d=0,e=0,f=0,g=0;b=a+2504|0;if((c[b>>2]|0)>0){d=c[a+2496>>2]|0;e=0;do{c[d+(e<<2)>>2]=0;e=e+1|0}while((e|0)<(c[b>>2]|0));}b=a+2508|0;if((c[b>>2]|0)>0){e=c[a+2500>>2]|0;d=0;do{c[e+(d<<2)>>2]=0;d=d+1|0}while((d|0)<(c[b>>2]|0));f=0}else f=0;do{b=a+(f*48|0)|0;c[b>>2]=0;d=a+384+(f*48|0)|0;c[d>>2]=0;e=a+768+(f*48|0)|0;c[e>>2]=0;g=a+1152+(f*48|0)|0;c[g>>2]=0;c[b+4>>2]=0;c[d+4>>2]=0;c[e+4>>2]=0;c[g+4>>2]=0;c[b+8>>2]=0;c[d+8>>2]=0;c[e+8>>2]=0;c[g+8>>2]=0;c[b+12>>2]=0;c[d+12>>2]=0;c[e+12>>2]=0;c[g+12>>2]=0;c[b+16>>2]=0;c[d+16>>2]=0;c[e+16>>2]=0;c[g+16>>2]=0;c[b+20>>2]=0;c[d+20>>2]=0;c[e+20>>2]=0;c[g+20>>2]=0;c[b+24>>2]=0;c[d+24>>2]=0;c[e+24>>2]=0;c[g+24>>2]=0;c[b+28>>2]=0;c[d+28>>2]=0;c[e+28>>2]=0;c[g+28>>2]=0;c[b+32>>2]=0;c[d+32>>2]=0;c[e+32>>2]=0;c[g+32>>2]=0;c[b+36>>2]=0;c[d+36>>2]=0;c[e+36>>2]=0;c[g+36>>2]=0;c[b+40>>2]=0;c[d+40>>2]=0;c[e+40>>2]=0;c[g+40>>2]=0;c[b+44>>2]=0;c[d+44>>2]=0;c[e+44>>2]=0;c[g+44>>2]=0;f=f+1|0}while((f|0)!=8);return}function Xb(b,d,e){b=b|0;d=d|0;e=e|0;var f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0,s=0,t=0,u=0,v=0,w=0,x=0,y=0,z=0,A=0;f=0;f=0;g=d&255;h=(e|0)!=0;a:do if(h&(b&3|0)!=0){i=d&255;j=e;k=b;while(1){if((a[k>>0]|0)==i<<24>>24){l=j;m=k;f=6;break a}n=k+1|0;o=j+-1|0;p=(o|0)!=0;if(p&(n&3|0)!=0){j=o;k=n}else{q=o;r=p;s=n;f=5;break}}}else{q=e;r=h;s=b;f=5}while(0);if((f|0)==5)if(r){l=q;m=s;f=6}else{t=0;u=s}b:do if((f|0)==6){s=d&255;if((a[m>>0]|0)==s<<24>>24){t=l;u=m}else{q=$(g,16843009)|0;c:do if(l>>>0>3){r=l;b=m;while(1){h=c[b>>2]^q;if((h&-2139062144^-2139062144)&h+-16843009){v=r;w=b;break}h=b+4|0;e=r+-4|0;if(e>>>0>3){r=e;b=h}else{x=e;y=h;f=11;break c}}z=v;A=w}else{x=l;y=m;f=11}while(0);if((f|0)==11)if(!x){t=0;u=y;break}else{z=x;A=y}while(1){if((a[A>>0]|0)==s<<24>>24){t=z;u=A;break b}q=A+1|0;z=z+-1|0;if(!z){t=0;u=q;break}else A=q}}}while(0);return ((t|0)!=0?u:0)|0}function Yb(d){d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0;e=d+8|0;c[d+12>>2]=c[e>>2];c[d+4>>2]=0;c[d+28>>2]=0;nc(d,0);f=d+16|0;g=c[f>>2]|0;h=d+20|0;i=c[h>>2]|0;if((g+1|0)>>>0<i>>>0){j=c[e>>2]|0;k=g}else{g=i+8192|0;c[h>>2]=g;h=Vc(c[e>>2]|0,g*20|0)|0;c[e>>2]=h;j=h;k=c[f>>2]|0}h=j+(k*20|0)|0;c[h>>2]=0;a[h+4>>0]=0;c[h+8>>2]=0;h=c[f>>2]|0;c[j+(h*20|0)+12>>2]=0;if(!(b[348]&16384))return;if((c[j>>2]|0)!=1){f=d+32|0;k=j;do{e=k+12|0;g=c[e>>2]|0;if(g){c[f>>2]=(c[f>>2]|0)-g;c[e>>2]=0}k=k+20|0}while((c[k>>2]|0)!=1);}k=j+((h+-1|0)*20|0)|0;h=d+32|0;d=c[h>>2]|0;if((c[k>>2]|0)==2){l=d;m=k}else{f=d;d=k;while(1){k=d+12|0;e=f-(c[k>>2]|0)|0;c[k>>2]=0;if((d|0)==(j|0)){n=e;o=j;break}k=d+-20|0;if((c[k>>2]|0)==2){n=e;o=k;break}else{f=e;d=k}}c[h>>2]=n;l=n;m=o}o=m+12|0;c[h>>2]=l-(c[o>>2]|0);c[o>>2]=0;return}function Zb(b,f){b=b|0;f=f|0;var g=0,h=0,i=0,j=0,k=0;g=c[b+564>>2]|0;h=d[f>>0]|0;i=b+52+(h<<5)+8|0;if((c[f+4>>2]|0)>>>0>63){a[i>>0]=1;return}a[i>>0]=0;if(!g)return;else j=g;do{if(((e[j>>1]|0)>>>8|0)==(h|0)){g=j+33|0;do if(a[g>>0]&2){i=j+32|0;f=d[i>>0]|0;if(!(f&64)){if(f&4)a[i>>0]=f^4;c[j+20>>2]=0;break}i=j+24|0;b=a[i>>0]|0;if(!(f&128)){if((b&255)>=4)break;a[i>>0]=4;f=c[j+8>>2]|0;k=c[f+52>>2]|0;if((c[j+28>>2]|0)>(c[f+80>>2]|0)){c[j+20>>2]=0-k;break}else{c[j+20>>2]=k;break}}else{if((b&255)>=5)break;a[i>>0]=5;i=c[j+8>>2]|0;b=c[i+56>>2]|0;if((c[j+28>>2]|0)>(c[i+84>>2]|0)){c[j+20>>2]=0-b;break}else{c[j+20>>2]=b;break}}}while(0);a[g>>0]=0}j=c[j+40>>2]|0}while((j|0)!=0);return}function _b(a,b,d,e,f,g){a=a|0;b=b|0;d=d|0;e=e|0;f=f|0;g=g|0;var h=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0;h=i;i=i+96|0;j=h+64|0;k=h+40|0;l=h+16|0;m=h;if(e>>>0>17){i=h;return}c[4]=e;n=c[2]|0;if(n)vb(n);n=pb(256)|0;$c(n|0,0,256)|0;o=(f|0)==0;p=c[24+(e<<2)>>2]|0;do if(!g)if(o){c[m>>2]=a;c[m+4>>2]=b;c[m+8>>2]=d;c[m+12>>2]=p;Gd(n,104,m)|0;break}else{c[l>>2]=a;c[l+4>>2]=b;c[l+8>>2]=d;c[l+12>>2]=f;c[l+16>>2]=p;Gd(n,128,l)|0;break}else{e=Xa(g|0)|0;if(o){c[k>>2]=a;c[k+4>>2]=b;c[k+8>>2]=d;c[k+12>>2]=p;c[k+16>>2]=e;Gd(n,160,k)|0;break}else{c[j>>2]=a;c[j+4>>2]=b;c[j+8>>2]=d;c[j+12>>2]=f;c[j+16>>2]=p;c[j+20>>2]=e;Gd(n,192,j)|0;break}}while(0);c[2]=n;i=h;return}function $b(a){a=a|0;var b=0,d=0,e=0,f=0,g=0,h=0,j=0,k=0;b=i;i=i+16|0;d=b+8|0;e=b+4|0;f=b;c[d>>2]=0;c[e>>2]=441668941;c[f>>2]=1297239878;if(!(c[208]|0)){_b(1104,784,1632,8,0,0);g=0;i=b;return g|0}if(!a){_b(1104,784,1636,9,816,0);g=0;i=b;return g|0}h=Jb(a,d)|0;if(!h){g=0;i=b;return g|0}do if(!(Yc(h,38352,8)|0))j=zb(h,c[d>>2]|0)|0;else{if(!(Yc(h,38648,18)|0)){j=ub(h,c[d>>2]|0)|0;break}if(!(Yc(h,e,4)|0)){j=xb(h,c[d>>2]|0)|0;break}a=(Yc(h,f,4)|0)==0;k=c[d>>2]|0;if(a){j=yb(h,k)|0;break}else{j=tb(h,k)|0;break}}while(0);vb(h);if(!j){g=j;i=b;return g|0}if(!(sc(j)|0)){jc(j);g=j;i=b;return g|0}else{hc(j)|0;g=0;i=b;return g|0}return 0}function ac(b){b=b|0;var e=0,f=0,g=0,h=0;a[b+52>>0]=0;e=b+32|0;f=d[e>>0]|0;if(!(f&64)){if(f&4)a[e>>0]=f^4;c[b+20>>2]=0;return}e=b+33|0;g=a[e>>0]|0;if(g<<24>>24){a[e>>0]=g&255|2;return}if(f&32){g=b+24|0;if((d[g>>0]|0)>=3)return;a[g>>0]=3;g=c[b+8>>2]|0;e=c[g+48>>2]|0;if((c[b+28>>2]|0)>(c[g+76>>2]|0)){c[b+20>>2]=0-e;return}else{c[b+20>>2]=e;return}}e=b+24|0;g=a[e>>0]|0;if(!(f&128)){if((g&255)>=4)return;a[e>>0]=4;f=c[b+8>>2]|0;h=c[f+52>>2]|0;if((c[b+28>>2]|0)>(c[f+80>>2]|0)){c[b+20>>2]=0-h;return}else{c[b+20>>2]=h;return}}else{if((g&255)>=5)return;a[e>>0]=5;e=c[b+8>>2]|0;g=c[e+56>>2]|0;if((c[b+28>>2]|0)>(c[e+84>>2]|0)){c[b+20>>2]=0-g;return}else{c[b+20>>2]=g;return}}}function bc(a){a=a|0;var d=0,f=0,g=0,h=0,i=0;if(!(c[208]|0)){_b(28224,784,2014,8,0,0);d=0;return d|0}if(!a){_b(28224,784,2018,9,1056,0);d=0;return d|0}Xd(a);f=a+44|0;g=c[f>>2]|0;do if(!g){h=pb(20)|0;c[f>>2]=h;if(h){c[h>>2]=0;i=h;break}_b(28224,784,2025,1,28248,0);ae(a);d=0;return d|0}else i=g;while(0);g=a+24|0;c[i+4>>2]=c[a+28>>2];c[i+8>>2]=c[a+32>>2];b[i+12>>1]=b[a+36>>1]|0;c[i+16>>2]=(((c[i+8>>2]|0)*1e3|0)>>>0)/((e[380]|0)>>>0)|0;do if(!(c[g>>2]|0))c[i>>2]=0;else{vb(c[i>>2]|0);h=pb((ce(c[g>>2]|0)|0)+1|0)|0;c[c[f>>2]>>2]=h;if(!h){_b(28224,784,2039,1,28264,0);break}else{Qd(h|0,c[g>>2]|0)|0;break}}while(0);ae(a);d=c[f>>2]|0;return d|0}function cc(a,b,d){a=a|0;b=b|0;d=d|0;var e=0,f=0,g=0,h=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0;e=i;i=i+224|0;f=e+120|0;g=e+80|0;h=e;j=e+136|0;k=g;l=k+40|0;do{c[k>>2]=0;k=k+4|0}while((k|0)<(l|0));c[f>>2]=c[d>>2];if((nb(0,b,f,h,g)|0)<0){m=-1;i=e;return m|0}d=a+48|0;if(!(c[d>>2]|0)){k=a+44|0;l=c[k>>2]|0;c[k>>2]=j;n=a+28|0;c[n>>2]=j;o=a+20|0;c[o>>2]=j;c[d>>2]=80;p=a+16|0;c[p>>2]=j+80;j=nb(a,b,f,h,g)|0;if(!l)q=j;else{jb[c[a+36>>2]&1](a,0,0)|0;r=(c[o>>2]|0)==0?-1:j;c[k>>2]=l;c[d>>2]=0;c[p>>2]=0;c[n>>2]=0;c[o>>2]=0;q=r}}else q=nb(a,b,f,h,g)|0;m=q;i=e;return m|0}function dc(b,d,e){b=b|0;d=d|0;e=e|0;var f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0;f=e+16|0;g=c[f>>2]|0;do if(!g)if(!(bd(e)|0)){h=c[f>>2]|0;break}else{i=0;return i|0}else h=g;while(0);g=e+20|0;f=c[g>>2]|0;if((h-f|0)>>>0<d>>>0){i=jb[c[e+36>>2]&1](e,b,d)|0;return i|0}a:do if((a[e+75>>0]|0)>-1){h=d;while(1){if(!h){j=d;k=b;l=f;m=0;break a}n=h+-1|0;if((a[b+n>>0]|0)==10){o=h;break}else h=n}if((jb[c[e+36>>2]&1](e,b,o)|0)>>>0<o>>>0){i=o;return i|0}else{j=d-o|0;k=b+o|0;l=c[g>>2]|0;m=o;break}}else{j=d;k=b;l=f;m=0}while(0);Wc(l|0,k|0,j|0)|0;c[g>>2]=(c[g>>2]|0)+j;i=m+j|0;return i|0}function ec(b){b=b|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0;e=0;e=0;f=b+104|0;g=c[f>>2]|0;if(!g)e=3;else if((c[b+108>>2]|0)<(g|0))e=3;if((e|0)==3){g=gd(b)|0;if((g|0)>=0){h=c[f>>2]|0;f=b+8|0;if(!h){i=c[f>>2]|0;j=i;k=i;e=9}else{i=c[f>>2]|0;f=c[b+4>>2]|0;l=i;m=h-(c[b+108>>2]|0)+-1|0;if((l-f|0)>(m|0)){c[b+100>>2]=f+m;n=i}else{j=l;k=i;e=9}}if((e|0)==9){c[b+100>>2]=j;n=k}k=c[b+4>>2]|0;if(n){j=b+108|0;c[j>>2]=n+1-k+(c[j>>2]|0);}j=k+-1|0;if((d[j>>0]|0|0)==(g|0)){o=g;return o|0}a[j>>0]=g;o=g;return o|0}}c[b+100>>2]=0;o=-1;return o|0}function fc(b,d,e,f){b=b|0;d=d|0;e=e|0;f=f|0;var g=0,h=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0;g=i;i=i+128|0;h=g+112|0;j=g;k=j;l=39752;m=k+112|0;do{c[k>>2]=c[l>>2];k=k+4|0;l=l+4|0}while((k|0)<(m|0));if((d+-1|0)>>>0>2147483646)if(!d){n=h;o=1}else{c[(La()|0)>>2]=75;p=-1;i=g;return p|0}else{n=b;o=d}d=-2-n|0;b=o>>>0>d>>>0?d:o;c[j+48>>2]=b;o=j+20|0;c[o>>2]=n;c[j+44>>2]=n;d=n+b|0;n=j+16|0;c[n>>2]=d;c[j+28>>2]=d;d=cc(j,e,f)|0;if(!b){p=d;i=g;return p|0}b=c[o>>2]|0;a[b+(((b|0)==(c[n>>2]|0))<<31>>31)>>0]=0;p=d;i=g;return p|0}function gc(b,c,e){b=b|0;c=c|0;e=e|0;var f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0,r=0;if(!e){f=0;return f|0}g=a[b>>0]|0;a:do if(!(g<<24>>24)){h=0;i=c}else{j=e;k=g;l=g&255;m=b;n=c;while(1){j=j+-1|0;o=a[n>>0]|0;if(!((j|0)!=0&o<<24>>24!=0)){h=k;i=n;break a}if(k<<24>>24!=o<<24>>24){o=je(l)|0;if((o|0)!=(je(d[n>>0]|0)|0)){p=m;q=n;break}}m=m+1|0;o=n+1|0;r=a[m>>0]|0;if(!(r<<24>>24)){h=0;i=o;break a}else{k=r;l=r&255;n=o}}h=a[p>>0]|0;i=q}while(0);q=je(h&255)|0;f=q-(je(d[i>>0]|0)|0)|0;return f|0}function hc(a){a=a|0;var b=0,d=0,e=0,f=0,g=0,h=0,i=0;if(!(c[208]|0)){_b(1040,784,1584,8,0,0);b=-1;return b|0}if(!a){_b(1040,784,1588,9,1056,0);b=-1;return b|0}if(!(c[268]|0)){_b(1040,784,1592,9,1080,0);b=-1;return b|0}Xd(a);d=c[268]|0;e=c[d>>2]|0;a:do if((e|0)==(a|0)){f=c[d+4>>2]|0;vb(d);c[268]=f;if(f)c[f+8>>2]=0}else{if((e|0)==(a|0))g=d;else{f=d;while(1){h=c[f+4>>2]|0;if(!h)break a;if((c[h>>2]|0)==(a|0)){g=h;break}else f=h}}if(g){f=g+4|0;h=c[g+8>>2]|0;c[h+4>>2]=c[f>>2];i=c[f>>2]|0;if(i)c[i+8>>2]=h;vb(g);}}while(0);Mb(a);b=0;return b|0}function ic(e,f,h){e=e|0;f=f|0;h=h|0;var i=0,j=0,k=0.0,l=0.0,m=0.0,n=0.0,o=0.0,p=0.0;if(a[h+53>>0]|0)return;i=(f&255)>15?15:f&255;f=e+52+(i<<5)|0;i=(d[f+12>>0]|0)+192+(d[f+13>>0]|0)|0;j=(($((($(d[f+9>>0]|0,d[f+11>>0]|0)|0)>>>0)/127|0,d[h+2>>0]|0)|0)>>>0)/127|0;k=+(b[384]|0)*.0009765625*.25;f=(i&128)>>>0>127?127:i&255;l=+g[36552+(127-f<<2)>>2];m=+g[36552+(f<<2)>>2];if(!(b[e+36>>1]&1)){n=+(b[31496+(j<<1)>>1]|0)*.0009765625;o=n*+Q(10.0,+(l/20.0));p=n*+Q(10.0,+(m/20.0));}else{n=+g[37064+(j<<2)>>2];o=+Q(10.0,+((l+n)/20.0));p=+Q(10.0,+((m+n)/20.0));}c[h+44>>2]=~~(k*o*1024.0);c[h+48>>2]=~~(k*p*1024.0);return}function jc(b){b=b|0;var d=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0;d=b+16|0;if(!(c[d>>2]|0))return;f=b+8|0;g=c[f>>2]|0;h=0;i=0;while(1){if((c[g+(h*20|0)>>2]|0)==2){j=g+(h*20|0)|0;k=kc(b,a[j+4>>0]|0,c[j+8>>2]&255)|0;j=(e[380]|0)+k|0;l=c[f>>2]|0;m=j>>>0>i>>>0?j:i}else{l=g;m=i}j=c[l+(h*20|0)+12>>2]|0;if(!m)n=0;else n=m>>>0<j>>>0?0:m-j|0;j=h+1|0;if((j|0)==(c[d>>2]|0)){o=h;p=n;break}else{g=l;h=j;i=n}}if(!p)return;n=(c[b+8>>2]|0)+(o*20|0)+12|0;c[n>>2]=(c[n>>2]|0)+p;n=b+32|0;c[n>>2]=(c[n>>2]|0)+p;return}function kc(e,f,g){e=e|0;f=f|0;g=g|0;var h=0,i=0,j=0,k=0;h=f&255;if(!(a[e+52+(h<<5)+31>>0]|0))i=c[e+52+(h<<5)+4>>2]|0;else i=uc(e,(g&255|d[e+52+(h<<5)>>0]<<8|128)&65535)|0;if(!i){j=0;return j|0}do if(!(b[i>>1]&128))k=(c[31752+((((g&255)%12|0)&255)*100<<2)>>2]|0)>>>(10-(((g&255)/12|0)&255)|0);else{h=a[i+84>>0]|0;if(!(h<<24>>24)){k=(c[31752+((((g&255)%12|0)&255)*100<<2)>>2]|0)>>>(10-(((g&255)/12|0)&255)|0);break}else{k=(c[31752+((((h&255)%12|0)&255)*100<<2)>>2]|0)>>>(10-(((h&255)/12|0)&255)|0);break}}while(0);g=tc(i,(k>>>0)/100|0)|0;if(!g){j=0;return j|0}j=c[g+104>>2]|0;return j|0}function lc(b){b=b|0;var c=0,d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0,p=0,q=0;c=0;c=0;d=b;while(1){b=d+1|0;if(!(me(a[d>>0]|0)|0)){e=d;f=b;break}else d=b}d=a[e>>0]|0;b=d<<24>>24;if((b|0)==43){g=0;c=5}else if((b|0)==45){g=1;c=5}else{h=e;i=d;j=0}if((c|0)==5){h=f;i=a[f>>0]|0;j=g}g=(i<<24>>24)+-48|0;if(g>>>0<10){k=h;l=g;m=0}else{n=0;o=(j|0)!=0;p=0-n|0;q=o?n:p;return q|0}while(1){k=k+1|0;g=(m*10|0)-l|0;l=(a[k>>0]|0)+-48|0;if(l>>>0>=10){n=g;break}else m=g}o=(j|0)!=0;p=0-n|0;q=o?n:p;return q|0}function mc(f,g){f=f|0;g=g|0;var h=0,i=0,j=0,k=0,l=0;h=c[f+564>>2]|0;i=(c[g+4>>2]|0)+57344|0;j=d[g>>0]|0;g=f+52+(j<<5)|0;b[g+18>>1]=i;f=($(i<<16>>16,b[g+20>>1]|0)|0)/((i>>>15&1)+8191|0)|0;c[g+24>>2]=f;if(!h)return;g=((e[380]|0)*100|0)>>>10;i=h;do{h=e[i>>1]|0;if((h>>>8|0)==(j|0)){k=a[(c[i+4>>2]|0)+84>>0]|0;l=((k<<24>>24==0?h&127:k&255)*100|0)+f|0;k=(l|0)<0?0:(l|0)>12700?12700:l;c[i+16>>2]=((((c[31752+(((k|0)%1200|0)<<2)>>2]|0)>>>(10-((k|0)/1200|0)|0)>>>0)/(g>>>0)|0)<<10>>>0)/((c[(c[i+8>>2]|0)+92>>2]|0)>>>0)|0}i=c[i+40>>2]|0}while((i|0)!=0);return}function nc(d,e){d=d|0;e=e|0;var f=0,g=0,h=0,i=0;e=0;do{a[d+52+(e<<5)>>0]=0;if((e|0)==9)f=0;else f=uc(d,0)|0;g=d+52+(e<<5)|0;c[g+4>>2]=f;a[g+8>>0]=0;a[g+9>>0]=100;a[g+10>>0]=127;a[g+11>>0]=127;a[g+12>>0]=64;a[g+13>>0]=64;b[g+18>>1]=0;b[g+20>>1]=200;b[g+28>>1]=-1;a[g+31>>0]=0;e=e+1|0}while((e|0)!=16);e=c[d+564>>2]|0;if(!e){h=d+371|0;a[h>>0]=1;return}else i=e;do{if(!(a[i+53>>0]|0)){ic(d,16,i);e=c[i+36>>2]|0;if(e)ic(d,16,e);}i=c[i+40>>2]|0}while((i|0)!=0);h=d+371|0;a[h>>0]=1;return}function oc(d,e){d=d|0;e=e|0;var f=0,g=0,h=0,i=0;f=d+229948|0;g=c[f>>2]|0;a:do if(g){h=c[d+229944>>2]|0;i=0;while(1){if((b[c[h+(i<<2)>>2]>>1]|0)==e<<16>>16)break;i=i+1|0;if(i>>>0>=g>>>0)break a}return}while(0);g=uc(d,e)|0;if(!g)return;Xd(37672);if(!(a[g+2>>0]|0))if((Gb(g)|0)==-1){ae(37672);return}if(!(c[g+92>>2]|0)){ae(37672);return}else{e=(c[f>>2]|0)+1|0;c[f>>2]=e;i=d+229944|0;d=Vc(c[i>>2]|0,e<<2)|0;c[i>>2]=d;c[d+((c[f>>2]|0)+-1<<2)>>2]=g;f=g+88|0;c[f>>2]=(c[f>>2]|0)+1;ae(37672);return}}function pc(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0;g=c[f>>2]|0;h=e+g|0;i=g>>>1;j=jd(i+2|0,2)|0;c[f+96>>2]=j;if(!j){_b(31288,29944,638,1,31224,c[(La()|0)>>2]|0);k=-1;return k|0}l=e;e=j+(i+-1<<1)|0;while(1){b[e>>1]=((d[l+1>>0]|0)<<8|(d[l>>0]|0))^32768;l=l+2|0;if(l>>>0>=h>>>0)break;else e=e+-2|0}e=f+8|0;h=f+4|0;l=g-(c[h>>2]|0)|0;j=g-(c[e>>2]|0)|0;g=f+16|0;m=d[g>>0]|0;a[g>>0]=m<<4|m>>>4;c[h>>2]=j>>>1;c[e>>2]=l>>>1;c[f>>2]=i;i=f+32|0;a[i>>0]=(d[i>>0]|0)^18;k=0;return k|0}function qc(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0,m=0;g=c[f>>2]|0;h=e+g|0;i=g>>>1;j=jd(i+2|0,2)|0;c[f+96>>2]=j;if(!j){_b(31320,29944,469,1,31224,c[(La()|0)>>2]|0);k=-1;return k|0}l=e;e=j+(i+-1<<1)|0;while(1){b[e>>1]=(d[l+1>>0]|0)<<8|(d[l>>0]|0);l=l+2|0;if(l>>>0>=h>>>0)break;else e=e+-2|0}e=f+8|0;h=f+4|0;l=g-(c[h>>2]|0)|0;j=g-(c[e>>2]|0)|0;g=f+16|0;m=d[g>>0]|0;a[g>>0]=m<<4|m>>>4;c[h>>2]=j>>>1;c[e>>2]=l>>>1;c[f>>2]=i;i=f+32|0;a[i>>0]=(d[i>>0]|0)^16;k=0;return k|0}function rc(b,c){b=b|0;c=c|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0,o=0;e=a[b>>0]|0;a:do if(!(e<<24>>24)){f=0;g=c}else{h=e;i=e&255;j=b;k=c;while(1){l=a[k>>0]|0;if(!(l<<24>>24)){f=h;g=k;break a}if(h<<24>>24!=l<<24>>24){l=je(i)|0;if((l|0)!=(je(d[k>>0]|0)|0)){m=j;n=k;break}}j=j+1|0;l=k+1|0;o=a[j>>0]|0;if(!(o<<24>>24)){f=0;g=l;break a}else{h=o;i=o&255;k=l}}f=a[m>>0]|0;g=n}while(0);n=je(f&255)|0;return n-(je(d[g>>0]|0)|0)|0}function sc(a){a=a|0;var b=0,d=0,e=0,f=0;b=c[268]|0;if(!b){d=pb(12)|0;c[268]=d;if(!d){_b(28312,784,759,1,28328,c[(La()|0)>>2]|0);e=-1;return e|0}else{c[d>>2]=a;c[d+8>>2]=0;c[(c[268]|0)+4>>2]=0;e=0;return e|0}}d=c[b+4>>2]|0;if(!d)f=b;else{b=d;while(1){d=c[b+4>>2]|0;if(!d){f=b;break}else b=d}}b=pb(12)|0;c[f+4>>2]=b;if(!b){_b(28312,784,773,1,28328,c[(La()|0)>>2]|0);e=-1;return e|0}else{c[b+8>>2]=f;c[b+4>>2]=0;c[b>>2]=a;e=0;return e|0}return 0}function tc(a,b){a=a|0;b=b|0;var d=0,e=0,f=0,g=0,h=0,i=0,j=0,k=0;d=0;d=0;Xd(37672);if(!a){ae(37672);e=0;return e|0}f=a+92|0;a=c[f>>2]|0;if(!a){ae(37672);e=0;return e|0}if(!b){ae(37672);e=c[f>>2]|0;return e|0}else{g=a;h=a}while(1){if((c[g+20>>2]|0)>>>0<b>>>0)if((c[g+24>>2]|0)>>>0>b>>>0){i=g;d=9;break}else j=g;else j=h;g=c[g+100>>2]|0;if(!g){k=j;d=11;break}else h=j}if((d|0)==9){ae(37672);e=i;return e|0}else if((d|0)==11){ae(37672);e=k;return e|0}return 0}function uc(a,d){a=a|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0,l=0;a=0;a=0;Xd(37672);e=d&65535;f=c[37680+((e&127)<<2)>>2]|0;a:do if(f){g=f;h=e;i=d;b:while(1){if(g){j=g;do{if((b[j>>1]|0)==i<<16>>16){k=j;break b}j=c[j+96>>2]|0}while((j|0)!=0);}ae(37672);j=h&255;if(!(h&65280)){l=0;a=9;break}Xd(37672);g=c[37680+((h&127)<<2)>>2]|0;if(!g)break a;else{h=j;i=j&65535}}if((a|0)==9)return l|0;ae(37672);l=k;return l|0}while(0);ae(37672);l=0;return l|0}function vc(b,e){b=b|0;e=e|0;var f=0,g=0,h=0,i=0;f=(c[e+4>>2]|0)>>>8;g=d[e>>0]|0;e=b+568+(g*7168|0)+(f*56|0)|0;if(!(a[b+568+(g*7168|0)+(f*56|0)+34>>0]|0))if(!(a[b+115256+(g*7168|0)+(f*56|0)+34>>0]|0))return;else{h=1;i=b+115256+(g*7168|0)+(f*56|0)|0}else{h=0;i=e}e=a[b+568+(h*114688|0)+(g*7168|0)+(f*56|0)+32>>0]|0;if((e&4)==0?(a[b+52+(g<<5)+31>>0]|0)!=0:0)return;if(e&64)if(!(a[b+568+(h*114688|0)+(g*7168|0)+(f*56|0)+24>>0]|0)){a[b+568+(h*114688|0)+(g*7168|0)+(f*56|0)+52>>0]=1;return}ac(i);return}function wc(a,d,f){a=a|0;d=d|0;f=f|0;var g=0,h=0,i=0;if(!(c[208]|0)){_b(28176,784,1957,8,0,0);g=-1;return g|0}if(!a){_b(28176,784,1961,9,1056,0);g=-1;return g|0}Xd(a);h=d&65535;if(!((h&32783|0)!=0&(h&32752|0)==0)){_b(28176,784,1968,9,888,0);ae(a);g=-1;return g|0}if(f&32752){_b(28176,784,1973,9,28200,0);ae(a);g=-1;return g|0}i=a+36|0;b[i>>1]=(e[i>>1]|0)&(h^33023)|f&d&65535;if(!(h&1)){if(h&4)Wb(c[a+229964>>2]|0);}else Kc(a,16);ae(a);g=0;return g|0}function xc(b,d,e){b=b|0;d=d|0;e=e|0;var f=0;if(!b){f=1;return f|0}if(d>>>0<128){a[b>>0]=d;f=1;return f|0}if(d>>>0<2048){a[b>>0]=d>>>6|192;a[b+1>>0]=d&63|128;f=2;return f|0}if(d>>>0<55296|(d&-8192|0)==57344){a[b>>0]=d>>>12|224;a[b+1>>0]=d>>>6&63|128;a[b+2>>0]=d&63|128;f=3;return f|0}if((d+-65536|0)>>>0<1048576){a[b>>0]=d>>>18|240;a[b+1>>0]=d>>>12&63|128;a[b+2>>0]=d>>>6&63|128;a[b+3>>0]=d&63|128;f=4;return f|0}else{c[(La()|0)>>2]=84;f=-1;return f|0}return 0}function yc(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0;g=c[f>>2]|0;h=e+g|0;i=jd(g+2|0,2)|0;c[f+96>>2]=i;if(!i){_b(31304,29944,305,1,31224,c[(La()|0)>>2]|0);j=-1;return j|0}k=e;e=i+(g+-1<<1)|0;while(1){b[e>>1]=(d[k>>0]|0)<<8^32768;k=k+1|0;if((k|0)==(h|0))break;else e=e+-2|0}e=f+8|0;h=c[e>>2]|0;k=f+4|0;c[e>>2]=g-(c[k>>2]|0);c[k>>2]=g-h;h=f+16|0;g=d[h>>0]|0;a[h>>0]=g<<4|g>>>4;g=f+32|0;a[g>>0]=(d[g>>0]|0)^18;j=0;return j|0}function zc(){var a=0,b=0,d=0,e=0,f=0,g=0;Xd(37672);a=0;do{b=37680+(a<<2)|0;d=c[b>>2]|0;if(d){e=d;do{d=c[e+92>>2]|0;if(!d)f=e;else{g=d;do{d=c[g+100>>2]|0;vb(c[g+96>>2]|0);vb(c[(c[b>>2]|0)+92>>2]|0);c[(c[b>>2]|0)+92>>2]=d;d=c[b>>2]|0;g=c[d+92>>2]|0}while((g|0)!=0);f=d}vb(c[f+4>>2]|0);g=c[b>>2]|0;e=c[g+96>>2]|0;vb(g);c[b>>2]=e}while((e|0)!=0);}a=a+1|0}while((a|0)!=128);ae(37672);return}function Ac(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0;g=c[f>>2]|0;h=e+g|0;i=jd(g+2|0,2)|0;c[f+96>>2]=i;if(!i){_b(31336,29944,156,1,31224,c[(La()|0)>>2]|0);j=-1;return j|0}k=e;e=i+(g+-1<<1)|0;while(1){b[e>>1]=(d[k>>0]|0)<<8;k=k+1|0;if((k|0)==(h|0))break;else e=e+-2|0}e=f+8|0;h=c[e>>2]|0;k=f+4|0;c[e>>2]=g-(c[k>>2]|0);c[k>>2]=g-h;h=f+16|0;g=d[h>>0]|0;a[h>>0]=g<<4|g>>>4;g=f+32|0;a[g>>0]=(d[g>>0]|0)^16;j=0;return j|0}function Bc(b,f){b=b|0;f=f|0;var g=0,h=0,i=0;g=c[b+564>>2]|0;h=d[f>>0]|0;if((g|0)!=0?(a[b+52+(h<<5)+31>>0]|0)==0:0)i=g;else return;do{do if(((e[i>>1]|0)>>>8|0)==(h|0)){g=i+33|0;b=a[g>>0]|0;if(b<<24>>24){a[g>>0]=b&255|2;break}if(a[i+32>>0]&64){b=i+24|0;if((d[b>>0]|0)<5){g=c[i+8>>2]|0;f=c[g+56>>2]|0;c[i+20>>2]=(c[i+28>>2]|0)>(c[g+84>>2]|0)?0-f|0:f;a[b>>0]=5}}}while(0);i=c[i+40>>2]|0}while((i|0)!=0);return}function Cc(a,b){a=+a;b=b|0;var d=0.0,e=0,f=0,g=0,i=0.0;if((b|0)>1023){d=a*8988465674311579538646525.0e283;e=b+-1023|0;if((e|0)>1023){f=b+-2046|0;g=(f|0)>1023?1023:f;i=d*8988465674311579538646525.0e283}else{g=e;i=d}}else if((b|0)<-1022){d=a*2.2250738585072014e-308;e=b+1022|0;if((e|0)<-1022){f=b+2044|0;g=(f|0)<-1022?-1022:f;i=d*2.2250738585072014e-308}else{g=e;i=d}}else{g=b;i=a}b=Ld(g+1023|0,0,52)|0;g=D;c[k>>2]=b;c[k+4>>2]=g;return +(i*+h[k>>3]);}function Dc(b,d){b=b|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0;e=a[d>>0]|0;f=d+4|0;d=c[f>>2]|0;g=d>>>8;h=e&255;i=b+568+(h*7168|0)+(g*56|0)|0;if(!(a[b+568+(h*7168|0)+(g*56|0)+34>>0]|0))if(!(a[b+115256+(h*7168|0)+(g*56|0)+34>>0]|0))return;else{j=1;k=b+115256+(h*7168|0)+(g*56|0)|0}else{j=0;k=i}i=b+568+(j*114688|0)+(h*7168|0)+(g*56|0)|0;a[i+2>>0]=d;ic(b,e,k);k=c[i+36>>2]|0;if(!k)return;a[k+2>>0]=c[f>>2];ic(b,e,k);return}function Ec(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0;g=c[f>>2]|0;h=e+g|0;i=g>>>1;g=jd(i+2|0,2)|0;c[f+96>>2]=g;if(!g){_b(31416,29944,548,1,31224,c[(La()|0)>>2]|0);j=-1;return j|0}k=e;e=g;while(1){b[e>>1]=((d[k+1>>0]|0)<<8|(d[k>>0]|0))^32768;k=k+2|0;if(k>>>0>=h>>>0)break;else e=e+2|0}e=f+4|0;c[e>>2]=(c[e>>2]|0)>>>1;e=f+8|0;c[e>>2]=(c[e>>2]|0)>>>1;c[f>>2]=i;i=f+32|0;a[i>>0]=(d[i>>0]|0)^2;j=0;return j|0}function Fc(){var a=0,d=0,e=0;if(!(c[208]|0)){_b(28288,784,2052,8,0,0);a=-1;return a|0}d=c[268]|0;if(d){e=d;do{hc(c[e>>2]|0)|0;e=c[268]|0}while((e|0)!=0);}zc();Xd(960);vb(c[314]|0);c[314]=0;ae(960);Xd(776);b[390]=0;b[391]=0;ae(776);b[384]=948;b[348]=0;c[184]=0;c[186]=0;c[188]=0;g[176]=16.875;g[178]=22.5;g[180]=8.4375;g[182]=16.875;c[208]=0;e=c[2]|0;if(!e){a=0;return a|0}vb(e);a=0;return a|0}function Gc(a,d,e){a=a|0;d=d|0;e=e|0;var f=0;if(c[208]|0){_b(840,784,1525,10,0,0);f=-1;return f|0}if(!a){_b(840,784,1530,9,856,0);f=-1;return f|0}$c(37680,0,512)|0;if((sb(a)|0)==-1){f=-1;return f|0}if(e&4080){_b(840,784,1540,9,888,0);zc();f=-1;return f|0}b[348]=e;if((d&65535)<11025){_b(840,784,1548,9,912,0);zc();f=-1;return f|0}else{b[380]=d;c[240]=0;c[9418]=0;b[384]=948;c[208]=1;f=0;return f|0}return 0}function Hc(a,b){a=+a;b=b|0;var d=0,e=0,f=0,g=0,i=0.0,j=0.0,l=0,m=0.0;h[k>>3]=a;d=c[k>>2]|0;e=c[k+4>>2]|0;f=Od(d|0,e|0,52)|0;g=f&2047;if(!g){if(a!=0.0){i=+Hc(a*18446744073709551616.0,b);j=i;l=(c[b>>2]|0)+-64|0}else{j=a;l=0}c[b>>2]=l;m=j;return +m}else if((g|0)==2047){m=a;return +m}else{c[b>>2]=g+-1022;c[k>>2]=d;c[k+4>>2]=e&-2146435073|1071644672;m=+h[k>>3];return +m}return +(0.0);}function Ic(b,c,e){b=b|0;c=c|0;e=e|0;var f=0,g=0,h=0,i=0,j=0,k=0,l=0,m=0,n=0;if(!e){f=0;return f|0}g=a[b>>0]|0;a:do if(!(g<<24>>24)){h=0;i=c}else{j=e;k=g;l=b;m=c;while(1){j=j+-1|0;n=a[m>>0]|0;if(!(k<<24>>24==n<<24>>24&((j|0)!=0&n<<24>>24!=0))){h=k;i=m;break a}l=l+1|0;n=m+1|0;k=a[l>>0]|0;if(!(k<<24>>24)){h=0;i=n;break}else m=n}}while(0);f=(h&255)-(d[i>>0]|0)|0;return f|0}function Jc(b,d,e,f){b=b|0;d=d|0;e=e|0;f=f|0;var g=0,h=0,i=0,j=0,k=0,l=0;g=b+16|0;h=c[g>>2]|0;i=b+20|0;j=c[i>>2]|0;if((h+1|0)>>>0<j>>>0){k=c[b+8>>2]|0;l=h}else{h=j+8192|0;c[i>>2]=h;i=b+8|0;b=Vc(c[i>>2]|0,h*20|0)|0;c[i>>2]=b;k=b;l=c[g>>2]|0}b=k+(l*20|0)|0;c[b>>2]=2;a[b+4>>0]=d;c[b+8>>2]=(e&255)<<8|f&255;f=c[g>>2]|0;c[k+(f*20|0)+12>>2]=0;c[g>>2]=f+1;return 0}function Kc(b,d){b=b|0;d=d|0;var f=0,g=0,h=0,i=0;f=c[b+564>>2]|0;if(!f)return;g=d&255;if((d&255)<16)h=f;else{i=f;do{if(!(a[i+53>>0]|0)){ic(b,d,i);f=c[i+36>>2]|0;if(f)ic(b,d,f);}i=c[i+40>>2]|0}while((i|0)!=0);return}do{if(((e[h>>1]|0)>>>8|0)==(g|0))if(!(a[h+53>>0]|0)){ic(b,d,h);i=c[h+36>>2]|0;if(i)ic(b,d,i);}h=c[h+40>>2]|0}while((h|0)!=0);return}function Lc(a,e){a=a|0;e=e|0;var f=0,g=0,h=0,i=0,j=0;f=c[e>>2]|0;g=a+f|0;h=f>>>1;f=jd(h+2|0,2)|0;c[e+96>>2]=f;if(!f){_b(31448,29944,379,1,31224,c[(La()|0)>>2]|0);i=-1;return i|0}j=a;a=f;while(1){b[a>>1]=(d[j+1>>0]|0)<<8|(d[j>>0]|0);j=j+2|0;if(j>>>0>=g>>>0)break;else a=a+2|0}a=e+4|0;c[a>>2]=(c[a>>2]|0)>>>1;a=e+8|0;c[a>>2]=(c[a>>2]|0)>>>1;c[e>>2]=h;i=0;return i|0}function Mc(a,b,d,e){a=a|0;b=b|0;d=d|0;e=e|0;var f=0,g=0,h=0,j=0,k=0,l=0,m=0;f=i;i=i+8|0;g=f|0;h=((b|0)<0?-1:0)<<1|0;j=b>>31|h;k=((b|0)<0?-1:0)>>31|h;h=((e|0)<0?-1:0)<<1|0;l=e>>31|h;m=((e|0)<0?-1:0)>>31|h;h=Dd(j^a,k^b,j,k)|0;b=D;Hb(h,b,Dd(l^d,m^e,l,m)|0,D,g)|0;m=Dd(c[g>>2]^j,c[g+4>>2]^k,j,k)|0;k=D;i=f;return (D=k,m)|0}function Nc(b,d){b=b|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0;e=b+16|0;f=c[e>>2]|0;g=b+20|0;h=c[g>>2]|0;if((f+1|0)>>>0<h>>>0){i=c[b+8>>2]|0;j=f}else{f=h+8192|0;c[g>>2]=f;g=b+8|0;b=Vc(c[g>>2]|0,f*20|0)|0;c[g>>2]=b;i=b;j=c[e>>2]|0}b=i+(j*20|0)|0;c[b>>2]=3;a[b+4>>0]=0;c[b+8>>2]=d;d=c[e>>2]|0;c[i+(d*20|0)+12>>2]=0;c[e>>2]=d+1;return 0}function Oc(b,d){b=b|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0;e=b+16|0;f=c[e>>2]|0;g=b+20|0;h=c[g>>2]|0;if((f+1|0)>>>0<h>>>0){i=c[b+8>>2]|0;j=f}else{f=h+8192|0;c[g>>2]=f;g=b+8|0;b=Vc(c[g>>2]|0,f*20|0)|0;c[g>>2]=b;i=b;j=c[e>>2]|0}b=i+(j*20|0)|0;c[b>>2]=5;a[b+4>>0]=0;c[b+8>>2]=d;d=c[e>>2]|0;c[i+(d*20|0)+12>>2]=0;c[e>>2]=d+1;return 0}function Pc(b){b=b|0;var d=0,e=0,f=0,g=0,h=0,i=0;d=b+16|0;e=c[d>>2]|0;f=b+20|0;g=c[f>>2]|0;if((e+1|0)>>>0<g>>>0){h=c[b+8>>2]|0;i=e}else{e=g+8192|0;c[f>>2]=e;f=b+8|0;b=Vc(c[f>>2]|0,e*20|0)|0;c[f>>2]=b;h=b;i=c[d>>2]|0}b=h+(i*20|0)|0;c[b>>2]=4;a[b+4>>0]=0;c[b+8>>2]=0;b=c[d>>2]|0;c[h+(b*20|0)+12>>2]=0;c[d>>2]=b+1;return 0}function Qc(a,b){a=a|0;b=b|0;var d=0,e=0,f=0,g=0,h=0.0,j=0;d=i;i=i+112|0;e=d;f=e;g=f+112|0;do{c[f>>2]=0;f=f+4|0}while((f|0)<(g|0));f=e+4|0;c[f>>2]=a;g=e+8|0;c[g>>2]=-1;c[e+44>>2]=a;c[e+76>>2]=-1;rd(e,0);h=+qb(e,1,1);j=(c[f>>2]|0)-(c[g>>2]|0)+(c[e+108>>2]|0)|0;if(!b){i=d;return +h}c[b>>2]=(j|0)!=0?a+j|0:a;i=d;return +h}function Rc(b,d){b=b|0;d=d|0;var f=0,g=0,h=0,i=0;f=a[d>>0]|0;g=c[b+564>>2]|0;h=d+4|0;d=f&255;a[b+52+(d<<5)+10>>0]=c[h>>2];if(!g)return;else i=g;do{if(!(a[i+53>>0]|0))if(((e[i>>1]|0)>>>8|0)==(d|0)){a[i+2>>0]=c[h>>2];ic(b,f,i);g=c[i+36>>2]|0;if(g){a[g+2>>0]=c[h>>2];ic(b,f,g);}}i=c[i+40>>2]|0}while((i|0)!=0);return}function Sc(b){b=b|0;var d=0,e=0,f=0,g=0;d=b+74|0;e=a[d>>0]|0;a[d>>0]=e+255|e;e=b+20|0;d=b+44|0;if((c[e>>2]|0)>>>0>(c[d>>2]|0)>>>0)jb[c[b+36>>2]&1](b,0,0)|0;c[b+16>>2]=0;c[b+28>>2]=0;c[e>>2]=0;e=c[b>>2]|0;if(!(e&20)){f=c[d>>2]|0;c[b+8>>2]=f;c[b+4>>2]=f;g=0;return g|0}if(!(e&4)){g=-1;return g|0}c[b>>2]=e|32;g=-1;return g|0}function Tc(){var d=0,e=0;d=pb(230008)|0;$c(d|0,0,230008)|0;b[d+36>>1]=b[348]|0;oc(d,0);c[d+20>>2]=8192;e=pb(163840)|0;c[d+8>>2]=e;c[d+16>>2]=0;c[d+12>>2]=e;c[d+4>>2]=0;c[d+28>>2]=0;c[d+40>>2]=0;c[d+32>>2]=0;h[d+229984>>3]=1.0;h[d+229976>>3]=0.0;c[d+229968>>2]=0;h[d+229992>>3]=1.0;a[d+23e4>>0]=0;c[d+230004>>2]=0;nc(d,0);return d|0}function Uc(a){a=+a;var b=0,d=0.0,e=0,f=0.0,g=0.0,i=0.0;h[k>>3]=a;b=c[k+4>>2]|0;d=(b|0)<0?-.5:.5;e=b&2147483647;c[k>>2]=c[k>>2];c[k+4>>2]=e;f=+h[k>>3];if(e>>>0>=1082535490){g=d*2.0*+Wd(f);return +g}i=+Kb(f);if(e>>>0>=1072693248){g=d*(i+i/(i+1.0));return +g}if(e>>>0<1045430272){g=a;return +g}g=d*(i*2.0-i*i/(i+1.0));return +g}function Vc(a,b){a=a|0;b=b|0;var d=0,e=0,f=0,g=0;if(!a){d=pb(b)|0;return d|0}if(b>>>0>4294967231){c[(La()|0)>>2]=12;d=0;return d|0}e=Eb(a+-8|0,b>>>0<11?16:b+11&-8)|0;if(e){d=e+8|0;return d|0}e=pb(b)|0;if(!e){d=0;return d|0}f=c[a+-4>>2]|0;g=(f&-8)-((f&3|0)==0?8:4)|0;Wc(e|0,a|0,(g>>>0<b>>>0?g:b)|0)|0;vb(a);d=e;return d|0}function Wc(b,d,e){b=b|0;d=d|0;e=e|0;var f=0;if((e|0)>=4096)return Aa(b|0,d|0,e|0)|0;f=b|0;if((b&3)==(d&3)){while(b&3){if(!e)return f|0;a[b>>0]=a[d>>0]|0;b=b+1|0;d=d+1|0;e=e-1|0}while((e|0)>=4){c[b>>2]=c[d>>2];b=b+4|0;d=d+4|0;e=e-4|0}}while((e|0)>0){a[b>>0]=a[d>>0]|0;b=b+1|0;d=d+1|0;e=e-1|0}return f|0}function Xc(e,f){e=e|0;f=f|0;var g=0,h=0,i=0,j=0;g=c[f>>2]|0;h=e+g|0;i=jd(g+2|0,2)|0;c[f+96>>2]=i;if(!i){_b(31432,29944,227,1,31224,c[(La()|0)>>2]|0);j=-1;return j|0}g=e;e=i;while(1){b[e>>1]=(d[g>>0]|0)<<8^32768;g=g+1|0;if((g|0)==(h|0))break;else e=e+2|0}e=f+32|0;a[e>>0]=(d[e>>0]|0)^2;j=0;return j|0}function Yc(b,c,d){b=b|0;c=c|0;d=d|0;var e=0,f=0,g=0,h=0,i=0,j=0,k=0;e=0;e=0;if(!d){f=0;return f|0}else{g=d;h=b;i=c}while(1){c=a[h>>0]|0;b=a[i>>0]|0;if(c<<24>>24!=b<<24>>24){j=c;k=b;break}g=g+-1|0;if(!g){f=0;e=5;break}else{h=h+1|0;i=i+1|0}}if((e|0)==5)return f|0;f=(j&255)-(k&255)|0;return f|0}function Zc(a,b,c,d){a=a|0;b=b|0;c=c|0;d=d|0;var e=0,f=0,g=0,h=0,i=0;e=((b|0)<0?-1:0)<<1|0;f=b>>31|e;g=((b|0)<0?-1:0)>>31|e;e=((d|0)<0?-1:0)<<1|0;h=d>>31|e;i=((d|0)<0?-1:0)>>31|e;e=Dd(f^a,g^b,f,g)|0;b=D;a=h^f;f=i^g;return Dd((Hb(e,b,Dd(h^c,i^d,h,i)|0,D,0)|0)^a,D^f,a,f)|0}function _c(a,b){a=a|0;b=b|0;var d=0,e=0,f=0;d=i;i=i+16|0;e=d;if((Ja(c[9722]|0,a|0,b|0)|0)<0){a=c[n>>2]|0;c[e>>2]=Xa(c[(La()|0)>>2]|0)|0;Wa(a|0,39568,e|0)|0;ab(c[9722]|0)|0;c[9722]=-1;f=-1;i=d;return f|0}else{c[9746]=(c[9746]|0)+b;f=0;i=d;return f|0}return 0}function $c(b,d,e){b=b|0;d=d|0;e=e|0;var f=0,g=0,h=0,i=0;f=b+e|0;if((e|0)>=20){d=d&255;g=b&3;h=d|d<<8|d<<16|d<<24;i=f&~3;if(g){g=b+4-g|0;while((b|0)<(g|0)){a[b>>0]=d;b=b+1|0}}while((b|0)<(i|0)){c[b>>2]=h;b=b+4|0}}while((b|0)<(f|0)){a[b>>0]=d;b=b+1|0}return b-e|0}function ad(a,e){a=a|0;e=e|0;var f=0,g=0,h=0,i=0;f=c[e>>2]|0;g=a+f|0;h=jd(f+2|0,2)|0;c[e+96>>2]=h;if(!h){_b(31464,29944,77,0,31480,c[(La()|0)>>2]|0);i=-1;return i|0}e=a;a=h;while(1){b[a>>1]=(d[e>>0]|0)<<8;e=e+1|0;if((e|0)==(g|0)){i=0;break}else a=a+2|0}return i|0}function bd(b){b=b|0;var d=0,e=0,f=0;d=b+74|0;e=a[d>>0]|0;a[d>>0]=e+255|e;e=c[b>>2]|0;if(!(e&8)){c[b+8>>2]=0;c[b+4>>2]=0;d=c[b+44>>2]|0;c[b+28>>2]=d;c[b+20>>2]=d;c[b+16>>2]=d+(c[b+48>>2]|0);f=0;return f|0}else{c[b>>2]=e|32;f=-1;return f|0}return 0}function cd(b){b=b|0;a[k>>0]=a[b>>0];a[k+1>>0]=a[b+1>>0];a[k+2>>0]=a[b+2>>0];a[k+3>>0]=a[b+3>>0];a[k+4>>0]=a[b+4>>0];a[k+5>>0]=a[b+5>>0];a[k+6>>0]=a[b+6>>0];a[k+7>>0]=a[b+7>>0]}function dd(d,e){d=d|0;e=e|0;var f=0,g=0;f=a[e>>0]|0;e=f&255;g=d+52+(e<<5)|0;a[g+11>>0]=127;a[g+10>>0]=127;b[g+28>>1]=-1;b[g+20>>1]=200;b[g+18>>1]=0;c[g+24>>2]=0;a[g+8>>0]=0;Kc(d,f);return}function ed(b,f){b=b|0;f=f|0;var g=0;g=c[b+564>>2]|0;if(!g)return;b=d[f>>0]|0;f=g;do{if(((e[f>>1]|0)>>>8|0)==(b|0)){a[f+34>>0]=0;g=f+36|0;if(c[g>>2]|0)c[g>>2]=0}f=c[f+40>>2]|0}while((f|0)!=0);return}function fd(a,b){a=+a;b=+b;var d=0,e=0,f=0;h[k>>3]=a;d=c[k>>2]|0;e=c[k+4>>2]|0;h[k>>3]=b;f=c[k+4>>2]&-2147483648|e&2147483647;c[k>>2]=d;c[k+4>>2]=f;return +(+h[k>>3]);}function gd(a){a=a|0;var b=0,e=0,f=0,g=0;b=0;b=0;e=i;i=i+16|0;f=e;if(!(c[a+8>>2]|0))if(!(Sc(a)|0))b=3;else g=-1;else b=3;if((b|0)==3)if((jb[c[a+32>>2]&1](a,f,1)|0)==1)g=d[f>>0]|0;else g=-1;i=e;return g|0}function hd(a,b){a=a|0;b=b|0;var c=0,d=0,e=0,f=0;c=a&65535;d=b&65535;e=$(d,c)|0;f=a>>>16;a=(e>>>16)+($(d,f)|0)|0;d=b>>>16;b=$(d,c)|0;return (D=(a>>>16)+($(d,f)|0)+(((a&65535)+b|0)>>>16)|0,a+b<<16|e&65535|0)|0}function id(b,e){b=b|0;e=e|0;var f=0,g=0,h=0;f=d[e>>0]|0;g=b+52+(f<<5)|0;h=c[e+4>>2]|0;if(!(a[b+52+(f<<5)+31>>0]|0)){c[b+52+(f<<5)+4>>2]=uc(b,(d[g>>0]<<8|h)&65535)|0;return}else{a[g>>0]=h;return}}function jd(a,b){a=a|0;b=b|0;var d=0,e=0;if(!a)d=0;else{e=$(b,a)|0;if((b|a)>>>0>65535)d=((e>>>0)/(a>>>0)|0|0)==(b|0)?e:-1;else d=e}e=pb(d)|0;if(!e)return e|0;if(!(c[e+-4>>2]&3))return e|0;$c(e|0,0,d|0)|0;return e|0}function kd(b,c,d){b=b|0;c=c|0;d=d|0;var e=0,f=0,g=0;e=0;e=0;f=c&255;c=d;while(1){if(!c){g=0;e=4;break}c=c+-1|0;d=b+c|0;if((a[d>>0]|0)==f<<24>>24){g=d;e=4;break}}if((e|0)==4)return g|0;return 0}function ld(e,f){e=e|0;f=f|0;var g=0,h=0;g=d[f>>0]|0;if(a[e+52+(g<<5)+30>>0]|0)return;if(b[e+52+(g<<5)+28>>1]|0)return;h=e+52+(g<<5)+20|0;g=b[h>>1]|0;b[h>>1]=g-((g|0)%100|0)+(c[f+4>>2]|0);return}function md(a){a=a|0;var d=0;if(!(c[208]|0)){_b(968,784,1565,8,0,0);d=-1;return d|0}if(a<<24>>24<0){_b(968,784,1569,9,992,0);d=-1;return d|0}else{b[384]=b[31496+((a&255)<<1)>>1]|0;d=0;return d|0}return 0}function nd(e,f){e=e|0;f=f|0;var g=0,h=0;g=d[f>>0]|0;if(a[e+52+(g<<5)+30>>0]|0)return;if(b[e+52+(g<<5)+28>>1]|0)return;h=e+52+(g<<5)+20|0;b[h>>1]=((c[f+4>>2]|0)*100|0)+((b[h>>1]|0)%100|0);return}function od(c,e){c=c|0;e=e|0;var f=0;f=d[e>>0]|0;if(a[c+52+(f<<5)+30>>0]|0)return;if(b[c+52+(f<<5)+28>>1]|0)return;e=c+52+(f<<5)+20|0;f=b[e>>1]|0;if(f<<16>>16>=16383)return;b[e>>1]=f+1<<16>>16;return}function pd(c,e){c=c|0;e=e|0;var f=0;f=d[e>>0]|0;if(a[c+52+(f<<5)+30>>0]|0)return;if(b[c+52+(f<<5)+28>>1]|0)return;e=c+52+(f<<5)+20|0;f=b[e>>1]|0;if(f<<16>>16<=0)return;b[e>>1]=f+-1<<16>>16;return}function qd(b){b=b|0;var c=0;c=a[m+(b&255)>>0]|0;if((c|0)<8)return c|0;c=a[m+(b>>8&255)>>0]|0;if((c|0)<8)return c+8|0;c=a[m+(b>>16&255)>>0]|0;if((c|0)<8)return c+16|0;return (a[m+(b>>>24)>>0]|0)+24|0}function rd(a,b){a=a|0;b=b|0;var d=0,e=0,f=0;c[a+104>>2]=b;d=c[a+4>>2]|0;e=c[a+8>>2]|0;f=e-d|0;c[a+108>>2]=f;if((b|0)!=0&(f|0)>(b|0)){c[a+100>>2]=d+b;return}else{c[a+100>>2]=e;return}}function sd(b,e){b=b|0;e=e|0;var f=0,g=0,h=0;f=d[e>>0]|0;g=b+52+(f<<5)+31|0;if(!(c[e+4>>2]|0)){a[g>>0]=0;h=uc(b,0)|0}else{a[g>>0]=1;h=0}c[b+52+(f<<5)+4>>2]=h;return}function td(a,b,d){a=a|0;b=b|0;d=d|0;var e=0,f=0,g=0;e=a+20|0;f=c[e>>2]|0;g=(c[a+16>>2]|0)-f|0;a=g>>>0>d>>>0?d:g;Wc(f|0,b|0,a|0)|0;c[e>>2]=(c[e>>2]|0)+a;return d|0}function ud(a,b){a=a|0;b=b|0;var d=0,e=0,f=0;d=i;i=i+16|0;e=d;f=c[n>>2]|0;Sa(13,f|0)|0;c[e>>2]=b;qa(f|0,a|0,e|0)|0;Sa(10,f|0)|0;i=d;return}function vd(a,b,d,e){a=a|0;b=b|0;d=d|0;e=e|0;var f=0,g=0;f=i;i=i+8|0;g=f|0;Hb(a,b,d,e,g)|0;i=f;return (D=c[g+4>>2]|0,c[g>>2]|0)|0}function wd(f,g){f=f|0;g=g|0;var h=0,i=0;h=d[g>>0]|0;i=f+52+(h<<5)|0;h=i+28|0;b[h>>1]=e[h>>1]&127|c[g+4>>2]<<7;a[i+30>>0]=1;return}function xd(f,g){f=f|0;g=g|0;var h=0,i=0;h=d[g>>0]|0;i=f+52+(h<<5)|0;h=i+28|0;b[h>>1]=e[h>>1]&127|c[g+4>>2]<<7;a[i+30>>0]=0;return}function yd(f,g){f=f|0;g=g|0;var h=0,i=0;h=d[g>>0]|0;i=f+52+(h<<5)|0;h=i+28|0;b[h>>1]=e[h>>1]&16256|c[g+4>>2];a[i+30>>0]=1;return}function zd(b,c,d){b=b|0;c=c|0;d=d|0;var e=0,f=0,g=0;while((e|0)<(d|0)){f=c+e|0;a[b+e>>0]=g?0:a[f>>0]|0;g=g?1:(a[f>>0]|0)==0;e=e+1|0}return b|0}function Ad(f,g){f=f|0;g=g|0;var h=0,i=0;h=d[g>>0]|0;i=f+52+(h<<5)|0;h=i+28|0;b[h>>1]=e[h>>1]&16256|c[g+4>>2];a[i+30>>0]=0;return}function Bd(a,b,c,d){a=a|0;b=b|0;c=c|0;d=d|0;var e=0,f=0;e=a;a=c;c=hd(e,a)|0;f=D;return (D=($(b,a)|0)+($(d,e)|0)+f|f&0,c|0|0)|0}function Cd(){}function Dd(a,b,c,d){a=a|0;b=b|0;c=c|0;d=d|0;var e=0;e=b-d|0;d=(e|0)>>>0;d=(e|0)-(c>>>0>a>>>0|0)>>>0;return (D=d,a-c>>>0|0)|0}function Ed(b){b=b|0;a[k>>0]=a[b>>0];a[k+1>>0]=a[b+1>>0];a[k+2>>0]=a[b+2>>0];a[k+3>>0]=a[b+3>>0]}function Fd(a,b,c){a=a|0;b=b|0;c=c|0;if((c|0)<32){D=b>>c;return a>>>c|(b&(1<<c)-1)<<32-c}D=(b|0)<0?-1:0;return b>>c-32|0}function Gd(a,b,d){a=a|0;b=b|0;d=d|0;var e=0,f=0;e=i;i=i+16|0;f=e;c[f>>2]=d;d=fe(a,b,f)|0;i=e;return d|0}function Hd(a){a=a|0;var c=0,d=0;Xd(776);c=a&65535;if((c|0)==32)d=b[391]|0;else if((c|0)==16)d=b[390]|0;else d=0;ae(776);return d|0}function Id(b,c){b=b|0;c=c|0;var d=0,e=0;d=b+(ce(b)|0)|0;do{a[d+e>>0]=a[c+e>>0];e=e+1|0}while(a[c+(e-1)>>0]|0);return b|0}function Jd(b,d){b=b|0;d=d|0;var e=0;e=a[d>>0]|0;a[b+52+((e&255)<<5)+11>>0]=c[d+4>>2];Kc(b,e);return}function Kd(b,d){b=b|0;d=d|0;var e=0;e=a[d>>0]|0;a[b+52+((e&255)<<5)+12>>0]=c[d+4>>2];Kc(b,e);return}function Ld(a,b,c){a=a|0;b=b|0;c=c|0;if((c|0)<32){D=b<<c|(a&(1<<c)-1<<32-c)>>>32-c;return a<<c}D=a<<c-32;return 0}function Md(b,d){b=b|0;d=d|0;var e=0;e=a[d>>0]|0;a[b+52+((e&255)<<5)+9>>0]=c[d+4>>2];Kc(b,e);return}function Nd(b,d){b=b|0;d=d|0;var e=0;e=a[d>>0]|0;a[b+52+((e&255)<<5)+13>>0]=c[d+4>>2];Kc(b,e);return}function Od(a,b,c){a=a|0;b=b|0;c=c|0;if((c|0)<32){D=b>>>c;return a>>>c|(b&(1<<c)-1)<<32-c}D=0;return b>>>c-32|0}function Pd(a,b,c,d){a=a|0;b=b|0;c=c|0;d=d|0;var e=0;e=a+c>>>0;return (D=b+d+(e>>>0<a>>>0|0)>>>0,e|0)|0}function Qd(b,c){b=b|0;c=c|0;var d=0;do{a[b+d>>0]=a[c+d>>0];d=d+1|0}while(a[c+(d-1)>>0]|0);return b|0}function Rd(a,d){a=a|0;d=d|0;if((b[a+36>>1]|0)>=0)return;c[a+230004>>2]=c[d+4>>2];return}function Sd(a,d){a=a|0;d=d|0;if((b[a+36>>1]|0)<0)return;c[a+230004>>2]=c[d+4>>2];return}function Td(a,b,c,d){a=a|0;b=b|0;c=c|0;d=d|0;return jb[a&1](b|0,c|0,d|0)|0}function Ud(b,e){b=b|0;e=e|0;a[b+52+((d[e>>0]|0)<<5)>>0]=c[e+4>>2];return}function Vd(a){a=a|0;if(!a)return;vb(c[a+2496>>2]|0);vb(c[a+2500>>2]|0);vb(a);return}function Wd(a){a=+a;return +(+Y(+(a+-1416.0996898839683))*2247116418577894884661631.0e283*2247116418577894884661631.0e283);}function Xd(a){a=a|0;if(c[a>>2]|0)do sa(500)|0;while((c[a>>2]|0)!=0);c[a>>2]=1;return}function Yd(a){a=a|0;var b=0;b=i;i=i+a|0;i=i+15&-16;return b|0}function Zd(a,b){a=a|0;b=b|0;return +(+(b>>>0)/+(a>>>0)/1.0e6*+(e[380]|0|0));}function _d(a,b,c,d){a=a|0;b=b|0;c=c|0;d=d|0;return Hb(a,b,c,d,0)|0}function $d(a,b){a=a|0;b=b|0;var c=0;if(!a)c=0;else c=xc(a,b,0)|0;return c|0}function ae(a){a=a|0;var b=0;b=c[a>>2]|0;if(!b)return;c[a>>2]=b+-1;return}function be(a,b,c){a=a|0;b=b|0;c=c|0;return lb[a&31](b|0,c|0)|0}function ce(b){b=b|0;var c=0;c=b;while(a[c>>0]|0)c=c+1|0;return c-b|0}function de(a,b){a=a|0;b=b|0;cb(5,a|0,b|0)|0;return 0}function ee(a,b,c){a=a|0;b=b|0;c=c|0;kb[a&63](b|0,c|0);}function fe(a,b,c){a=a|0;b=b|0;c=c|0;return fc(a,2147483647,b,c)|0}function ge(){var a=0;a=c[2]|0;if(!a)return;vb(a);c[2]=0;return}function he(a,b){a=a|0;b=b|0;return kd(a,b,(ce(a|0)|0)+1|0)|0}function ie(a,b){a=a|0;b=b|0;if(!o){o=a;p=b}}function je(a){a=a|0;var b=0;b=(Ee(a)|0)==0;return (b?a:a|32)|0}function ke(a,b){a=a|0;b=b|0;nc(a,0);return}function le(a,b){a=a|0;b=b|0;i=a;j=b}function me(a){a=a|0;return ((a|0)==32|(a+-9|0)>>>0<5)&1|0}function ne(a,b,c){a=a|0;b=b|0;c=c|0;ca(0);return 0}function oe(a,b){a=a|0;b=b|0;return}function pe(a,b){a=+a;b=+b;return +(+fd(a,b));}function qe(a,b){a=a|0;b=b|0;return}function re(a,b){a=a|0;b=b|0;return}function se(a,b){a=+a;b=b|0;return +(+Cc(a,b));}function te(a,b){a=a|0;b=b|0;return}function ue(a,b){a=a|0;b=b|0;return}function ve(a,b){a=+a;b=b|0;return +(+Hc(a,b));}function we(a,b){a=a|0;b=b|0;return}function xe(a,b){a=a|0;b=b|0;return}function ye(a,b){a=a|0;b=b|0;return}function ze(a,b){a=a|0;b=b|0;return}function Ae(a,b){a=a|0;b=b|0;return}function Be(a,b){a=a|0;b=b|0;return}function Ce(a,b){a=a|0;b=b|0;return}function De(a,b){a=a|0;b=b|0;return}function Ee(a){a=a|0;return (a+-65|0)>>>0<26|0}function Fe(a,b){a=a|0;b=b|0;return}function Ge(a,b){a=+a;b=+b;return +(+Fb(a,b));}function He(a,b){a=a|0;b=b|0;return}function Ie(a,b){a=a|0;b=b|0;ca(2);return 0}function Je(a){a=a|0;return +(+Qc(a,0));}function Ke(a){a=a|0;fb=a}function Le(a,b){a=a|0;b=b|0;ca(1);}function Me(a){a=a|0;i=a}function Ne(a){a=a|0;D=a}function Oe(){return c[2]|0}function Pe(){return gb|0}function Qe(){return 1024}function Re(){return D|0}function Se(){return i|0}
-
-// EMSCRIPTEN_END_FUNCS
-var jb=[ne,td];var kb=[Le,Ib,vc,ze,ye,He,Rd,Be,Ae,oe,Sd,Fe,Ce,Dc,De,id,Rc,mc,we,re,xe,ue,qe,te,sd,ke,nd,Ud,Md,Kd,Nd,Jd,ld,Zb,od,pd,yd,wd,Ad,xd,ed,dd,Bc,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le,Le];var lb=[Ie,ad,Lc,Xc,Ec,Ub,Ob,Tb,Nb,Ac,qc,yc,pc,Vb,Rb,Sb,Qb,_c,de,Ie,Ie,Ie,Ie,Ie,Ie,Ie,Ie,Ie,Ie,Ie,Ie,Ie];return{_i64Subtract:Dd,_strcat:Id,_free:vb,_strncpy:zd,_strlen:ce,_memset:$c,_malloc:pb,_i64Add:Pd,_memcpy:Wc,_wildwebmidi:Cb,_bitshift64Lshr:Od,_strcpy:Qd,_bitshift64Shl:Ld,runPostSets:Cd,stackAlloc:Yd,stackSave:Se,stackRestore:Me,establishStackSpace:le,setThrew:ie,setTempRet0:Ne,getTempRet0:Re,emterpret:mb,setAsyncState:Ke,emtStackSave:Pe,dynCall_iiii:Td,dynCall_vii:ee,dynCall_iii:be}})
-
-
-// EMSCRIPTEN_END_ASM
-(Module.asmGlobalArg,Module.asmLibraryArg,buffer);var _i64Subtract=Module["_i64Subtract"]=asm["_i64Subtract"];var _strcat=Module["_strcat"]=asm["_strcat"];var _free=Module["_free"]=asm["_free"];var runPostSets=Module["runPostSets"]=asm["runPostSets"];var _strncpy=Module["_strncpy"]=asm["_strncpy"];var _strlen=Module["_strlen"]=asm["_strlen"];var _memset=Module["_memset"]=asm["_memset"];var _malloc=Module["_malloc"]=asm["_malloc"];var _i64Add=Module["_i64Add"]=asm["_i64Add"];var _memcpy=Module["_memcpy"]=asm["_memcpy"];var _wildwebmidi=Module["_wildwebmidi"]=asm["_wildwebmidi"];var _bitshift64Lshr=Module["_bitshift64Lshr"]=asm["_bitshift64Lshr"];var _strcpy=Module["_strcpy"]=asm["_strcpy"];var _bitshift64Shl=Module["_bitshift64Shl"]=asm["_bitshift64Shl"];var dynCall_iiii=Module["dynCall_iiii"]=asm["dynCall_iiii"];var dynCall_vii=Module["dynCall_vii"]=asm["dynCall_vii"];var dynCall_iii=Module["dynCall_iii"]=asm["dynCall_iii"];Runtime.stackAlloc=asm["stackAlloc"];Runtime.stackSave=asm["stackSave"];Runtime.stackRestore=asm["stackRestore"];Runtime.establishStackSpace=asm["establishStackSpace"];Runtime.setTempRet0=asm["setTempRet0"];Runtime.getTempRet0=asm["getTempRet0"];var i64Math=(function(){var goog={math:{}};goog.math.Long=(function(low,high){this.low_=low|0;this.high_=high|0});goog.math.Long.IntCache_={};goog.math.Long.fromInt=(function(value){if(-128<=value&&value<128){var cachedObj=goog.math.Long.IntCache_[value];if(cachedObj){return cachedObj}}var obj=new goog.math.Long(value|0,value<0?-1:0);if(-128<=value&&value<128){goog.math.Long.IntCache_[value]=obj}return obj});goog.math.Long.fromNumber=(function(value){if(isNaN(value)||!isFinite(value)){return goog.math.Long.ZERO}else if(value<=-goog.math.Long.TWO_PWR_63_DBL_){return goog.math.Long.MIN_VALUE}else if(value+1>=goog.math.Long.TWO_PWR_63_DBL_){return goog.math.Long.MAX_VALUE}else if(value<0){return goog.math.Long.fromNumber(-value).negate()}else{return new goog.math.Long(value%goog.math.Long.TWO_PWR_32_DBL_|0,value/goog.math.Long.TWO_PWR_32_DBL_|0)}});goog.math.Long.fromBits=(function(lowBits,highBits){return new goog.math.Long(lowBits,highBits)});goog.math.Long.fromString=(function(str,opt_radix){if(str.length==0){throw Error("number format error: empty string")}var radix=opt_radix||10;if(radix<2||36<radix){throw Error("radix out of range: "+radix)}if(str.charAt(0)=="-"){return goog.math.Long.fromString(str.substring(1),radix).negate()}else if(str.indexOf("-")>=0){throw Error('number format error: interior "-" character: '+str)}var radixToPower=goog.math.Long.fromNumber(Math.pow(radix,8));var result=goog.math.Long.ZERO;for(var i=0;i<str.length;i+=8){var size=Math.min(8,str.length-i);var value=parseInt(str.substring(i,i+size),radix);if(size<8){var power=goog.math.Long.fromNumber(Math.pow(radix,size));result=result.multiply(power).add(goog.math.Long.fromNumber(value))}else{result=result.multiply(radixToPower);result=result.add(goog.math.Long.fromNumber(value))}}return result});goog.math.Long.TWO_PWR_16_DBL_=1<<16;goog.math.Long.TWO_PWR_24_DBL_=1<<24;goog.math.Long.TWO_PWR_32_DBL_=goog.math.Long.TWO_PWR_16_DBL_*goog.math.Long.TWO_PWR_16_DBL_;goog.math.Long.TWO_PWR_31_DBL_=goog.math.Long.TWO_PWR_32_DBL_/2;goog.math.Long.TWO_PWR_48_DBL_=goog.math.Long.TWO_PWR_32_DBL_*goog.math.Long.TWO_PWR_16_DBL_;goog.math.Long.TWO_PWR_64_DBL_=goog.math.Long.TWO_PWR_32_DBL_*goog.math.Long.TWO_PWR_32_DBL_;goog.math.Long.TWO_PWR_63_DBL_=goog.math.Long.TWO_PWR_64_DBL_/2;goog.math.Long.ZERO=goog.math.Long.fromInt(0);goog.math.Long.ONE=goog.math.Long.fromInt(1);goog.math.Long.NEG_ONE=goog.math.Long.fromInt(-1);goog.math.Long.MAX_VALUE=goog.math.Long.fromBits(4294967295|0,2147483647|0);goog.math.Long.MIN_VALUE=goog.math.Long.fromBits(0,2147483648|0);goog.math.Long.TWO_PWR_24_=goog.math.Long.fromInt(1<<24);goog.math.Long.prototype.toInt=(function(){return this.low_});goog.math.Long.prototype.toNumber=(function(){return this.high_*goog.math.Long.TWO_PWR_32_DBL_+this.getLowBitsUnsigned()});goog.math.Long.prototype.toString=(function(opt_radix){var radix=opt_radix||10;if(radix<2||36<radix){throw Error("radix out of range: "+radix)}if(this.isZero()){return"0"}if(this.isNegative()){if(this.equals(goog.math.Long.MIN_VALUE)){var radixLong=goog.math.Long.fromNumber(radix);var div=this.div(radixLong);var rem=div.multiply(radixLong).subtract(this);return div.toString(radix)+rem.toInt().toString(radix)}else{return"-"+this.negate().toString(radix)}}var radixToPower=goog.math.Long.fromNumber(Math.pow(radix,6));var rem=this;var result="";while(true){var remDiv=rem.div(radixToPower);var intval=rem.subtract(remDiv.multiply(radixToPower)).toInt();var digits=intval.toString(radix);rem=remDiv;if(rem.isZero()){return digits+result}else{while(digits.length<6){digits="0"+digits}result=""+digits+result}}});goog.math.Long.prototype.getHighBits=(function(){return this.high_});goog.math.Long.prototype.getLowBits=(function(){return this.low_});goog.math.Long.prototype.getLowBitsUnsigned=(function(){return this.low_>=0?this.low_:goog.math.Long.TWO_PWR_32_DBL_+this.low_});goog.math.Long.prototype.getNumBitsAbs=(function(){if(this.isNegative()){if(this.equals(goog.math.Long.MIN_VALUE)){return 64}else{return this.negate().getNumBitsAbs()}}else{var val=this.high_!=0?this.high_:this.low_;for(var bit=31;bit>0;bit--){if((val&1<<bit)!=0){break}}return this.high_!=0?bit+33:bit+1}});goog.math.Long.prototype.isZero=(function(){return this.high_==0&&this.low_==0});goog.math.Long.prototype.isNegative=(function(){return this.high_<0});goog.math.Long.prototype.isOdd=(function(){return(this.low_&1)==1});goog.math.Long.prototype.equals=(function(other){return this.high_==other.high_&&this.low_==other.low_});goog.math.Long.prototype.notEquals=(function(other){return this.high_!=other.high_||this.low_!=other.low_});goog.math.Long.prototype.lessThan=(function(other){return this.compare(other)<0});goog.math.Long.prototype.lessThanOrEqual=(function(other){return this.compare(other)<=0});goog.math.Long.prototype.greaterThan=(function(other){return this.compare(other)>0});goog.math.Long.prototype.greaterThanOrEqual=(function(other){return this.compare(other)>=0});goog.math.Long.prototype.compare=(function(other){if(this.equals(other)){return 0}var thisNeg=this.isNegative();var otherNeg=other.isNegative();if(thisNeg&&!otherNeg){return-1}if(!thisNeg&&otherNeg){return 1}if(this.subtract(other).isNegative()){return-1}else{return 1}});goog.math.Long.prototype.negate=(function(){if(this.equals(goog.math.Long.MIN_VALUE)){return goog.math.Long.MIN_VALUE}else{return this.not().add(goog.math.Long.ONE)}});goog.math.Long.prototype.add=(function(other){var a48=this.high_>>>16;var a32=this.high_&65535;var a16=this.low_>>>16;var a00=this.low_&65535;var b48=other.high_>>>16;var b32=other.high_&65535;var b16=other.low_>>>16;var b00=other.low_&65535;var c48=0,c32=0,c16=0,c00=0;c00+=a00+b00;c16+=c00>>>16;c00&=65535;c16+=a16+b16;c32+=c16>>>16;c16&=65535;c32+=a32+b32;c48+=c32>>>16;c32&=65535;c48+=a48+b48;c48&=65535;return goog.math.Long.fromBits(c16<<16|c00,c48<<16|c32)});goog.math.Long.prototype.subtract=(function(other){return this.add(other.negate())});goog.math.Long.prototype.multiply=(function(other){if(this.isZero()){return goog.math.Long.ZERO}else if(other.isZero()){return goog.math.Long.ZERO}if(this.equals(goog.math.Long.MIN_VALUE)){return other.isOdd()?goog.math.Long.MIN_VALUE:goog.math.Long.ZERO}else if(other.equals(goog.math.Long.MIN_VALUE)){return this.isOdd()?goog.math.Long.MIN_VALUE:goog.math.Long.ZERO}if(this.isNegative()){if(other.isNegative()){return this.negate().multiply(other.negate())}else{return this.negate().multiply(other).negate()}}else if(other.isNegative()){return this.multiply(other.negate()).negate()}if(this.lessThan(goog.math.Long.TWO_PWR_24_)&&other.lessThan(goog.math.Long.TWO_PWR_24_)){return goog.math.Long.fromNumber(this.toNumber()*other.toNumber())}var a48=this.high_>>>16;var a32=this.high_&65535;var a16=this.low_>>>16;var a00=this.low_&65535;var b48=other.high_>>>16;var b32=other.high_&65535;var b16=other.low_>>>16;var b00=other.low_&65535;var c48=0,c32=0,c16=0,c00=0;c00+=a00*b00;c16+=c00>>>16;c00&=65535;c16+=a16*b00;c32+=c16>>>16;c16&=65535;c16+=a00*b16;c32+=c16>>>16;c16&=65535;c32+=a32*b00;c48+=c32>>>16;c32&=65535;c32+=a16*b16;c48+=c32>>>16;c32&=65535;c32+=a00*b32;c48+=c32>>>16;c32&=65535;c48+=a48*b00+a32*b16+a16*b32+a00*b48;c48&=65535;return goog.math.Long.fromBits(c16<<16|c00,c48<<16|c32)});goog.math.Long.prototype.div=(function(other){if(other.isZero()){throw Error("division by zero")}else if(this.isZero()){return goog.math.Long.ZERO}if(this.equals(goog.math.Long.MIN_VALUE)){if(other.equals(goog.math.Long.ONE)||other.equals(goog.math.Long.NEG_ONE)){return goog.math.Long.MIN_VALUE}else if(other.equals(goog.math.Long.MIN_VALUE)){return goog.math.Long.ONE}else{var halfThis=this.shiftRight(1);var approx=halfThis.div(other).shiftLeft(1);if(approx.equals(goog.math.Long.ZERO)){return other.isNegative()?goog.math.Long.ONE:goog.math.Long.NEG_ONE}else{var rem=this.subtract(other.multiply(approx));var result=approx.add(rem.div(other));return result}}}else if(other.equals(goog.math.Long.MIN_VALUE)){return goog.math.Long.ZERO}if(this.isNegative()){if(other.isNegative()){return this.negate().div(other.negate())}else{return this.negate().div(other).negate()}}else if(other.isNegative()){return this.div(other.negate()).negate()}var res=goog.math.Long.ZERO;var rem=this;while(rem.greaterThanOrEqual(other)){var approx=Math.max(1,Math.floor(rem.toNumber()/other.toNumber()));var log2=Math.ceil(Math.log(approx)/Math.LN2);var delta=log2<=48?1:Math.pow(2,log2-48);var approxRes=goog.math.Long.fromNumber(approx);var approxRem=approxRes.multiply(other);while(approxRem.isNegative()||approxRem.greaterThan(rem)){approx-=delta;approxRes=goog.math.Long.fromNumber(approx);approxRem=approxRes.multiply(other)}if(approxRes.isZero()){approxRes=goog.math.Long.ONE}res=res.add(approxRes);rem=rem.subtract(approxRem)}return res});goog.math.Long.prototype.modulo=(function(other){return this.subtract(this.div(other).multiply(other))});goog.math.Long.prototype.not=(function(){return goog.math.Long.fromBits(~this.low_,~this.high_)});goog.math.Long.prototype.and=(function(other){return goog.math.Long.fromBits(this.low_&other.low_,this.high_&other.high_)});goog.math.Long.prototype.or=(function(other){return goog.math.Long.fromBits(this.low_|other.low_,this.high_|other.high_)});goog.math.Long.prototype.xor=(function(other){return goog.math.Long.fromBits(this.low_^other.low_,this.high_^other.high_)});goog.math.Long.prototype.shiftLeft=(function(numBits){numBits&=63;if(numBits==0){return this}else{var low=this.low_;if(numBits<32){var high=this.high_;return goog.math.Long.fromBits(low<<numBits,high<<numBits|low>>>32-numBits)}else{return goog.math.Long.fromBits(0,low<<numBits-32)}}});goog.math.Long.prototype.shiftRight=(function(numBits){numBits&=63;if(numBits==0){return this}else{var high=this.high_;if(numBits<32){var low=this.low_;return goog.math.Long.fromBits(low>>>numBits|high<<32-numBits,high>>numBits)}else{return goog.math.Long.fromBits(high>>numBits-32,high>=0?0:-1)}}});goog.math.Long.prototype.shiftRightUnsigned=(function(numBits){numBits&=63;if(numBits==0){return this}else{var high=this.high_;if(numBits<32){var low=this.low_;return goog.math.Long.fromBits(low>>>numBits|high<<32-numBits,high>>>numBits)}else if(numBits==32){return goog.math.Long.fromBits(high,0)}else{return goog.math.Long.fromBits(high>>>numBits-32,0)}}});var navigator={appName:"Modern Browser"};var dbits;var canary=0xdeadbeefcafe;var j_lm=(canary&16777215)==15715070;function BigInteger(a,b,c){if(a!=null)if("number"==typeof a)this.fromNumber(a,b,c);else if(b==null&&"string"!=typeof a)this.fromString(a,256);else this.fromString(a,b)}function nbi(){return new BigInteger(null)}function am1(i,x,w,j,c,n){while(--n>=0){var v=x*this[i++]+w[j]+c;c=Math.floor(v/67108864);w[j++]=v&67108863}return c}function am2(i,x,w,j,c,n){var xl=x&32767,xh=x>>15;while(--n>=0){var l=this[i]&32767;var h=this[i++]>>15;var m=xh*l+h*xl;l=xl*l+((m&32767)<<15)+w[j]+(c&1073741823);c=(l>>>30)+(m>>>15)+xh*h+(c>>>30);w[j++]=l&1073741823}return c}function am3(i,x,w,j,c,n){var xl=x&16383,xh=x>>14;while(--n>=0){var l=this[i]&16383;var h=this[i++]>>14;var m=xh*l+h*xl;l=xl*l+((m&16383)<<14)+w[j]+c;c=(l>>28)+(m>>14)+xh*h;w[j++]=l&268435455}return c}if(j_lm&&navigator.appName=="Microsoft Internet Explorer"){BigInteger.prototype.am=am2;dbits=30}else if(j_lm&&navigator.appName!="Netscape"){BigInteger.prototype.am=am1;dbits=26}else{BigInteger.prototype.am=am3;dbits=28}BigInteger.prototype.DB=dbits;BigInteger.prototype.DM=(1<<dbits)-1;BigInteger.prototype.DV=1<<dbits;var BI_FP=52;BigInteger.prototype.FV=Math.pow(2,BI_FP);BigInteger.prototype.F1=BI_FP-dbits;BigInteger.prototype.F2=2*dbits-BI_FP;var BI_RM="0123456789abcdefghijklmnopqrstuvwxyz";var BI_RC=new Array;var rr,vv;rr="0".charCodeAt(0);for(vv=0;vv<=9;++vv)BI_RC[rr++]=vv;rr="a".charCodeAt(0);for(vv=10;vv<36;++vv)BI_RC[rr++]=vv;rr="A".charCodeAt(0);for(vv=10;vv<36;++vv)BI_RC[rr++]=vv;function int2char(n){return BI_RM.charAt(n)}function intAt(s,i){var c=BI_RC[s.charCodeAt(i)];return c==null?-1:c}function bnpCopyTo(r){for(var i=this.t-1;i>=0;--i)r[i]=this[i];r.t=this.t;r.s=this.s}function bnpFromInt(x){this.t=1;this.s=x<0?-1:0;if(x>0)this[0]=x;else if(x<-1)this[0]=x+DV;else this.t=0}function nbv(i){var r=nbi();r.fromInt(i);return r}function bnpFromString(s,b){var k;if(b==16)k=4;else if(b==8)k=3;else if(b==256)k=8;else if(b==2)k=1;else if(b==32)k=5;else if(b==4)k=2;else{this.fromRadix(s,b);return}this.t=0;this.s=0;var i=s.length,mi=false,sh=0;while(--i>=0){var x=k==8?s[i]&255:intAt(s,i);if(x<0){if(s.charAt(i)=="-")mi=true;continue}mi=false;if(sh==0)this[this.t++]=x;else if(sh+k>this.DB){this[this.t-1]|=(x&(1<<this.DB-sh)-1)<<sh;this[this.t++]=x>>this.DB-sh}else this[this.t-1]|=x<<sh;sh+=k;if(sh>=this.DB)sh-=this.DB}if(k==8&&(s[0]&128)!=0){this.s=-1;if(sh>0)this[this.t-1]|=(1<<this.DB-sh)-1<<sh}this.clamp();if(mi)BigInteger.ZERO.subTo(this,this)}function bnpClamp(){var c=this.s&this.DM;while(this.t>0&&this[this.t-1]==c)--this.t}function bnToString(b){if(this.s<0)return"-"+this.negate().toString(b);var k;if(b==16)k=4;else if(b==8)k=3;else if(b==2)k=1;else if(b==32)k=5;else if(b==4)k=2;else return this.toRadix(b);var km=(1<<k)-1,d,m=false,r="",i=this.t;var p=this.DB-i*this.DB%k;if(i-->0){if(p<this.DB&&(d=this[i]>>p)>0){m=true;r=int2char(d)}while(i>=0){if(p<k){d=(this[i]&(1<<p)-1)<<k-p;d|=this[--i]>>(p+=this.DB-k)}else{d=this[i]>>(p-=k)&km;if(p<=0){p+=this.DB;--i}}if(d>0)m=true;if(m)r+=int2char(d)}}return m?r:"0"}function bnNegate(){var r=nbi();BigInteger.ZERO.subTo(this,r);return r}function bnAbs(){return this.s<0?this.negate():this}function bnCompareTo(a){var r=this.s-a.s;if(r!=0)return r;var i=this.t;r=i-a.t;if(r!=0)return this.s<0?-r:r;while(--i>=0)if((r=this[i]-a[i])!=0)return r;return 0}function nbits(x){var r=1,t;if((t=x>>>16)!=0){x=t;r+=16}if((t=x>>8)!=0){x=t;r+=8}if((t=x>>4)!=0){x=t;r+=4}if((t=x>>2)!=0){x=t;r+=2}if((t=x>>1)!=0){x=t;r+=1}return r}function bnBitLength(){if(this.t<=0)return 0;return this.DB*(this.t-1)+nbits(this[this.t-1]^this.s&this.DM)}function bnpDLShiftTo(n,r){var i;for(i=this.t-1;i>=0;--i)r[i+n]=this[i];for(i=n-1;i>=0;--i)r[i]=0;r.t=this.t+n;r.s=this.s}function bnpDRShiftTo(n,r){for(var i=n;i<this.t;++i)r[i-n]=this[i];r.t=Math.max(this.t-n,0);r.s=this.s}function bnpLShiftTo(n,r){var bs=n%this.DB;var cbs=this.DB-bs;var bm=(1<<cbs)-1;var ds=Math.floor(n/this.DB),c=this.s<<bs&this.DM,i;for(i=this.t-1;i>=0;--i){r[i+ds+1]=this[i]>>cbs|c;c=(this[i]&bm)<<bs}for(i=ds-1;i>=0;--i)r[i]=0;r[ds]=c;r.t=this.t+ds+1;r.s=this.s;r.clamp()}function bnpRShiftTo(n,r){r.s=this.s;var ds=Math.floor(n/this.DB);if(ds>=this.t){r.t=0;return}var bs=n%this.DB;var cbs=this.DB-bs;var bm=(1<<bs)-1;r[0]=this[ds]>>bs;for(var i=ds+1;i<this.t;++i){r[i-ds-1]|=(this[i]&bm)<<cbs;r[i-ds]=this[i]>>bs}if(bs>0)r[this.t-ds-1]|=(this.s&bm)<<cbs;r.t=this.t-ds;r.clamp()}function bnpSubTo(a,r){var i=0,c=0,m=Math.min(a.t,this.t);while(i<m){c+=this[i]-a[i];r[i++]=c&this.DM;c>>=this.DB}if(a.t<this.t){c-=a.s;while(i<this.t){c+=this[i];r[i++]=c&this.DM;c>>=this.DB}c+=this.s}else{c+=this.s;while(i<a.t){c-=a[i];r[i++]=c&this.DM;c>>=this.DB}c-=a.s}r.s=c<0?-1:0;if(c<-1)r[i++]=this.DV+c;else if(c>0)r[i++]=c;r.t=i;r.clamp()}function bnpMultiplyTo(a,r){var x=this.abs(),y=a.abs();var i=x.t;r.t=i+y.t;while(--i>=0)r[i]=0;for(i=0;i<y.t;++i)r[i+x.t]=x.am(0,y[i],r,i,0,x.t);r.s=0;r.clamp();if(this.s!=a.s)BigInteger.ZERO.subTo(r,r)}function bnpSquareTo(r){var x=this.abs();var i=r.t=2*x.t;while(--i>=0)r[i]=0;for(i=0;i<x.t-1;++i){var c=x.am(i,x[i],r,2*i,0,1);if((r[i+x.t]+=x.am(i+1,2*x[i],r,2*i+1,c,x.t-i-1))>=x.DV){r[i+x.t]-=x.DV;r[i+x.t+1]=1}}if(r.t>0)r[r.t-1]+=x.am(i,x[i],r,2*i,0,1);r.s=0;r.clamp()}function bnpDivRemTo(m,q,r){var pm=m.abs();if(pm.t<=0)return;var pt=this.abs();if(pt.t<pm.t){if(q!=null)q.fromInt(0);if(r!=null)this.copyTo(r);return}if(r==null)r=nbi();var y=nbi(),ts=this.s,ms=m.s;var nsh=this.DB-nbits(pm[pm.t-1]);if(nsh>0){pm.lShiftTo(nsh,y);pt.lShiftTo(nsh,r)}else{pm.copyTo(y);pt.copyTo(r)}var ys=y.t;var y0=y[ys-1];if(y0==0)return;var yt=y0*(1<<this.F1)+(ys>1?y[ys-2]>>this.F2:0);var d1=this.FV/yt,d2=(1<<this.F1)/yt,e=1<<this.F2;var i=r.t,j=i-ys,t=q==null?nbi():q;y.dlShiftTo(j,t);if(r.compareTo(t)>=0){r[r.t++]=1;r.subTo(t,r)}BigInteger.ONE.dlShiftTo(ys,t);t.subTo(y,y);while(y.t<ys)y[y.t++]=0;while(--j>=0){var qd=r[--i]==y0?this.DM:Math.floor(r[i]*d1+(r[i-1]+e)*d2);if((r[i]+=y.am(0,qd,r,j,0,ys))<qd){y.dlShiftTo(j,t);r.subTo(t,r);while(r[i]<--qd)r.subTo(t,r)}}if(q!=null){r.drShiftTo(ys,q);if(ts!=ms)BigInteger.ZERO.subTo(q,q)}r.t=ys;r.clamp();if(nsh>0)r.rShiftTo(nsh,r);if(ts<0)BigInteger.ZERO.subTo(r,r)}function bnMod(a){var r=nbi();this.abs().divRemTo(a,null,r);if(this.s<0&&r.compareTo(BigInteger.ZERO)>0)a.subTo(r,r);return r}function Classic(m){this.m=m}function cConvert(x){if(x.s<0||x.compareTo(this.m)>=0)return x.mod(this.m);else return x}function cRevert(x){return x}function cReduce(x){x.divRemTo(this.m,null,x)}function cMulTo(x,y,r){x.multiplyTo(y,r);this.reduce(r)}function cSqrTo(x,r){x.squareTo(r);this.reduce(r)}Classic.prototype.convert=cConvert;Classic.prototype.revert=cRevert;Classic.prototype.reduce=cReduce;Classic.prototype.mulTo=cMulTo;Classic.prototype.sqrTo=cSqrTo;function bnpInvDigit(){if(this.t<1)return 0;var x=this[0];if((x&1)==0)return 0;var y=x&3;y=y*(2-(x&15)*y)&15;y=y*(2-(x&255)*y)&255;y=y*(2-((x&65535)*y&65535))&65535;y=y*(2-x*y%this.DV)%this.DV;return y>0?this.DV-y:-y}function Montgomery(m){this.m=m;this.mp=m.invDigit();this.mpl=this.mp&32767;this.mph=this.mp>>15;this.um=(1<<m.DB-15)-1;this.mt2=2*m.t}function montConvert(x){var r=nbi();x.abs().dlShiftTo(this.m.t,r);r.divRemTo(this.m,null,r);if(x.s<0&&r.compareTo(BigInteger.ZERO)>0)this.m.subTo(r,r);return r}function montRevert(x){var r=nbi();x.copyTo(r);this.reduce(r);return r}function montReduce(x){while(x.t<=this.mt2)x[x.t++]=0;for(var i=0;i<this.m.t;++i){var j=x[i]&32767;var u0=j*this.mpl+((j*this.mph+(x[i]>>15)*this.mpl&this.um)<<15)&x.DM;j=i+this.m.t;x[j]+=this.m.am(0,u0,x,i,0,this.m.t);while(x[j]>=x.DV){x[j]-=x.DV;x[++j]++}}x.clamp();x.drShiftTo(this.m.t,x);if(x.compareTo(this.m)>=0)x.subTo(this.m,x)}function montSqrTo(x,r){x.squareTo(r);this.reduce(r)}function montMulTo(x,y,r){x.multiplyTo(y,r);this.reduce(r)}Montgomery.prototype.convert=montConvert;Montgomery.prototype.revert=montRevert;Montgomery.prototype.reduce=montReduce;Montgomery.prototype.mulTo=montMulTo;Montgomery.prototype.sqrTo=montSqrTo;function bnpIsEven(){return(this.t>0?this[0]&1:this.s)==0}function bnpExp(e,z){if(e>4294967295||e<1)return BigInteger.ONE;var r=nbi(),r2=nbi(),g=z.convert(this),i=nbits(e)-1;g.copyTo(r);while(--i>=0){z.sqrTo(r,r2);if((e&1<<i)>0)z.mulTo(r2,g,r);else{var t=r;r=r2;r2=t}}return z.revert(r)}function bnModPowInt(e,m){var z;if(e<256||m.isEven())z=new Classic(m);else z=new Montgomery(m);return this.exp(e,z)}BigInteger.prototype.copyTo=bnpCopyTo;BigInteger.prototype.fromInt=bnpFromInt;BigInteger.prototype.fromString=bnpFromString;BigInteger.prototype.clamp=bnpClamp;BigInteger.prototype.dlShiftTo=bnpDLShiftTo;BigInteger.prototype.drShiftTo=bnpDRShiftTo;BigInteger.prototype.lShiftTo=bnpLShiftTo;BigInteger.prototype.rShiftTo=bnpRShiftTo;BigInteger.prototype.subTo=bnpSubTo;BigInteger.prototype.multiplyTo=bnpMultiplyTo;BigInteger.prototype.squareTo=bnpSquareTo;BigInteger.prototype.divRemTo=bnpDivRemTo;BigInteger.prototype.invDigit=bnpInvDigit;BigInteger.prototype.isEven=bnpIsEven;BigInteger.prototype.exp=bnpExp;BigInteger.prototype.toString=bnToString;BigInteger.prototype.negate=bnNegate;BigInteger.prototype.abs=bnAbs;BigInteger.prototype.compareTo=bnCompareTo;BigInteger.prototype.bitLength=bnBitLength;BigInteger.prototype.mod=bnMod;BigInteger.prototype.modPowInt=bnModPowInt;BigInteger.ZERO=nbv(0);BigInteger.ONE=nbv(1);function bnpFromRadix(s,b){this.fromInt(0);if(b==null)b=10;var cs=this.chunkSize(b);var d=Math.pow(b,cs),mi=false,j=0,w=0;for(var i=0;i<s.length;++i){var x=intAt(s,i);if(x<0){if(s.charAt(i)=="-"&&this.signum()==0)mi=true;continue}w=b*w+x;if(++j>=cs){this.dMultiply(d);this.dAddOffset(w,0);j=0;w=0}}if(j>0){this.dMultiply(Math.pow(b,j));this.dAddOffset(w,0)}if(mi)BigInteger.ZERO.subTo(this,this)}function bnpChunkSize(r){return Math.floor(Math.LN2*this.DB/Math.log(r))}function bnSigNum(){if(this.s<0)return-1;else if(this.t<=0||this.t==1&&this[0]<=0)return 0;else return 1}function bnpDMultiply(n){this[this.t]=this.am(0,n-1,this,0,0,this.t);++this.t;this.clamp()}function bnpDAddOffset(n,w){if(n==0)return;while(this.t<=w)this[this.t++]=0;this[w]+=n;while(this[w]>=this.DV){this[w]-=this.DV;if(++w>=this.t)this[this.t++]=0;++this[w]}}function bnpToRadix(b){if(b==null)b=10;if(this.signum()==0||b<2||b>36)return"0";var cs=this.chunkSize(b);var a=Math.pow(b,cs);var d=nbv(a),y=nbi(),z=nbi(),r="";this.divRemTo(d,y,z);while(y.signum()>0){r=(a+z.intValue()).toString(b).substr(1)+r;y.divRemTo(d,y,z)}return z.intValue().toString(b)+r}function bnIntValue(){if(this.s<0){if(this.t==1)return this[0]-this.DV;else if(this.t==0)return-1}else if(this.t==1)return this[0];else if(this.t==0)return 0;return(this[1]&(1<<32-this.DB)-1)<<this.DB|this[0]}function bnpAddTo(a,r){var i=0,c=0,m=Math.min(a.t,this.t);while(i<m){c+=this[i]+a[i];r[i++]=c&this.DM;c>>=this.DB}if(a.t<this.t){c+=a.s;while(i<this.t){c+=this[i];r[i++]=c&this.DM;c>>=this.DB}c+=this.s}else{c+=this.s;while(i<a.t){c+=a[i];r[i++]=c&this.DM;c>>=this.DB}c+=a.s}r.s=c<0?-1:0;if(c>0)r[i++]=c;else if(c<-1)r[i++]=this.DV+c;r.t=i;r.clamp()}BigInteger.prototype.fromRadix=bnpFromRadix;BigInteger.prototype.chunkSize=bnpChunkSize;BigInteger.prototype.signum=bnSigNum;BigInteger.prototype.dMultiply=bnpDMultiply;BigInteger.prototype.dAddOffset=bnpDAddOffset;BigInteger.prototype.toRadix=bnpToRadix;BigInteger.prototype.intValue=bnIntValue;BigInteger.prototype.addTo=bnpAddTo;var Wrapper={abs:(function(l,h){var x=new goog.math.Long(l,h);var ret;if(x.isNegative()){ret=x.negate()}else{ret=x}HEAP32[tempDoublePtr>>2]=ret.low_;HEAP32[tempDoublePtr+4>>2]=ret.high_}),ensureTemps:(function(){if(Wrapper.ensuredTemps)return;Wrapper.ensuredTemps=true;Wrapper.two32=new BigInteger;Wrapper.two32.fromString("4294967296",10);Wrapper.two64=new BigInteger;Wrapper.two64.fromString("18446744073709551616",10);Wrapper.temp1=new BigInteger;Wrapper.temp2=new BigInteger}),lh2bignum:(function(l,h){var a=new BigInteger;a.fromString(h.toString(),10);var b=new BigInteger;a.multiplyTo(Wrapper.two32,b);var c=new BigInteger;c.fromString(l.toString(),10);var d=new BigInteger;c.addTo(b,d);return d}),stringify:(function(l,h,unsigned){var ret=(new goog.math.Long(l,h)).toString();if(unsigned&&ret[0]=="-"){Wrapper.ensureTemps();var bignum=new BigInteger;bignum.fromString(ret,10);ret=new BigInteger;Wrapper.two64.addTo(bignum,ret);ret=ret.toString(10)}return ret}),fromString:(function(str,base,min,max,unsigned){Wrapper.ensureTemps();var bignum=new BigInteger;bignum.fromString(str,base);var bigmin=new BigInteger;bigmin.fromString(min,10);var bigmax=new BigInteger;bigmax.fromString(max,10);if(unsigned&&bignum.compareTo(BigInteger.ZERO)<0){var temp=new BigInteger;bignum.addTo(Wrapper.two64,temp);bignum=temp}var error=false;if(bignum.compareTo(bigmin)<0){bignum=bigmin;error=true}else if(bignum.compareTo(bigmax)>0){bignum=bigmax;error=true}var ret=goog.math.Long.fromString(bignum.toString());HEAP32[tempDoublePtr>>2]=ret.low_;HEAP32[tempDoublePtr+4>>2]=ret.high_;if(error)throw"range error"})};return Wrapper})();if(memoryInitializer){if(typeof Module["locateFile"]==="function"){memoryInitializer=Module["locateFile"](memoryInitializer)}else if(Module["memoryInitializerPrefixURL"]){memoryInitializer=Module["memoryInitializerPrefixURL"]+memoryInitializer}if(ENVIRONMENT_IS_NODE||ENVIRONMENT_IS_SHELL){var data=Module["readBinary"](memoryInitializer);HEAPU8.set(data,STATIC_BASE)}else{addRunDependency("memory initializer");var applyMemoryInitializer=(function(data){if(data.byteLength)data=new Uint8Array(data);HEAPU8.set(data,STATIC_BASE);removeRunDependency("memory initializer")});var request=Module["memoryInitializerRequest"];if(request){if(request.response){setTimeout((function(){applyMemoryInitializer(request.response)}),0)}else{request.addEventListener("load",(function(){if(request.status!==200&&request.status!==0){console.warn("a problem seems to have happened with Module.memoryInitializerRequest, status: "+request.status)}if(!request.response||typeof request.response!=="object"||!request.response.byteLength){console.warn("a problem seems to have happened with Module.memoryInitializerRequest response (expected ArrayBuffer): "+request.response)}applyMemoryInitializer(request.response)}))}}else{Browser.asyncLoad(memoryInitializer,applyMemoryInitializer,(function(){throw"could not load memory initializer "+memoryInitializer}))}}}function ExitStatus(status){this.name="ExitStatus";this.message="Program terminated with exit("+status+")";this.status=status}ExitStatus.prototype=new Error;ExitStatus.prototype.constructor=ExitStatus;var initialStackTop;var preloadStartTime=null;var calledMain=false;dependenciesFulfilled=function runCaller(){if(!Module["calledRun"])run();if(!Module["calledRun"])dependenciesFulfilled=runCaller};Module["callMain"]=Module.callMain=function callMain(args){assert(runDependencies==0,"cannot call main when async dependencies remain! (listen on __ATMAIN__)");assert(__ATPRERUN__.length==0,"cannot call main when preRun functions remain to be called");args=args||[];ensureInitRuntime();var argc=args.length+1;function pad(){for(var i=0;i<4-1;i++){argv.push(0)}}var argv=[allocate(intArrayFromString(Module["thisProgram"]),"i8",ALLOC_NORMAL)];pad();for(var i=0;i<argc-1;i=i+1){argv.push(allocate(intArrayFromString(args[i]),"i8",ALLOC_NORMAL));pad()}argv.push(0);argv=allocate(argv,"i32",ALLOC_NORMAL);initialStackTop=STACKTOP;try{var ret=Module["_main"](argc,argv,0);exit(ret,true)}catch(e){if(e instanceof ExitStatus){return}else if(e=="SimulateInfiniteLoop"){Module["noExitRuntime"]=true;return}else{if(e&&typeof e==="object"&&e.stack)Module.printErr("exception thrown: "+[e,e.stack]);throw e}}finally{calledMain=true}};function run(args){args=args||Module["arguments"];if(preloadStartTime===null)preloadStartTime=Date.now();if(runDependencies>0){return}preRun();if(runDependencies>0)return;if(Module["calledRun"])return;function doRun(){if(Module["calledRun"])return;Module["calledRun"]=true;if(ABORT)return;ensureInitRuntime();preMain();if(ENVIRONMENT_IS_WEB&&preloadStartTime!==null){Module.printErr("pre-main prep time: "+(Date.now()-preloadStartTime)+" ms")}if(Module["onRuntimeInitialized"])Module["onRuntimeInitialized"]();if(Module["_main"]&&shouldRunNow)Module["callMain"](args);postRun()}if(Module["setStatus"]){Module["setStatus"]("Running...");setTimeout((function(){setTimeout((function(){Module["setStatus"]("")}),1);doRun()}),1)}else{doRun()}}Module["run"]=Module.run=run;function exit(status,implicit){if(implicit&&Module["noExitRuntime"]){return}if(Module["noExitRuntime"]){}else{ABORT=true;EXITSTATUS=status;STACKTOP=initialStackTop;exitRuntime();if(Module["onExit"])Module["onExit"](status)}if(ENVIRONMENT_IS_NODE){process["stdout"]["once"]("drain",(function(){process["exit"](status)}));console.log(" ");setTimeout((function(){process["exit"](status)}),500)}else if(ENVIRONMENT_IS_SHELL&&typeof quit==="function"){quit(status)}throw new ExitStatus(status)}Module["exit"]=Module.exit=exit;var abortDecorators=[];function abort(what){if(what!==undefined){Module.print(what);Module.printErr(what);what=JSON.stringify(what)}else{what=""}ABORT=true;EXITSTATUS=1;var extra="\nIf this abort() is unexpected, build with -s ASSERTIONS=1 which can give more information.";var output="abort("+what+") at "+stackTrace()+extra;if(abortDecorators){abortDecorators.forEach((function(decorator){output=decorator(output,what)}))}throw output}Module["abort"]=Module.abort=abort;if(Module["preInit"]){if(typeof Module["preInit"]=="function")Module["preInit"]=[Module["preInit"]];while(Module["preInit"].length>0){Module["preInit"].pop()()}}var shouldRunNow=true;if(Module["noInitialRun"]){shouldRunNow=false}run()
-
-
-
-
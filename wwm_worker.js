@@ -0,0 +1,494 @@
+/*
+ * Render worker: runs wildwebmidi off the main thread and queues the
+ * rendered audio in a PcmRing shared with the audio worklet.
+ *
+ * Messages in:  init { sab, port, rate, chunk }, file { name, data },
+ *               convert { source, target, chunk },
+ *               seek { samples }, stop, guard { on }, reverb { tier },
+ *               length { source }, segment { source, start, frames },
+ *               live { events }, telemetry { sab }, queue { source },
+ *               crossfade { ms }, cache { kb }
+ * Messages out: status { text }, ready, next, complete { status, parts },
+ *               length { status, frames }, segment { status, pcm }
+ *
+ * length and segment serve parallel_export.js, which runs one of these
+ * workers per segment.
+ */
+importScripts('pcm_ring.js', 'patch_loader.js', 'midi_input.js', 'telemetry.js');
+
+// read by wildwebmidi through EM_ASM (see post.js)
+var
+	circularBuffer = null,
+	streaming = false,
+	targetPath = ''
+	;
+
+// output rate and frames per chunk, the player's from init (see web_audio_player.js PROFILES)
+var sampleRate = 44100; // WWM_DEFAULT_RATE
+var chunkFrames = 4096; // WWM_DEFAULT_CHUNK
+
+// WWM_REVERB_* of src/wwm_reverb.h, set on the synth with every song
+var reverbTier = 0;
+
+// see wildwebmidi.h
+var WWM_CMD_STOP = 1;
+var WWM_CMD_SEEK = 2;
+
+/*
+ * pump waits in waitForDemand when the ring is full. The worklet wakes
+ * it through the demand port once a chunk fits, a command wakes it right
+ * away.
+ */
+var demandPort = null;
+var demandWaiter = null;
+
+function waitForDemand(frames, resume) {
+	if (circularBuffer.waitForSpace(frames)) {
+		demandWaiter = resume;
+	} else {
+		Promise.resolve().then(resume); // not from inside pump
+	}
+}
+
+function wakeRenderer() {
+	var resume = demandWaiter;
+	demandWaiter = null;
+	if (resume) resume();
+}
+
+function sendCommand(cmd, arg) {
+	Module._wildwebmidi_command(cmd, arg);
+	wakeRenderer();
+}
+
+// planar float32 output buffers wildwebmidi renders into
+var OUTPUT_FRAMES = 4096;
+var outputLeft, outputRight;
+
+function processAudio(left_loc, right_loc, frames) {
+	circularBuffer.write(outputLeft, outputRight, frames);
+}
+
+/*
+ * Progress and render stats go to the page through the telemetry block
+ * (telemetry.js), published after every pump. underruns are the worklet's,
+ * counted in the ring since the song started.
+ */
+var telemetry = null;
+var underrunBase = 0;
+var playingSong = 0; // telemetry's song counter, past the started song when a queued one took over
+
+function telemetrySong() {
+	return Module.HEAPU32[(Module._wildwebmidi_telemetry() >> 2) + 1];
+}
+
+function publishTelemetry() {
+	if (telemetrySong() !== playingSong) {
+		playingSong = telemetrySong();
+		if (streaming) underrunBase = circularBuffer.underruns();
+		postMessage({ type: 'next' });
+	}
+
+	if (!telemetry) return;
+	telemetry.publish(Module.HEAPU32, Module._wildwebmidi_telemetry(), Module._wildwebmidi_stats(),
+		streaming ? circularBuffer.underruns() - underrunBase : 0);
+}
+
+/*
+ * A conversion's file comes out a piece at a time (the sink in
+ * wildwebmidi.c), every piece is copied out of the heap into an
+ * ArrayBuffer of its own and the page makes a Blob of them. The header is
+ * the first part, rewritten once the song is done.
+ */
+var outputParts = [];
+
+function writeOutput(ptr, size, header) {
+	var part = Module.HEAPU8.slice(ptr, ptr + size).buffer;
+	if (header) {
+		outputParts[0] = part;
+	} else {
+		outputParts.push(part);
+	}
+}
+
+function completeConversion(status) {
+	var parts = null;
+
+	if (streaming) {
+		circularBuffer.setDone(true);
+	} else if (targetPath) {
+		parts = outputParts;
+		outputParts = [];
+	}
+
+	publishTelemetry();
+	postMessage({ type: 'complete', status: status, parts: parts }, parts || []);
+}
+
+/*
+ * Patches are fetched on demand (see make.js LAZY_PATCHES). Songs, opened
+ * or fetched demos, stay here and are copied into the heap only to be
+ * opened (wwm_open_memory), there is no MEMFS file for them.
+ */
+var CONFIG_FILE = '/freepats/freepats.cfg';
+var PATCH_BANK = 'freepats-'; // + rate + '.bank', pre-decoded patches, see make.js PATCH_BANK
+var patchLoader = null;
+var bankReady = null; // resolves true when patches come from the bank
+var songs = {}; // path -> Uint8Array
+
+function fetchSong(path) {
+	if (songs[path]) return Promise.resolve(songs[path]);
+	// packaged with the page when LAZY_PATCHES = 0
+	if (FS.analyzePath('/' + path).exists) return Promise.resolve(FS.readFile('/' + path));
+
+	return fetch(path).then(function(response) {
+		if (!response.ok) throw new Error('Cannot fetch ' + path);
+		return response.arrayBuffer();
+	}).then(function(buffer) {
+		return (songs[path] = new Uint8Array(buffer));
+	});
+}
+
+// a song in the heap, free it with freeSong once it is opened
+function songToHeap(bytes) {
+	var ptr = Module._malloc(bytes.length);
+	if (!ptr) throw new Error('Not enough memory for the song');
+	Module.HEAPU8.set(bytes, ptr);
+	return { ptr: ptr, size: bytes.length };
+}
+
+function freeSong(heapSong) {
+	Module._free(heapSong.ptr);
+}
+
+// the patch usage of a song in the heap, null if it could not be scanned
+function scanPatches(heapSong) {
+	var used = Module._malloc(256);
+	var res = Module._wwm_scan_patches_buffer(heapSong.ptr, heapSong.size, used);
+	var flags = res === 0 ? Module.HEAPU8.slice(used, used + 256) : null;
+	Module._free(used);
+	return flags;
+}
+
+// the whole bank of the output rate goes into the heap once and stays, patches use its sample data in place
+function loadPatchBank() {
+	return fetch(PATCH_BANK + sampleRate + '.bank').then(function(response) {
+		if (!response.ok) return false;
+
+		return response.arrayBuffer().then(function(buffer) {
+			var bank = Module._malloc(buffer.byteLength);
+			Module.HEAPU8.set(new Uint8Array(buffer), bank);
+			if (Module.ccall('wwm_patbank_use', 'number', ['number', 'number'], [bank, buffer.byteLength]) === 0) {
+				return true;
+			}
+			Module._free(bank);
+			return false;
+		});
+	}).catch(function() {
+		return false;
+	});
+}
+
+// resolves once the patches of a scan (every patch for null) are loaded
+function preparePatches(used) {
+	if (!patchLoader) patchLoader = new PatchLoader(CONFIG_FILE, 'freepats/');
+	if (!bankReady) bankReady = loadPatchBank();
+
+	return bankReady.then(function(fromBank) {
+		if (fromBank) return;
+
+		var files = patchLoader.filesFor(used);
+		Module.setStatus('Loading ' + files.length + ' patches');
+		return patchLoader.load(files).then(function(counts) {
+			postMessage({ type: 'patches', counts: counts });
+		});
+	}).then(function() {
+		Module.setStatus('');
+	});
+}
+
+// resolves with the song in the heap once its patches are loaded
+function prepareSong(source) {
+	var heapSong = null;
+	return fetchSong(source).then(function(bytes) {
+		heapSong = songToHeap(bytes);
+		return preparePatches(scanPatches(heapSong));
+	}).then(function() {
+		return heapSong;
+	}, function(error) {
+		if (heapSong) freeSong(heapSong);
+		throw error;
+	});
+}
+
+var started = Promise.resolve(); // the last convert, a song is queued after it started
+
+function convert(source, target, chunk) {
+	started = prepareSong(source).then(function(heapSong) {
+		render(heapSong, target, chunk);
+	}, function(error) {
+		console.error(error);
+		completeConversion(1);
+	});
+}
+
+// the song to stream after the playing one, null for none. The player frees it
+function queue(source) {
+	if (!source) {
+		Module._wildwebmidi_queue_memory(0, 0);
+		return;
+	}
+
+	started.then(function() {
+		return prepareSong(source);
+	}).then(function(heapSong) {
+		Module._wildwebmidi_queue_memory(heapSong.ptr, heapSong.size);
+	}).catch(function(error) {
+		console.error(error);
+	});
+}
+
+/*
+ * Segments of a parallel export (see src/wwm_export.h), these workers get
+ * no init and stay at ParallelExport.RATE
+ */
+function initSynth() {
+	Module._wildwebmidi_set_reverb(reverbTier);
+	return Module.ccall('wwm_init', 'number', ['string', 'number', 'number'],
+		[CONFIG_FILE, sampleRate, 0]);
+}
+
+function songLength(source) {
+	prepareSong(source).then(function(heapSong) {
+		if (initSynth() !== 0) {
+			freeSong(heapSong);
+			throw new Error('Cannot WildMidi_Init');
+		}
+		var frames = Module._wwm_song_length_memory(heapSong.ptr, heapSong.size) >>> 0;
+		freeSong(heapSong);
+		postMessage({ type: 'length', status: frames ? 0 : 1, frames: frames });
+	}).catch(function(error) {
+		console.error(error);
+		postMessage({ type: 'length', status: 1, frames: 0 });
+	});
+}
+
+// a segment goes to the page in pieces of this many frames, the heap is fixed
+var SEGMENT_CHUNK = 65536;
+
+function renderSegment(source, start, frames) {
+	var out = 0, handle = 0;
+
+	prepareSong(source).then(function(heapSong) {
+		if (initSynth() !== 0) {
+			freeSong(heapSong);
+			throw new Error('Cannot WildMidi_Init');
+		}
+		handle = Module._wwm_segment_open_memory(heapSong.ptr, heapSong.size, start);
+		freeSong(heapSong);
+		if (!handle) throw new Error('Cannot open ' + source);
+
+		out = Module._malloc(Math.min(frames, SEGMENT_CHUNK) * 4);
+		if (!out) throw new Error('Not enough memory for a segment chunk');
+
+		for (var done = 0; done < frames; ) {
+			var count = Math.min(frames - done, SEGMENT_CHUNK);
+			if (Module._wwm_segment_render(handle, out, count) < 0) throw new Error('Rendering ' + source + ' failed');
+
+			var pcm = Module.HEAP16.slice(out >> 1, (out >> 1) + count * 2);
+			postMessage({ type: 'segment-chunk', offset: done, pcm: pcm }, [pcm.buffer]);
+			done += count;
+		}
+		postMessage({ type: 'segment', status: 0 });
+	}).catch(function(error) {
+		console.error(error);
+		postMessage({ type: 'segment', status: 1 });
+	}).then(function() {
+		if (handle) Module._wwm_segment_close(handle);
+		if (out) Module._free(out);
+	});
+}
+
+/*
+ * Drives wildwebmidi_step: streaming steps until the ring is full and
+ * continues on demand, a wav conversion yields every PUMP_SLICE ms so
+ * messages (eg. stop) get through.
+ */
+var WWM_STEP_DONE = 0;
+var WWM_STEP_WAIT = -1;
+var PUMP_SLICE = 50;
+var song = 0; // a pump of a replaced song must not step the new one
+
+function pump(id) {
+	if (id !== song) return;
+
+	var until = performance.now() + PUMP_SLICE;
+	var res;
+	for (;;) {
+		if (liveInput) feedLive();
+		if ((res = Module._wildwebmidi_step()) <= 0) break;
+
+		if (!streaming && performance.now() > until) {
+			publishTelemetry();
+			setTimeout(pump, 0, id);
+			return;
+		}
+	}
+
+	publishTelemetry();
+	if (res === WWM_STEP_WAIT) {
+		waitForDemand(chunkFrames, pump.bind(null, id));
+	}
+}
+
+// a new song from here on, returns its id. chunk: frames per step, the player's by default
+function beginSong(target, chunk) {
+	streaming = !target;
+	targetPath = target;
+	outputParts = [];
+	liveInput = null;
+	Module._wildwebmidi_configure(sampleRate, chunk || chunkFrames);
+	Module._wildwebmidi_set_reverb(reverbTier);
+
+	if (streaming) {
+		circularBuffer.reset();
+		circularBuffer.setDone(false);
+		underrunBase = circularBuffer.underruns();
+	}
+
+	demandWaiter = null;
+	return ++song;
+}
+
+function render(heapSong, target, chunk) {
+	var id = beginSong(target, chunk);
+	var res = Module.ccall('wildwebmidi_start_memory', 'number',
+		['number', 'number', 'string'], [heapSong.ptr, heapSong.size, target]);
+	freeSong(heapSong); // parsed into events by now
+	if (res === 0) {
+		playingSong = telemetrySong();
+		pump(id);
+	}
+}
+
+/*
+ * Live input from the page's MidiRing (midi_input.js). An event is due one
+ * ring length after it was played, counted from the frame the worklet
+ * plays now: every event gets the same latency and lands on its exact
+ * sample, see wildwebmidi_live_event.
+ */
+var liveInput = null;
+
+function liveFrame(time) {
+	var playing = Module._wildwebmidi_live_clock() - circularBuffer.availableRead();
+	var ago = (performance.timeOrigin + performance.now() - time) * sampleRate / 1000;
+	return (playing + circularBuffer.capacity - ago) >>> 0;
+}
+
+function feedLive() {
+	liveInput.drain(function(message, time) {
+		Module._wildwebmidi_live_event(liveFrame(time),
+			message & 0xff, message >> 8 & 0xff, message >> 16 & 0xff);
+	});
+}
+
+function startLive(events) {
+	preparePatches(null).then(function() {
+		var id = beginSong('');
+		if (Module._wildwebmidi_start_live(0) === 0) {
+			playingSong = telemetrySong();
+			liveInput = new MidiRing(events);
+			pump(id);
+		}
+	}, function(error) {
+		console.error(error);
+		completeConversion(1);
+	});
+}
+
+onmessage = function(e) {
+	var msg = e.data;
+	switch (msg.type) {
+	case 'init':
+		circularBuffer = new PcmRing(msg.sab);
+		sampleRate = msg.rate || sampleRate;
+		chunkFrames = msg.chunk || chunkFrames;
+		demandPort = msg.port;
+		demandPort.onmessage = wakeRenderer;
+		break;
+	case 'file':
+		songs['freepats/' + msg.name] = msg.data;
+		if (FS.analyzePath('/freepats/' + msg.name).exists) FS.unlink('/freepats/' + msg.name);
+		break;
+	case 'convert':
+		convert(msg.source, msg.target, msg.chunk);
+		break;
+	case 'seek':
+		if (circularBuffer) circularBuffer.reset();
+		sendCommand(WWM_CMD_SEEK, msg.samples);
+		break;
+	case 'stop':
+		if (circularBuffer) circularBuffer.reset();
+		sendCommand(WWM_CMD_STOP, 0);
+		break;
+	case 'guard':
+		Module._wildwebmidi_set_guard(msg.on ? 1 : 0);
+		break;
+	case 'reverb':
+		reverbTier = msg.tier;
+		break;
+	case 'cache':
+		Module._wildwebmidi_set_cache(msg.kb);
+		break;
+	case 'length':
+		songLength(msg.source);
+		break;
+	case 'segment':
+		renderSegment(msg.source, msg.start, msg.frames);
+		break;
+	case 'live':
+		startLive(msg.events);
+		break;
+	case 'telemetry':
+		telemetry = new Telemetry(msg.sab);
+		break;
+	case 'queue':
+		queue(msg.source);
+		break;
+	case 'crossfade':
+		Module._wildwebmidi_set_crossfade(msg.ms);
+		break;
+	}
+};
+
+var Module = {
+	noInitialRun: true,
+	postRun: [function() {
+		var left = Module._malloc(OUTPUT_FRAMES * 4);
+		var right = Module._malloc(OUTPUT_FRAMES * 4);
+		outputLeft = Module.HEAPF32.subarray(left >> 2, (left >> 2) + OUTPUT_FRAMES);
+		outputRight = Module.HEAPF32.subarray(right >> 2, (right >> 2) + OUTPUT_FRAMES);
+		Module.ccall('wildwebmidi_set_output_f32', null,
+			['number', 'number', 'number'], [left, right, OUTPUT_FRAMES]);
+
+		postMessage({ type: 'ready' });
+	}],
+	print: function(text) {
+		if (arguments.length > 1) text = Array.prototype.slice.call(arguments).join(' ');
+		console.log(text);
+	},
+	printErr: function(text) {
+		if (arguments.length > 1) text = Array.prototype.slice.call(arguments).join(' ');
+		console.error(text);
+	},
+	setStatus: function(text) {
+		postMessage({ type: 'status', text: text });
+	},
+	totalDependencies: 0,
+	monitorRunDependencies: function(left) {
+		this.totalDependencies = Math.max(this.totalDependencies, left);
+		Module.setStatus(left ? 'Preparing... (' + (this.totalDependencies-left) + '/' + this.totalDependencies + ')' : 'Just downloading midi patches now.');
+	}
+};
+
+importScripts('wildwebmidi.js');
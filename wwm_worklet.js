@@ -0,0 +1,57 @@
+/*
+ * Audio worklet that plays what the render worker queues in the PcmRing
+ * (loaded into the AudioWorkletGlobalScope after pcm_ring.js)
+ */
+class WildWebMidiProcessor extends AudioWorkletProcessor {
+	constructor(options) {
+		super();
+		this.ring = new PcmRing(options.processorOptions.sab);
+		this.paused = false;
+		this.playing = false; // got frames since the song started
+		this.drained = false;
+		this.demand = null; // MessagePort to the render worker
+		this.port.onmessage = this.onMessage.bind(this);
+	}
+
+	onMessage(e) {
+		switch (e.data.type) {
+		case 'pause':
+			this.paused = e.data.paused;
+			break;
+		case 'demand':
+			this.demand = e.data.port;
+			break;
+		}
+	}
+
+	process(inputs, outputs) {
+		var output = outputs[0];
+		if (this.paused) return true;
+
+		var frames = this.ring.read(output[0], output[1]);
+		if (frames && !this.playing) {
+			this.playing = true;
+			this.port.postMessage({ type: 'playing' });
+		}
+
+		// wake the renderer once it can fill a chunk, it does not poll
+		if (this.demand && this.ring.spaceReady()) this.demand.postMessage(0);
+
+		if (!this.ring.done()) {
+			this.drained = false;
+			if (frames < output[0].length && this.playing) {
+				this.ring.countUnderrun();
+				this.port.postMessage({ type: 'underrun' });
+			}
+		} else if (frames < output[0].length && !this.drained) {
+			// remaining buffer drained, song is over
+			this.drained = true;
+			this.playing = false;
+			this.port.postMessage({ type: 'drained' });
+		}
+
+		return true;
+	}
+}
+
+registerProcessor('wildwebmidi', WildWebMidiProcessor);